@@ -22,7 +22,7 @@ public:
 	virtual void Destroy(lua_State *L);
 };
 
-BaseUserData* BaseUserData_get_userdata(lua_State *L, int index, char* userdata_type);
+BaseUserData* BaseUserData_get_userdata(lua_State *L, int index, const char* userdata_type);
 
 
 
@@ -0,0 +1,36 @@
+#ifndef body_pool_userdata_h
+#define body_pool_userdata_h
+
+#include <dmsdk/sdk.h>
+#include "undefine_none.h"
+#include "objects/base_userdata.h"
+#include "objects/collision_body_userdata.h"
+#include "reactphysics3d/reactphysics3d.h"
+
+namespace rp3dDefold {
+
+//preallocated clones of template body.
+//free bodies are disabled and wait for acquire.
+class BodyPoolUserdata : public BaseUserData {
+private:
+
+public:
+    reactphysics3d::PhysicsWorld *world=NULL;
+    dmArray<CollisionBodyUserdata*> bodies;
+    dmArray<CollisionBodyUserdata*> freeBodies;
+
+    BodyPoolUserdata(reactphysics3d::PhysicsWorld *world);
+	~BodyPoolUserdata();
+
+	virtual void Destroy(lua_State *L);
+};
+
+void BodyPoolUserdataInitMetaTable(lua_State *L);
+BodyPoolUserdata* BodyPoolUserdataCheck(lua_State *L, int index);
+BodyPoolUserdata* BodyPoolUserdataCreate(lua_State *L, reactphysics3d::PhysicsWorld *world,
+                                         reactphysics3d::CollisionBody *templateBody, int size);
+//destroy pool and all bodies of the pool
+void BodyPoolUserdataDestroyWithBodies(lua_State *L, BodyPoolUserdata *pool);
+
+}
+#endif
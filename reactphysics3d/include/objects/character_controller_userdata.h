@@ -0,0 +1,33 @@
+#ifndef character_controller_userdata_h
+#define character_controller_userdata_h
+
+#include <dmsdk/sdk.h>
+#include "undefine_none.h"
+#include "objects/base_userdata.h"
+#include "reactphysics3d/reactphysics3d.h"
+
+namespace rp3dDefold {
+
+//kinematic character controller.
+//controller body destroyed with controller.
+class CharacterControllerUserdata : public BaseUserData {
+private:
+
+public:
+    reactphysics3d::PhysicsWorld *world=NULL;
+    reactphysics3d::CharacterController *controller=NULL;
+
+    CharacterControllerUserdata(reactphysics3d::PhysicsWorld *world, reactphysics3d::CharacterController *controller);
+	~CharacterControllerUserdata();
+
+	virtual void Destroy(lua_State *L);
+};
+
+void CharacterControllerUserdataInitMetaTable(lua_State *L);
+CharacterControllerUserdata* CharacterControllerUserdataCheck(lua_State *L, int index);
+reactphysics3d::CharacterControllerSettings CharacterControllerSettings_from_table(lua_State *L, int index);
+//destroy controller and body of controller
+void CharacterControllerUserdataDestroyWithBody(lua_State *L, CharacterControllerUserdata *controller);
+
+}
+#endif
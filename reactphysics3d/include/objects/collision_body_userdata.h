@@ -9,6 +9,8 @@
 
 namespace rp3dDefold {
 
+class BodyPoolUserdata;
+
 //use same class to collision and rigid body.
 //use diff meta tables
 class CollisionBodyUserdata : public BaseUserData {
@@ -18,6 +20,10 @@ public:
     reactphysics3d::CollisionBody *body;
     int user_data_ref;
     bool isRigidBody;
+    //pool that owns the body. NULL for bodies created by world
+    BodyPoolUserdata* pool=NULL;
+    //body is released into pool and disabled
+    bool isInPool=false;
 
     CollisionBodyUserdata(reactphysics3d::CollisionBody* body);
     CollisionBodyUserdata(reactphysics3d::RigidBody* body);
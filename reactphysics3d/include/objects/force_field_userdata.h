@@ -0,0 +1,33 @@
+#ifndef force_field_userdata_h
+#define force_field_userdata_h
+
+#include <dmsdk/sdk.h>
+#include "undefine_none.h"
+#include "objects/base_userdata.h"
+#include "reactphysics3d/reactphysics3d.h"
+
+namespace rp3dDefold {
+
+//force field volume.
+//volume collider is not destroyed with field.
+class ForceFieldUserdata : public BaseUserData {
+private:
+
+public:
+    reactphysics3d::PhysicsWorld *world=NULL;
+    reactphysics3d::ForceField *field=NULL;
+
+    ForceFieldUserdata(reactphysics3d::PhysicsWorld *world, reactphysics3d::ForceField *field);
+	~ForceFieldUserdata();
+
+	virtual void Destroy(lua_State *L);
+};
+
+void ForceFieldUserdataInitMetaTable(lua_State *L);
+ForceFieldUserdata* ForceFieldUserdataCheck(lua_State *L, int index);
+reactphysics3d::ForceFieldSettings ForceFieldSettings_from_table(lua_State *L, int index);
+reactphysics3d::ForceFieldType ForceFieldTypeStringToEnum(lua_State *L,const char* str);
+const char * ForceFieldTypeEnumToString(reactphysics3d::ForceFieldType type);
+
+}
+#endif
@@ -10,5 +10,6 @@ namespace rp3dDefold {
     void JointInfoPush(lua_State *L, reactphysics3d::JointInfo *);
     reactphysics3d::JointInfo* JointInfoCheck(lua_State *L, int index);
     const char * JointTypeEnumToString(reactphysics3d::JointType type);
+    reactphysics3d::decimal JointBreakThresholdCheck(lua_State *L, int index, const char* name);
 }
 #endif
\ No newline at end of file
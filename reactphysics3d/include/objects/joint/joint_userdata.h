@@ -20,6 +20,11 @@
 {"getReactionForce", Joint_GetReactionForce},\
 {"getReactionTorque", Joint_GetReactionTorque},\
 {"isCollisionEnabled", Joint_IsCollisionEnabled},\
+{"getBreakForce", Joint_GetBreakForce},\
+{"setBreakForce", Joint_SetBreakForce},\
+{"getBreakTorque", Joint_GetBreakTorque},\
+{"setBreakTorque", Joint_SetBreakTorque},\
+{"isBroken", Joint_IsBroken},\
 {"getEntityId", Joint_GetEntityId}\
 
 
@@ -43,6 +48,11 @@ class JointUserdata : public BaseUserData {
     int Joint_GetReactionForce(lua_State *L);
     int Joint_GetReactionTorque(lua_State *L);
     int Joint_IsCollisionEnabled(lua_State *L);
+    int Joint_GetBreakForce(lua_State *L);
+    int Joint_SetBreakForce(lua_State *L);
+    int Joint_GetBreakTorque(lua_State *L);
+    int Joint_SetBreakTorque(lua_State *L);
+    int Joint_IsBroken(lua_State *L);
     int Joint_GetEntityId(lua_State *L);
     int Joint_ToString(lua_State *L);
 
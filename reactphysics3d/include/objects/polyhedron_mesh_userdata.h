@@ -28,6 +28,9 @@ void PolyhedronMeshUserdataInitMetaTable(lua_State *L);
 PolyhedronMeshUserdata* PolyhedronMeshUserdataCheck(lua_State *L, int index);
 PolyhedronMeshUserdata* PolyhedronMeshUserdataFromLua(reactphysics3d::PhysicsCommon *physicsCommon,lua_State *L);
 PolyhedronMeshUserdata* PolyhedronMeshUserdataFromBufferClone(reactphysics3d::PhysicsCommon *physicsCommon,lua_State *L);
+PolyhedronMeshUserdata* PolyhedronMeshUserdataConvexHullFromLua(reactphysics3d::PhysicsCommon *physicsCommon,lua_State *L);
+PolyhedronMeshUserdata* PolyhedronMeshUserdataConvexHullFromBufferClone(reactphysics3d::PhysicsCommon *physicsCommon,lua_State *L);
+void PolyhedronMeshUserdataPushConvexDecompositionFromBufferClone(reactphysics3d::PhysicsCommon *physicsCommon,lua_State *L);
 
 }
 #endif
\ No newline at end of file
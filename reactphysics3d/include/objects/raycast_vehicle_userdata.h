@@ -0,0 +1,32 @@
+#ifndef raycast_vehicle_userdata_h
+#define raycast_vehicle_userdata_h
+
+#include <dmsdk/sdk.h>
+#include "undefine_none.h"
+#include "objects/base_userdata.h"
+#include "reactphysics3d/reactphysics3d.h"
+
+namespace rp3dDefold {
+
+//raycast vehicle.
+//chassis body is not destroyed with vehicle.
+class RaycastVehicleUserdata : public BaseUserData {
+private:
+
+public:
+    reactphysics3d::PhysicsWorld *world=NULL;
+    reactphysics3d::RaycastVehicle *vehicle=NULL;
+
+    RaycastVehicleUserdata(reactphysics3d::PhysicsWorld *world, reactphysics3d::RaycastVehicle *vehicle);
+	~RaycastVehicleUserdata();
+
+	virtual void Destroy(lua_State *L);
+};
+
+void RaycastVehicleUserdataInitMetaTable(lua_State *L);
+RaycastVehicleUserdata* RaycastVehicleUserdataCheck(lua_State *L, int index);
+reactphysics3d::RaycastVehicleSettings RaycastVehicleSettings_from_table(lua_State *L, int index);
+reactphysics3d::WheelSettings WheelSettings_from_table(lua_State *L, int index);
+
+}
+#endif
@@ -24,17 +24,31 @@
 {"getLocalInertiaTensor", CollisionShape_GetLocalInertiaTensor},\
 {"getVolume", CollisionShape_GetVolume},\
 {"computeAABB", CollisionShape_ComputeAABB},\
+{"isShared", CollisionShape_IsShared},\
 {"__tostring", CollisionShape_ToString}\
 
 
 namespace rp3dDefold {
 
+//parameters of a shared shape. Same parameters -> same shape
+struct CollisionShapeSharedKey {
+    uint32_t name;
+    float params[3];
+    void* mesh;
+};
+
 //use same for all Shaped
 //use diff meta tables
 class CollisionShapeUserdata : public BaseUserData {
     public:
         reactphysics3d::CollisionShape* shape = NULL;
         void* heightData = NULL;
+        reactphysics3d::PhysicsCommon* physicsCommon = NULL;
+        //create/getShared calls that was not destroyed.
+        //Shape is freed when it have no references and no colliders
+        int refCount = 1;
+        bool isShared = false;
+        CollisionShapeSharedKey sharedKey;
         CollisionShapeUserdata(reactphysics3d::CollisionShape* shape);
         ~CollisionShapeUserdata();
 
@@ -51,6 +65,7 @@ class CollisionShapeUserdata : public BaseUserData {
     int CollisionShape_GetLocalInertiaTensor(lua_State *L);
     int CollisionShape_GetVolume(lua_State *L);
     int CollisionShape_ComputeAABB(lua_State *L);
+    int CollisionShape_IsShared(lua_State *L);
 
     int CollisionShape_ToString(lua_State *L);
 
@@ -58,5 +73,18 @@ class CollisionShapeUserdata : public BaseUserData {
     void CollisionShapeUserdataInitMetaTable(lua_State *L);
     CollisionShapeUserdata* CollisionShapePush(lua_State *L, reactphysics3d::CollisionShape* shape);
     CollisionShapeUserdata* CollisionShapeCheck(lua_State *L, int index);
+    void CollisionShapeCheckNotShared(lua_State *L, int index);
+
+    void CollisionShapeSharedKeyInit(CollisionShapeSharedKey &key, reactphysics3d::CollisionShapeName name,
+                                     float p1, float p2, float p3, void* mesh);
+    //return shared shape with same key or NULL. Add reference to returned shape
+    CollisionShapeUserdata* CollisionShapeUserdataGetShared(const CollisionShapeSharedKey &key);
+    void CollisionShapeUserdataAddShared(CollisionShapeUserdata* userdata, const CollisionShapeSharedKey &key);
+    //remove shared shapes of mesh from cache. Call it before mesh is destroyed
+    void CollisionShapeUserdataRemoveSharedMesh(void* mesh);
+    //remove reference. Free shape if it not used by colliders
+    void CollisionShapeUserdataRelease(lua_State *L, CollisionShapeUserdata* userdata);
+    //free released shapes that are not used by colliders anymore. Call it after colliders was removed
+    void CollisionShapeUserdataFreeUnused(lua_State *L);
 }
 #endif
\ No newline at end of file
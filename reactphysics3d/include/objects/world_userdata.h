@@ -11,15 +11,21 @@
 namespace rp3dDefold {
 
 //should have table on top of stack
-static void PushCollisionCallbackData(lua_State *L,const reactphysics3d::CollisionCallback::CallbackData &callbackData);
+void PushCollisionCallbackData(lua_State *L,const reactphysics3d::CollisionCallback::CallbackData &callbackData);
 //should have table on top of stack
-static void PushOverlapCallbackData(lua_State *L,const reactphysics3d::OverlapCallback::CallbackData &callbackData);
+void PushOverlapCallbackData(lua_State *L,const reactphysics3d::OverlapCallback::CallbackData &callbackData);
+//should have table on top of stack
+void PushBrokenJoints(lua_State *L,const reactphysics3d::Array<reactphysics3d::Joint*> &joints);
+//should have table on top of stack
+void PushBodies(lua_State *L,const reactphysics3d::Array<reactphysics3d::RigidBody*> &bodies);
 
 
 class LuaEventListener : public reactphysics3d::EventListener {
 public:
     int fun_onContact_ref=LUA_REFNIL;
     int fun_onTrigger_ref=LUA_REFNIL;
+    int fun_onJointBreak_ref=LUA_REFNIL;
+    int fun_onSleepChange_ref=LUA_REFNIL;
     int defold_script_instance_ref=LUA_REFNIL;
     lua_State *L=NULL;
     bool error=false;
@@ -55,6 +61,24 @@ public:
                        }
                        break;
                    }
+                   case HASH_onJointBreak:{
+                       if(lua_isfunction(L,-1)){
+                           lua_pushvalue(L,-1);
+                           fun_onJointBreak_ref = luaL_ref(L,LUA_REGISTRYINDEX);
+                       }else{
+                           luaL_error(L,"onJointBreak must be function");
+                       }
+                       break;
+                   }
+                   case HASH_onSleepChange:{
+                       if(lua_isfunction(L,-1)){
+                           lua_pushvalue(L,-1);
+                           fun_onSleepChange_ref = luaL_ref(L,LUA_REGISTRYINDEX);
+                       }else{
+                           luaL_error(L,"onSleepChange must be function");
+                       }
+                       break;
+                   }
                    default:
                        luaL_error(L, "unknown key:%s", key);
                        break;
@@ -62,7 +86,8 @@ public:
               /* removes 'value'; keeps 'key' for next iteration */
               lua_pop(L, 1);
            }
-           if(fun_onContact_ref == LUA_REFNIL && fun_onTrigger_ref == LUA_REFNIL){
+           if(fun_onContact_ref == LUA_REFNIL && fun_onTrigger_ref == LUA_REFNIL && fun_onJointBreak_ref == LUA_REFNIL
+                && fun_onSleepChange_ref == LUA_REFNIL){
                 dmLogWarning("No functions in eventListener");
            }
            lua_pop(L,1); //remove table
@@ -123,24 +148,66 @@ public:
         }
     }
 
+    inline void onJointBreak(const reactphysics3d::Array<reactphysics3d::Joint*> &joints){
+        if(!error && fun_onJointBreak_ref != LUA_REFNIL){
+            lua_rawgeti(L,LUA_REGISTRYINDEX,fun_onJointBreak_ref);
+            lua_newtable(L);
+            PushBrokenJoints(L,joints);
+            if (lua_pcall(L, 1, 0, 0) != 0){
+                 error = true;
+                 error_message = lua_tostring(L,-1);
+                 lua_pop(L,1);
+            }
+        }
+    }
+
+    inline void onSleepChange(const reactphysics3d::Array<reactphysics3d::RigidBody*> &sleepingBodies,
+                              const reactphysics3d::Array<reactphysics3d::RigidBody*> &awakeBodies){
+        if(!error && fun_onSleepChange_ref != LUA_REFNIL){
+            lua_rawgeti(L,LUA_REGISTRYINDEX,fun_onSleepChange_ref);
+            lua_newtable(L);
+            PushBodies(L,sleepingBodies);
+            lua_newtable(L);
+            PushBodies(L,awakeBodies);
+            if (lua_pcall(L, 2, 0, 0) != 0){
+                 error = true;
+                 error_message = lua_tostring(L,-1);
+                 lua_pop(L,1);
+            }
+        }
+    }
+
     inline void Destroy(lua_State *L){
         luaL_unref(L,LUA_REGISTRYINDEX, fun_onContact_ref);
         luaL_unref(L,LUA_REGISTRYINDEX, fun_onTrigger_ref);
+        luaL_unref(L,LUA_REGISTRYINDEX, fun_onJointBreak_ref);
+        luaL_unref(L,LUA_REGISTRYINDEX, fun_onSleepChange_ref);
         luaL_unref(L,LUA_REGISTRYINDEX, defold_script_instance_ref);
 
         fun_onContact_ref = LUA_REFNIL;
         fun_onTrigger_ref = LUA_REFNIL;
+        fun_onJointBreak_ref = LUA_REFNIL;
+        fun_onSleepChange_ref = LUA_REFNIL;
         defold_script_instance_ref = LUA_REFNIL;
     }
 };
 
 
+class BodyPoolUserdata;
+class CharacterControllerUserdata;
+class RaycastVehicleUserdata;
+class ForceFieldUserdata;
+
 class WorldUserdata : public BaseUserData {
 private:
 
 public:
     reactphysics3d::PhysicsWorld *world=NULL;
     LuaEventListener *eventListener=NULL;
+    dmArray<BodyPoolUserdata*> bodyPools;
+    dmArray<CharacterControllerUserdata*> characterControllers;
+    dmArray<RaycastVehicleUserdata*> raycastVehicles;
+    dmArray<ForceFieldUserdata*> forceFields;
 
     WorldUserdata(reactphysics3d::PhysicsWorld* world);
 	~WorldUserdata();
@@ -155,6 +222,9 @@ reactphysics3d::PhysicsWorld::WorldSettings WorldSettings_from_table(lua_State *
 
 const char * OverlapPairEventTypeEnumToString(reactphysics3d::OverlapCallback::OverlapPair::EventType name);
 const char * ContactPairEventTypeEnumToString(reactphysics3d::CollisionCallback::ContactPair::EventType name);
+reactphysics3d::RadialImpulseFalloff RadialImpulseFalloffStringToEnum(lua_State *L,const char* str);
+//write the entity ids of colliders and bodies into the buffer at index(if not nil). Push the number of colliders
+void QueryBufferWrite(lua_State *L, int index, const reactphysics3d::Array<reactphysics3d::Collider*> &colliders);
 
 
 
@@ -44,6 +44,7 @@ struct RaycastInfo;
 class DefaultPoolAllocator;
 class Profiler;
 class Logger;
+class DynamicAABBTree;
 
 // Class CollisionBody
 /**
@@ -62,6 +63,12 @@ class CollisionBody {
         /// Reference to the world the body belongs to
         PhysicsWorld& mWorld;
 
+        /// Local tree with the colliders of a compound body (nullptr if the body is not compound)
+        DynamicAABBTree* mCompoundTree;
+
+        /// Collider that holds the single broad-phase proxy of a compound body
+        Collider* mCompoundProxyCollider;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -81,6 +88,33 @@ class CollisionBody {
         /// (as if the body has moved).
         void askForBroadPhaseCollisionCheck() const;
 
+        /// Add a new collider into the collision detection (or into the compound tree)
+        void addColliderToCollisionDetection(Collider* collider, const AABB& worldAABB);
+
+        /// Remove a collider from the collision detection (or from the compound tree)
+        void removeColliderFromCollisionDetection(Collider* collider);
+
+        /// Return true if a collider can be stored in the compound tree of the body
+        bool canBeCompoundChild(const Collider* collider) const;
+
+        /// Insert a collider into the compound tree of the body
+        void insertColliderIntoCompound(Collider* collider);
+
+        /// Remove a collider from the compound tree of the body
+        void removeColliderFromCompound(Collider* collider);
+
+        /// Update the compound tree after the shape or the transform of a collider has changed
+        void updateColliderInCompound(Collider* collider);
+
+        /// Move a collider in or out of the compound tree if its properties have changed
+        void refreshColliderInCompound(Collider* collider);
+
+        /// Select a collider to hold the broad-phase proxy of the compound body
+        void selectCompoundProxy();
+
+        /// Return the world-space AABB of all the colliders of the compound tree
+        AABB getCompoundWorldAABB() const;
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -124,6 +158,12 @@ class CollisionBody {
         /// Remove a collider from the body
         virtual void removeCollider(Collider* collider);
 
+        /// Set whether the colliders of the body share a single broad-phase proxy
+        void setIsCompound(bool isCompound);
+
+        /// Return true if the colliders of the body share a single broad-phase proxy
+        bool isCompound() const;
+
         /// Return true if a point is inside the collision body
         bool testPointInside(const Vector3& worldPoint) const;
 
@@ -145,6 +185,9 @@ class CollisionBody {
         /// Return the number of colliders associated with this body
         uint32 getNbColliders() const;
 
+        /// Return the physics world of the body
+        PhysicsWorld& getWorld() const;
+
         /// Return the world-space coordinates of a point given the local-space coordinates of the body
         Vector3 getWorldPoint(const Vector3& localPoint) const;
 
@@ -171,6 +214,8 @@ class CollisionBody {
 
         friend class PhysicsWorld;
         friend class CollisionDetectionSystem;
+        friend class BroadPhaseSystem;
+        friend class BroadPhaseRaycastCallback;
         friend class BroadPhaseAlgorithm;
         friend class ConvexMeshShape;
         friend class Collider;
@@ -185,6 +230,19 @@ RP3D_FORCE_INLINE bool CollisionBody::testAABBOverlap(const AABB& worldAABB) con
     return worldAABB.testCollision(getAABB());
 }
 
+// Return true if the colliders of the body share a single broad-phase proxy
+/**
+ * @return True if the body is a compound body
+ */
+RP3D_FORCE_INLINE bool CollisionBody::isCompound() const {
+    return mCompoundTree != nullptr;
+}
+
+// Return the physics world of the body
+RP3D_FORCE_INLINE PhysicsWorld& CollisionBody::getWorld() const {
+    return mWorld;
+}
+
 // Return the corresponding entity of the body
 /**
  * @return The entity of the body
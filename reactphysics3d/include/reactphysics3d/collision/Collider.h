@@ -157,6 +157,12 @@ class Collider {
         /// Set whether the collider is a trigger
         void setIsTrigger(bool isTrigger) const;
 
+        /// Return the number of colliders inside the trigger
+        uint32 getNbTriggerOccupants() const;
+
+        /// Add the colliders inside the trigger to an array
+        uint32 getTriggerOccupants(Array<Collider*>& occupants) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -39,12 +39,15 @@ struct NarrowPhaseInfoBatch;
 class ConvexShape;
 class Profiler;
 class VoronoiSimplex;
+class Transform;
+struct Vector3;
 template<typename T> class Array;
 
 // Constants
 constexpr decimal REL_ERROR = decimal(1.0e-3);
 constexpr decimal REL_ERROR_SQUARE = REL_ERROR * REL_ERROR;
 constexpr int MAX_ITERATIONS_GJK_RAYCAST = 32;
+constexpr decimal SHAPE_CAST_SKIN_DISTANCE = decimal(0.005);
 
 // Class GJKAlgorithm
 /**
@@ -74,6 +77,18 @@ class GJKAlgorithm {
 
         // -------------------- Methods -------------------- //
 
+        /// Run the GJK distance algorithm on two convex shapes without margin
+        bool computeCoreDistance(const ConvexShape* shapeA, const ConvexShape* shapeB, const Transform& transformBToA,
+                                 VoronoiSimplex& simplex, Vector3& v) const;
+
+        /// Compute the penetration depth of two convex shapes along both directions of an axis
+        void testPenetrationAxis(const ConvexShape* shapeA, const ConvexShape* shapeB, const Transform& transformBToA,
+                                 const Vector3& axis, Vector3& localNormal, decimal& depth) const;
+
+        /// Compute the axis of minimum penetration of two convex shapes with the separating axis test
+        void computeMinPenetrationAxis(const ConvexShape* shapeA, const ConvexShape* shapeB, const Transform& transformBToA,
+                                       Vector3& localNormal, decimal& depth) const;
+
     public :
 
         enum class GJKResult {
@@ -100,6 +115,23 @@ class GJKAlgorithm {
         void testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
                            uint32 batchNbItems, Array<GJKResult>& gjkResults);
 
+        /// Compute the time of impact of a convex shape B moving along a translation against a convex shape A
+        bool shapeCast(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                       const Transform& transformB, const Vector3& translationB, decimal maxFraction,
+                       decimal& hitFraction, Vector3& hitPoint, Vector3& hitNormal) const;
+
+        /// Compute the closest points of two separated convex shapes
+        bool computeClosestPoints(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                                  const Transform& transformB, Vector3& pointA, Vector3& pointB) const;
+
+        /// Compute the penetration of two overlapping convex shapes
+        bool computePenetration(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                                const Transform& transformB, Vector3& normal, decimal& depth) const;
+
+        /// Return true if two convex shapes overlap
+        bool testOverlap(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                         const Transform& transformB) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -140,6 +140,9 @@ class VoronoiSimplex {
         /// Return true if the simplex is empty
         bool isEmpty() const;
 
+        /// Remove all the points of the simplex
+        void reset();
+
         /// Return the points of the simplex
         int getSimplex(Vector3* mSuppPointsA, Vector3* mSuppPointsB, Vector3* mPoints) const;
 
@@ -181,6 +184,13 @@ RP3D_FORCE_INLINE bool VoronoiSimplex::isEmpty() const {
     return mNbPoints == 0;
 }
 
+// Remove all the points of the simplex
+RP3D_FORCE_INLINE void VoronoiSimplex::reset() {
+    mNbPoints = 0;
+    mRecomputeClosestPoint = false;
+    mIsClosestPointValid = false;
+}
+
 // Set the barycentric coordinates of the closest point
 RP3D_FORCE_INLINE void VoronoiSimplex::setBarycentricCoords(decimal a, decimal b, decimal c, decimal d) {
     mBarycentricCoords[0] = a;
@@ -112,6 +112,9 @@ class AABB {
         /// Apply a scale factor to the AABB
         void applyScale(const Vector3& scale);
 
+        /// Apply a transform to the AABB (the result encloses the transformed box)
+        void applyTransform(const Transform& transform);
+
         /// Create and return an AABB for a triangle
         static AABB createAABBForTriangle(const Vector3* trianglePoints);
 
@@ -202,6 +205,14 @@ RP3D_FORCE_INLINE void AABB::applyScale(const Vector3& scale) {
     mMaxCoordinates = mMaxCoordinates * scale;
 }
 
+// Apply a transform to the AABB (the result encloses the transformed box)
+RP3D_FORCE_INLINE void AABB::applyTransform(const Transform& transform) {
+    const Vector3 center = transform * getCenter();
+    const Vector3 halfExtents = transform.getOrientation().getMatrix().getAbsoluteMatrix() * (getExtent() * decimal(0.5));
+    mMinCoordinates = center - halfExtents;
+    mMaxCoordinates = center + halfExtents;
+}
+
 // Merge the AABB in parameter with the current one
 RP3D_FORCE_INLINE void AABB::mergeWithAABB(const AABB& aabb) {
     mMinCoordinates.x = std::min(mMinCoordinates.x, aabb.mMinCoordinates.x);
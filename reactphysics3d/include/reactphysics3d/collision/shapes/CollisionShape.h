@@ -82,6 +82,9 @@ class CollisionShape {
         /// Pointer to user data
         void* mUserData=NULL;
 
+        /// Incremented each time the size of the shape changes
+        uint32 mVersion = 0;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -143,6 +146,12 @@ class CollisionShape {
         /// Return the id of the shape
         uint32 getId() const;
 
+        /// Return the number of colliders that use the collision shape
+        uint32 getNbColliders() const;
+
+        /// Return a number that is incremented each time the size of the shape changes
+        uint32 getVersion() const;
+
         /// Return the local inertia tensor of the collision shapes
         virtual Vector3 getLocalInertiaTensor(decimal mass) const=0;
 
@@ -198,6 +207,16 @@ RP3D_FORCE_INLINE uint32 CollisionShape::getId() const {
    return mId;
 }
 
+// Return the number of colliders that use the collision shape
+RP3D_FORCE_INLINE uint32 CollisionShape::getNbColliders() const {
+   return static_cast<uint32>(mColliders.size());
+}
+
+// Return a number that is incremented each time the size of the shape changes
+RP3D_FORCE_INLINE uint32 CollisionShape::getVersion() const {
+   return mVersion;
+}
+
 // Assign a new collider to the collision shape
 RP3D_FORCE_INLINE void CollisionShape::addCollider(Collider* collider) {
     mColliders.add(collider);
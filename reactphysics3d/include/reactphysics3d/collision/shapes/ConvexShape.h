@@ -80,6 +80,7 @@ class ConvexShape : public CollisionShape {
 
         friend class GJKAlgorithm;
         friend class SATAlgorithm;
+        friend class ForceField;
 };
 
 // Return true if the collision shape is convex, false if it is concave
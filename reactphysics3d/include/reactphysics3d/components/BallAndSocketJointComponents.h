@@ -246,6 +246,7 @@ class BallAndSocketJointComponents : public Components {
 
         friend class BroadPhaseSystem;
         friend class SolveBallAndSocketJointSystem;
+        friend class ArticulationSolverSystem;
 };
 
 // Return a pointer to a given joint
@@ -68,6 +68,9 @@ class ColliderComponents : public Components {
         /// Ids of the colliders for the broad-phase algorithm
         int32* mBroadPhaseIds;
 
+        /// Ids of the colliders in the local tree of their compound body (-1 if not in a compound tree)
+        int32* mCompoundIds;
+
         /// Transform from local-space of the collider to the body-space of its body
         Transform* mLocalToBodyTransforms;
 
@@ -176,6 +179,12 @@ class ColliderComponents : public Components {
         /// Set the broad-phase id of a given collider
         void setBroadPhaseId(Entity colliderEntity, int32 broadPhaseId);
 
+        /// Return the id of a given collider in the compound tree of its body
+        int32 getCompoundId(Entity colliderEntity) const;
+
+        /// Set the id of a given collider in the compound tree of its body
+        void setCompoundId(Entity colliderEntity, int32 compoundId);
+
         /// Return the collision category bits of a given collider
         unsigned short getCollisionCategoryBits(Entity colliderEntity) const;
 
@@ -281,6 +290,22 @@ RP3D_FORCE_INLINE void ColliderComponents::setBroadPhaseId(Entity colliderEntity
     mBroadPhaseIds[mMapEntityToComponentIndex[colliderEntity]] = broadPhaseId;
 }
 
+// Return the id of a given collider in the compound tree of its body
+RP3D_FORCE_INLINE int32 ColliderComponents::getCompoundId(Entity colliderEntity) const {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    return mCompoundIds[mMapEntityToComponentIndex[colliderEntity]];
+}
+
+// Set the id of a given collider in the compound tree of its body
+RP3D_FORCE_INLINE void ColliderComponents::setCompoundId(Entity colliderEntity, int32 compoundId) {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    mCompoundIds[mMapEntityToComponentIndex[colliderEntity]] = compoundId;
+}
+
 // Return the collision category bits of a given collider
 RP3D_FORCE_INLINE unsigned short ColliderComponents::getCollisionCategoryBits(Entity colliderEntity) const {
 
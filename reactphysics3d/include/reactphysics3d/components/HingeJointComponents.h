@@ -413,6 +413,7 @@ class HingeJointComponents : public Components {
         friend class BroadPhaseSystem;
         friend class SolveHingeJointSystem;
         friend class HingeJoint;
+        friend class ArticulationSolverSystem;
 };
 
 // Return a pointer to a given joint
@@ -76,6 +76,15 @@ class JointComponents : public Components {
         /// True if the joint has already been added into an island during islands creation
         bool* mIsAlreadyInIsland;
 
+        /// Array of forces (in Newtons) above which the joints break
+        decimal* mBreakForces;
+
+        /// Array of torques (in Newtons * meters) above which the joints break
+        decimal* mBreakTorques;
+
+        /// Array of boolean values to know if the joints are broken
+        bool* mIsBroken;
+
         // -------------------- Methods -------------------- //
 
         /// Allocate memory for a given number of components
@@ -101,12 +110,16 @@ class JointComponents : public Components {
             JointType jointType;
             JointsPositionCorrectionTechnique positionCorrectionTechnique;
             bool isCollisionEnabled;
+            decimal breakForce;
+            decimal breakTorque;
 
             /// Constructor
             JointComponent(Entity body1Entity, Entity body2Entity, Joint* joint, JointType jointType,
-                           JointsPositionCorrectionTechnique positionCorrectionTechnique, bool isCollisionEnabled)
+                           JointsPositionCorrectionTechnique positionCorrectionTechnique, bool isCollisionEnabled,
+                           decimal breakForce, decimal breakTorque)
                 : body1Entity(body1Entity), body2Entity(body2Entity), joint(joint), jointType(jointType),
-                  positionCorrectionTechnique(positionCorrectionTechnique), isCollisionEnabled(isCollisionEnabled)  {
+                  positionCorrectionTechnique(positionCorrectionTechnique), isCollisionEnabled(isCollisionEnabled),
+                  breakForce(breakForce), breakTorque(breakTorque) {
 
             }
         };
@@ -152,6 +165,24 @@ class JointComponents : public Components {
         /// Set to true if the joint has already been added into an island during island creation
         void setIsAlreadyInIsland(Entity jointEntity, bool isAlreadyInIsland);
 
+        /// Return the force above which a joint breaks
+        decimal getBreakForce(Entity jointEntity) const;
+
+        /// Set the force above which a joint breaks
+        void setBreakForce(Entity jointEntity, decimal breakForce);
+
+        /// Return the torque above which a joint breaks
+        decimal getBreakTorque(Entity jointEntity) const;
+
+        /// Set the torque above which a joint breaks
+        void setBreakTorque(Entity jointEntity, decimal breakTorque);
+
+        /// Return true if a joint is broken
+        bool getIsBroken(Entity jointEntity) const;
+
+        /// Set whether a joint is broken
+        void setIsBroken(Entity jointEntity, bool isBroken);
+
         // -------------------- Friendship -------------------- //
 
         friend class BroadPhaseSystem;
@@ -161,6 +192,7 @@ class JointComponents : public Components {
         friend class SolveFixedJointSystem;
         friend class SolveHingeJointSystem;
         friend class SolveSliderJointSystem;
+        friend struct JointColoring;
 
 };
 
@@ -224,6 +256,42 @@ RP3D_FORCE_INLINE void JointComponents::setIsAlreadyInIsland(Entity jointEntity,
     mIsAlreadyInIsland[mMapEntityToComponentIndex[jointEntity]] = isAlreadyInIsland;
 }
 
+// Return the force above which a joint breaks
+RP3D_FORCE_INLINE decimal JointComponents::getBreakForce(Entity jointEntity) const {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    return mBreakForces[mMapEntityToComponentIndex[jointEntity]];
+}
+
+// Set the force above which a joint breaks
+RP3D_FORCE_INLINE void JointComponents::setBreakForce(Entity jointEntity, decimal breakForce) {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    mBreakForces[mMapEntityToComponentIndex[jointEntity]] = breakForce;
+}
+
+// Return the torque above which a joint breaks
+RP3D_FORCE_INLINE decimal JointComponents::getBreakTorque(Entity jointEntity) const {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    return mBreakTorques[mMapEntityToComponentIndex[jointEntity]];
+}
+
+// Set the torque above which a joint breaks
+RP3D_FORCE_INLINE void JointComponents::setBreakTorque(Entity jointEntity, decimal breakTorque) {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    mBreakTorques[mMapEntityToComponentIndex[jointEntity]] = breakTorque;
+}
+
+// Return true if a joint is broken
+RP3D_FORCE_INLINE bool JointComponents::getIsBroken(Entity jointEntity) const {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    return mIsBroken[mMapEntityToComponentIndex[jointEntity]];
+}
+
+// Set whether a joint is broken
+RP3D_FORCE_INLINE void JointComponents::setIsBroken(Entity jointEntity, bool isBroken) {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    mIsBroken[mMapEntityToComponentIndex[jointEntity]] = isBroken;
+}
+
 }
 
 #endif
@@ -386,6 +386,7 @@ class RigidBodyComponents : public Components {
         friend class FixedJoint;
         friend class HingeJoint;
         friend class SliderJoint;
+        friend class ArticulationSolverSystem;
 };
 
 // Return a pointer to a body rigid
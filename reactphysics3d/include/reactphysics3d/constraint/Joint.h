@@ -68,11 +68,17 @@ struct JointInfo {
         /// True if the two bodies of the joint are allowed to collide with each other
         bool isCollisionEnabled;
 
+        /// Force (in Newtons) above which the joint breaks. By default, the joint never breaks
+        decimal breakForce;
+
+        /// Torque (in Newtons * meters) above which the joint breaks. By default, the joint never breaks
+        decimal breakTorque;
+
         /// Constructor
         JointInfo(JointType constraintType)
                       : body1(nullptr), body2(nullptr), type(constraintType),
                         positionCorrectionTechnique(JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL),
-                        isCollisionEnabled(true) {
+                        isCollisionEnabled(true), breakForce(DECIMAL_LARGEST), breakTorque(DECIMAL_LARGEST) {
 
         }
 
@@ -80,7 +86,7 @@ struct JointInfo {
         JointInfo(RigidBody* rigidBody1, RigidBody* rigidBody2, JointType constraintType)
                       : body1(rigidBody1), body2(rigidBody2), type(constraintType),
                         positionCorrectionTechnique(JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL),
-                        isCollisionEnabled(true) {
+                        isCollisionEnabled(true), breakForce(DECIMAL_LARGEST), breakTorque(DECIMAL_LARGEST) {
         }
 
         /// Destructor
@@ -149,6 +155,21 @@ class Joint {
         /// Return true if the collision between the two bodies of the joint is enabled
         bool isCollisionEnabled() const;
 
+        /// Return the force (in Newtons) above which the joint breaks
+        decimal getBreakForce() const;
+
+        /// Set the force (in Newtons) above which the joint breaks
+        void setBreakForce(decimal breakForce);
+
+        /// Return the torque (in Newtons * meters) above which the joint breaks
+        decimal getBreakTorque() const;
+
+        /// Set the torque (in Newtons * meters) above which the joint breaks
+        void setBreakTorque(decimal breakTorque);
+
+        /// Return true if the joint has been broken
+        bool isBroken() const;
+
         /// Return the entity id of the joint
         Entity getEntity() const;
 
@@ -0,0 +1,353 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_CHARACTER_CONTROLLER_H
+#define REACTPHYSICS3D_CHARACTER_CONTROLLER_H
+
+// Libraries
+#include <reactphysics3d/mathematics/mathematics.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class PhysicsWorld;
+class RigidBody;
+class Collider;
+class ConvexShape;
+struct ShapeCastInfo;
+
+// Constants
+constexpr int MAX_CHARACTER_SLIDE_ITERATIONS = 4;
+constexpr int MAX_CHARACTER_DEPENETRATION_ITERATIONS = 4;
+
+// Structure CharacterControllerSettings
+/**
+ * This structure contains the settings of a character controller.
+ */
+struct CharacterControllerSettings {
+
+    /// Up direction of the character (unit vector)
+    Vector3 up = Vector3(0, 1, 0);
+
+    /// Maximum angle (in radians) between the up direction and a surface the character can walk on
+    decimal maxSlopeAngle = PI_RP3D / decimal(4.0);
+
+    /// Maximum height of an obstacle the character can step on
+    decimal stepHeight = decimal(0.3);
+
+    /// Maximum distance the character is moved down to stay on the ground
+    decimal snapDistance = decimal(0.2);
+
+    /// Distance kept between the character and the colliders it touches
+    decimal skinWidth = decimal(0.01);
+
+    /// Force applied to the dynamic bodies hit by the character (zero to disable)
+    decimal pushForce = decimal(0.0);
+
+    /// Bits mask of the categories of colliders that block the character
+    unsigned short collideWithMaskBits = 0xFFFF;
+};
+
+// Class CharacterController
+/**
+ * This class represents a kinematic character controller. The character is a kinematic
+ * rigid body with a single convex collider (usually a capsule). The character is moved
+ * with shape casts against the colliders of the world (move and slide). It can step on
+ * small obstacles, it cannot walk on slopes steeper than the maximum slope angle and it
+ * stays on the ground when walking down slopes or stairs. The overlaps at the start of a
+ * move are resolved first and the dynamic bodies hit by the character can be pushed.
+ */
+class CharacterController {
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Reference to the physics world
+        PhysicsWorld& mWorld;
+
+        /// Kinematic body of the character
+        RigidBody* mBody;
+
+        /// Collider of the character
+        Collider* mCollider;
+
+        /// Convex shape of the character
+        const ConvexShape* mShape;
+
+        /// Up direction of the character
+        Vector3 mUp;
+
+        /// Maximum walkable slope angle (in radians)
+        decimal mMaxSlopeAngle;
+
+        /// Cosine of the maximum walkable slope angle
+        decimal mCosMaxSlopeAngle;
+
+        /// Maximum height of an obstacle the character can step on
+        decimal mStepHeight;
+
+        /// Maximum distance the character is moved down to stay on the ground
+        decimal mSnapDistance;
+
+        /// Distance kept between the character and the colliders it touches
+        decimal mSkinWidth;
+
+        /// Force applied to the dynamic bodies hit by the character
+        decimal mPushForce;
+
+        /// Bits mask of the categories of colliders that block the character
+        unsigned short mCollideWithMaskBits;
+
+        /// True if the character stands on a walkable surface
+        bool mIsOnGround;
+
+        /// Normal of the ground surface (only valid if the character is on the ground)
+        Vector3 mGroundNormal;
+
+        /// Collider of the ground (only valid if the character is on the ground)
+        Collider* mGroundCollider;
+
+        /// Displacement of the character during the last move
+        Vector3 mDisplacement;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        CharacterController(PhysicsWorld& world, RigidBody* body, Collider* collider, const CharacterControllerSettings& settings);
+
+        /// Destructor
+        ~CharacterController() = default;
+
+        /// Move the character out of the colliders it overlaps with
+        void depenetrate(Vector3& position, const Quaternion& orientation) const;
+
+        /// Move the character along a displacement and slide along the surfaces that are hit
+        bool slide(Vector3& position, const Quaternion& orientation, const Vector3& displacement, bool isHorizontal,
+                   ShapeCastInfo* hits, int& nbHits) const;
+
+        /// Try to move the character horizontally over an obstacle
+        bool stepUp(Vector3& position, const Quaternion& orientation, const Vector3& displacement,
+                    ShapeCastInfo* hits, int& nbHits) const;
+
+        /// Reset the ground state (the character is not on the ground anymore)
+        void resetGround();
+
+        /// Find the ground under the character and snap the character to it
+        void updateGround(Vector3& position, const Quaternion& orientation, bool snapToGround);
+
+        /// Apply the push force to the dynamic bodies hit by the character
+        void pushBodies(const ShapeCastInfo* hits, int nbHits) const;
+
+        /// Return true if a surface normal is walkable
+        bool isWalkable(const Vector3& normal) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Deleted copy-constructor
+        CharacterController(const CharacterController& controller) = delete;
+
+        /// Deleted assignment operator
+        CharacterController& operator=(const CharacterController& controller) = delete;
+
+        /// Move the character
+        void move(const Vector3& displacement);
+
+        /// Return the kinematic body of the character
+        RigidBody* getBody();
+
+        /// Return the collider of the character
+        Collider* getCollider();
+
+        /// Return the world-space position of the character
+        const Vector3& getPosition() const;
+
+        /// Teleport the character to a world-space position
+        void setPosition(const Vector3& position);
+
+        /// Return the up direction of the character
+        const Vector3& getUp() const;
+
+        /// Set the up direction of the character
+        void setUp(const Vector3& up);
+
+        /// Return the maximum walkable slope angle (in radians)
+        decimal getMaxSlopeAngle() const;
+
+        /// Set the maximum walkable slope angle (in radians)
+        void setMaxSlopeAngle(decimal maxSlopeAngle);
+
+        /// Return the maximum height of an obstacle the character can step on
+        decimal getStepHeight() const;
+
+        /// Set the maximum height of an obstacle the character can step on
+        void setStepHeight(decimal stepHeight);
+
+        /// Return the maximum distance the character is moved down to stay on the ground
+        decimal getSnapDistance() const;
+
+        /// Set the maximum distance the character is moved down to stay on the ground
+        void setSnapDistance(decimal snapDistance);
+
+        /// Return the distance kept between the character and the colliders it touches
+        decimal getSkinWidth() const;
+
+        /// Set the distance kept between the character and the colliders it touches
+        void setSkinWidth(decimal skinWidth);
+
+        /// Return the force applied to the dynamic bodies hit by the character
+        decimal getPushForce() const;
+
+        /// Set the force applied to the dynamic bodies hit by the character
+        void setPushForce(decimal pushForce);
+
+        /// Return the bits mask of the categories of colliders that block the character
+        unsigned short getCollideWithMaskBits() const;
+
+        /// Set the bits mask of the categories of colliders that block the character
+        void setCollideWithMaskBits(unsigned short collideWithMaskBits);
+
+        /// Return true if the character stands on a walkable surface
+        bool isOnGround() const;
+
+        /// Return the normal of the ground surface (only valid if the character is on the ground)
+        const Vector3& getGroundNormal() const;
+
+        /// Return the collider of the ground (null if the character is not on the ground)
+        Collider* getGroundCollider() const;
+
+        /// Return the displacement of the character during the last move
+        const Vector3& getDisplacement() const;
+
+        // -------------------- Friendship -------------------- //
+
+        friend class PhysicsWorld;
+};
+
+// Return the kinematic body of the character
+RP3D_FORCE_INLINE RigidBody* CharacterController::getBody() {
+    return mBody;
+}
+
+// Return the collider of the character
+RP3D_FORCE_INLINE Collider* CharacterController::getCollider() {
+    return mCollider;
+}
+
+// Return the up direction of the character
+RP3D_FORCE_INLINE const Vector3& CharacterController::getUp() const {
+    return mUp;
+}
+
+// Return the maximum walkable slope angle (in radians)
+RP3D_FORCE_INLINE decimal CharacterController::getMaxSlopeAngle() const {
+    return mMaxSlopeAngle;
+}
+
+// Return the maximum height of an obstacle the character can step on
+RP3D_FORCE_INLINE decimal CharacterController::getStepHeight() const {
+    return mStepHeight;
+}
+
+// Set the maximum height of an obstacle the character can step on
+RP3D_FORCE_INLINE void CharacterController::setStepHeight(decimal stepHeight) {
+    assert(stepHeight >= decimal(0.0));
+    mStepHeight = stepHeight;
+}
+
+// Return the maximum distance the character is moved down to stay on the ground
+RP3D_FORCE_INLINE decimal CharacterController::getSnapDistance() const {
+    return mSnapDistance;
+}
+
+// Set the maximum distance the character is moved down to stay on the ground
+RP3D_FORCE_INLINE void CharacterController::setSnapDistance(decimal snapDistance) {
+    assert(snapDistance >= decimal(0.0));
+    mSnapDistance = snapDistance;
+}
+
+// Return the distance kept between the character and the colliders it touches
+RP3D_FORCE_INLINE decimal CharacterController::getSkinWidth() const {
+    return mSkinWidth;
+}
+
+// Set the distance kept between the character and the colliders it touches
+RP3D_FORCE_INLINE void CharacterController::setSkinWidth(decimal skinWidth) {
+    assert(skinWidth > decimal(0.0));
+    mSkinWidth = skinWidth;
+}
+
+// Return the force applied to the dynamic bodies hit by the character
+RP3D_FORCE_INLINE decimal CharacterController::getPushForce() const {
+    return mPushForce;
+}
+
+// Set the force applied to the dynamic bodies hit by the character
+RP3D_FORCE_INLINE void CharacterController::setPushForce(decimal pushForce) {
+    assert(pushForce >= decimal(0.0));
+    mPushForce = pushForce;
+}
+
+// Return the bits mask of the categories of colliders that block the character
+RP3D_FORCE_INLINE unsigned short CharacterController::getCollideWithMaskBits() const {
+    return mCollideWithMaskBits;
+}
+
+// Set the bits mask of the categories of colliders that block the character
+RP3D_FORCE_INLINE void CharacterController::setCollideWithMaskBits(unsigned short collideWithMaskBits) {
+    mCollideWithMaskBits = collideWithMaskBits;
+}
+
+// Return true if the character stands on a walkable surface
+RP3D_FORCE_INLINE bool CharacterController::isOnGround() const {
+    return mIsOnGround;
+}
+
+// Return the normal of the ground surface (only valid if the character is on the ground)
+RP3D_FORCE_INLINE const Vector3& CharacterController::getGroundNormal() const {
+    return mGroundNormal;
+}
+
+// Return the collider of the ground (null if the character is not on the ground)
+RP3D_FORCE_INLINE Collider* CharacterController::getGroundCollider() const {
+    return mGroundCollider;
+}
+
+// Return the displacement of the character during the last move
+RP3D_FORCE_INLINE const Vector3& CharacterController::getDisplacement() const {
+    return mDisplacement;
+}
+
+// Return true if a surface normal is walkable
+RP3D_FORCE_INLINE bool CharacterController::isWalkable(const Vector3& normal) const {
+    return normal.dot(mUp) >= mCosMaxSlopeAngle;
+}
+
+}
+
+#endif
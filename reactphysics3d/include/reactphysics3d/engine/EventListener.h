@@ -29,9 +29,13 @@
 // Libraries
 #include <reactphysics3d/collision/CollisionCallback.h>
 #include <reactphysics3d/collision/OverlapCallback.h>
+#include <reactphysics3d/containers/Array.h>
 
 namespace reactphysics3d {
 
+class Joint;
+class RigidBody;
+
 // Class EventListener
 /**
  * This class can be used to receive notifications about events that occur during the simulation.
@@ -62,6 +66,19 @@ class EventListener : public CollisionCallback {
          * @param callbackData Contains information about all the triggers that are colliding
          */
         virtual void onTrigger(const OverlapCallback::CallbackData& /*callbackData*/) {}
+
+        /// Called at the end of a step when some joints have been broken during the step
+        /**
+         * @param joints The joints whose force or torque has exceeded their break threshold
+         */
+        virtual void onJointBreak(const Array<Joint*>& /*joints*/) {}
+
+        /// Called at the end of a step when the sleeping state of some bodies has changed since the previous step
+        /**
+         * @param sleepingBodies The bodies that have fallen asleep
+         * @param awakeBodies The bodies that have been woken up
+         */
+        virtual void onSleepChange(const Array<RigidBody*>& /*sleepingBodies*/, const Array<RigidBody*>& /*awakeBodies*/) {}
 };
 
 }
@@ -0,0 +1,363 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_FORCE_FIELD_H
+#define REACTPHYSICS3D_FORCE_FIELD_H
+
+// Libraries
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/engine/Entity.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class PhysicsWorld;
+class Collider;
+class ConvexShape;
+
+// Enumeration ForceFieldType
+/**
+ * Type of the force of a force field
+ * WIND : Constant force along the direction of the field
+ * ATTRACTOR : Acceleration toward the center of the field (away from it for a negative strength)
+ * BUOYANCY : Buoyancy force and drag of a fluid whose surface is the top of the volume
+ */
+enum class ForceFieldType {WIND, ATTRACTOR, BUOYANCY};
+
+// Structure ForceFieldSettings
+/**
+ * This structure contains the settings of a force field.
+ */
+struct ForceFieldSettings {
+
+    /// Type of the force field
+    ForceFieldType type = ForceFieldType::WIND;
+
+    /// Direction of the wind (world-space)
+    Vector3 direction = Vector3(1, 0, 0);
+
+    /// Force of the wind or acceleration of the attractor
+    decimal strength = decimal(10.0);
+
+    /// Center of the attractor (world-space)
+    Vector3 center = Vector3(0, 0, 0);
+
+    /// Distance where the acceleration of the attractor becomes zero (zero for a constant acceleration)
+    decimal radius = decimal(0.0);
+
+    /// Density of the fluid (buoyancy)
+    decimal fluidDensity = decimal(1000.0);
+
+    /// Linear drag of the fluid (buoyancy)
+    decimal linearDrag = decimal(1.0);
+
+    /// Angular drag of the fluid (buoyancy)
+    decimal angularDrag = decimal(1.0);
+
+    /// Bits mask of the categories of colliders that are affected by the field
+    unsigned short collideWithMaskBits = 0xFFFF;
+};
+
+// Class ForceField
+/**
+ * This class represents a volume that applies a force to the dynamic bodies inside it. The
+ * volume is a collider (usually a trigger) or a world-space AABB. The forces of the fields
+ * are added to the external forces of the bodies at each update of the world, before the
+ * velocities are integrated with the gravity. A wind or an attractor acts on the bodies
+ * whose center of mass is inside the volume. A buoyancy field acts on each convex collider
+ * with the volume of the collider under the fluid surface (exact for a sphere and computed
+ * from the extent of the shape along the gravity for the other convex shapes). Sleeping
+ * bodies are not woken up by the fields.
+ */
+class ForceField {
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Reference to the physics world
+        PhysicsWorld& mWorld;
+
+        /// True if the volume of the field is a collider
+        bool mIsColliderVolume;
+
+        /// Collider of the volume (null if the volume is an AABB or if the collider has been removed)
+        Collider* mCollider;
+
+        /// World-space AABB of the volume (only used if the volume is not a collider)
+        AABB mAABB;
+
+        /// True if the field is enabled
+        bool mIsEnabled;
+
+        /// Type of the force field
+        ForceFieldType mType;
+
+        /// Direction of the wind (unit vector)
+        Vector3 mDirection;
+
+        /// Force of the wind or acceleration of the attractor
+        decimal mStrength;
+
+        /// Center of the attractor
+        Vector3 mCenter;
+
+        /// Distance where the acceleration of the attractor becomes zero
+        decimal mRadius;
+
+        /// Density of the fluid
+        decimal mFluidDensity;
+
+        /// Linear drag of the fluid
+        decimal mLinearDrag;
+
+        /// Angular drag of the fluid
+        decimal mAngularDrag;
+
+        /// Bits mask of the categories of colliders that are affected by the field
+        unsigned short mCollideWithMaskBits;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ForceField(PhysicsWorld& world, Collider* collider, const AABB& aabb, const ForceFieldSettings& settings);
+
+        /// Destructor
+        ~ForceField() = default;
+
+        /// Add the forces of the field to the external forces of the bodies inside the volume
+        void applyForces(decimal timeStep);
+
+        /// Return true if a world-space point is inside the volume
+        bool isPointInside(const Vector3& point) const;
+
+        /// Compute the force of a wind or an attractor on a body
+        Vector3 computeBodyForce(Entity bodyEntity, const Vector3& centerOfMass) const;
+
+        /// Add the buoyancy force and the drag of the fluid on a collider
+        void applyBuoyancy(Entity colliderEntity, const Vector3& up, decimal gravityLength, decimal surfaceHeight,
+                           decimal timeStep);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Deleted copy-constructor
+        ForceField(const ForceField& field) = delete;
+
+        /// Deleted assignment operator
+        ForceField& operator=(const ForceField& field) = delete;
+
+        /// Return the type of the force field
+        ForceFieldType getType() const;
+
+        /// Return true if the field is enabled
+        bool isEnabled() const;
+
+        /// Enable or disable the field
+        void setIsEnabled(bool isEnabled);
+
+        /// Return the collider of the volume (null if the volume is an AABB or if the collider has been removed)
+        Collider* getCollider() const;
+
+        /// Return the world-space AABB of the volume
+        AABB getAABB() const;
+
+        /// Use a world-space AABB as the volume of the field
+        void setAABB(const AABB& aabb);
+
+        /// Return the direction of the wind
+        const Vector3& getDirection() const;
+
+        /// Set the direction of the wind
+        void setDirection(const Vector3& direction);
+
+        /// Return the force of the wind or the acceleration of the attractor
+        decimal getStrength() const;
+
+        /// Set the force of the wind or the acceleration of the attractor
+        void setStrength(decimal strength);
+
+        /// Return the center of the attractor
+        const Vector3& getCenter() const;
+
+        /// Set the center of the attractor
+        void setCenter(const Vector3& center);
+
+        /// Return the distance where the acceleration of the attractor becomes zero
+        decimal getRadius() const;
+
+        /// Set the distance where the acceleration of the attractor becomes zero
+        void setRadius(decimal radius);
+
+        /// Return the density of the fluid
+        decimal getFluidDensity() const;
+
+        /// Set the density of the fluid
+        void setFluidDensity(decimal fluidDensity);
+
+        /// Return the linear drag of the fluid
+        decimal getLinearDrag() const;
+
+        /// Set the linear drag of the fluid
+        void setLinearDrag(decimal linearDrag);
+
+        /// Return the angular drag of the fluid
+        decimal getAngularDrag() const;
+
+        /// Set the angular drag of the fluid
+        void setAngularDrag(decimal angularDrag);
+
+        /// Return the bits mask of the categories of colliders that are affected by the field
+        unsigned short getCollideWithMaskBits() const;
+
+        /// Set the bits mask of the categories of colliders that are affected by the field
+        void setCollideWithMaskBits(unsigned short collideWithMaskBits);
+
+        // -------------------- Friendship -------------------- //
+
+        friend class PhysicsWorld;
+};
+
+// Return the type of the force field
+RP3D_FORCE_INLINE ForceFieldType ForceField::getType() const {
+    return mType;
+}
+
+// Return true if the field is enabled
+RP3D_FORCE_INLINE bool ForceField::isEnabled() const {
+    return mIsEnabled;
+}
+
+// Enable or disable the field
+RP3D_FORCE_INLINE void ForceField::setIsEnabled(bool isEnabled) {
+    mIsEnabled = isEnabled;
+}
+
+// Return the collider of the volume (null if the volume is an AABB or if the collider has been removed)
+RP3D_FORCE_INLINE Collider* ForceField::getCollider() const {
+    return mCollider;
+}
+
+// Use a world-space AABB as the volume of the field
+RP3D_FORCE_INLINE void ForceField::setAABB(const AABB& aabb) {
+    mIsColliderVolume = false;
+    mCollider = nullptr;
+    mAABB = aabb;
+}
+
+// Return the direction of the wind
+RP3D_FORCE_INLINE const Vector3& ForceField::getDirection() const {
+    return mDirection;
+}
+
+// Set the direction of the wind
+/**
+ * @param direction Direction of the wind (it does not need to be normalized)
+ */
+RP3D_FORCE_INLINE void ForceField::setDirection(const Vector3& direction) {
+    assert(direction.lengthSquare() > MACHINE_EPSILON);
+    mDirection = direction.getUnit();
+}
+
+// Return the force of the wind or the acceleration of the attractor
+RP3D_FORCE_INLINE decimal ForceField::getStrength() const {
+    return mStrength;
+}
+
+// Set the force of the wind or the acceleration of the attractor
+RP3D_FORCE_INLINE void ForceField::setStrength(decimal strength) {
+    mStrength = strength;
+}
+
+// Return the center of the attractor
+RP3D_FORCE_INLINE const Vector3& ForceField::getCenter() const {
+    return mCenter;
+}
+
+// Set the center of the attractor
+RP3D_FORCE_INLINE void ForceField::setCenter(const Vector3& center) {
+    mCenter = center;
+}
+
+// Return the distance where the acceleration of the attractor becomes zero
+RP3D_FORCE_INLINE decimal ForceField::getRadius() const {
+    return mRadius;
+}
+
+// Set the distance where the acceleration of the attractor becomes zero
+RP3D_FORCE_INLINE void ForceField::setRadius(decimal radius) {
+    assert(radius >= decimal(0.0));
+    mRadius = radius;
+}
+
+// Return the density of the fluid
+RP3D_FORCE_INLINE decimal ForceField::getFluidDensity() const {
+    return mFluidDensity;
+}
+
+// Set the density of the fluid
+RP3D_FORCE_INLINE void ForceField::setFluidDensity(decimal fluidDensity) {
+    assert(fluidDensity >= decimal(0.0));
+    mFluidDensity = fluidDensity;
+}
+
+// Return the linear drag of the fluid
+RP3D_FORCE_INLINE decimal ForceField::getLinearDrag() const {
+    return mLinearDrag;
+}
+
+// Set the linear drag of the fluid
+RP3D_FORCE_INLINE void ForceField::setLinearDrag(decimal linearDrag) {
+    assert(linearDrag >= decimal(0.0));
+    mLinearDrag = linearDrag;
+}
+
+// Return the angular drag of the fluid
+RP3D_FORCE_INLINE decimal ForceField::getAngularDrag() const {
+    return mAngularDrag;
+}
+
+// Set the angular drag of the fluid
+RP3D_FORCE_INLINE void ForceField::setAngularDrag(decimal angularDrag) {
+    assert(angularDrag >= decimal(0.0));
+    mAngularDrag = angularDrag;
+}
+
+// Return the bits mask of the categories of colliders that are affected by the field
+RP3D_FORCE_INLINE unsigned short ForceField::getCollideWithMaskBits() const {
+    return mCollideWithMaskBits;
+}
+
+// Set the bits mask of the categories of colliders that are affected by the field
+RP3D_FORCE_INLINE void ForceField::setCollideWithMaskBits(unsigned short collideWithMaskBits) {
+    mCollideWithMaskBits = collideWithMaskBits;
+}
+
+}
+
+#endif
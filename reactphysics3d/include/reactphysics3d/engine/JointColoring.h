@@ -0,0 +1,112 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef REACTPHYSICS3D_JOINT_COLORING_H
+#define REACTPHYSICS3D_JOINT_COLORING_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/engine/Entity.h>
+#include <cassert>
+
+namespace reactphysics3d {
+
+// Declarations
+class MemoryManager;
+class JointComponents;
+class RigidBodyComponents;
+
+// Structure JointColoring
+/**
+ * This structure partitions the enabled joints of a given type into colors. Two joints
+ * of the same color never share a body. Therefore, the joints of a color can be solved
+ * in any order (or in parallel) without write conflicts on the bodies velocities,
+ * positions and orientations. The color of a joint is one more than the highest color of
+ * the previous joints of its bodies. This way, the joints that share a body are still solved
+ * in the order of the components and the result is the same as a sequential solver, whatever
+ * the way the colors are split. The static and kinematic bodies are not shared either because
+ * the position solver normalizes their orientation. The arrays are allocated with the frame
+ * allocator and are valid until release() is called.
+ */
+struct JointColoring {
+
+    public:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Number of joints
+        uint32 nbJoints;
+
+        /// Number of colors
+        uint32 nbColors;
+
+        /// Index of the joint components sorted by color (the joints of a color keep the components order)
+        uint32* sortedJoints;
+
+        /// For each color, index of the end of the color in the "sortedJoints" array
+        uint32* colorsEndIndex;
+
+        /// For each joint component, index of the joint in the joint components
+        uint32* jointComponentIndices;
+
+        /// For each joint component, index of the body 1 in the rigid body components
+        uint32* rigidBodyComponentIndicesBody1;
+
+        /// For each joint component, index of the body 2 in the rigid body components
+        uint32* rigidBodyComponentIndicesBody2;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        JointColoring()
+            :nbJoints(0), nbColors(0), sortedJoints(nullptr), colorsEndIndex(nullptr), jointComponentIndices(nullptr),
+             rigidBodyComponentIndicesBody1(nullptr), rigidBodyComponentIndicesBody2(nullptr) {
+
+        }
+
+        /// Compute the colors of the joints
+        void compute(MemoryManager& memoryManager, const Entity* jointEntities, uint32 nbJointEntities,
+                     JointComponents& jointComponents, RigidBodyComponents& rigidBodyComponents);
+
+        /// Release the arrays allocated by the last call to compute()
+        void release(MemoryManager& memoryManager);
+
+        /// Return the index of the first joint of a color in the "sortedJoints" array
+        uint32 getColorStartIndex(uint32 color) const {
+            assert(color < nbColors);
+            return color == 0 ? 0 : colorsEndIndex[color - 1];
+        }
+
+        /// Return the index after the last joint of a color in the "sortedJoints" array
+        uint32 getColorEndIndex(uint32 color) const {
+            assert(color < nbColors);
+            return colorsEndIndex[color];
+        }
+};
+
+}
+
+#endif
@@ -181,7 +181,8 @@ class OverlappingPairs {
                 /// Temporal coherence data store collision information about the last frame.
                 /// If two convex shapes overlap, we have a single collision data but if one shape is concave,
                 /// we might have collision data for several overlapping triangles. The key in the map is the
-                /// shape Ids of the two collision shapes.
+                /// entity id of the convex collider and the id of the triangle (or the entity ids of the two
+                /// colliders for the convex children of a compound body).
                 Map<uint64, LastFrameCollisionInfo*> lastFrameCollisionInfos;
 
                 /// Constructor
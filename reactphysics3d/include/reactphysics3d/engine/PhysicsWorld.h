@@ -53,6 +53,9 @@
 #include <reactphysics3d/systems/ContactSolverSystem.h>
 #include <reactphysics3d/systems/DynamicsSystem.h>
 #include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/engine/CharacterController.h>
+#include <reactphysics3d/engine/RaycastVehicle.h>
+#include <reactphysics3d/engine/ForceField.h>
 #include <reactphysics3d/utils/DebugRenderer.h>
 #include <sstream>
 
@@ -64,6 +67,17 @@ class Island;
 class RigidBody;
 class PhysicsCommon;
 struct JointInfo;
+class ConvexShape;
+struct ShapeCastInfo;
+
+// Enumeration RadialImpulseFalloff
+/**
+ * Decrease of a radial impulse with the distance to its center
+ * CONSTANT : The impulse does not decrease
+ * LINEAR : The impulse decreases linearly to zero at the radius
+ * QUADRATIC : The impulse decreases with the square of the distance to zero at the radius
+ */
+enum class RadialImpulseFalloff {CONSTANT, LINEAR, QUADRATIC};
 
 // Class PhysicsWorld
 /**
@@ -106,6 +120,14 @@ class PhysicsWorld {
             /// Number of iterations when solving the position constraints of the Sequential Impulse technique
             uint16 defaultPositionSolverNbIterations;
 
+            /// Number of substeps of a simulation step (the collision detection is computed once per step
+            /// and the bodies are integrated and solved in each substep)
+            uint16 defaultNbSubsteps;
+
+            /// True if the ball-and-socket and hinge joints that connect bodies in a tree are
+            /// solved exactly by the articulation solver instead of the iterative solver
+            bool isArticulationSolverEnabled;
+
             /// Time (in seconds) that a body must stay still to be considered sleeping
             float defaultTimeBeforeSleep;
 
@@ -133,6 +155,8 @@ class PhysicsWorld {
                 isSleepingEnabled = true;
                 defaultVelocitySolverNbIterations = 6;
                 defaultPositionSolverNbIterations = 3;
+                defaultNbSubsteps = 1;
+                isArticulationSolverEnabled = false;
                 defaultTimeBeforeSleep = 1.0f;
                 defaultSleepLinearVelocity = decimal(0.02);
                 defaultSleepAngularVelocity = decimal(3.0) * (PI_RP3D / decimal(180.0));
@@ -155,6 +179,8 @@ class PhysicsWorld {
                 ss << "isSleepingEnabled=" << isSleepingEnabled << std::endl;
                 ss << "defaultVelocitySolverNbIterations=" << defaultVelocitySolverNbIterations << std::endl;
                 ss << "defaultPositionSolverNbIterations=" << defaultPositionSolverNbIterations << std::endl;
+                ss << "defaultNbSubsteps=" << defaultNbSubsteps << std::endl;
+                ss << "isArticulationSolverEnabled=" << isArticulationSolverEnabled << std::endl;
                 ss << "defaultTimeBeforeSleep=" << defaultTimeBeforeSleep << std::endl;
                 ss << "defaultSleepLinearVelocity=" << defaultSleepLinearVelocity << std::endl;
                 ss << "defaultSleepAngularVelocity=" << defaultSleepAngularVelocity << std::endl;
@@ -254,6 +280,9 @@ class PhysicsWorld {
         /// Number of iterations for the position solver of the Sequential Impulses technique
         uint16 mNbPositionSolverIterations;
 
+        /// Number of substeps of a simulation step
+        uint16 mNbSubsteps;
+
         /// True if the spleeping technique for inactive bodies is enabled
         bool mIsSleepingEnabled;
 
@@ -273,6 +302,21 @@ class PhysicsWorld {
         /// becomes smaller than the sleep velocity.
         decimal mTimeBeforeSleep;
 
+        /// Joints broken during the current step (reported to the event listener at the end of the step)
+        Array<Joint*> mBrokenJoints;
+
+        /// Sleeping state changes of the bodies since the previous step (body entity and new sleeping state)
+        Array<Pair<Entity, bool>> mSleepChanges;
+
+        /// All the character controllers of the physics world
+        Array<CharacterController*> mCharacterControllers;
+
+        /// All the raycast vehicles of the physics world
+        Array<RaycastVehicle*> mVehicles;
+
+        /// All the force fields of the physics world
+        Array<ForceField*> mForceFields;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
@@ -284,8 +328,14 @@ class PhysicsWorld {
         /// Notify the world whether a joint is disabled or not
         void setJointDisabled(Entity jointEntity, bool isDisabled);
 
-        /// Solve the contacts and constraints
-        void solveContactsAndConstraints(decimal timeStep);
+        /// Return true if a joint is broken or if one of its two bodies is disabled
+        bool isJointDisabled(Entity jointEntity) const;
+
+        /// Solve the contacts and constraints in a substep
+        void solveContactsAndConstraints(decimal timeStep, uint32 substep);
+
+        /// Solve the velocities of the contacts and constraints again after the positions of a substep are integrated
+        void relaxContactsAndConstraints();
 
         /// Solve the position error correction of the constraints
         void solvePositionCorrection();
@@ -299,6 +349,27 @@ class PhysicsWorld {
         /// Put bodies to sleep if needed.
         void updateSleepingBodies(decimal timeStep);
 
+        /// Disable the joints whose force or torque exceeds their break threshold
+        void breakJoints();
+
+        /// Report the bodies whose sleeping state has changed since the previous step to the event listener
+        void reportSleepChanges();
+
+        /// Apply the suspension and tire forces of the raycast vehicles
+        void updateVehicles(decimal timeStep);
+
+        /// Add the forces of the force fields to the external forces of the bodies
+        void applyForceFields(decimal timeStep);
+
+        /// Remove a collider that is destroyed from the volumes of the force fields
+        void removeColliderFromForceFields(const Collider* collider);
+
+        /// Remove a collider that is destroyed from the ground of the character controllers
+        void removeColliderFromCharacterControllers(const Collider* collider);
+
+        /// Remove a collider that is destroyed from the ground of the wheels of the vehicles
+        void removeColliderFromVehicles(const Collider* collider);
+
         /// Add the joint to the array of joints of the two bodies involved in the joint
         void addJointToBodies(Entity body1, Entity body2, Entity joint);
 
@@ -324,6 +395,15 @@ class PhysicsWorld {
         /// Ray cast method
         void raycast(const Ray& ray, RaycastCallback* raycastCallback, unsigned short raycastWithCategoryMaskBits = 0xFFFF) const;
 
+        /// Cast a convex shape along a translation and return true if a collider is hit
+        bool shapeCast(const ConvexShape* shape, const Transform& transform, const Vector3& translation,
+                       ShapeCastInfo& shapeCastInfo, unsigned short collideWithMaskBits = 0xFFFF,
+                       const CollisionBody* ignoredBody = nullptr) const;
+
+        /// Compute the translation that moves a convex shape out of its deepest overlapping collider
+        bool computePenetration(const ConvexShape* shape, const Transform& transform, Vector3& translation,
+                                unsigned short collideWithMaskBits = 0xFFFF, const CollisionBody* ignoredBody = nullptr) const;
+
         /// Return true if two bodies overlap (collide)
         bool testOverlap(CollisionBody* body1, CollisionBody* body2);
 
@@ -333,6 +413,26 @@ class PhysicsWorld {
         /// Report all the bodies that overlap (collide) in the world
         void testOverlap(OverlapCallback& overlapCallback);
 
+        /// Report all the colliders that overlap with a convex shape at a given transform
+        void testOverlap(const ConvexShape* shape, const Transform& transform, Array<Collider*>& colliders,
+                         unsigned short collideWithMaskBits = 0xFFFF) const;
+
+        /// Compute the closest points between two colliders with convex shapes
+        bool computeClosestPoints(const Collider* collider1, const Collider* collider2,
+                                  Vector3& worldPoint1, Vector3& worldPoint2) const;
+
+        /// Report all the colliders whose AABB overlaps with a world-space AABB
+        void queryAABB(const AABB& aabb, Array<Collider*>& colliders, unsigned short collideWithMaskBits = 0xFFFF) const;
+
+        /// Report all the colliders whose AABB overlaps with a world-space sphere
+        void querySphere(const Vector3& center, decimal radius, Array<Collider*>& colliders,
+                         unsigned short collideWithMaskBits = 0xFFFF) const;
+
+        /// Apply an impulse away from a center to the dynamic bodies in a radius (explosion)
+        uint32 applyRadialImpulse(const Vector3& center, decimal radius, decimal impulse,
+                                  RadialImpulseFalloff falloff = RadialImpulseFalloff::LINEAR,
+                                  unsigned short collideWithMaskBits = 0xFFFF, bool isOcclusionEnabled = false);
+
         /// Test collision and report contacts between two bodies.
         void testCollision(CollisionBody* body1, CollisionBody* body2, CollisionCallback& callback);
 
@@ -372,24 +472,65 @@ class PhysicsWorld {
         /// Set the number of iterations for the position constraint solver
         void setNbIterationsPositionSolver(uint32 nbIterations);
 
+        /// Get the number of substeps of a simulation step
+        uint16 getNbSubsteps() const;
+
+        /// Set the number of substeps of a simulation step
+        void setNbSubsteps(uint16 nbSubsteps);
+
+        /// Return true if the joints connected in a tree are solved by the articulation solver
+        bool isArticulationSolverEnabled() const;
+
+        /// Enable/Disable the articulation solver for the joints connected in a tree
+        void setIsArticulationSolverEnabled(bool isEnabled);
+
         /// Set the position correction technique used for contacts
         void setContactsPositionCorrectionTechnique(ContactsPositionCorrectionTechnique technique);
 
         /// Create a rigid body into the physics world.
         RigidBody* createRigidBody(const Transform& transform);
 
-        /// Disable the joints for pair of sleeping bodies
+        /// Recompute the enabled/disabled state of all the joints of the world
         void enableDisableJoints();
 
         /// Destroy a rigid body and all the joints which it belongs
         void destroyRigidBody(RigidBody* rigidBody);
 
+        /// Create a copy of a body (colliders, mass properties and settings) with a new transform
+        CollisionBody* cloneBody(CollisionBody* body, const Transform& transform);
+
         /// Create a joint between two bodies in the world and return a pointer to the new joint
         Joint* createJoint(const JointInfo& jointInfo);
 
         /// Destroy a joint
         void destroyJoint(Joint* joint);
 
+        /// Return the joint with a given entity id or nullptr if there is no such joint
+        Joint* getJoint(uint32 jointEntityId);
+
+        /// Create a kinematic character controller with a convex shape
+        CharacterController* createCharacterController(ConvexShape* shape, const Transform& transform,
+                                                 const CharacterControllerSettings& settings = CharacterControllerSettings());
+
+        /// Destroy a character controller and its body
+        void destroyCharacterController(CharacterController* controller);
+
+        /// Create a raycast vehicle with a dynamic chassis body
+        RaycastVehicle* createRaycastVehicle(RigidBody* chassisBody,
+                                             const RaycastVehicleSettings& settings = RaycastVehicleSettings());
+
+        /// Destroy a raycast vehicle (the chassis body is not destroyed)
+        void destroyRaycastVehicle(RaycastVehicle* vehicle);
+
+        /// Create a force field whose volume is a collider
+        ForceField* createForceField(Collider* volume, const ForceFieldSettings& settings = ForceFieldSettings());
+
+        /// Create a force field whose volume is a world-space AABB
+        ForceField* createForceField(const AABB& volume, const ForceFieldSettings& settings = ForceFieldSettings());
+
+        /// Destroy a force field
+        void destroyForceField(ForceField* field);
+
         /// Return the gravity vector of the world
         Vector3 getGravity() const;
 
@@ -483,6 +624,9 @@ class PhysicsWorld {
         friend class CollisionCallback::CallbackData;
         friend class OverlapCallback::CallbackData;
         friend class DebugRenderer;
+        friend class CharacterController;
+        friend class RaycastVehicle;
+        friend class ForceField;
 };
 
 // Set the collision dispatch configuration
@@ -509,6 +653,42 @@ RP3D_FORCE_INLINE void PhysicsWorld::raycast(const Ray& ray,
     mCollisionDetection.raycast(raycastCallback, ray, raycastWithCategoryMaskBits);
 }
 
+// Cast a convex shape along a translation and return true if a collider is hit
+/**
+ * The shape keeps the orientation of the transform during the whole cast and
+ * trigger colliders are ignored.
+ * @param shape Convex collision shape to cast
+ * @param transform Transform of the shape at the start of the cast
+ * @param translation Translation of the shape during the cast
+ * @param shapeCastInfo Information about the closest hit (only valid if the method returns true)
+ * @param collideWithMaskBits Bits mask corresponding to the category of
+ *                            colliders that can be hit
+ * @param ignoredBody Body whose colliders cannot be hit (can be null)
+ * @return True if a collider is hit during the cast
+ */
+RP3D_FORCE_INLINE bool PhysicsWorld::shapeCast(const ConvexShape* shape, const Transform& transform, const Vector3& translation,
+                                               ShapeCastInfo& shapeCastInfo, unsigned short collideWithMaskBits,
+                                               const CollisionBody* ignoredBody) const {
+    return mCollisionDetection.shapeCast(shape, transform, translation, shapeCastInfo, collideWithMaskBits, ignoredBody);
+}
+
+// Compute the translation that moves a convex shape out of its deepest overlapping collider
+/**
+ * Only the deepest penetration is resolved. Call this method again with the
+ * moved transform to resolve the other overlaps. Trigger colliders are ignored.
+ * @param shape Convex collision shape
+ * @param transform Transform of the shape
+ * @param[out] translation Translation that separates the shape from the deepest overlapping collider
+ * @param collideWithMaskBits Bits mask corresponding to the category of
+ *                            colliders that are tested
+ * @param ignoredBody Body whose colliders are not tested (can be null)
+ * @return True if the shape overlaps with a collider
+ */
+RP3D_FORCE_INLINE bool PhysicsWorld::computePenetration(const ConvexShape* shape, const Transform& transform, Vector3& translation,
+                                                        unsigned short collideWithMaskBits, const CollisionBody* ignoredBody) const {
+    return mCollisionDetection.computePenetration(shape, transform, translation, collideWithMaskBits, ignoredBody);
+}
+
 // Test collision and report contacts between two bodies.
 /// Use this method if you only want to get all the contacts between two bodies.
 /// All the contacts will be reported using the callback object in paramater.
@@ -571,6 +751,64 @@ RP3D_FORCE_INLINE void PhysicsWorld::testOverlap(OverlapCallback& overlapCallbac
     mCollisionDetection.testOverlap(overlapCallback);
 }
 
+// Report all the colliders that overlap with a convex shape at a given transform
+/// Use this method to query the world with a shape without creating a body. The colliders
+/// that overlap with the shape are added to the array. Triggers are ignored.
+/**
+ * @param shape Convex collision shape to test overlap with
+ * @param transform World-space transform of the shape
+ * @param colliders Array where the overlapping colliders are added
+ * @param collideWithMaskBits Bits mask corresponding to the category of
+ *                            colliders that can be reported
+ */
+RP3D_FORCE_INLINE void PhysicsWorld::testOverlap(const ConvexShape* shape, const Transform& transform, Array<Collider*>& colliders,
+                                                 unsigned short collideWithMaskBits) const {
+    mCollisionDetection.testOverlap(shape, transform, colliders, collideWithMaskBits);
+}
+
+// Compute the closest points between two colliders with convex shapes
+/// The distance between the colliders is the distance between the two points. This method
+/// uses the GJK algorithm and does not create any contact.
+/**
+ * @param collider1 Pointer to the first collider (its shape must be convex)
+ * @param collider2 Pointer to the second collider (its shape must be convex)
+ * @param worldPoint1 Closest point on the first collider in world-space
+ * @param worldPoint2 Closest point on the second collider in world-space
+ * @return False if the colliders overlap (the points are not computed) and true otherwise
+ */
+RP3D_FORCE_INLINE bool PhysicsWorld::computeClosestPoints(const Collider* collider1, const Collider* collider2,
+                                                          Vector3& worldPoint1, Vector3& worldPoint2) const {
+    return mCollisionDetection.computeClosestPoints(collider1, collider2, worldPoint1, worldPoint2);
+}
+
+// Report all the colliders whose AABB overlaps with a world-space AABB
+/// This is a coarse query on the broad-phase that does not run the narrow-phase.
+/// Trigger colliders are reported.
+/**
+ * @param aabb World-space AABB to query
+ * @param colliders Array where the colliders are added
+ * @param collideWithMaskBits Bits mask corresponding to the category of
+ *                            colliders that can be reported
+ */
+RP3D_FORCE_INLINE void PhysicsWorld::queryAABB(const AABB& aabb, Array<Collider*>& colliders, unsigned short collideWithMaskBits) const {
+    mCollisionDetection.queryAABB(aabb, colliders, collideWithMaskBits);
+}
+
+// Report all the colliders whose AABB overlaps with a world-space sphere
+/// This is a coarse query on the broad-phase that does not run the narrow-phase.
+/// Trigger colliders are reported.
+/**
+ * @param center World-space center of the sphere
+ * @param radius Radius of the sphere
+ * @param colliders Array where the colliders are added
+ * @param collideWithMaskBits Bits mask corresponding to the category of
+ *                            colliders that can be reported
+ */
+RP3D_FORCE_INLINE void PhysicsWorld::querySphere(const Vector3& center, decimal radius, Array<Collider*>& colliders,
+                                                 unsigned short collideWithMaskBits) const {
+    mCollisionDetection.querySphere(center, radius, colliders, collideWithMaskBits);
+}
+
 // Return a reference to the memory manager of the world
 RP3D_FORCE_INLINE MemoryManager& PhysicsWorld::getMemoryManager() {
     return mMemoryManager;
@@ -612,6 +850,22 @@ RP3D_FORCE_INLINE uint16 PhysicsWorld::getNbIterationsPositionSolver() const {
     return mNbPositionSolverIterations;
 }
 
+// Get the number of substeps of a simulation step
+/**
+ * @return The number of substeps of a simulation step
+ */
+RP3D_FORCE_INLINE uint16 PhysicsWorld::getNbSubsteps() const {
+    return mNbSubsteps;
+}
+
+// Return true if the joints connected in a tree are solved by the articulation solver
+/**
+ * @return True if the articulation solver is enabled
+ */
+RP3D_FORCE_INLINE bool PhysicsWorld::isArticulationSolverEnabled() const {
+    return mConstraintSolverSystem.isArticulationSolverActive();
+}
+
 // Set the position correction technique used for contacts
 /**
  * @param technique Technique used for the position correction (Baumgarte or Split Impulses)
@@ -0,0 +1,407 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_RAYCAST_VEHICLE_H
+#define REACTPHYSICS3D_RAYCAST_VEHICLE_H
+
+// Libraries
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/containers/Array.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class PhysicsWorld;
+class RigidBody;
+class Collider;
+class MemoryAllocator;
+
+// Structure RaycastVehicleSettings
+/**
+ * This structure contains the settings of a raycast vehicle.
+ */
+struct RaycastVehicleSettings {
+
+    /// Forward direction of the vehicle (in the local-space of the chassis body)
+    Vector3 forward = Vector3(0, 0, -1);
+
+    /// Up direction of the vehicle (in the local-space of the chassis body)
+    Vector3 up = Vector3(0, 1, 0);
+
+    /// Bits mask of the categories of colliders that the wheels can touch
+    unsigned short collideWithMaskBits = 0xFFFF;
+};
+
+// Structure WheelSettings
+/**
+ * This structure contains the settings of a wheel of a raycast vehicle.
+ * The suspension stiffness and damping are given per unit of mass of the chassis
+ * so that the same values can be used for light and heavy vehicles.
+ */
+struct WheelSettings {
+
+    /// Top point of the suspension (in the local-space of the chassis body)
+    Vector3 connectionPoint = Vector3(0, 0, 0);
+
+    /// Radius of the wheel
+    decimal radius = decimal(0.5);
+
+    /// Length of the suspension at rest
+    decimal suspensionRestLength = decimal(0.6);
+
+    /// Maximum compression of the suspension from its rest length
+    decimal maxSuspensionTravel = decimal(0.5);
+
+    /// Stiffness of the suspension spring (per unit of mass of the chassis)
+    decimal suspensionStiffness = decimal(20.0);
+
+    /// Damping of the suspension when it is compressed (per unit of mass of the chassis)
+    decimal dampingCompression = decimal(2.3);
+
+    /// Damping of the suspension when it is extended (per unit of mass of the chassis)
+    decimal dampingRelaxation = decimal(4.4);
+
+    /// Maximum force of the suspension
+    decimal maxSuspensionForce = decimal(6000.0);
+
+    /// Friction coefficient of the tire (the friction force is at most this coefficient times the suspension force)
+    decimal frictionSlip = decimal(1.5);
+
+    /// Factor of the roll torque of the tire forces (0 to apply them at the height of the center of mass)
+    decimal rollInfluence = decimal(0.1);
+};
+
+// Class RaycastVehicle
+/**
+ * This class represents a vehicle made of a dynamic chassis body and of wheels that are
+ * simulated with rays. At each update of the world (before the velocities are integrated),
+ * a ray is cast down from the top of the suspension of each wheel. If the wheel touches a
+ * collider, the suspension (spring and damper) and the tire forces (engine, brake and side
+ * friction limited by the friction slip) are applied to the chassis at the contact point.
+ * A sleeping chassis is only updated when an engine force is applied.
+ */
+class RaycastVehicle {
+
+    private :
+
+        // Structure Wheel
+        /**
+         * Settings and state of a wheel
+         */
+        struct Wheel {
+
+            /// Settings of the wheel
+            WheelSettings settings;
+
+            /// Steering angle (in radians)
+            decimal steering;
+
+            /// Engine force applied by the wheel
+            decimal engineForce;
+
+            /// Maximum brake force of the wheel
+            decimal brake;
+
+            /// Rotation angle of the wheel around its axle (in radians)
+            decimal rotation;
+
+            /// Rotation of the wheel during the last update (in radians)
+            decimal deltaRotation;
+
+            /// Current length of the suspension
+            decimal suspensionLength;
+
+            /// True if the wheel touches a collider
+            bool isInContact;
+
+            /// Contact point of the wheel (world-space)
+            Vector3 contactPoint;
+
+            /// Contact normal of the wheel (world-space)
+            Vector3 contactNormal;
+
+            /// Collider touched by the wheel (null if the wheel is not in contact)
+            Collider* groundCollider;
+
+            /// Suspension force applied during the last update
+            decimal suspensionForce;
+
+            /// Ratio between the applied and the requested tire force (1 if the tire does not skid)
+            decimal skidInfo;
+
+            /// Constructor
+            Wheel(const WheelSettings& wheelSettings);
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Reference to the physics world
+        PhysicsWorld& mWorld;
+
+        /// Dynamic body of the chassis
+        RigidBody* mBody;
+
+        /// Forward direction of the vehicle (local-space of the chassis)
+        Vector3 mForward;
+
+        /// Up direction of the vehicle (local-space of the chassis)
+        Vector3 mUp;
+
+        /// Right direction of the vehicle (local-space of the chassis)
+        Vector3 mRight;
+
+        /// Bits mask of the categories of colliders that the wheels can touch
+        unsigned short mCollideWithMaskBits;
+
+        /// Wheels of the vehicle
+        Array<Wheel> mWheels;
+
+        /// Speed of the chassis along its forward direction during the last update
+        decimal mCurrentSpeed;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        RaycastVehicle(PhysicsWorld& world, RigidBody* body, const RaycastVehicleSettings& settings, MemoryAllocator& allocator);
+
+        /// Destructor
+        ~RaycastVehicle() = default;
+
+        /// Compute the suspension, the tire forces and apply them to the chassis
+        void update(decimal timeStep);
+
+        /// Cast the suspension ray of a wheel and update its contact
+        void castWheel(Wheel& wheel, const Transform& chassisTransform, const Vector3& up);
+
+        /// Remove a collider that is destroyed from the ground of the wheels
+        void removeGroundCollider(const Collider* collider);
+
+        /// Return the effective mass of the chassis at a point along a direction
+        decimal computeEffectiveMass(const Vector3& relativePosition, const Vector3& direction) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Deleted copy-constructor
+        RaycastVehicle(const RaycastVehicle& vehicle) = delete;
+
+        /// Deleted assignment operator
+        RaycastVehicle& operator=(const RaycastVehicle& vehicle) = delete;
+
+        /// Return the chassis body of the vehicle
+        RigidBody* getBody();
+
+        /// Add a wheel to the vehicle and return its index
+        uint32 addWheel(const WheelSettings& settings);
+
+        /// Return the number of wheels
+        uint32 getNbWheels() const;
+
+        /// Return the settings of a wheel
+        const WheelSettings& getWheelSettings(uint32 wheelIndex) const;
+
+        /// Return the steering angle of a wheel (in radians)
+        decimal getSteering(uint32 wheelIndex) const;
+
+        /// Set the steering angle of a wheel (in radians)
+        void setSteering(uint32 wheelIndex, decimal steering);
+
+        /// Return the engine force of a wheel
+        decimal getEngineForce(uint32 wheelIndex) const;
+
+        /// Set the engine force of a wheel
+        void setEngineForce(uint32 wheelIndex, decimal engineForce);
+
+        /// Return the maximum brake force of a wheel
+        decimal getBrake(uint32 wheelIndex) const;
+
+        /// Set the maximum brake force of a wheel
+        void setBrake(uint32 wheelIndex, decimal brake);
+
+        /// Return the rotation angle of a wheel around its axle (in radians)
+        decimal getWheelRotation(uint32 wheelIndex) const;
+
+        /// Return the world-space transform of a wheel (center and orientation)
+        Transform getWheelTransform(uint32 wheelIndex) const;
+
+        /// Return true if a wheel touches a collider
+        bool isWheelInContact(uint32 wheelIndex) const;
+
+        /// Return the contact point of a wheel (only valid if the wheel is in contact)
+        const Vector3& getWheelContactPoint(uint32 wheelIndex) const;
+
+        /// Return the contact normal of a wheel (only valid if the wheel is in contact)
+        const Vector3& getWheelContactNormal(uint32 wheelIndex) const;
+
+        /// Return the collider touched by a wheel (null if the wheel is not in contact)
+        Collider* getWheelGroundCollider(uint32 wheelIndex) const;
+
+        /// Return the current length of the suspension of a wheel
+        decimal getSuspensionLength(uint32 wheelIndex) const;
+
+        /// Return the suspension force of a wheel during the last update
+        decimal getSuspensionForce(uint32 wheelIndex) const;
+
+        /// Return the ratio between the applied and the requested tire force of a wheel
+        decimal getSkidInfo(uint32 wheelIndex) const;
+
+        /// Return the speed of the chassis along its forward direction
+        decimal getCurrentSpeed() const;
+
+        /// Return the bits mask of the categories of colliders that the wheels can touch
+        unsigned short getCollideWithMaskBits() const;
+
+        /// Set the bits mask of the categories of colliders that the wheels can touch
+        void setCollideWithMaskBits(unsigned short collideWithMaskBits);
+
+        // -------------------- Friendship -------------------- //
+
+        friend class PhysicsWorld;
+};
+
+// Return the chassis body of the vehicle
+RP3D_FORCE_INLINE RigidBody* RaycastVehicle::getBody() {
+    return mBody;
+}
+
+// Return the number of wheels
+RP3D_FORCE_INLINE uint32 RaycastVehicle::getNbWheels() const {
+    return static_cast<uint32>(mWheels.size());
+}
+
+// Return the settings of a wheel
+RP3D_FORCE_INLINE const WheelSettings& RaycastVehicle::getWheelSettings(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].settings;
+}
+
+// Return the steering angle of a wheel (in radians)
+RP3D_FORCE_INLINE decimal RaycastVehicle::getSteering(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].steering;
+}
+
+// Set the steering angle of a wheel (in radians)
+RP3D_FORCE_INLINE void RaycastVehicle::setSteering(uint32 wheelIndex, decimal steering) {
+    assert(wheelIndex < mWheels.size());
+    mWheels[wheelIndex].steering = steering;
+}
+
+// Return the engine force of a wheel
+RP3D_FORCE_INLINE decimal RaycastVehicle::getEngineForce(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].engineForce;
+}
+
+// Set the engine force of a wheel
+/// A positive force moves the vehicle forward and a negative force moves it backward.
+RP3D_FORCE_INLINE void RaycastVehicle::setEngineForce(uint32 wheelIndex, decimal engineForce) {
+    assert(wheelIndex < mWheels.size());
+    mWheels[wheelIndex].engineForce = engineForce;
+}
+
+// Return the maximum brake force of a wheel
+RP3D_FORCE_INLINE decimal RaycastVehicle::getBrake(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].brake;
+}
+
+// Set the maximum brake force of a wheel
+RP3D_FORCE_INLINE void RaycastVehicle::setBrake(uint32 wheelIndex, decimal brake) {
+    assert(wheelIndex < mWheels.size());
+    assert(brake >= decimal(0.0));
+    mWheels[wheelIndex].brake = brake;
+}
+
+// Return the rotation angle of a wheel around its axle (in radians)
+RP3D_FORCE_INLINE decimal RaycastVehicle::getWheelRotation(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].rotation;
+}
+
+// Return true if a wheel touches a collider
+RP3D_FORCE_INLINE bool RaycastVehicle::isWheelInContact(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].isInContact;
+}
+
+// Return the contact point of a wheel (only valid if the wheel is in contact)
+RP3D_FORCE_INLINE const Vector3& RaycastVehicle::getWheelContactPoint(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].contactPoint;
+}
+
+// Return the contact normal of a wheel (only valid if the wheel is in contact)
+RP3D_FORCE_INLINE const Vector3& RaycastVehicle::getWheelContactNormal(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].contactNormal;
+}
+
+// Return the collider touched by a wheel (null if the wheel is not in contact)
+RP3D_FORCE_INLINE Collider* RaycastVehicle::getWheelGroundCollider(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].groundCollider;
+}
+
+// Return the current length of the suspension of a wheel
+RP3D_FORCE_INLINE decimal RaycastVehicle::getSuspensionLength(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].suspensionLength;
+}
+
+// Return the suspension force of a wheel during the last update
+RP3D_FORCE_INLINE decimal RaycastVehicle::getSuspensionForce(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].suspensionForce;
+}
+
+// Return the ratio between the applied and the requested tire force of a wheel
+/// The value is 1 if the tire does not skid and smaller than 1 if the tire force is
+/// limited by the friction slip.
+RP3D_FORCE_INLINE decimal RaycastVehicle::getSkidInfo(uint32 wheelIndex) const {
+    assert(wheelIndex < mWheels.size());
+    return mWheels[wheelIndex].skidInfo;
+}
+
+// Return the speed of the chassis along its forward direction
+RP3D_FORCE_INLINE decimal RaycastVehicle::getCurrentSpeed() const {
+    return mCurrentSpeed;
+}
+
+// Return the bits mask of the categories of colliders that the wheels can touch
+RP3D_FORCE_INLINE unsigned short RaycastVehicle::getCollideWithMaskBits() const {
+    return mCollideWithMaskBits;
+}
+
+// Set the bits mask of the categories of colliders that the wheels can touch
+RP3D_FORCE_INLINE void RaycastVehicle::setCollideWithMaskBits(unsigned short collideWithMaskBits) {
+    mCollideWithMaskBits = collideWithMaskBits;
+}
+
+}
+
+#endif
@@ -54,6 +54,10 @@
 #include <reactphysics3d/collision/shapes/AABB.h>
 #include <reactphysics3d/collision/Collider.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/collision/ShapeCastInfo.h>
+#include <reactphysics3d/engine/CharacterController.h>
+#include <reactphysics3d/engine/RaycastVehicle.h>
+#include <reactphysics3d/engine/ForceField.h>
 #include <reactphysics3d/collision/TriangleMesh.h>
 #include <reactphysics3d/collision/PolyhedronMesh.h>
 #include <reactphysics3d/collision/TriangleVertexArray.h>
@@ -65,6 +69,8 @@
 #include <reactphysics3d/constraint/HingeJoint.h>
 #include <reactphysics3d/constraint/FixedJoint.h>
 #include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/utils/QuickHull.h>
+#include <reactphysics3d/utils/ConvexDecomposition.h>
 
 /// Alias to the ReactPhysics3D namespace
 namespace rp3d = reactphysics3d;
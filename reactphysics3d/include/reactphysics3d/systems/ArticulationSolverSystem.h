@@ -0,0 +1,243 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef REACTPHYSICS3D_ARTICULATION_SOLVER_SYSTEM_H
+#define REACTPHYSICS3D_ARTICULATION_SOLVER_SYSTEM_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+namespace reactphysics3d {
+
+// Declarations
+class MemoryManager;
+class RigidBodyComponents;
+class BallAndSocketJointComponents;
+class HingeJointComponents;
+struct JointColoring;
+
+// Class ArticulationSolverSystem
+/**
+ * This class solves exactly the velocity constraints of the ball-and-socket and hinge joints
+ * that connect bodies in a tree (ropes, chains, ragdolls, ...). Such a group of joints is
+ * called an articulation. Instead of iterating over the joints like the Sequential Impulse
+ * solver, the linear system of the articulation is solved directly in linear time with the
+ * method described by David Baraff in "Linear-Time Dynamics using Lagrange Multipliers"
+ * (SIGGRAPH 1996).
+ *
+ * The bodies and the joints of an articulation are the nodes of a tree and the matrix
+ * H = [M J^T ; J 0] of the system is sparse with the same structure. Its LDL^T factorization
+ * is computed once per step by eliminating the nodes from the leaves to the root (without
+ * any fill-in). Then, each velocity iteration only needs one forward and one backward
+ * substitution to compute the impulses of all the joints of the articulation.
+ *
+ * A group of joints is an articulation if its dynamic bodies are connected without any loop,
+ * if at most one of its joints is attached to a static or kinematic body and if its bodies
+ * have no locked axis. The other joints are solved by the iterative solver. The limits and
+ * the motors of the articulated joints are also solved by the iterative solver.
+ */
+class ArticulationSolverSystem {
+
+    private :
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of rows of a node of the tree (the six degrees of freedom of a body)
+        static const uint32 MAX_NODE_DIMENSION = 6;
+
+        // Structure ArticulationNode
+        /**
+         * A node of the tree of an articulation (a body or a joint)
+         */
+        struct ArticulationNode {
+
+            /// Diagonal block D of the LDL^T factorization
+            decimal D[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION];
+
+            /// Inverse of the diagonal block D
+            decimal inverseD[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION];
+
+            /// Block L = D^-1 * H(node, parent) of the factorization
+            decimal L[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION];
+
+            /// For a joint node, Jacobian of the constraints for the body 1 and the body 2 (linear and angular parts)
+            decimal jacobianBody1[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION];
+            decimal jacobianBody2[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION];
+
+            /// Right-hand side and solution of the system for this node
+            decimal x[MAX_NODE_DIMENSION];
+
+            /// Number of rows of the node (6 for a body, 3 for a ball-and-socket joint, 5 for a hinge joint)
+            uint32 dimension;
+
+            /// Index of the parent node (-1 for the root of the tree)
+            int32 parentIndex;
+
+            /// True if the node is a body and false if it is a joint
+            bool isBody;
+
+            /// True if the node is a hinge joint and false if it is a ball-and-socket joint
+            bool isHingeJoint;
+
+            /// Index of the body in the rigid body components or index of the joint in the joint components of its type
+            uint32 componentIndex;
+
+            /// For a joint node, index of the rigid body components of the body 1 and the body 2
+            uint32 rigidBodyComponentIndexBody1;
+            uint32 rigidBodyComponentIndexBody2;
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory manager
+        MemoryManager& mMemoryManager;
+
+        /// Reference to the rigid body components
+        RigidBodyComponents& mRigidBodyComponents;
+
+        /// Reference to the ball-and-socket joint components
+        BallAndSocketJointComponents& mBallAndSocketJointComponents;
+
+        /// Reference to the hinge joint components
+        HingeJointComponents& mHingeJointComponents;
+
+        /// Nodes of all the articulations (the nodes of an articulation are stored contiguously
+        /// and each parent is stored before its children)
+        ArticulationNode* mNodes;
+
+        /// Number of nodes
+        uint32 mNbNodes;
+
+        /// Number of allocated nodes
+        uint32 mNbAllocatedNodes;
+
+        /// For each articulation, index of its first node
+        uint32* mArticulationsStartIndex;
+
+        /// Number of articulations
+        uint32 mNbArticulations;
+
+        /// For each enabled ball-and-socket joint component, true if the joint is solved by this solver
+        bool* mIsBallAndSocketJointArticulated;
+
+        /// For each enabled hinge joint component, true if the joint is solved by this solver
+        bool* mIsHingeJointArticulated;
+
+        /// Number of enabled ball-and-socket and hinge joint components
+        uint32 mNbJoints;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Pointer to the profiler
+        Profiler* mProfiler;
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Return true if a body can be part of an articulation
+        bool isBodyArticulable(uint32 rigidBodyComponentIndex) const;
+
+        /// Compute the Jacobian of the constraints of a joint node
+        void computeJacobians(ArticulationNode& node) const;
+
+        /// Compute the block H(node, parent) of the matrix of the system
+        void computeParentBlock(const ArticulationNode& node, const ArticulationNode& parent,
+                                decimal block[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION]) const;
+
+        /// Compute the LDL^T factorization of an articulation and return false if it is singular
+        bool factorize(uint32 startIndex, uint32 endIndex);
+
+        /// Mark the joints of an articulation as solved (or not) by this solver
+        void setJointsArticulated(uint32 startIndex, uint32 endIndex, bool isArticulated);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ArticulationSolverSystem(MemoryManager& memoryManager, RigidBodyComponents& rigidBodyComponents,
+                                 BallAndSocketJointComponents& ballAndSocketJointComponents,
+                                 HingeJointComponents& hingeJointComponents);
+
+        /// Destructor
+        ~ArticulationSolverSystem() = default;
+
+        /// Find the articulations and factorize their systems
+        void initialize(const JointColoring& ballAndSocketJointColoring, const JointColoring& hingeJointColoring);
+
+        /// Solve the velocity constraints of the articulated joints
+        void solveVelocityConstraints();
+
+        /// Release the memory allocated for the articulations (no joint is articulated)
+        void reset();
+
+        /// Return the array that tells if each enabled ball-and-socket joint is articulated (or null)
+        const bool* getArticulatedBallAndSocketJoints() const;
+
+        /// Return the array that tells if each enabled hinge joint is articulated (or null)
+        const bool* getArticulatedHingeJoints() const;
+
+        /// Return the number of articulations
+        uint32 getNbArticulations() const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Set the profiler
+        void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+// Return the array that tells if each enabled ball-and-socket joint is articulated (or null)
+RP3D_FORCE_INLINE const bool* ArticulationSolverSystem::getArticulatedBallAndSocketJoints() const {
+    return mIsBallAndSocketJointArticulated;
+}
+
+// Return the array that tells if each enabled hinge joint is articulated (or null)
+RP3D_FORCE_INLINE const bool* ArticulationSolverSystem::getArticulatedHingeJoints() const {
+    return mIsHingeJointArticulated;
+}
+
+// Return the number of articulations
+RP3D_FORCE_INLINE uint32 ArticulationSolverSystem::getNbArticulations() const {
+    return mNbArticulations;
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void ArticulationSolverSystem::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
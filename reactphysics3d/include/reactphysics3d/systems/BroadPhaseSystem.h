@@ -95,6 +95,52 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
         // Called for a broad-phase shape that has to be tested for raycast
         virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
 
+        // Raycast against the colliders in the compound tree of a body
+        decimal raycastCompound(CollisionBody* body, const Ray& ray);
+
+};
+
+// Class CompoundRaycastCallback
+/**
+ * Callback called when the AABB of a collider in the compound tree
+ * of a body is hit by a ray.
+ */
+class CompoundRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+    private :
+
+        const DynamicAABBTree& mCompoundTree;
+
+        /// Ray in world-space
+        const Ray& mWorldRay;
+
+        unsigned short mRaycastWithCategoryMaskBits;
+
+        RaycastTest& mRaycastTest;
+
+        /// Hit fraction to report to the broad-phase (negative if no collider has been hit)
+        decimal mHitFraction;
+
+    public:
+
+        // Constructor
+        CompoundRaycastCallback(const DynamicAABBTree& compoundTree, const Ray& worldRay,
+                                unsigned short raycastWithCategoryMaskBits, RaycastTest& raycastTest)
+            : mCompoundTree(compoundTree), mWorldRay(worldRay), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
+              mRaycastTest(raycastTest), mHitFraction(decimal(-1.0)) {
+
+        }
+
+        // Destructor
+        virtual ~CompoundRaycastCallback() override = default;
+
+        // Called for a collider of the compound tree that has to be tested for raycast
+        virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
+
+        // Return the hit fraction to report to the broad-phase
+        decimal getHitFraction() const {
+            return mHitFraction;
+        }
 };
 
 // Class BroadPhaseSystem
@@ -198,6 +244,9 @@ class BroadPhaseSystem {
         /// Ray casting method
         void raycast(const Ray& ray, RaycastTest& raycastTest, unsigned short raycastWithCategoryMaskBits) const;
 
+        /// Report the broad-phase ids of all the shapes overlapping with the AABB in parameter
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -225,6 +274,11 @@ RP3D_FORCE_INLINE Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int bro
     return static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(broadPhaseId));
 }
 
+// Report the broad-phase ids of all the shapes overlapping with the AABB in parameter
+RP3D_FORCE_INLINE void BroadPhaseSystem::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes) const {
+    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
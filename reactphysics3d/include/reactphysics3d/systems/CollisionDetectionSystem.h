@@ -57,6 +57,8 @@ class ContactPoint;
 class MemoryManager;
 class EventListener;
 class CollisionDispatch;
+class ConvexShape;
+struct ShapeCastInfo;
 
 // Class CollisionDetectionSystem
 /**
@@ -132,6 +134,24 @@ class CollisionDetectionSystem {
         /// Array of lost contact pairs (contact pairs in contact in previous frame but not in the current one)
         Array<ContactPair> mLostContactPairs;
 
+        /// Map a trigger collider entity to the entities of the colliders inside the trigger
+        /// (updated with the OverlapStart and OverlapExit events of each update)
+        Map<Entity, Set<Entity>> mTriggerOccupants;
+
+        /// Map a collider entity to the entities of the triggers that the collider is inside
+        Map<Entity, Set<Entity>> mOccupiedTriggers;
+
+        /// Colliders whose overlapping pairs have been removed without OverlapExit event since the last
+        /// update (their triggers are computed again with the trigger contact pairs of the next update)
+        Set<Entity> mCollidersToUpdateInTriggers;
+
+        /// Colliders whose overlapping pairs have been removed between the narrow-phase and the report of
+        /// the triggers (their pairs are created again in the next frame so they are also updated in the next update)
+        Set<Entity> mCollidersToUpdateInNextTriggers;
+
+        /// True between the narrow-phase and the report of the contacts and triggers of an update
+        bool mIsReportPending;
+
         /// Pointer to the map of overlappingPairId to the index of contact pair of the previous frame
         /// (either mMapPairIdToContactPairIndex1 or mMapPairIdToContactPairIndex2)
         Map<uint64, uint> mPreviousMapPairIdToContactPairIndex;
@@ -223,6 +243,32 @@ class CollisionDetectionSystem {
         void computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator,
                                                NarrowPhaseInput& narrowPhaseInput, bool reportContacts);
 
+        /// Compute the concave vs convex middle-phase algorithm for two given colliders of an overlapping pair
+        void computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, Entity collider1, Entity collider2,
+                                               bool isShape1Convex, NarrowPhaseAlgorithmType algorithmType, MemoryAllocator& allocator,
+                                               NarrowPhaseInput& narrowPhaseInput, bool reportContacts);
+
+        /// Compute the middle-phase for an overlapping pair involving the proxy of a compound body
+        void computeCompoundMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator,
+                                        NarrowPhaseInput& narrowPhaseInput, bool reportContacts);
+
+        /// Add the colliders of a compound tree overlapping a world-space AABB (or the collider itself if not compound)
+        void computeCompoundOverlappingColliders(uint32 colliderIndex, const AABB& worldAABB, Array<Entity>& colliders,
+                                                 Array<int32>& overlappingNodes) const;
+
+        /// Compute the colliders whose broad-phase AABB overlaps with a world-space AABB for a query
+        void computeQueryColliders(const AABB& worldAABB, unsigned short collideWithMaskBits, bool reportTriggers,
+                                   Array<Entity>& colliders, const CollisionBody* ignoredBody = nullptr) const;
+
+        /// Return true if an overlapping pair involves the proxy of a compound body
+        bool isCompoundPair(const OverlappingPairs::OverlappingPair& overlappingPair) const;
+
+        /// Compute the id of the contact pair between two colliders of a compound overlapping pair
+        static uint64 computeCompoundContactPairId(Entity collider1Entity, Entity collider2Entity);
+
+        /// Return true if a contact pair id is the id of a contact pair between two colliders of a compound overlapping pair
+        static bool isCompoundContactPairId(uint64 contactPairId);
+
         /// Swap the previous and current contacts arrays
         void swapPreviousAndCurrentContacts();
 
@@ -269,6 +315,18 @@ class CollisionDetectionSystem {
         void reportContacts(CollisionCallback& callback, Array<ContactPair>* contactPairs,
                             Array<ContactManifold>* manifolds, Array<ContactPoint>* contactPoints, Array<ContactPair>& lostContactPairs);
 
+        /// Update the colliders inside the triggers with the trigger contact pairs that start or are lost
+        void updateTriggerOccupants();
+
+        /// Remove the triggers of a collider that are not in the trigger contact pairs of the current frame
+        void removeLostTriggerOccupants(Entity colliderEntity, const Set<Pair<Entity, Entity>>& currentTriggerPairs);
+
+        /// Add a collider to the colliders inside a trigger
+        void addTriggerOccupant(Entity triggerColliderEntity, Entity colliderEntity);
+
+        /// Remove a collider from the colliders inside a trigger
+        void removeTriggerOccupant(Entity triggerColliderEntity, Entity colliderEntity);
+
         /// Report all triggers
         void reportTriggers(EventListener& eventListener, Array<ContactPair>* contactPairs, Array<ContactPair>& lostContactPairs);
 
@@ -349,6 +407,39 @@ class CollisionDetectionSystem {
         void raycast(RaycastCallback* raycastCallback, const Ray& ray,
                      unsigned short raycastWithCategoryMaskBits) const;
 
+        /// Cast a convex shape along a translation and report the first collider hit
+        bool shapeCast(const ConvexShape* shape, const Transform& transform, const Vector3& translation,
+                       ShapeCastInfo& shapeCastInfo, unsigned short collideWithMaskBits,
+                       const CollisionBody* ignoredBody) const;
+
+        /// Compute the translation that moves a convex shape out of its deepest overlapping collider
+        bool computePenetration(const ConvexShape* shape, const Transform& transform, Vector3& translation,
+                                unsigned short collideWithMaskBits, const CollisionBody* ignoredBody) const;
+
+        /// Report all the colliders that overlap with a convex shape at a given transform
+        void testOverlap(const ConvexShape* shape, const Transform& transform, Array<Collider*>& colliders,
+                         unsigned short collideWithMaskBits) const;
+
+        /// Compute the closest points between two colliders with convex shapes
+        bool computeClosestPoints(const Collider* collider1, const Collider* collider2,
+                                  Vector3& worldPoint1, Vector3& worldPoint2) const;
+
+        /// Report all the colliders whose AABB overlaps with a world-space AABB
+        void queryAABB(const AABB& aabb, Array<Collider*>& colliders, unsigned short collideWithMaskBits) const;
+
+        /// Report all the colliders whose AABB overlaps with a world-space sphere
+        void querySphere(const Vector3& center, decimal radius, Array<Collider*>& colliders,
+                         unsigned short collideWithMaskBits) const;
+
+        /// Report the colliders that overlap with a trigger collider in the last update
+        uint32 getTriggerOccupants(Entity triggerColliderEntity, Array<Collider*>* occupants) const;
+
+        /// Remove a collider from the triggers and remove the colliders inside it
+        void removeColliderFromTriggers(Entity colliderEntity);
+
+        /// Ask for the triggers of a collider to be computed again at the next update
+        void askForTriggersUpdate(Entity colliderEntity);
+
         /// Return true if two bodies (collide) overlap
         bool testOverlap(CollisionBody* body1, CollisionBody* body2);
 
@@ -392,6 +483,7 @@ class CollisionDetectionSystem {
         friend class ConvexMeshShape;
         friend class RigidBody;
         friend class DebugRenderer;
+        friend class ForceField;
 };
 
 // Return a reference to the collision dispatch configuration
@@ -428,6 +520,24 @@ RP3D_FORCE_INLINE void CollisionDetectionSystem::askForBroadPhaseCollisionCheck(
     }
 }
 
+// Return true if an overlapping pair involves the proxy of a compound body
+RP3D_FORCE_INLINE bool CollisionDetectionSystem::isCompoundPair(const OverlappingPairs::OverlappingPair& overlappingPair) const {
+    return mCollidersComponents.getCompoundId(overlappingPair.collider1) != -1 ||
+           mCollidersComponents.getCompoundId(overlappingPair.collider2) != -1;
+}
+
+// Compute the id of the contact pair between two colliders of a compound overlapping pair
+RP3D_FORCE_INLINE uint64 CollisionDetectionSystem::computeCompoundContactPairId(Entity collider1Entity, Entity collider2Entity) {
+
+    // The highest bit is set so that the id cannot be the id of an overlapping pair
+    return (uint64(1) << 63) | (static_cast<uint64>(collider1Entity.id & 0x7FFFFFFF) << 32) | static_cast<uint64>(collider2Entity.id);
+}
+
+// Return true if a contact pair id is the id of a contact pair between two colliders of a compound overlapping pair
+RP3D_FORCE_INLINE bool CollisionDetectionSystem::isCompoundContactPairId(uint64 contactPairId) {
+    return (contactPairId >> 63) != 0;
+}
+
 // Return a pointer to the world
 RP3D_FORCE_INLINE PhysicsWorld* CollisionDetectionSystem::getWorld() {
     return mWorld;
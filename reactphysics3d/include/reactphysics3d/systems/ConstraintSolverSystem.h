@@ -33,6 +33,7 @@
 #include <reactphysics3d/systems/SolveFixedJointSystem.h>
 #include <reactphysics3d/systems/SolveHingeJointSystem.h>
 #include <reactphysics3d/systems/SolveSliderJointSystem.h>
+#include <reactphysics3d/systems/ArticulationSolverSystem.h>
 
 namespace reactphysics3d {
 
@@ -44,6 +45,7 @@ class Profiler;
 class RigidBodyComponents;
 class JointComponents;
 class DynamicsComponents;
+class MemoryManager;
 
 // Structure ConstraintSolverData
 /**
@@ -155,6 +157,9 @@ class ConstraintSolverSystem {
         /// True if the warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// True if the ball-and-socket and hinge joints connected in a tree are solved by the articulation solver
+        bool mIsArticulationSolverActive;
+
         /// Reference to the islands
         Islands& mIslands;
 
@@ -173,6 +178,9 @@ class ConstraintSolverSystem {
         /// Solver for the SliderJoint constraints
         SolveSliderJointSystem mSolveSliderJointSystem;
 
+        /// Direct solver for the articulated BallAndSocketJoint and HingeJoint constraints
+        ArticulationSolverSystem mArticulationSolverSystem;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -184,7 +192,7 @@ class ConstraintSolverSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+        ConstraintSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                TransformComponents& transformComponents,
                                JointComponents& jointComponents,
                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -197,12 +205,27 @@ class ConstraintSolverSystem {
         /// Initialize the constraint solver
         void initialize(decimal dt);
 
+        /// Apply the impulses of the previous substep to the bodies again
+        void warmStart();
+
         /// Solve the constraints
         void solveVelocityConstraints();
 
         /// Solve the position constraints
         void solvePositionConstraints();
 
+        /// Release the memory allocated to solve the constraints
+        void reset();
+
+        /// Add the enabled joints whose force or torque exceeds their break threshold into an array
+        void findBrokenJoints(Array<Entity>& brokenJoints) const;
+
+        /// Return true if the articulation solver is active
+        bool isArticulationSolverActive() const;
+
+        /// Set to true to solve the joints connected in a tree with the articulation solver
+        void setIsArticulationSolverActive(bool isActive);
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -224,10 +247,21 @@ RP3D_FORCE_INLINE void ConstraintSolverSystem::setProfiler(Profiler* profiler) {
     mSolveFixedJointSystem.setProfiler(profiler);
     mSolveHingeJointSystem.setProfiler(profiler);
     mSolveSliderJointSystem.setProfiler(profiler);
+    mArticulationSolverSystem.setProfiler(profiler);
 }
 
 #endif
 
+// Return true if the articulation solver is active
+RP3D_FORCE_INLINE bool ConstraintSolverSystem::isArticulationSolverActive() const {
+    return mIsArticulationSolverActive;
+}
+
+// Set to true to solve the joints connected in a tree with the articulation solver
+RP3D_FORCE_INLINE void ConstraintSolverSystem::setIsArticulationSolverActive(bool isActive) {
+    mIsArticulationSolverActive = isActive;
+}
+
 }
 
 #endif
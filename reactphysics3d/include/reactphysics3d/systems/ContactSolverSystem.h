@@ -120,6 +120,17 @@ class ColliderComponents;
  * constraints at the center of the contact manifold, we need two constraints for tangential
  * friction but also another twist friction constraint to prevent spin of the body around the
  * contact manifold center.
+ *
+ * The contact manifolds are solved in batches. The manifolds are first colored so that two
+ * manifolds of the same color never share a dynamic body (while keeping the solving order of
+ * the manifolds that share a body). The manifolds of a color are then grouped into batches of
+ * NB_BATCH_LANES manifolds whose data is stored as structures of arrays (one lane per manifold).
+ * The velocities of the bodies of a batch are gathered at the beginning of the batch and
+ * scattered back at the end so that the lanes can be solved together without dependencies
+ * between them (the compiler can vectorize the loops over the lanes).
+ * There are no SIMD intrinsics: the lane loops are plain C++ so that the same code is used for
+ * every platform (including HTML5 without SIMD). The scalar build is the reference target and
+ * must not be slower than solving the manifolds one by one.
  */
 class ContactSolverSystem {
 
@@ -147,6 +158,9 @@ class ContactSolverSystem {
             /// Penetration depth
             decimal penetrationDepth;
 
+            /// Separation of the two contact points along the normal when the solver is initialized
+            decimal separation;
+
             /// Velocity restitution bias
             decimal restitutionBias;
 
@@ -185,6 +199,12 @@ class ContactSolverSystem {
             /// Index of body 2 in the dynamics components arrays
             uint32 rigidBodyComponentIndexBody2;
 
+            /// Index of collider 1 in the colliders components arrays
+            uint32 colliderComponentIndex1;
+
+            /// Index of collider 2 in the colliders components arrays
+            uint32 colliderComponentIndex2;
+
             /// Inverse of the mass of body 1
             decimal massInverseBody1;
 
@@ -271,10 +291,180 @@ class ContactSolverSystem {
             /// Twist friction impulse at contact manifold center
             decimal frictionTwistImpulse;
 
+            /// Index of the first contact point of the manifold in the contact points array
+            uint32 contactPointsIndex;
+
             /// Number of contact points
             int8 nbContacts;
         };
 
+        /// Number of contact manifolds solved together in a batch
+        static const uint32 NB_BATCH_LANES = 4;
+
+        // Structure Vector3Lanes
+        /**
+         * Vectors of the lanes of a batch stored as a structure of arrays
+         */
+        struct Vector3Lanes {
+
+            /// X components
+            decimal x[NB_BATCH_LANES];
+
+            /// Y components
+            decimal y[NB_BATCH_LANES];
+
+            /// Z components
+            decimal z[NB_BATCH_LANES];
+        };
+
+        // Structure Matrix3x3Lanes
+        /**
+         * 3x3 matrices of the lanes of a batch stored as a structure of arrays
+         */
+        struct Matrix3x3Lanes {
+
+            /// Values of the matrices (row, column, lane)
+            decimal m[3][3][NB_BATCH_LANES];
+        };
+
+        // Structure ContactPointBatch
+        /**
+         * Contact solver internal data structure to store the contact points at the
+         * same index in the contact manifolds of a batch. The lanes of the manifolds
+         * that do not have that many contact points have a zero inverse mass so that
+         * they do not apply any impulse.
+         */
+        struct ContactPointBatch {
+
+            /// Normal vectors of the contacts
+            Vector3Lanes normal;
+
+            /// Vectors from the body 1 center to the contact points
+            Vector3Lanes r1;
+
+            /// Vectors from the body 2 center to the contact points
+            Vector3Lanes r2;
+
+            /// Cross products of r1 with the contact normals
+            Vector3Lanes i1TimesR1CrossN;
+
+            /// Cross products of r2 with the contact normals
+            Vector3Lanes i2TimesR2CrossN;
+
+            /// Penetration depth position correction biases
+            decimal biasPenetrationDepth[NB_BATCH_LANES];
+
+            /// Velocity restitution biases
+            decimal restitutionBias[NB_BATCH_LANES];
+
+            /// Inverse of the matrix K for the penetration
+            decimal inversePenetrationMass[NB_BATCH_LANES];
+
+            /// Accumulated normal impulses
+            decimal penetrationImpulse[NB_BATCH_LANES];
+
+            /// Accumulated split impulses for penetration correction
+            decimal penetrationSplitImpulse[NB_BATCH_LANES];
+        };
+
+        // Structure ContactManifoldBatch
+        /**
+         * Contact solver internal data structure to store a batch of contact
+         * manifolds that do not share any dynamic body.
+         */
+        struct ContactManifoldBatch {
+
+            /// Indices of the contact manifolds of the lanes in the contact constraints array
+            uint32 contactConstraintIndices[NB_BATCH_LANES];
+
+            /// Indices of body 1 in the dynamics components arrays
+            uint32 rigidBodyComponentIndexBody1[NB_BATCH_LANES];
+
+            /// Indices of body 2 in the dynamics components arrays
+            uint32 rigidBodyComponentIndexBody2[NB_BATCH_LANES];
+
+            /// Number of used lanes
+            uint32 nbLanes;
+
+            /// Index of the first contact point batch in the contact point batches array
+            uint32 contactPointBatchesIndex;
+
+            /// Number of contact point batches (maximum number of contact points of the manifolds)
+            uint32 nbContactPointBatches;
+
+            /// Inverses of the mass of body 1
+            decimal massInverseBody1[NB_BATCH_LANES];
+
+            /// Inverses of the mass of body 2
+            decimal massInverseBody2[NB_BATCH_LANES];
+
+            /// Linear lock axis factors of body 1
+            Vector3Lanes linearLockAxisFactorBody1;
+
+            /// Linear lock axis factors of body 2
+            Vector3Lanes linearLockAxisFactorBody2;
+
+            /// Angular lock axis factors of body 1
+            Vector3Lanes angularLockAxisFactorBody1;
+
+            /// Angular lock axis factors of body 2
+            Vector3Lanes angularLockAxisFactorBody2;
+
+            /// Inverse inertia tensors of body 1
+            Matrix3x3Lanes inverseInertiaTensorBody1;
+
+            /// Inverse inertia tensors of body 2
+            Matrix3x3Lanes inverseInertiaTensorBody2;
+
+            /// Mix friction coefficients
+            decimal frictionCoefficient[NB_BATCH_LANES];
+
+            /// Average normal vectors of the contact manifolds
+            Vector3Lanes normal;
+
+            /// R1 vectors for the friction constraints
+            Vector3Lanes r1Friction;
+
+            /// R2 vectors for the friction constraints
+            Vector3Lanes r2Friction;
+
+            /// Cross products of r1 with 1st friction vector
+            Vector3Lanes r1CrossT1;
+
+            /// Cross products of r1 with 2nd friction vector
+            Vector3Lanes r1CrossT2;
+
+            /// Cross products of r2 with 1st friction vector
+            Vector3Lanes r2CrossT1;
+
+            /// Cross products of r2 with 2nd friction vector
+            Vector3Lanes r2CrossT2;
+
+            /// First friction directions at contact manifold centers
+            Vector3Lanes frictionVector1;
+
+            /// Second friction directions at contact manifold centers
+            Vector3Lanes frictionVector2;
+
+            /// Matrix K for the first friction constraints
+            decimal inverseFriction1Mass[NB_BATCH_LANES];
+
+            /// Matrix K for the second friction constraints
+            decimal inverseFriction2Mass[NB_BATCH_LANES];
+
+            /// Matrix K for the twist friction constraints
+            decimal inverseTwistFrictionMass[NB_BATCH_LANES];
+
+            /// First friction direction impulses at manifold centers
+            decimal friction1Impulse[NB_BATCH_LANES];
+
+            /// Second friction direction impulses at manifold centers
+            decimal friction2Impulse[NB_BATCH_LANES];
+
+            /// Twist friction impulses at contact manifold centers
+            decimal frictionTwistImpulse[NB_BATCH_LANES];
+        };
+
         // -------------------- Constants --------------------- //
 
         /// Beta value for the penetration depth position correction without split impulses
@@ -312,6 +502,18 @@ class ContactSolverSystem {
         /// Number of contact constraints
         uint32 mNbContactManifolds;
 
+        /// Batches of contact manifolds
+        ContactManifoldBatch* mContactManifoldBatches;
+
+        /// Batches of contact points
+        ContactPointBatch* mContactPointBatches;
+
+        /// Number of batches of contact manifolds
+        uint32 mNbContactManifoldBatches;
+
+        /// Number of batches of contact points
+        uint32 mNbContactPointBatches;
+
         /// Reference to the islands
         Islands& mIslands;
 
@@ -357,6 +559,18 @@ class ContactSolverSystem {
         /// Warm start the solver.
         void warmStart();
 
+        /// Color the contact manifolds and group them into batches
+        void createBatches();
+
+        /// Initialize a lane of a batch with a contact manifold
+        void initializeBatchLane(ContactManifoldBatch& batch, uint32 lane, uint32 contactConstraintIndex);
+
+        /// Compute the velocity bias of the penetration constraint of a contact point
+        decimal computeBiasPenetrationDepth(decimal penetrationDepth) const;
+
+        /// Copy the impulses of the batches back into the contact constraints
+        void storeBatchesImpulses();
+
    public:
 
         // -------------------- Methods -------------------- //
@@ -379,11 +593,14 @@ class ContactSolverSystem {
         void storeImpulses();
 
         /// Solve the contacts
-        void solve();
+        void solve(bool useBias = true);
 
         /// Release allocated memory
         void reset();
 
+        /// Update the penetration depths and warm start the solver at the beginning of a substep
+        void initializeSubstep();
+
         /// Return true if the split impulses position correction technique is used for contacts
         bool isSplitImpulseActive() const;
 
@@ -425,6 +642,15 @@ RP3D_FORCE_INLINE decimal ContactSolverSystem::computeMixedFrictionCoefficient(c
     return material1.getFrictionCoefficientSqrt() * material2.getFrictionCoefficientSqrt();
 }
 
+// Compute the velocity bias of the penetration constraint of a contact point
+RP3D_FORCE_INLINE decimal ContactSolverSystem::computeBiasPenetrationDepth(decimal penetrationDepth) const {
+
+    if (penetrationDepth <= SLOP) return decimal(0.0);
+
+    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+    return -(beta/mTimeStep) * std::max(0.0f, float(penetrationDepth - SLOP));
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
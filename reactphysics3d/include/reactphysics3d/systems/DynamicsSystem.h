@@ -106,9 +106,6 @@ class DynamicsSystem {
         /// Reset the external force and torque applied to the bodies
         void resetBodiesForceAndTorque();
 
-        /// Reset the split velocities of the bodies
-        void resetSplitVelocities();
-
 };
 
 #ifdef IS_RP3D_PROFILING_ENABLED
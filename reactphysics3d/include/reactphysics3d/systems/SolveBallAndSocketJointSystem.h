@@ -32,11 +32,13 @@
 #include <reactphysics3d/components/JointComponents.h>
 #include <reactphysics3d/components/BallAndSocketJointComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
+#include <reactphysics3d/engine/JointColoring.h>
 
 namespace reactphysics3d {
 
 // Forward declarations
 class PhysicsWorld;
+class MemoryManager;
 
 // Class SolveBallAndSocketJointSystem
 /**
@@ -53,6 +55,9 @@ class SolveBallAndSocketJointSystem {
 
         // -------------------- Attributes -------------------- //
 
+        /// Memory manager
+        MemoryManager& mMemoryManager;
+
         /// Physics world
         PhysicsWorld& mWorld;
 
@@ -74,6 +79,12 @@ class SolveBallAndSocketJointSystem {
         /// True if warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// Colors of the enabled joints (computed before solving the constraints)
+        JointColoring mColoring;
+
+        /// For each enabled joint, true if its equality constraints are solved by the articulation solver (or null)
+        const bool* mArticulatedJoints;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Pointer to the profiler
@@ -85,7 +96,7 @@ class SolveBallAndSocketJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveBallAndSocketJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+        SolveBallAndSocketJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
                                       TransformComponents& transformComponents,
                                       JointComponents& jointComponents,
                                       BallAndSocketJointComponents& ballAndSocketJointComponents);
@@ -105,12 +116,21 @@ class SolveBallAndSocketJointSystem {
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
+        /// Release the memory allocated to solve the constraints
+        void reset();
+
         /// Set the time step
         void setTimeStep(decimal timeStep);
 
         /// Set to true to enable warm starting
         void setIsWarmStartingActive(bool isWarmStartingActive);
 
+        /// Set the joints whose equality constraints are solved by the articulation solver (or null)
+        void setArticulatedJoints(const bool* articulatedJoints);
+
+        /// Return the colors of the enabled joints (computed before solving the constraints)
+        const JointColoring& getColoring() const;
+
         /// Return the current cone angle (for the cone limit)
         static decimal computeCurrentConeHalfAngle(const Vector3& coneLimitWorldAxisBody1, const Vector3& coneLimitWorldAxisBody2);
 
@@ -143,6 +163,21 @@ RP3D_FORCE_INLINE void SolveBallAndSocketJointSystem::setIsWarmStartingActive(bo
     mIsWarmStartingActive = isWarmStartingActive;
 }
 
+// Release the memory allocated to solve the constraints
+RP3D_FORCE_INLINE void SolveBallAndSocketJointSystem::reset() {
+    mColoring.release(mMemoryManager);
+}
+
+// Set the joints whose equality constraints are solved by the articulation solver (or null)
+RP3D_FORCE_INLINE void SolveBallAndSocketJointSystem::setArticulatedJoints(const bool* articulatedJoints) {
+    mArticulatedJoints = articulatedJoints;
+}
+
+// Return the colors of the enabled joints (computed before solving the constraints)
+RP3D_FORCE_INLINE const JointColoring& SolveBallAndSocketJointSystem::getColoring() const {
+    return mColoring;
+}
+
 // Return the current cone angle (for the cone limit)
 /**
  * @return The positive cone angle in radian in range [0, PI]
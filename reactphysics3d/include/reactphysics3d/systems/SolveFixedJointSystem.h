@@ -32,10 +32,12 @@
 #include <reactphysics3d/components/JointComponents.h>
 #include <reactphysics3d/components/FixedJointComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
+#include <reactphysics3d/engine/JointColoring.h>
 
 namespace reactphysics3d {
 
 class PhysicsWorld;
+class MemoryManager;
 
 // Class SolveFixedJointSystem
 /**
@@ -52,6 +54,9 @@ class SolveFixedJointSystem {
 
         // -------------------- Attributes -------------------- //
 
+        /// Memory manager
+        MemoryManager& mMemoryManager;
+
         /// Physics world
         PhysicsWorld& mWorld;
 
@@ -73,6 +78,9 @@ class SolveFixedJointSystem {
         /// True if warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// Colors of the enabled joints (computed before solving the constraints)
+        JointColoring mColoring;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Pointer to the profiler
@@ -84,7 +92,7 @@ class SolveFixedJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveFixedJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents, TransformComponents& transformComponents,
+        SolveFixedJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents, TransformComponents& transformComponents,
                               JointComponents& jointComponents, FixedJointComponents& fixedJointComponents);
 
         /// Destructor
@@ -102,6 +110,9 @@ class SolveFixedJointSystem {
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
+        /// Release the memory allocated to solve the constraints
+        void reset();
+
         /// Set the time step
         void setTimeStep(decimal timeStep);
 
@@ -137,6 +148,11 @@ RP3D_FORCE_INLINE void SolveFixedJointSystem::setIsWarmStartingActive(bool isWar
     mIsWarmStartingActive = isWarmStartingActive;
 }
 
+// Release the memory allocated to solve the constraints
+RP3D_FORCE_INLINE void SolveFixedJointSystem::reset() {
+    mColoring.release(mMemoryManager);
+}
+
 
 }
 
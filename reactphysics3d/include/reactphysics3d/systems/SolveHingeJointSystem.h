@@ -32,10 +32,12 @@
 #include <reactphysics3d/components/JointComponents.h>
 #include <reactphysics3d/components/HingeJointComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
+#include <reactphysics3d/engine/JointColoring.h>
 
 namespace reactphysics3d {
 
 class PhysicsWorld;
+class MemoryManager;
 
 // Class SolveHingeJointSystem
 /**
@@ -52,6 +54,9 @@ class SolveHingeJointSystem {
 
         // -------------------- Attributes -------------------- //
 
+        /// Memory manager
+        MemoryManager& mMemoryManager;
+
         /// Physics world
         PhysicsWorld& mWorld;
 
@@ -73,6 +78,12 @@ class SolveHingeJointSystem {
         /// True if warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// Colors of the enabled joints (computed before solving the constraints)
+        JointColoring mColoring;
+
+        /// For each enabled joint, true if its equality constraints are solved by the articulation solver (or null)
+        const bool* mArticulatedJoints;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Pointer to the profiler
@@ -99,7 +110,7 @@ class SolveHingeJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveHingeJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+        SolveHingeJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
                               TransformComponents& transformComponents,
                               JointComponents& jointComponents,
                               HingeJointComponents& hingeJointComponents);
@@ -119,12 +130,21 @@ class SolveHingeJointSystem {
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
+        /// Release the memory allocated to solve the constraints
+        void reset();
+
         /// Set the time step
         void setTimeStep(decimal timeStep);
 
         /// Set to true to enable warm starting
         void setIsWarmStartingActive(bool isWarmStartingActive);
 
+        /// Set the joints whose equality constraints are solved by the articulation solver (or null)
+        void setArticulatedJoints(const bool* articulatedJoints);
+
+        /// Return the colors of the enabled joints (computed before solving the constraints)
+        const JointColoring& getColoring() const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Set the profiler
@@ -158,6 +178,21 @@ RP3D_FORCE_INLINE void SolveHingeJointSystem::setIsWarmStartingActive(bool isWar
     mIsWarmStartingActive = isWarmStartingActive;
 }
 
+// Release the memory allocated to solve the constraints
+RP3D_FORCE_INLINE void SolveHingeJointSystem::reset() {
+    mColoring.release(mMemoryManager);
+}
+
+// Set the joints whose equality constraints are solved by the articulation solver (or null)
+RP3D_FORCE_INLINE void SolveHingeJointSystem::setArticulatedJoints(const bool* articulatedJoints) {
+    mArticulatedJoints = articulatedJoints;
+}
+
+// Return the colors of the enabled joints (computed before solving the constraints)
+RP3D_FORCE_INLINE const JointColoring& SolveHingeJointSystem::getColoring() const {
+    return mColoring;
+}
+
 
 }
 
@@ -32,10 +32,12 @@
 #include <reactphysics3d/components/JointComponents.h>
 #include <reactphysics3d/components/SliderJointComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
+#include <reactphysics3d/engine/JointColoring.h>
 
 namespace reactphysics3d {
 
 class PhysicsWorld;
+class MemoryManager;
 
 // Class SolveSliderJointSystem
 /**
@@ -52,6 +54,9 @@ class SolveSliderJointSystem {
 
         // -------------------- Attributes -------------------- //
 
+        /// Memory manager
+        MemoryManager& mMemoryManager;
+
         /// Physics world
         PhysicsWorld& mWorld;
 
@@ -73,6 +78,9 @@ class SolveSliderJointSystem {
         /// True if warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// Colors of the enabled joints (computed before solving the constraints)
+        JointColoring mColoring;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Pointer to the profiler
@@ -86,7 +94,7 @@ class SolveSliderJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveSliderJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+        SolveSliderJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
                               TransformComponents& transformComponents,
                               JointComponents& jointComponents,
                               SliderJointComponents& sliderJointComponents);
@@ -106,6 +114,9 @@ class SolveSliderJointSystem {
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
+        /// Release the memory allocated to solve the constraints
+        void reset();
+
         /// Set the time step
         void setTimeStep(decimal timeStep);
 
@@ -141,6 +152,11 @@ RP3D_FORCE_INLINE void SolveSliderJointSystem::setIsWarmStartingActive(bool isWa
     mIsWarmStartingActive = isWarmStartingActive;
 }
 
+// Release the memory allocated to solve the constraints
+RP3D_FORCE_INLINE void SolveSliderJointSystem::reset() {
+    mColoring.release(mMemoryManager);
+}
+
 }
 
 #endif
@@ -0,0 +1,99 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_CONVEX_DECOMPOSITION_H
+#define REACTPHYSICS3D_CONVEX_DECOMPOSITION_H
+
+// Libraries
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/collision/PolygonVertexArray.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class ConvexDecomposition
+/**
+ * This class computes an approximate convex decomposition of a triangle mesh so that a
+ * concave object can be simulated as a dynamic body with several convex mesh colliders.
+ * The mesh is voxelized (surface and interior) and the set of voxels is recursively cut
+ * by axis-aligned planes. At each step, the part with the largest concavity (volume of
+ * its convex hull that is not filled by voxels) is cut by the plane that minimizes the
+ * concavity of the two resulting parts. The final parts are converted into convex hulls
+ * with the QuickHull class.
+ */
+class ConvexDecomposition {
+
+    public:
+
+        /// Parameters of the decomposition
+        struct Settings {
+
+            /// Maximum number of convex hulls
+            uint32 maxNbHulls = 8;
+
+            /// Maximum number of vertices of each convex hull
+            uint32 maxNbVerticesPerHull = 32;
+
+            /// Number of voxels along the largest axis of the mesh
+            uint32 resolution = 32;
+
+            /// A part is not cut anymore when its concavity is smaller than this
+            /// fraction of the volume of the convex hull of the whole mesh
+            decimal concavity = decimal(0.01);
+        };
+
+        /// Range of a convex hull inside the output arrays
+        struct Hull {
+
+            /// Index of the first vertex of the hull in the array of vertices
+            uint32 verticesStart;
+
+            /// Number of vertices of the hull
+            uint32 nbVertices;
+
+            /// Index of the first face of the hull in the array of faces
+            uint32 facesStart;
+
+            /// Number of faces of the hull
+            uint32 nbFaces;
+
+            /// Index of the first vertex index of the hull in the array of indices
+            uint32 indicesStart;
+
+            /// Number of vertex indices of the hull
+            uint32 nbIndices;
+        };
+
+        /// Compute the approximate convex decomposition of a triangle mesh
+        static bool computeDecomposition(const Vector3* vertices, const uint32* triangleIndices, uint32 nbTriangles,
+                                         MemoryAllocator& allocator, const Settings& settings,
+                                         Array<Vector3>& outVertices, Array<uint32>& outIndices,
+                                         Array<PolygonVertexArray::PolygonFace>& outFaces, Array<Hull>& outHulls);
+};
+
+}
+
+#endif
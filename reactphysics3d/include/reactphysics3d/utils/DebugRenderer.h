@@ -30,7 +30,9 @@
 #include <reactphysics3d/containers/Array.h>
 #include <reactphysics3d/containers/Map.h>
 #include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
 #include <reactphysics3d/engine/EventListener.h>
+#include <reactphysics3d/engine/Entity.h>
 #include <string>
 
 /// ReactPhysics3D namespace
@@ -41,6 +43,7 @@ class ConcaveMeshShape;
 class ConvexMeshShape;
 class HeightFieldShape;
 class Collider;
+class CollisionShape;
 class PhysicsWorld;
 
 // Class DebugRenderer
@@ -140,6 +143,36 @@ class DebugRenderer : public EventListener {
 
     private:
 
+        /// Cached shape primitives of a collider of a static body
+        struct StaticCacheEntry {
+
+            /// Shape of the collider
+            const CollisionShape* shape;
+
+            /// Version of the shape when the primitives were generated
+            uint32 shapeVersion;
+
+            /// Local-to-world transform of the collider when the primitives were generated
+            Transform transform;
+
+            /// Color of the primitives
+            uint32 color;
+
+            /// Index of the last frame where the collider was drawn
+            uint32 frame;
+
+            /// Cached lines of the collider
+            Array<DebugLine> lines;
+
+            /// Cached triangles of the collider
+            Array<DebugTriangle> triangles;
+
+            /// Constructor
+            StaticCacheEntry(MemoryAllocator& allocator) : lines(allocator), triangles(allocator) {
+
+            }
+        };
+
 		// -------------------- Constants -------------------- //
 
 		/// Number of sectors used to draw a sphere or a capsule
@@ -180,6 +213,33 @@ class DebugRenderer : public EventListener {
         /// Pointer to user data
         void* mUserData=NULL;
 
+        /// True if only the colliders that overlap the view AABB are displayed
+        bool mHasViewAABB;
+
+        /// World-space AABB of the displayed region
+        AABB mViewAABB;
+
+        /// True if only the colliders inside the view frustum are displayed
+        bool mHasViewFrustum;
+
+        /// Normals of the six frustum planes (pointing inside)
+        Vector3 mViewFrustumNormals[6];
+
+        /// Distances of the six frustum planes
+        decimal mViewFrustumDistances[6];
+
+        /// Maximum number of lines and triangles (0 if there is no limit)
+        uint32 mMaxNbPrimitives;
+
+        /// True if the shape primitives of static bodies are cached
+        bool mIsStaticCacheEnabled;
+
+        /// Map a collider entity of a static body with its cached collision shape entry
+        Map<Entity, StaticCacheEntry*> mStaticCacheEntries;
+
+        /// Index of the current frame (used to remove the entries of the colliders that are not drawn anymore)
+        uint32 mStaticCacheFrame;
+
         // -------------------- Methods -------------------- //
 
 		/// Draw an AABB
@@ -206,6 +266,24 @@ class DebugRenderer : public EventListener {
 		/// Draw the collision shape of a collider
 		void drawCollisionShapeOfCollider(const Collider* collider, uint32 color);
 
+		/// Draw the collision shape of a collider of a static body using the cache
+		void drawCachedCollisionShapeOfCollider(const Collider* collider, bool isDisplayed, uint32 color);
+
+		/// Remove the cached entries of the colliders that were not drawn in the current frame
+		void removeUnusedStaticCacheEntries();
+
+		/// Remove all the cached entries
+		void clearStaticCache();
+
+		/// Return true if a world-space AABB is inside the view region
+		bool isInViewRegion(const AABB& aabb) const;
+
+		/// Return true if the maximum number of primitives is not reached
+		bool hasPrimitivesBudget() const;
+
+		/// Remove the last primitives that are over the maximum number of primitives
+		void applyPrimitivesBudget();
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -252,6 +330,30 @@ class DebugRenderer : public EventListener {
         /// Return the length of contact normal
         void setContactNormalLength(decimal contactNormalLength);
 
+        /// Display only the colliders that overlap a world-space AABB
+        void setViewAABB(const AABB& aabb);
+
+        /// Remove the view AABB
+        void removeViewAABB();
+
+        /// Display only the colliders inside a frustum given by six planes
+        void setViewFrustum(const Vector3* planeNormals, const decimal* planeDistances);
+
+        /// Remove the view frustum
+        void removeViewFrustum();
+
+        /// Return the maximum number of lines and triangles (0 if there is no limit)
+        uint32 getMaxNbPrimitives() const;
+
+        /// Set the maximum number of lines and triangles (0 if there is no limit)
+        void setMaxNbPrimitives(uint32 maxNbPrimitives);
+
+        /// Return true if the shape primitives of static bodies are cached
+        bool getIsStaticCacheEnabled() const;
+
+        /// Set whether the shape primitives of static bodies are cached
+        void setIsStaticCacheEnabled(bool isEnabled);
+
         /// Generate the rendering primitives (triangles, lines, ...) of a physics world
 		void computeDebugRenderingPrimitives(const PhysicsWorld& world);
 
@@ -373,6 +475,33 @@ RP3D_FORCE_INLINE void DebugRenderer::setContactNormalLength(decimal contactNorm
     mContactNormalLength = contactNormalLength;
 }
 
+// Return the maximum number of lines and triangles
+/**
+ * @return The maximum number of primitives (0 if there is no limit)
+ */
+RP3D_FORCE_INLINE uint32 DebugRenderer::getMaxNbPrimitives() const {
+    return mMaxNbPrimitives;
+}
+
+// Set the maximum number of lines and triangles
+/// When the limit is reached, the last primitives are removed and the next colliders are not displayed.
+/**
+ * @param maxNbPrimitives The maximum number of primitives (0 if there is no limit)
+ */
+RP3D_FORCE_INLINE void DebugRenderer::setMaxNbPrimitives(uint32 maxNbPrimitives) {
+    mMaxNbPrimitives = maxNbPrimitives;
+}
+
+// Return true if the shape primitives of static bodies are cached
+RP3D_FORCE_INLINE bool DebugRenderer::getIsStaticCacheEnabled() const {
+    return mIsStaticCacheEnabled;
+}
+
+// Return true if the maximum number of primitives is not reached
+RP3D_FORCE_INLINE bool DebugRenderer::hasPrimitivesBudget() const {
+    return mMaxNbPrimitives == 0 || mLines.size() + mTriangles.size() < mMaxNbPrimitives;
+}
+
 //@FIX ADD METHODS TO MAKE LUA BINDING EASY
 // Return a pointer to the user data attached to this body
 /**
@@ -0,0 +1,60 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_QUICK_HULL_H
+#define REACTPHYSICS3D_QUICK_HULL_H
+
+// Libraries
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/collision/PolygonVertexArray.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class QuickHull
+/**
+ * This class computes the convex hull of an arbitrary cloud of points with the
+ * quickhull algorithm. The result can be used to build a PolygonVertexArray and
+ * a PolyhedronMesh. The hull is grown by always adding the point that is the
+ * farthest from the current hull. Therefore, when a maximum number of vertices
+ * is given, the algorithm stops early and returns a simplified hull (contained in
+ * the exact hull) that keeps the most significant points of the cloud. Adjacent
+ * coplanar triangles are merged into polygon faces.
+ */
+class QuickHull {
+
+    public:
+
+        /// Compute the convex hull of a cloud of points
+        static bool computeConvexHull(const Vector3* points, uint32 nbPoints, MemoryAllocator& allocator,
+                                      Array<Vector3>& outVertices, Array<uint32>& outIndices,
+                                      Array<PolygonVertexArray::PolygonFace>& outFaces,
+                                      uint32 maxNbVertices = 0, decimal coplanarAngleTolerance = decimal(0.01));
+};
+
+}
+
+#endif
@@ -66,5 +66,45 @@ enum HASH_STRINGS : unsigned int {
 	HASH_isSleepingEnabled = 1845704431u,
 	HASH_DYNAMIC = 1095276215u,
 	HASH_defaultBounciness = 1376286060u,
-	HASH_FRONT_AND_BACK = 2278768726u
+	HASH_FRONT_AND_BACK = 2278768726u,
+	HASH_maxHulls = 2370693775u,
+	HASH_maxVerticesPerHull = 3876701372u,
+	HASH_resolution = 240465721u,
+	HASH_concavity = 1410926401u,
+	HASH_defaultNbSubsteps = 3302128174u,
+	HASH_isArticulationSolverEnabled = 4208679288u,
+	HASH_breakForce = 2635401081u,
+	HASH_breakTorque = 2149560182u,
+	HASH_onJointBreak = 4055982709u,
+	HASH_up = 7675214u,
+	HASH_maxSlopeAngle = 1242633853u,
+	HASH_stepHeight = 2878289532u,
+	HASH_snapDistance = 1126879317u,
+	HASH_skinWidth = 3086345148u,
+	HASH_pushForce = 289828567u,
+	HASH_collideWithMaskBits = 3481896863u,
+	HASH_forward = 41715513u,
+	HASH_connectionPoint = 4261571664u,
+	HASH_radius = 4247170068u,
+	HASH_suspensionRestLength = 3604396481u,
+	HASH_maxSuspensionTravel = 2169144721u,
+	HASH_suspensionStiffness = 2652664222u,
+	HASH_dampingCompression = 1747971595u,
+	HASH_dampingRelaxation = 1518117819u,
+	HASH_maxSuspensionForce = 84757351u,
+	HASH_frictionSlip = 474927828u,
+	HASH_rollInfluence = 1831680181u,
+	HASH_WIND = 4094788665u,
+	HASH_ATTRACTOR = 295564633u,
+	HASH_BUOYANCY = 2459322902u,
+	HASH_direction = 76773900u,
+	HASH_strength = 696641828u,
+	HASH_center = 2531032649u,
+	HASH_fluidDensity = 3284522075u,
+	HASH_linearDrag = 823771808u,
+	HASH_angularDrag = 505554420u,
+	HASH_CONSTANT = 4036427730u,
+	HASH_LINEAR = 1122143399u,
+	HASH_QUADRATIC = 4031638997u,
+	HASH_onSleepChange = 4097343408u
 };
\ No newline at end of file
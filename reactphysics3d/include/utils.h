@@ -14,6 +14,7 @@ namespace rp3dDefold {
 
 	void pushRp3dTransform(lua_State *L,reactphysics3d::Transform transform);
 	void pushRp3dRaycastInfo(lua_State *L,const  reactphysics3d::RaycastInfo &info);
+	void pushRp3dShapeCastInfo(lua_State *L,const reactphysics3d::ShapeCastInfo &info);
 	void pushRp3dMaterial(lua_State *L, reactphysics3d::Material &material);
 	reactphysics3d::Transform checkRp3dTransform(lua_State *L, int index);
 	reactphysics3d::Ray CheckRay(lua_State *L, int index);
@@ -22,6 +22,10 @@
 #include "objects/polyhedron_mesh_userdata.h"
 #include "objects/triangle_vertex_array_userdata.h"
 #include "objects/triangle_mesh_userdata.h"
+#include "objects/body_pool_userdata.h"
+#include "objects/character_controller_userdata.h"
+#include "objects/raycast_vehicle_userdata.h"
+#include "objects/force_field_userdata.h"
 #include "objects/joint/joint_info.h"
 #include "objects/joint/joint_userdata.h"
 
@@ -81,6 +85,7 @@ static int DestroyPhysicsWorldLua(lua_State* L){
     physicsCommon.destroyPhysicsWorld(data->world);
     data->Destroy(L);
     delete data;
+    CollisionShapeUserdataFreeUnused(L);
     return 0;
 }
 
@@ -90,7 +95,7 @@ static int CreateBoxShape(lua_State* L){
     dmVMath::Vector3* v3 = dmScript::CheckVector3(L, 1);
     Vector3 v3rp3d(v3->getX(),v3->getY(),v3->getZ());
     BoxShape * shape = physicsCommon.createBoxShape(v3rp3d);
-    CollisionShapePush(L,shape);
+    CollisionShapePush(L,shape)->physicsCommon = &physicsCommon;
     return 1;
 }
 
@@ -98,18 +103,32 @@ static int DestroyBoxShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 1);
     CollisionShapeUserdata * shapeUserdata = BoxShapeCheckUserdata(L,1);
-    BoxShape* shape = static_cast<BoxShape*>(shapeUserdata->shape);
-    shapeUserdata->Destroy(L);
-    delete shapeUserdata;
-    physicsCommon.destroyBoxShape(shape);
+    CollisionShapeUserdataRelease(L,shapeUserdata);
     return 0;
 }
 
+static int GetSharedBoxShape(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    Vector3 halfExtents = checkRp3dVector3(L, 1);
+    CollisionShapeSharedKey key;
+    CollisionShapeSharedKeyInit(key, CollisionShapeName::BOX, halfExtents.x, halfExtents.y, halfExtents.z, NULL);
+    CollisionShapeUserdata* userdata = CollisionShapeUserdataGetShared(key);
+    if(userdata == NULL){
+        userdata = CollisionShapePush(L, physicsCommon.createBoxShape(halfExtents));
+        userdata->physicsCommon = &physicsCommon;
+        CollisionShapeUserdataAddShared(userdata, key);
+    }else{
+        userdata->Push(L);
+    }
+    return 1;
+}
+
 static int CreateSphereShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
     SphereShape * shape = physicsCommon.createSphereShape(luaL_checknumber(L,1));
-    CollisionShapePush(L,shape);
+    CollisionShapePush(L,shape)->physicsCommon = &physicsCommon;
     return 1;
 }
 
@@ -117,18 +136,32 @@ static int DestroySphereShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 1);
     CollisionShapeUserdata * shapeUserdata = SphereShapeCheckUserdata(L,1);
-    SphereShape* shape = static_cast<SphereShape*>(shapeUserdata->shape);
-    shapeUserdata->Destroy(L);
-    delete shapeUserdata;
-    physicsCommon.destroySphereShape(shape);
+    CollisionShapeUserdataRelease(L,shapeUserdata);
     return 0;
 }
 
+static int GetSharedSphereShape(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    float radius = luaL_checknumber(L,1);
+    CollisionShapeSharedKey key;
+    CollisionShapeSharedKeyInit(key, CollisionShapeName::SPHERE, radius, 0, 0, NULL);
+    CollisionShapeUserdata* userdata = CollisionShapeUserdataGetShared(key);
+    if(userdata == NULL){
+        userdata = CollisionShapePush(L, physicsCommon.createSphereShape(radius));
+        userdata->physicsCommon = &physicsCommon;
+        CollisionShapeUserdataAddShared(userdata, key);
+    }else{
+        userdata->Push(L);
+    }
+    return 1;
+}
+
 static int CreateCapsuleShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 2);
     CapsuleShape * shape = physicsCommon.createCapsuleShape(luaL_checknumber(L,1),luaL_checknumber(L,2));
-    CollisionShapePush(L,shape);
+    CollisionShapePush(L,shape)->physicsCommon = &physicsCommon;
     return 1;
 }
 
@@ -136,13 +169,28 @@ static int DestroyCapsuleShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 1);
     CollisionShapeUserdata * shapeUserdata = CapsuleShapeCheckUserdata(L,1);
-    CapsuleShape* shape = static_cast<CapsuleShape*>(shapeUserdata->shape);
-    shapeUserdata->Destroy(L);
-    delete shapeUserdata;
-    physicsCommon.destroyCapsuleShape(shape);
+    CollisionShapeUserdataRelease(L,shapeUserdata);
     return 0;
 }
 
+static int GetSharedCapsuleShape(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    float radius = luaL_checknumber(L,1);
+    float height = luaL_checknumber(L,2);
+    CollisionShapeSharedKey key;
+    CollisionShapeSharedKeyInit(key, CollisionShapeName::CAPSULE, radius, height, 0, NULL);
+    CollisionShapeUserdata* userdata = CollisionShapeUserdataGetShared(key);
+    if(userdata == NULL){
+        userdata = CollisionShapePush(L, physicsCommon.createCapsuleShape(radius, height));
+        userdata->physicsCommon = &physicsCommon;
+        CollisionShapeUserdataAddShared(userdata, key);
+    }else{
+        userdata->Push(L);
+    }
+    return 1;
+}
+
 static int CreatePolyhedronMesh(lua_State* L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 3);
@@ -159,6 +207,29 @@ static int CreatePolyhedronMeshFromMeshVerticesCopy(lua_State* L){
     return 1;
 }
 
+static int CreateConvexHullPolyhedronMesh(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1, 2);
+    PolyhedronMeshUserdata *mesh = PolyhedronMeshUserdataConvexHullFromLua(&physicsCommon,L);
+    mesh->Push(L);
+    return 1;
+}
+
+static int CreateConvexHullPolyhedronMeshFromMeshVerticesCopy(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1, 2);
+    PolyhedronMeshUserdata *mesh = PolyhedronMeshUserdataConvexHullFromBufferClone(&physicsCommon,L);
+    mesh->Push(L);
+    return 1;
+}
+
+static int CreateConvexDecompositionFromMeshVerticesCopy(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1, 2);
+    PolyhedronMeshUserdataPushConvexDecompositionFromBufferClone(&physicsCommon,L);
+    return 1;
+}
+
 static int CreateTriangleVertexArrayFromMeshVerticesCopy(lua_State* L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -173,6 +244,8 @@ static int DestroyPolyhedronMesh(lua_State* L){
     check_arg_count(L, 1);
     PolyhedronMeshUserdata * userdata = PolyhedronMeshUserdataCheck(L,1);
     PolyhedronMesh* mesh = userdata->mesh;
+    //new mesh can be allocated at same address
+    CollisionShapeUserdataRemoveSharedMesh(mesh);
     userdata->Destroy(L);
     delete userdata;
     physicsCommon.destroyPolyhedronMesh(mesh);
@@ -191,7 +264,28 @@ static int CreateConvexMeshShape(lua_State* L){
         scalingV3.z = dmV3->getZ();
     }
     ConvexMeshShape * shape = physicsCommon.createConvexMeshShape(mesh->mesh,scalingV3);
-    CollisionShapePush(L,shape);
+    CollisionShapePush(L,shape)->physicsCommon = &physicsCommon;
+    return 1;
+}
+
+static int GetSharedConvexMeshShape(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1,2);
+    PolyhedronMeshUserdata * mesh = PolyhedronMeshUserdataCheck(L,1);
+    Vector3 scalingV3(1,1,1);
+    if(lua_gettop(L) == 2){
+        scalingV3 = checkRp3dVector3(L, 2);
+    }
+    CollisionShapeSharedKey key;
+    CollisionShapeSharedKeyInit(key, CollisionShapeName::CONVEX_MESH, scalingV3.x, scalingV3.y, scalingV3.z, mesh->mesh);
+    CollisionShapeUserdata* userdata = CollisionShapeUserdataGetShared(key);
+    if(userdata == NULL){
+        userdata = CollisionShapePush(L, physicsCommon.createConvexMeshShape(mesh->mesh,scalingV3));
+        userdata->physicsCommon = &physicsCommon;
+        CollisionShapeUserdataAddShared(userdata, key);
+    }else{
+        userdata->Push(L);
+    }
     return 1;
 }
 
@@ -199,10 +293,7 @@ static int DestroyConvexMeshShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 1);
     CollisionShapeUserdata * shapeUserdata = ConvexMeshShapeCheckUserdata(L,1);
-    ConvexMeshShape* shape = static_cast<ConvexMeshShape*>(shapeUserdata->shape);
-    shapeUserdata->Destroy(L);
-    delete shapeUserdata;
-    physicsCommon.destroyConvexMeshShape(shape);
+    CollisionShapeUserdataRelease(L,shapeUserdata);
     return 0;
 }
 
@@ -218,7 +309,7 @@ static int CreateConcaveMeshShape(lua_State* L){
         scalingV3.z = dmV3->getZ();
     }
     ConcaveMeshShape * shape = physicsCommon.createConcaveMeshShape(mesh->mesh,scalingV3);
-    CollisionShapePush(L,shape);
+    CollisionShapePush(L,shape)->physicsCommon = &physicsCommon;
     return 1;
 }
 
@@ -226,10 +317,7 @@ static int DestroyConcaveMeshShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 1);
     CollisionShapeUserdata * shapeUserdata = ConcaveMeshShapeCheckUserdata(L,1);
-    ConcaveMeshShape* shape = static_cast<ConcaveMeshShape*>(shapeUserdata->shape);
-    shapeUserdata->Destroy(L);
-    delete shapeUserdata;
-    physicsCommon.destroyConcaveMeshShape(shape);
+    CollisionShapeUserdataRelease(L,shapeUserdata);
     return 0;
 }
 
@@ -360,6 +448,7 @@ static int CreateHeightFieldShape(lua_State* L){
 
 
     CollisionShapeUserdata* userdata = CollisionShapePush(L,shape);
+    userdata->physicsCommon = &physicsCommon;
     userdata->heightData = data;
 
     return 1;
@@ -369,10 +458,7 @@ static int DestroyHeightFieldShape(lua_State* L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 1);
     CollisionShapeUserdata * shapeUserdata = HeightFieldShapeCheckUserdata(L,1);
-    HeightFieldShape* shape = static_cast<HeightFieldShape*>(shapeUserdata->shape);
-    shapeUserdata->Destroy(L);
-    delete shapeUserdata;
-    physicsCommon.destroyHeightFieldShape(shape);
+    CollisionShapeUserdataRelease(L,shapeUserdata);
     return 0;
 }
 
@@ -523,15 +609,22 @@ static const luaL_reg Module_methods[] ={
     {"destroyPhysicsWorld", DestroyPhysicsWorldLua},
     {"createBoxShape", CreateBoxShape},
     {"destroyBoxShape", DestroyBoxShape},
+    {"getSharedBoxShape", GetSharedBoxShape},
     {"createSphereShape", CreateSphereShape},
     {"destroySphereShape", DestroySphereShape},
+    {"getSharedSphereShape", GetSharedSphereShape},
     {"createCapsuleShape", CreateCapsuleShape},
     {"destroyCapsuleShape", DestroyCapsuleShape},
+    {"getSharedCapsuleShape", GetSharedCapsuleShape},
     {"createPolyhedronMesh", CreatePolyhedronMesh},
     {"createPolyhedronMeshFromMeshVerticesCopy", CreatePolyhedronMeshFromMeshVerticesCopy},
+    {"createConvexHullPolyhedronMesh", CreateConvexHullPolyhedronMesh},
+    {"createConvexHullPolyhedronMeshFromMeshVerticesCopy", CreateConvexHullPolyhedronMeshFromMeshVerticesCopy},
+    {"createConvexDecompositionFromMeshVerticesCopy", CreateConvexDecompositionFromMeshVerticesCopy},
     {"destroyPolyhedronMesh", DestroyPolyhedronMesh},
     {"createConvexMeshShape", CreateConvexMeshShape},
     {"destroyConvexMeshShape", DestroyConvexMeshShape},
+    {"getSharedConvexMeshShape", GetSharedConvexMeshShape},
     {"createConcaveMeshShape", CreateConcaveMeshShape},
     {"destroyConcaveMeshShape", DestroyConcaveMeshShape},
     {"createTriangleVertexArray", CreateTriangleVertexArray},
@@ -675,6 +768,24 @@ static void LuaInit(lua_State* L){
         lua_setfield(L, -2, "NON_LINEAR_GAUSS_SEIDEL");
     lua_setfield(L, -2, "JointsPositionCorrectionTechnique");
 
+    lua_newtable(L);
+        lua_pushstring(L, "WIND");
+        lua_setfield(L, -2, "WIND");
+        lua_pushstring(L, "ATTRACTOR");
+        lua_setfield(L, -2, "ATTRACTOR");
+        lua_pushstring(L, "BUOYANCY");
+        lua_setfield(L, -2, "BUOYANCY");
+    lua_setfield(L, -2, "ForceFieldType");
+
+    lua_newtable(L);
+        lua_pushstring(L, "CONSTANT");
+        lua_setfield(L, -2, "CONSTANT");
+        lua_pushstring(L, "LINEAR");
+        lua_setfield(L, -2, "LINEAR");
+        lua_pushstring(L, "QUADRATIC");
+        lua_setfield(L, -2, "QUADRATIC");
+    lua_setfield(L, -2, "RadialImpulseFalloff");
+
 
 	lua_pop(L, 1);
 	assert(top == lua_gettop(L));
@@ -691,6 +802,10 @@ static dmExtension::Result InitializeMyExtension(dmExtension::Params* params){
     TriangleVertexArrayUserdataInitMetaTable(params->m_L);
     TriangleMeshUserdataInitMetaTable(params->m_L);
     JointUserdataInitMetaTable(params->m_L);
+    BodyPoolUserdataInitMetaTable(params->m_L);
+    CharacterControllerUserdataInitMetaTable(params->m_L);
+    RaycastVehicleUserdataInitMetaTable(params->m_L);
+    ForceFieldUserdataInitMetaTable(params->m_L);
 	LuaInit(params->m_L);
 	printf("Registered %s Extension\n", MODULE_NAME);
 	return dmExtension::RESULT_OK;
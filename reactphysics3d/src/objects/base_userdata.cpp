@@ -24,7 +24,7 @@ BaseUserData::~BaseUserData() {
     }
 }
 
-BaseUserData* BaseUserData_get_userdata(lua_State *L, int index, char *userdata_type) {
+BaseUserData* BaseUserData_get_userdata(lua_State *L, int index, const char *userdata_type) {
     int top = lua_gettop(L);
     BaseUserData *obj = NULL;
 
@@ -0,0 +1,164 @@
+#include "objects/body_pool_userdata.h"
+#include "objects/shape/collision_shape_userdata.h"
+#include "utils.h"
+
+#define META_NAME "rp3d::BodyPool"
+#define USERDATA_TYPE "rp3d::BodyPool"
+
+using namespace reactphysics3d;
+
+namespace rp3dDefold {
+
+BodyPoolUserdata::BodyPoolUserdata(PhysicsWorld *world): BaseUserData(USERDATA_TYPE){
+    this->metatable_name = META_NAME;
+    this->obj = world;
+    this->world = world;
+}
+
+BodyPoolUserdata::~BodyPoolUserdata() {
+
+}
+
+BodyPoolUserdata* BodyPoolUserdataCheck(lua_State *L, int index) {
+    BodyPoolUserdata *userdata = (BodyPoolUserdata*) BaseUserData_get_userdata(L, index, USERDATA_TYPE);
+	return userdata;
+}
+
+static void ResetBody(CollisionBodyUserdata* userdata){
+    if(userdata->isRigidBody){
+        RigidBody* body = static_cast<RigidBody*>(userdata->body);
+        body->setLinearVelocity(Vector3::zero());
+        body->setAngularVelocity(Vector3::zero());
+        body->resetForce();
+        body->resetTorque();
+    }
+}
+
+BodyPoolUserdata* BodyPoolUserdataCreate(lua_State *L, PhysicsWorld *world, CollisionBody *templateBody, int size){
+    BodyPoolUserdata* pool = new BodyPoolUserdata(world);
+    pool->bodies.SetCapacity(size);
+    pool->freeBodies.SetCapacity(size);
+    for(int i=0;i<size;++i){
+        CollisionBody* body = world->cloneBody(templateBody, templateBody->getTransform());
+        body->setIsActive(false);
+        CollisionBodyUserdata* userdata = new CollisionBodyUserdata(body);
+        userdata->pool = pool;
+        userdata->isInPool = true;
+        //create lua table now. Acquire should not allocate.
+        userdata->Push(L);
+        lua_pop(L,1);
+        pool->bodies.Push(userdata);
+        pool->freeBodies.Push(userdata);
+    }
+    return pool;
+}
+
+void BodyPoolUserdataDestroyWithBodies(lua_State *L, BodyPoolUserdata *pool){
+    PhysicsWorld* world = pool->world;
+    for(uint32_t i=0;i<pool->bodies.Size();++i){
+        CollisionBodyUserdata* userdata = pool->bodies[i];
+        CollisionBody* body = userdata->body;
+        bool isRigidBody = userdata->isRigidBody;
+        userdata->Destroy(L);
+        delete userdata;
+        if(isRigidBody){
+            RigidBody* rigidBody = static_cast<RigidBody*>(body);
+            world->rigidBodyRemoveJointsUserdata(L,rigidBody);
+            world->destroyRigidBody(rigidBody);
+        }else{
+            world->destroyCollisionBody(body);
+        }
+    }
+    pool->bodies.SetSize(0);
+    pool->freeBodies.SetSize(0);
+    pool->Destroy(L);
+    delete pool;
+    CollisionShapeUserdataFreeUnused(L);
+}
+
+static int Acquire(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    BodyPoolUserdata *pool = BodyPoolUserdataCheck(L, 1);
+    Transform transform = checkRp3dTransform(L,2);
+    if(pool->freeBodies.Empty()){
+        lua_pushnil(L);
+        return 1;
+    }
+    CollisionBodyUserdata* userdata = pool->freeBodies.Back();
+    pool->freeBodies.Pop();
+    userdata->isInPool = false;
+    userdata->body->setTransform(transform);
+    ResetBody(userdata);
+    userdata->body->setIsActive(true);
+    userdata->Push(L);
+	return 1;
+}
+
+static int Release(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    BodyPoolUserdata *pool = BodyPoolUserdataCheck(L, 1);
+    CollisionBodyUserdata *userdata = CollisionBodyUserdataCheck(L, 2);
+    if(userdata->pool != pool){
+        luaL_error(L,"body not from this pool");
+    }
+    if(userdata->isInPool){
+        luaL_error(L,"body already released");
+    }
+    userdata->isInPool = true;
+    userdata->body->setIsActive(false);
+    ResetBody(userdata);
+    pool->freeBodies.Push(userdata);
+	return 0;
+}
+
+static int GetNbBodies(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    BodyPoolUserdata *pool = BodyPoolUserdataCheck(L, 1);
+    lua_pushnumber(L,pool->bodies.Size());
+	return 1;
+}
+
+static int GetNbFreeBodies(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    BodyPoolUserdata *pool = BodyPoolUserdataCheck(L, 1);
+    lua_pushnumber(L,pool->freeBodies.Size());
+	return 1;
+}
+
+static int ToString(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    BodyPoolUserdata *pool = BodyPoolUserdataCheck(L, 1);
+    lua_pushfstring( L, "rp3d::BodyPool[%p]",(void *) pool);
+	return 1;
+}
+
+void BodyPoolUserdataInitMetaTable(lua_State *L){
+    int top = lua_gettop(L);
+    luaL_Reg functions[] = {
+        {"acquire", Acquire},
+        {"release", Release},
+        {"getNbBodies", GetNbBodies},
+        {"getNbFreeBodies", GetNbFreeBodies},
+        {"__tostring", ToString},
+        { 0, 0 }
+    };
+    luaL_newmetatable(L, META_NAME);
+    luaL_register (L, NULL,functions);
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -1, "__index");
+    lua_pop(L, 1);
+
+    assert(top == lua_gettop(L));
+}
+
+void BodyPoolUserdata::Destroy(lua_State *L){
+    world = NULL;
+    BaseUserData::Destroy(L);
+}
+
+}
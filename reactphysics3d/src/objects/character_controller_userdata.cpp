@@ -0,0 +1,355 @@
+#include "objects/character_controller_userdata.h"
+#include "objects/collision_body_userdata.h"
+#include "objects/collider_userdata.h"
+#include "objects/shape/collision_shape_userdata.h"
+#include "static_hash.h"
+#include "utils.h"
+
+#define META_NAME "rp3d::CharacterController"
+#define USERDATA_TYPE "rp3d::CharacterController"
+
+using namespace reactphysics3d;
+
+namespace rp3dDefold {
+
+CharacterControllerUserdata::CharacterControllerUserdata(PhysicsWorld *world, CharacterController *controller): BaseUserData(USERDATA_TYPE){
+    this->metatable_name = META_NAME;
+    this->obj = controller;
+    this->world = world;
+    this->controller = controller;
+}
+
+CharacterControllerUserdata::~CharacterControllerUserdata() {
+
+}
+
+CharacterControllerUserdata* CharacterControllerUserdataCheck(lua_State *L, int index) {
+    CharacterControllerUserdata *userdata = (CharacterControllerUserdata*) BaseUserData_get_userdata(L, index, USERDATA_TYPE);
+	return userdata;
+}
+
+static decimal CheckMaxSlopeAngle(lua_State *L, int index){
+    decimal angle = luaL_checknumber(L, index);
+    if(angle < 0 || angle > PI_RP3D){
+        luaL_error(L,"maxSlopeAngle should be in [0, pi]");
+    }
+    return angle;
+}
+
+static decimal CheckNotNegative(lua_State *L, int index, const char* name){
+    decimal value = luaL_checknumber(L, index);
+    if(value < 0){
+        luaL_error(L,"%s should be >= 0", name);
+    }
+    return value;
+}
+
+static decimal CheckSkinWidth(lua_State *L, int index){
+    decimal value = luaL_checknumber(L, index);
+    if(value <= 0){
+        luaL_error(L,"skinWidth should be > 0");
+    }
+    return value;
+}
+
+static Vector3 CheckUp(lua_State *L, int index){
+    Vector3 up = checkRp3dVector3(L, index);
+    if(up.lengthSquare() <= MACHINE_EPSILON){
+        luaL_error(L,"up should not be zero");
+    }
+    return up;
+}
+
+CharacterControllerSettings CharacterControllerSettings_from_table(lua_State *L, int index){
+    CharacterControllerSettings settings;
+    if (lua_istable(L, index)) {
+        lua_pushvalue(L,index);
+         lua_pushnil(L);  /* first key */
+         while (lua_next(L, -2) != 0) {
+            const char* key = lua_tostring(L, -2);
+            switch (hash_string(key)){
+                case HASH_up:
+                    settings.up = CheckUp(L,-1);break;
+                case HASH_maxSlopeAngle:
+                    settings.maxSlopeAngle = CheckMaxSlopeAngle(L,-1);break;
+                case HASH_stepHeight:
+                    settings.stepHeight = CheckNotNegative(L,-1,"stepHeight");break;
+                case HASH_snapDistance:
+                    settings.snapDistance = CheckNotNegative(L,-1,"snapDistance");break;
+                case HASH_skinWidth:
+                    settings.skinWidth = CheckSkinWidth(L,-1);break;
+                case HASH_pushForce:
+                    settings.pushForce = CheckNotNegative(L,-1,"pushForce");break;
+                case HASH_collideWithMaskBits:
+                    settings.collideWithMaskBits = luaL_checknumber(L,-1);break;
+                default:
+                    luaL_error(L, "unknown key:%s", key);
+                    break;
+            }
+           /* removes 'value'; keeps 'key' for next iteration */
+           lua_pop(L, 1);
+        }
+        lua_pop(L,1); //remove table
+    }else{
+        luaL_error(L,"CharacterControllerSettings should be table");
+    }
+    return settings;
+}
+
+void CharacterControllerUserdataDestroyWithBody(lua_State *L, CharacterControllerUserdata *controller){
+    PhysicsWorld* world = controller->world;
+    RigidBody* body = controller->controller->getBody();
+    CollisionBodyUserdata* bodyUserdata = (CollisionBodyUserdata*) body->getUserData();
+    if(bodyUserdata!=NULL){
+        bodyUserdata->Destroy(L);
+        delete bodyUserdata;
+    }
+    world->rigidBodyRemoveJointsUserdata(L,body);
+    world->destroyCharacterController(controller->controller);
+    controller->Destroy(L);
+    delete controller;
+    CollisionShapeUserdataFreeUnused(L);
+}
+
+static int Move(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->move(checkRp3dVector3(L, 2));
+	return 0;
+}
+
+static int GetPosition(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->controller->getPosition());
+	return 1;
+}
+
+static int SetPosition(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setPosition(checkRp3dVector3(L, 2));
+	return 0;
+}
+
+static int GetBody(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    CollisionBodyPush(L, userdata->controller->getBody());
+	return 1;
+}
+
+static int GetCollider(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    ColliderPush(L, userdata->controller->getCollider());
+	return 1;
+}
+
+static int IsOnGround(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushboolean(L, userdata->controller->isOnGround());
+	return 1;
+}
+
+static int GetGroundNormal(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->controller->getGroundNormal());
+	return 1;
+}
+
+static int GetGroundCollider(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    Collider* collider = userdata->controller->getGroundCollider();
+    if(collider != NULL){
+        ColliderPush(L, collider);
+    }else{
+        lua_pushnil(L);
+    }
+	return 1;
+}
+
+static int GetDisplacement(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->controller->getDisplacement());
+	return 1;
+}
+
+static int GetUp(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->controller->getUp());
+	return 1;
+}
+
+static int SetUp(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setUp(CheckUp(L, 2));
+	return 0;
+}
+
+static int GetMaxSlopeAngle(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->controller->getMaxSlopeAngle());
+	return 1;
+}
+
+static int SetMaxSlopeAngle(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setMaxSlopeAngle(CheckMaxSlopeAngle(L, 2));
+	return 0;
+}
+
+static int GetStepHeight(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->controller->getStepHeight());
+	return 1;
+}
+
+static int SetStepHeight(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setStepHeight(CheckNotNegative(L, 2, "stepHeight"));
+	return 0;
+}
+
+static int GetSnapDistance(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->controller->getSnapDistance());
+	return 1;
+}
+
+static int SetSnapDistance(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setSnapDistance(CheckNotNegative(L, 2, "snapDistance"));
+	return 0;
+}
+
+static int GetSkinWidth(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->controller->getSkinWidth());
+	return 1;
+}
+
+static int SetSkinWidth(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setSkinWidth(CheckSkinWidth(L, 2));
+	return 0;
+}
+
+static int GetPushForce(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->controller->getPushForce());
+	return 1;
+}
+
+static int SetPushForce(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setPushForce(CheckNotNegative(L, 2, "pushForce"));
+	return 0;
+}
+
+static int GetCollideWithMaskBits(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->controller->getCollideWithMaskBits());
+	return 1;
+}
+
+static int SetCollideWithMaskBits(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    userdata->controller->setCollideWithMaskBits(luaL_checknumber(L, 2));
+	return 0;
+}
+
+static int ToString(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CharacterControllerUserdata *userdata = CharacterControllerUserdataCheck(L, 1);
+    lua_pushfstring( L, "rp3d::CharacterController[%p]",(void *) userdata->controller);
+	return 1;
+}
+
+void CharacterControllerUserdataInitMetaTable(lua_State *L){
+    int top = lua_gettop(L);
+    luaL_Reg functions[] = {
+        {"move", Move},
+        {"getPosition", GetPosition},
+        {"setPosition", SetPosition},
+        {"getBody", GetBody},
+        {"getCollider", GetCollider},
+        {"isOnGround", IsOnGround},
+        {"getGroundNormal", GetGroundNormal},
+        {"getGroundCollider", GetGroundCollider},
+        {"getDisplacement", GetDisplacement},
+        {"getUp", GetUp},
+        {"setUp", SetUp},
+        {"getMaxSlopeAngle", GetMaxSlopeAngle},
+        {"setMaxSlopeAngle", SetMaxSlopeAngle},
+        {"getStepHeight", GetStepHeight},
+        {"setStepHeight", SetStepHeight},
+        {"getSnapDistance", GetSnapDistance},
+        {"setSnapDistance", SetSnapDistance},
+        {"getSkinWidth", GetSkinWidth},
+        {"setSkinWidth", SetSkinWidth},
+        {"getPushForce", GetPushForce},
+        {"setPushForce", SetPushForce},
+        {"getCollideWithMaskBits", GetCollideWithMaskBits},
+        {"setCollideWithMaskBits", SetCollideWithMaskBits},
+        {"__tostring", ToString},
+        { 0, 0 }
+    };
+    luaL_newmetatable(L, META_NAME);
+    luaL_register (L, NULL,functions);
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -1, "__index");
+    lua_pop(L, 1);
+
+    assert(top == lua_gettop(L));
+}
+
+void CharacterControllerUserdata::Destroy(lua_State *L){
+    world = NULL;
+    controller = NULL;
+    BaseUserData::Destroy(L);
+}
+
+}
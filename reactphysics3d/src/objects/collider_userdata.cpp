@@ -1,6 +1,7 @@
 #include "objects/collision_body_userdata.h"
 #include "static_hash.h"
 #include "objects/collider_userdata.h"
+#include "objects/world_userdata.h"
 #include "objects/aabb.h"
 #include "objects/shape/collision_shape_userdata.h"
 #include "utils.h"
@@ -212,6 +213,25 @@ static int SetIsTrigger(lua_State *L){
 	return 0;
 }
 
+static int GetNbTriggerOccupants(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ColliderUserdata *userdata = ColliderUserdataCheck(L, 1);
+    lua_pushnumber(L,userdata->collider->getNbTriggerOccupants());
+	return 1;
+}
+
+static int GetTriggerOccupants(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    ColliderUserdata *userdata = ColliderUserdataCheck(L, 1);
+
+    Array<Collider*> colliders(userdata->collider->getBody()->getWorld().getMemoryManager().getHeapAllocator());
+    userdata->collider->getTriggerOccupants(colliders);
+    QueryBufferWrite(L, 2, colliders);
+	return 1;
+}
+
 static int GetMaterial(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -307,6 +327,8 @@ void ColliderUserdataInitMetaTable(lua_State *L){
         {"getBroadPhaseId",GetBroadPhaseId},
         {"setIsTrigger",SetIsTrigger},
         {"getIsTrigger",GetIsTrigger},
+        {"getNbTriggerOccupants",GetNbTriggerOccupants},
+        {"getTriggerOccupants",GetTriggerOccupants},
         {"getMaterial",GetMaterial},
         {"setMaterial",SetMaterial},
         {"getMaterialBounciness",GetMaterialBounciness},
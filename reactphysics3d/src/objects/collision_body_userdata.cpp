@@ -90,6 +90,31 @@ static int SetIsActive(lua_State *L){
 	return 0;
 }
 
+static int Clone(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    CollisionBodyUserdata *userdata = CollisionBodyUserdataCheck(L, 1);
+    Transform transform = checkRp3dTransform(L,2);
+    CollisionBody* body = userdata->body->getWorld().cloneBody(userdata->body,transform);
+    CollisionBodyPush(L,body);
+	return 1;
+}
+
+static int IsCompound(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CollisionBodyUserdata *userdata = CollisionBodyUserdataCheck(L, 1);
+    lua_pushboolean(L,userdata->body->isCompound());
+	return 1;
+}
+static int SetIsCompound(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    CollisionBodyUserdata *userdata = CollisionBodyUserdataCheck(L, 1);
+    userdata->body->setIsCompound(lua_toboolean(L,2));
+	return 0;
+}
+
 static int GetUserData(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -203,6 +228,31 @@ static int AddCollider(lua_State *L){
 	return 1;
 }
 
+static int AddColliders(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3);
+    CollisionBodyUserdata *userdata = CollisionBodyUserdataCheck(L, 1);
+    if (!lua_istable(L, 2)) luaL_error(L,"collisionShapes is not table");
+    Transform transform = checkRp3dTransform(L,3);
+    int size = lua_objlen(L,2);
+    //check all shapes before adding any collider
+    for(int i=1;i<=size;i++){
+        lua_rawgeti(L, 2, i);
+        CollisionShapeCheck(L,-1);
+        lua_pop(L,1);
+    }
+    lua_createtable(L, size, 0);
+    for(int i=1;i<=size;i++){
+        lua_rawgeti(L, 2, i);
+        CollisionShapeUserdata* shapeLua = CollisionShapeCheck(L,-1);
+        lua_pop(L,1);
+        Collider* collider = userdata->body->addCollider(shapeLua->shape,transform);
+        ColliderPush(L,collider);
+        lua_rawseti(L, -2, i);
+    }
+	return 1;
+}
+
 static int GetNbColliders(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -233,6 +283,7 @@ static int RemoveCollider(lua_State *L){
     colliderUserdata->Destroy(L);
     delete colliderUserdata;
     body->body->removeCollider(collider);
+    CollisionShapeUserdataFreeUnused(L);
 
 	return 0;
 }
@@ -788,6 +839,9 @@ static void CollisionBodyUserdataRigidInitMetaTable(lua_State *L){
         {"isRigidBody",IsRigidBody},
         {"isActive",IsActive},
         {"setIsActive",SetIsActive},
+        {"isCompound",IsCompound},
+        {"setIsCompound",SetIsCompound},
+        {"clone",Clone},
         {"getUserData",GetUserData},
         {"setUserData",SetUserData},
         {"getTransform",GetTransform},
@@ -797,6 +851,7 @@ static void CollisionBodyUserdataRigidInitMetaTable(lua_State *L){
         {"getTransformQuat",GetTransformQuat},
         {"setTransformQuat",SetTransformQuat},
         {"addCollider",AddCollider},
+        {"addColliders",AddColliders},
         {"removeCollider",RemoveCollider},
         {"testPointInside",TestPointInside},
         {"raycast",Raycast},
@@ -871,6 +926,9 @@ void CollisionBodyUserdataInitMetaTable(lua_State *L){
         {"isRigidBody",IsRigidBody},
         {"isActive",IsActive},
         {"setIsActive",SetIsActive},
+        {"isCompound",IsCompound},
+        {"setIsCompound",SetIsCompound},
+        {"clone",Clone},
         {"getUserData",GetUserData},
         {"setUserData",SetUserData},
         {"getTransform",GetTransform},
@@ -880,6 +938,7 @@ void CollisionBodyUserdataInitMetaTable(lua_State *L){
         {"getTransformQuat",GetTransformQuat},
         {"setTransformQuat",SetTransformQuat},
         {"addCollider",AddCollider},
+        {"addColliders",AddColliders},
         {"removeCollider ",RemoveCollider},
         {"testPointInside",TestPointInside},
         {"raycast",Raycast},
@@ -1,10 +1,14 @@
 #include "static_hash.h"
 #include "objects/debug_renderer_userdata.h"
+#include "objects/aabb.h"
 #include "utils.h"
 
 #define META_NAME "rp3d::DebugRenderer"
 #define USERDATA_TYPE "rp3d::DebugRenderer"
 
+static const dmhash_t HASH_POSITION  = dmHashString64("position");
+static const dmhash_t HASH_COLOR  = dmHashString64("color");
+
 #include <render/render_ddf.h> // dmRenderDDF::DrawLine
 namespace dmRender
 {
@@ -93,6 +97,86 @@ static int GetContactNormalLength(lua_State *L){
     return 1;
 }
 
+static int SetViewAABB(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    DebugRendererUserdata *userdata = DebugRendererUserdataCheck(L, 1);
+    if(lua_isnil(L,2)){
+        userdata->renderer->removeViewAABB();
+    }else{
+        userdata->renderer->setViewAABB(AABBCheck(L,2)->aabb);
+    }
+    return 0;
+}
+
+//planes from view projection matrix(Gribb-Hartmann)
+static int SetViewFrustum(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    DebugRendererUserdata *userdata = DebugRendererUserdataCheck(L, 1);
+    if(lua_isnil(L,2)){
+        userdata->renderer->removeViewFrustum();
+        return 0;
+    }
+    dmVMath::Matrix4* m = dmScript::CheckMatrix4(L,2);
+    dmVMath::Vector4 rows[4] = {m->getRow(0), m->getRow(1), m->getRow(2), m->getRow(3)};
+    Vector3 normals[6];
+    decimal distances[6];
+    for(int i=0;i<3;i++){
+        for(int j=0;j<2;j++){
+            float sign = j==0 ? 1 : -1;
+            Vector3 normal(rows[3].getX() + sign * rows[i].getX(),
+                           rows[3].getY() + sign * rows[i].getY(),
+                           rows[3].getZ() + sign * rows[i].getZ());
+            decimal distance = rows[3].getW() + sign * rows[i].getW();
+            decimal length = normal.length();
+            if(length <= MACHINE_EPSILON){
+                luaL_error(L,"bad view projection matrix");
+            }
+            normals[i*2+j] = normal / length;
+            distances[i*2+j] = distance / length;
+        }
+    }
+    userdata->renderer->setViewFrustum(normals,distances);
+    return 0;
+}
+
+static int SetMaxNbPrimitives(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    DebugRendererUserdata *userdata = DebugRendererUserdataCheck(L, 1);
+    int maxNbPrimitives = luaL_checknumber(L,2);
+    if(maxNbPrimitives<0){
+        luaL_error(L,"maxNbPrimitives should be >= 0");
+    }
+    userdata->renderer->setMaxNbPrimitives(maxNbPrimitives);
+    return 0;
+}
+
+static int GetMaxNbPrimitives(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    DebugRendererUserdata *userdata = DebugRendererUserdataCheck(L, 1);
+    lua_pushnumber(L,userdata->renderer->getMaxNbPrimitives());
+    return 1;
+}
+
+static int SetIsStaticCacheEnabled(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    DebugRendererUserdata *userdata = DebugRendererUserdataCheck(L, 1);
+    userdata->renderer->setIsStaticCacheEnabled(lua_toboolean(L,2));
+    return 0;
+}
+
+static int GetIsStaticCacheEnabled(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    DebugRendererUserdata *userdata = DebugRendererUserdataCheck(L, 1);
+    lua_pushboolean(L,userdata->renderer->getIsStaticCacheEnabled());
+    return 1;
+}
+
 inline void RGBUintToVector(uint rgb, dmVMath::Vector4 &color){
     color.setX(((rgb & 0x00FF0000) >> 16)/256.0);
     color.setY(((rgb & 0x0000FF00) >> 8)/256.0);
@@ -161,6 +245,99 @@ static int Draw(lua_State *L){
 	return 0;
 }
 
+struct DebugBufferStreams {
+    dmBuffer::HBuffer buffer = 0x0;
+    float* positions = 0x0;
+    uint32_t count = 0;
+    uint32_t positionStride = 0;
+    float* colors = 0x0;
+    uint32_t colorComponents = 0;
+    uint32_t colorStride = 0;
+};
+
+//position stream is required. Color stream is optional.
+static void DebugBufferStreamsInit(lua_State *L, int index, DebugBufferStreams &streams){
+    streams.buffer = dmScript::CheckBufferUnpack(L,index);
+    dmBuffer::Result validate = dmBuffer::ValidateBuffer(streams.buffer);
+    if(validate!=dmBuffer::RESULT_OK ) luaL_error(L,"buffer invalid");
+
+    dmBuffer::ValueType type;
+    uint32_t components = 0;
+    dmBuffer::Result r = dmBuffer::GetStreamType(streams.buffer, HASH_POSITION, &type, &components);
+    if (r != dmBuffer::RESULT_OK) luaL_error(L,"buffer can't get position");
+    if (type != dmBuffer::VALUE_TYPE_FLOAT32 || components < 3) luaL_error(L,"position should be float32 with 3 components");
+    r = dmBuffer::GetStream(streams.buffer, HASH_POSITION, (void**)&streams.positions, &streams.count, &components, &streams.positionStride);
+    if (r != dmBuffer::RESULT_OK) luaL_error(L,"buffer can't get position");
+
+    r = dmBuffer::GetStreamType(streams.buffer, HASH_COLOR, &type, &streams.colorComponents);
+    if (r == dmBuffer::RESULT_OK){
+        if (type != dmBuffer::VALUE_TYPE_FLOAT32 || streams.colorComponents < 3) luaL_error(L,"color should be float32 with 3 or 4 components");
+        uint32_t colorCount = 0;
+        r = dmBuffer::GetStream(streams.buffer, HASH_COLOR, (void**)&streams.colors, &colorCount, &streams.colorComponents, &streams.colorStride);
+        if (r != dmBuffer::RESULT_OK) luaL_error(L,"buffer can't get color");
+    }
+}
+
+inline void DebugBufferWriteVertex(DebugBufferStreams &streams, uint32_t idx, const Vector3 &point, uint32 color){
+    float* position = streams.positions + idx * streams.positionStride;
+    position[0] = point.x;
+    position[1] = point.y;
+    position[2] = point.z;
+    if(streams.colors != 0x0){
+        float* c = streams.colors + idx * streams.colorStride;
+        c[0] = ((color & 0x00FF0000) >> 16)/255.0f;
+        c[1] = ((color & 0x0000FF00) >> 8)/255.0f;
+        c[2] = ((color & 0x000000FF) >> 0)/255.0f;
+        if(streams.colorComponents > 3) c[3] = 1.0f;
+    }
+}
+
+//unused vertices are degenerated to zero so previous frame is not drawn
+static void DebugBufferClear(DebugBufferStreams &streams, uint32_t from){
+    Vector3 zero(0,0,0);
+    for(uint32_t i=from;i<streams.count;++i){
+        DebugBufferWriteVertex(streams,i,zero,0);
+    }
+    dmBuffer::UpdateContentVersion(streams.buffer);
+}
+
+static int FillBuffer(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 2);
+    check_arg_count(L, 3);
+    DebugRendererUserdata *userdata = DebugRendererUserdataCheck(L, 1);
+
+    const Array<DebugRenderer::DebugLine>& lines = userdata->renderer->getLines();
+    if(!lua_isnil(L,2)){
+        DebugBufferStreams streams;
+        DebugBufferStreamsInit(L,2,streams);
+        uint32_t nbLines = lines.size() < streams.count/2 ? lines.size() : streams.count/2;
+        for(uint32_t i=0;i<nbLines;i++){
+            const DebugRenderer::DebugLine &line = lines[i];
+            DebugBufferWriteVertex(streams,i*2,line.point1,line.color1);
+            DebugBufferWriteVertex(streams,i*2+1,line.point2,line.color2);
+        }
+        DebugBufferClear(streams,nbLines*2);
+    }
+
+    const Array<DebugRenderer::DebugTriangle>& triangles = userdata->renderer->getTriangles();
+    if(!lua_isnil(L,3)){
+        DebugBufferStreams streams;
+        DebugBufferStreamsInit(L,3,streams);
+        uint32_t nbTriangles = triangles.size() < streams.count/3 ? triangles.size() : streams.count/3;
+        for(uint32_t i=0;i<nbTriangles;i++){
+            const DebugRenderer::DebugTriangle &triangle = triangles[i];
+            DebugBufferWriteVertex(streams,i*3,triangle.point1,triangle.color1);
+            DebugBufferWriteVertex(streams,i*3+1,triangle.point2,triangle.color2);
+            DebugBufferWriteVertex(streams,i*3+2,triangle.point3,triangle.color3);
+        }
+        DebugBufferClear(streams,nbTriangles*3);
+    }
+
+    lua_pushnumber(L,lines.size()*2);
+    lua_pushnumber(L,triangles.size()*3);
+	return 2;
+}
+
 static int ToString(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -179,7 +356,14 @@ void DebugRendererUserdataInitMetaTable(lua_State *L){
         {"setContactPointSphereRadius",SetContactPointSphereRadius},
         {"getContactNormalLength",GetContactNormalLength},
         {"setContactNormalLength",SetContactNormalLength},
+        {"setViewAABB",SetViewAABB},
+        {"setViewFrustum",SetViewFrustum},
+        {"getMaxNbPrimitives",GetMaxNbPrimitives},
+        {"setMaxNbPrimitives",SetMaxNbPrimitives},
+        {"getIsStaticCacheEnabled",GetIsStaticCacheEnabled},
+        {"setIsStaticCacheEnabled",SetIsStaticCacheEnabled},
         {"draw",Draw},
+        {"fillBuffer",FillBuffer},
         {"reset",Reset},
         {"__tostring",ToString},
         { 0, 0 }
@@ -0,0 +1,351 @@
+#include "objects/force_field_userdata.h"
+#include "objects/collider_userdata.h"
+#include "objects/aabb.h"
+#include "static_hash.h"
+#include "utils.h"
+
+#define META_NAME "rp3d::ForceField"
+#define USERDATA_TYPE "rp3d::ForceField"
+
+using namespace reactphysics3d;
+
+namespace rp3dDefold {
+
+ForceFieldUserdata::ForceFieldUserdata(PhysicsWorld *world, ForceField *field): BaseUserData(USERDATA_TYPE){
+    this->metatable_name = META_NAME;
+    this->obj = field;
+    this->world = world;
+    this->field = field;
+}
+
+ForceFieldUserdata::~ForceFieldUserdata() {
+
+}
+
+ForceFieldUserdata* ForceFieldUserdataCheck(lua_State *L, int index) {
+    ForceFieldUserdata *userdata = (ForceFieldUserdata*) BaseUserData_get_userdata(L, index, USERDATA_TYPE);
+	return userdata;
+}
+
+const char * ForceFieldTypeEnumToString(ForceFieldType type){
+    switch(type){
+        case ForceFieldType::WIND:
+            return "WIND";
+        case ForceFieldType::ATTRACTOR:
+            return "ATTRACTOR";
+        case ForceFieldType::BUOYANCY:
+            return "BUOYANCY";
+        default:
+            assert(false);
+    }
+    return "";
+}
+
+ForceFieldType ForceFieldTypeStringToEnum(lua_State *L,const char* str){
+    switch (hash_string(str)){
+        case HASH_WIND:
+            return ForceFieldType::WIND;
+        case HASH_ATTRACTOR:
+            return ForceFieldType::ATTRACTOR;
+        case HASH_BUOYANCY:
+            return ForceFieldType::BUOYANCY;
+        default:
+            luaL_error(L, "unknown ForceFieldType:%s", str);
+            break;
+    }
+    return ForceFieldType::WIND; //luaL_error does not return
+}
+
+static Vector3 CheckDirection(lua_State *L, int index, const char* name){
+    Vector3 direction = checkRp3dVector3(L, index);
+    if(direction.lengthSquare() <= MACHINE_EPSILON){
+        luaL_error(L,"%s should not be zero", name);
+    }
+    return direction;
+}
+
+static decimal CheckNotNegative(lua_State *L, int index, const char* name){
+    decimal value = luaL_checknumber(L, index);
+    if(value < 0){
+        luaL_error(L,"%s should be >= 0", name);
+    }
+    return value;
+}
+
+ForceFieldSettings ForceFieldSettings_from_table(lua_State *L, int index){
+    ForceFieldSettings settings;
+    if (lua_istable(L, index)) {
+        lua_pushvalue(L,index);
+         lua_pushnil(L);  /* first key */
+         while (lua_next(L, -2) != 0) {
+            const char* key = lua_tostring(L, -2);
+            switch (hash_string(key)){
+                case HASH_type:
+                    settings.type = ForceFieldTypeStringToEnum(L,luaL_checkstring(L,-1));break;
+                case HASH_direction:
+                    settings.direction = CheckDirection(L,-1,"direction");break;
+                case HASH_strength:
+                    settings.strength = luaL_checknumber(L,-1);break;
+                case HASH_center:
+                    settings.center = checkRp3dVector3(L,-1);break;
+                case HASH_radius:
+                    settings.radius = CheckNotNegative(L,-1,"radius");break;
+                case HASH_fluidDensity:
+                    settings.fluidDensity = CheckNotNegative(L,-1,"fluidDensity");break;
+                case HASH_linearDrag:
+                    settings.linearDrag = CheckNotNegative(L,-1,"linearDrag");break;
+                case HASH_angularDrag:
+                    settings.angularDrag = CheckNotNegative(L,-1,"angularDrag");break;
+                case HASH_collideWithMaskBits:
+                    settings.collideWithMaskBits = luaL_checknumber(L,-1);break;
+                default:
+                    luaL_error(L, "unknown key:%s", key);
+                    break;
+            }
+           /* removes 'value'; keeps 'key' for next iteration */
+           lua_pop(L, 1);
+        }
+        lua_pop(L,1); //remove table
+    }else{
+        luaL_error(L,"ForceFieldSettings should be table");
+    }
+    return settings;
+}
+
+static int GetType(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushstring(L, ForceFieldTypeEnumToString(userdata->field->getType()));
+	return 1;
+}
+
+static int IsEnabled(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushboolean(L, userdata->field->isEnabled());
+	return 1;
+}
+
+static int SetIsEnabled(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    if(!lua_isboolean(L,2)){
+        luaL_error(L,"isEnabled should be boolean");
+    }
+    userdata->field->setIsEnabled(lua_toboolean(L, 2));
+	return 0;
+}
+
+static int GetCollider(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    Collider* collider = userdata->field->getCollider();
+    if(collider == NULL){
+        lua_pushnil(L);
+    }else{
+        ColliderPush(L, collider);
+    }
+	return 1;
+}
+
+static int GetAABB(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    AABBPush(L, userdata->field->getAABB());
+	return 1;
+}
+
+static int SetAABB(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setAABB(AABBCheck(L, 2)->aabb);
+	return 0;
+}
+
+static int GetDirection(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->field->getDirection());
+	return 1;
+}
+
+static int SetDirection(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setDirection(CheckDirection(L, 2, "direction"));
+	return 0;
+}
+
+static int GetStrength(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->field->getStrength());
+	return 1;
+}
+
+static int SetStrength(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setStrength(luaL_checknumber(L, 2));
+	return 0;
+}
+
+static int GetCenter(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->field->getCenter());
+	return 1;
+}
+
+static int SetCenter(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setCenter(checkRp3dVector3(L, 2));
+	return 0;
+}
+
+static int GetRadius(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->field->getRadius());
+	return 1;
+}
+
+static int SetRadius(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setRadius(CheckNotNegative(L, 2, "radius"));
+	return 0;
+}
+
+static int GetFluidDensity(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->field->getFluidDensity());
+	return 1;
+}
+
+static int SetFluidDensity(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setFluidDensity(CheckNotNegative(L, 2, "fluidDensity"));
+	return 0;
+}
+
+static int GetLinearDrag(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->field->getLinearDrag());
+	return 1;
+}
+
+static int SetLinearDrag(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setLinearDrag(CheckNotNegative(L, 2, "linearDrag"));
+	return 0;
+}
+
+static int GetAngularDrag(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->field->getAngularDrag());
+	return 1;
+}
+
+static int SetAngularDrag(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setAngularDrag(CheckNotNegative(L, 2, "angularDrag"));
+	return 0;
+}
+
+static int GetCollideWithMaskBits(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->field->getCollideWithMaskBits());
+	return 1;
+}
+
+static int SetCollideWithMaskBits(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    userdata->field->setCollideWithMaskBits(luaL_checknumber(L, 2));
+	return 0;
+}
+
+static int ToString(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    ForceFieldUserdata *userdata = ForceFieldUserdataCheck(L, 1);
+    lua_pushfstring( L, "rp3d::ForceField[%p]",(void *) userdata->field);
+	return 1;
+}
+
+void ForceFieldUserdataInitMetaTable(lua_State *L){
+    int top = lua_gettop(L);
+
+    luaL_Reg functions[] = {
+        {"getType", GetType},
+        {"isEnabled", IsEnabled},
+        {"setIsEnabled", SetIsEnabled},
+        {"getCollider", GetCollider},
+        {"getAABB", GetAABB},
+        {"setAABB", SetAABB},
+        {"getDirection", GetDirection},
+        {"setDirection", SetDirection},
+        {"getStrength", GetStrength},
+        {"setStrength", SetStrength},
+        {"getCenter", GetCenter},
+        {"setCenter", SetCenter},
+        {"getRadius", GetRadius},
+        {"setRadius", SetRadius},
+        {"getFluidDensity", GetFluidDensity},
+        {"setFluidDensity", SetFluidDensity},
+        {"getLinearDrag", GetLinearDrag},
+        {"setLinearDrag", SetLinearDrag},
+        {"getAngularDrag", GetAngularDrag},
+        {"setAngularDrag", SetAngularDrag},
+        {"getCollideWithMaskBits", GetCollideWithMaskBits},
+        {"setCollideWithMaskBits", SetCollideWithMaskBits},
+        {"__tostring", ToString},
+        { 0, 0 }
+    };
+    luaL_newmetatable(L, META_NAME);
+    luaL_register (L, NULL,functions);
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -1, "__index");
+    lua_pop(L, 1);
+
+    assert(top == lua_gettop(L));
+}
+
+void ForceFieldUserdata::Destroy(lua_State *L){
+    world = NULL;
+    field = NULL;
+    BaseUserData::Destroy(L);
+}
+
+}
@@ -66,6 +66,12 @@ static const char * JointsPositionCorrectionTechniqueEnumToString(JointsPosition
 
 
 
+decimal JointBreakThresholdCheck(lua_State *L, int index, const char* name){
+    double value = luaL_checknumber(L,index);
+    if(value < 0) luaL_error(L,"%s must be >=0",name);
+    return value;
+}
+
 void JointInfoPush(lua_State *L,  JointInfo *info){
     lua_newtable(L);
     CollisionBodyPush(L,info->body1);
@@ -78,6 +84,10 @@ void JointInfoPush(lua_State *L,  JointInfo *info){
     lua_setfield(L, -2, "positionCorrectionTechnique");
     lua_pushboolean(L,info->isCollisionEnabled);
     lua_setfield(L, -2, "isCollisionEnabled");
+    lua_pushnumber(L,info->breakForce);
+    lua_setfield(L, -2, "breakForce");
+    lua_pushnumber(L,info->breakTorque);
+    lua_setfield(L, -2, "breakTorque");
 
 
     switch(info->type){
@@ -191,7 +201,7 @@ static BallAndSocketJointInfo* BallAndSocketJointInfoCheck(lua_State *L, int ind
     RigidBody* body2 = (RigidBody*)CollisionBodyRigidUserdataCheck(L,-1)->body;
     lua_pop(L,1);
 
-    BallAndSocketJointInfo* info = new BallAndSocketJointInfo(body1,body2,Vector3(0,0,0));
+    BallAndSocketJointInfo info(body1,body2,Vector3(0,0,0));
 
     /* table is in the stack at index 't' */
     lua_pushnil(L);  /* first key */
@@ -204,22 +214,28 @@ static BallAndSocketJointInfo* BallAndSocketJointInfoCheck(lua_State *L, int ind
             case HASH_body2:break;
             case HASH_type:break;
             case HASH_positionCorrectionTechnique:
-                info->positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
+                info.positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
                 break;
             case HASH_isCollisionEnabled:
-                info->isCollisionEnabled = lua_toboolean(L,-1);
+                info.isCollisionEnabled = lua_toboolean(L,-1);
+                break;
+            case HASH_breakForce:
+                info.breakForce = JointBreakThresholdCheck(L,-1,"breakForce");
+                break;
+            case HASH_breakTorque:
+                info.breakTorque = JointBreakThresholdCheck(L,-1,"breakTorque");
                 break;
             case HASH_isUsingLocalSpaceAnchors:
-                info->isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
+                info.isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
                 break;
             case HASH_anchorPointBody1LocalSpace:
-                info->anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointBody2LocalSpace:
-                info->anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointWorldSpace:
-                info->anchorPointWorldSpace = checkRp3dVector3(L,-1);
+                info.anchorPointWorldSpace = checkRp3dVector3(L,-1);
                 break;
            default:
                luaL_error(L, "unknown key:%s", key);
@@ -229,7 +245,7 @@ static BallAndSocketJointInfo* BallAndSocketJointInfoCheck(lua_State *L, int ind
       lua_pop(L, 1);
     }
 
-    return info;
+    return new BallAndSocketJointInfo(info);
 
 }
 
@@ -250,7 +266,7 @@ static HingeJointInfo* HingeJointInfoCheck(lua_State *L, int index){
     RigidBody* body2 = (RigidBody*)CollisionBodyRigidUserdataCheck(L,-1)->body;
     lua_pop(L,1);
 
-    HingeJointInfo* info = new HingeJointInfo(body1,body2,Vector3(0,0,0),Vector3(0,1,0));
+    HingeJointInfo info(body1,body2,Vector3(0,0,0),Vector3(0,1,0));
 
     /* table is in the stack at index 't' */
     lua_pushnil(L);  /* first key */
@@ -263,49 +279,55 @@ static HingeJointInfo* HingeJointInfoCheck(lua_State *L, int index){
             case HASH_body2:break;
             case HASH_type:break;
             case HASH_positionCorrectionTechnique:
-                info->positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
+                info.positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
                 break;
             case HASH_isCollisionEnabled:
-                info->isCollisionEnabled = lua_toboolean(L,-1);
+                info.isCollisionEnabled = lua_toboolean(L,-1);
+                break;
+            case HASH_breakForce:
+                info.breakForce = JointBreakThresholdCheck(L,-1,"breakForce");
+                break;
+            case HASH_breakTorque:
+                info.breakTorque = JointBreakThresholdCheck(L,-1,"breakTorque");
                 break;
             case HASH_isUsingLocalSpaceAnchors:
-                info->isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
+                info.isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
                 break;
             case HASH_anchorPointBody1LocalSpace:
-                info->anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointBody2LocalSpace:
-                info->anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointWorldSpace:
-                info->anchorPointWorldSpace = checkRp3dVector3(L,-1);
+                info.anchorPointWorldSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_rotationAxisWorld:
-                info->rotationAxisWorld = checkRp3dVector3(L,-1);
+                info.rotationAxisWorld = checkRp3dVector3(L,-1);
                 break;
             case HASH_rotationAxisBody1Local:
-                info->rotationAxisBody1Local = checkRp3dVector3(L,-1);
+                info.rotationAxisBody1Local = checkRp3dVector3(L,-1);
                 break;
             case HASH_rotationAxisBody2Local:
-                info->rotationAxisBody2Local = checkRp3dVector3(L,-1);
+                info.rotationAxisBody2Local = checkRp3dVector3(L,-1);
                 break;
             case HASH_isLimitEnabled:
-                info->isLimitEnabled = lua_toboolean(L,-1);
+                info.isLimitEnabled = lua_toboolean(L,-1);
                 break;
             case HASH_isMotorEnabled:
-                info->isMotorEnabled = lua_toboolean(L,-1);
+                info.isMotorEnabled = lua_toboolean(L,-1);
                 break;
             case HASH_minAngleLimit:
-                info->minAngleLimit = luaL_checknumber(L,-1);
+                info.minAngleLimit = luaL_checknumber(L,-1);
                 break;
             case HASH_maxAngleLimit:
-                info->maxAngleLimit = luaL_checknumber(L,-1);
+                info.maxAngleLimit = luaL_checknumber(L,-1);
                 break;
             case HASH_motorSpeed:
-                info->motorSpeed = luaL_checknumber(L,-1);
+                info.motorSpeed = luaL_checknumber(L,-1);
                 break;
             case HASH_maxMotorTorque:
-                info->maxMotorTorque = luaL_checknumber(L,-1);
+                info.maxMotorTorque = luaL_checknumber(L,-1);
                 break;
            default:
                luaL_error(L, "unknown key:%s", key);
@@ -315,7 +337,7 @@ static HingeJointInfo* HingeJointInfoCheck(lua_State *L, int index){
       lua_pop(L, 1);
     }
 
-    return info;
+    return new HingeJointInfo(info);
 
 }
 
@@ -336,7 +358,7 @@ static SliderJointInfo* SliderJointInfoCheck(lua_State *L, int index){
     RigidBody* body2 = (RigidBody*)CollisionBodyRigidUserdataCheck(L,-1)->body;
     lua_pop(L,1);
 
-    SliderJointInfo* info = new SliderJointInfo(body1,body2,Vector3(0,0,0),Vector3(0,1,0));
+    SliderJointInfo info(body1,body2,Vector3(0,0,0),Vector3(0,1,0));
 
     /* table is in the stack at index 't' */
     lua_pushnil(L);  /* first key */
@@ -349,46 +371,52 @@ static SliderJointInfo* SliderJointInfoCheck(lua_State *L, int index){
             case HASH_body2:break;
             case HASH_type:break;
             case HASH_positionCorrectionTechnique:
-                info->positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
+                info.positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
                 break;
             case HASH_isCollisionEnabled:
-                info->isCollisionEnabled = lua_toboolean(L,-1);
+                info.isCollisionEnabled = lua_toboolean(L,-1);
+                break;
+            case HASH_breakForce:
+                info.breakForce = JointBreakThresholdCheck(L,-1,"breakForce");
+                break;
+            case HASH_breakTorque:
+                info.breakTorque = JointBreakThresholdCheck(L,-1,"breakTorque");
                 break;
             case HASH_isUsingLocalSpaceAnchors:
-                info->isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
+                info.isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
                 break;
             case HASH_anchorPointBody1LocalSpace:
-                info->anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointBody2LocalSpace:
-                info->anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointWorldSpace:
-                info->anchorPointWorldSpace = checkRp3dVector3(L,-1);
+                info.anchorPointWorldSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_sliderAxisWorldSpace:
-                info->sliderAxisWorldSpace = checkRp3dVector3(L,-1);
+                info.sliderAxisWorldSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_sliderAxisBody1Local:
-                info->sliderAxisBody1Local = checkRp3dVector3(L,-1);
+                info.sliderAxisBody1Local = checkRp3dVector3(L,-1);
                 break;
             case HASH_isLimitEnabled:
-                info->isLimitEnabled = lua_toboolean(L,-1);
+                info.isLimitEnabled = lua_toboolean(L,-1);
                 break;
             case HASH_isMotorEnabled:
-                info->isMotorEnabled = lua_toboolean(L,-1);
+                info.isMotorEnabled = lua_toboolean(L,-1);
                 break;
             case HASH_minTranslationLimit:
-                info->minTranslationLimit = luaL_checknumber(L,-1);
+                info.minTranslationLimit = luaL_checknumber(L,-1);
                 break;
             case HASH_maxTranslationLimit:
-                info->maxTranslationLimit = luaL_checknumber(L,-1);
+                info.maxTranslationLimit = luaL_checknumber(L,-1);
                 break;
             case HASH_motorSpeed:
-                info->motorSpeed = luaL_checknumber(L,-1);
+                info.motorSpeed = luaL_checknumber(L,-1);
                 break;
             case HASH_maxMotorForce:
-                info->maxMotorForce = luaL_checknumber(L,-1);
+                info.maxMotorForce = luaL_checknumber(L,-1);
                 break;
            default:
                luaL_error(L, "unknown key:%s", key);
@@ -398,7 +426,7 @@ static SliderJointInfo* SliderJointInfoCheck(lua_State *L, int index){
       lua_pop(L, 1);
     }
 
-    return info;
+    return new SliderJointInfo(info);
 
 }
 
@@ -419,7 +447,7 @@ static FixedJointInfo* FixedJointInfoCheck(lua_State *L, int index){
     RigidBody* body2 = (RigidBody*)CollisionBodyRigidUserdataCheck(L,-1)->body;
     lua_pop(L,1);
 
-    FixedJointInfo* info = new FixedJointInfo(body1,body2,Vector3(0,0,0));
+    FixedJointInfo info(body1,body2,Vector3(0,0,0));
 
     /* table is in the stack at index 't' */
     lua_pushnil(L);  /* first key */
@@ -432,22 +460,28 @@ static FixedJointInfo* FixedJointInfoCheck(lua_State *L, int index){
             case HASH_body2:break;
             case HASH_type:break;
             case HASH_positionCorrectionTechnique:
-                info->positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
+                info.positionCorrectionTechnique = JointsPositionCorrectionTechniqueStringToEnum(L,luaL_checkstring(L,-1));
                 break;
             case HASH_isCollisionEnabled:
-                info->isCollisionEnabled = lua_toboolean(L,-1);
+                info.isCollisionEnabled = lua_toboolean(L,-1);
+                break;
+            case HASH_breakForce:
+                info.breakForce = JointBreakThresholdCheck(L,-1,"breakForce");
+                break;
+            case HASH_breakTorque:
+                info.breakTorque = JointBreakThresholdCheck(L,-1,"breakTorque");
                 break;
             case HASH_isUsingLocalSpaceAnchors:
-                info->isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
+                info.isUsingLocalSpaceAnchors = lua_toboolean(L,-1);
                 break;
             case HASH_anchorPointBody1LocalSpace:
-                info->anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody1LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointBody2LocalSpace:
-                info->anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
+                info.anchorPointBody2LocalSpace = checkRp3dVector3(L,-1);
                 break;
             case HASH_anchorPointWorldSpace:
-                info->anchorPointWorldSpace = checkRp3dVector3(L,-1);
+                info.anchorPointWorldSpace = checkRp3dVector3(L,-1);
                 break;
            default:
                luaL_error(L, "unknown key:%s", key);
@@ -457,11 +491,12 @@ static FixedJointInfo* FixedJointInfoCheck(lua_State *L, int index){
       lua_pop(L, 1);
     }
 
-    return info;
+    return new FixedJointInfo(info);
 
 }
 
 //YOU NEED DELETE JointInfo after use.
+//the info is allocated only when the whole table is parsed, so a lua error raised by a field does not leak it
 JointInfo* JointInfoCheck(lua_State *L, int index){
     if (!lua_istable(L, index))  luaL_error(L,"JointInfo should be table");
 
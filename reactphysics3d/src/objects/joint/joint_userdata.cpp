@@ -102,6 +102,46 @@ int Joint_IsCollisionEnabled(lua_State *L){
     return 1;
 }
 
+int Joint_GetBreakForce(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    JointUserdata* joint = JointUserdataCheck(L,1);
+    lua_pushnumber(L,joint->joint->getBreakForce());
+    return 1;
+}
+
+int Joint_SetBreakForce(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    JointUserdata* joint = JointUserdataCheck(L,1);
+    joint->joint->setBreakForce(JointBreakThresholdCheck(L,2,"breakForce"));
+    return 0;
+}
+
+int Joint_GetBreakTorque(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    JointUserdata* joint = JointUserdataCheck(L,1);
+    lua_pushnumber(L,joint->joint->getBreakTorque());
+    return 1;
+}
+
+int Joint_SetBreakTorque(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    JointUserdata* joint = JointUserdataCheck(L,1);
+    joint->joint->setBreakTorque(JointBreakThresholdCheck(L,2,"breakTorque"));
+    return 0;
+}
+
+int Joint_IsBroken(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    JointUserdata* joint = JointUserdataCheck(L,1);
+    lua_pushboolean(L,joint->joint->isBroken());
+    return 1;
+}
+
 int Joint_GetEntityId(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
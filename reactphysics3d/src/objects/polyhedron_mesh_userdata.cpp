@@ -1,6 +1,7 @@
 #include "static_hash.h"
 #include "objects/polyhedron_mesh_userdata.h"
 #include "utils.h"
+#include <reactphysics3d/memory/DefaultAllocator.h>
 
 #define META_NAME "rp3d::PolyhedronMesh"
 #define USERDATA_TYPE "rp3d::PolyhedronMesh"
@@ -324,4 +325,211 @@ PolyhedronMeshUserdata* PolyhedronMeshUserdataFromBufferClone(PhysicsCommon *phy
 }
 
 
+
+// Build a mesh from a convex polyhedron. Return NULL if the polyhedron is not valid
+static PolyhedronMeshUserdata* PolyhedronMeshUserdataFromPolyhedron(PhysicsCommon *physicsCommon,
+                                                                   const Vector3* hullVertices, uint32 nbVertices,
+                                                                   const uint32* hullIndices, uint32 nbIndices,
+                                                                   const PolygonVertexArray::PolygonFace* hullFaces, uint32 nbFaces){
+    float *vertices = new float[nbVertices*3];
+    for (uint32 i = 0; i < nbVertices; ++i){
+        vertices[i*3] = hullVertices[i].x;
+        vertices[i*3+1] = hullVertices[i].y;
+        vertices[i*3+2] = hullVertices[i].z;
+    }
+    int *indices = new int[nbIndices];
+    for (uint32 i = 0; i < nbIndices; ++i){
+        indices[i] = hullIndices[i];
+    }
+    PolygonVertexArray::PolygonFace* faces = new PolygonVertexArray::PolygonFace[nbFaces];
+    for (uint32 i = 0; i < nbFaces; ++i){
+        faces[i] = hullFaces[i];
+    }
+
+    PolygonVertexArray* polygonVertexArray = new PolygonVertexArray(
+        nbVertices, vertices,  3 * sizeof(float),
+        indices, sizeof(int),
+        nbFaces, faces,
+        PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+        PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    PolyhedronMesh* polyhedronMesh = physicsCommon->createPolyhedronMesh(polygonVertexArray);
+    if(polyhedronMesh == NULL){
+        delete[] vertices;
+        delete[] indices;
+        delete[] faces;
+        delete polygonVertexArray;
+        return NULL;
+    }
+    PolyhedronMeshUserdata* result = new PolyhedronMeshUserdata();
+    result->obj = polyhedronMesh;
+    result->mesh = polyhedronMesh;
+
+    result->vertices = vertices;
+    result->indices = indices;
+    result->faces = faces;
+    result->polygonVertexArray = polygonVertexArray;
+    return result;
+}
+
+// Build a mesh from the convex hull of a cloud of points. Return NULL if the points are degenerate
+static PolyhedronMeshUserdata* PolyhedronMeshUserdataFromConvexHull(PhysicsCommon *physicsCommon, const Vector3* points,
+                                                                   uint32 nbPoints, uint32 maxVertices){
+    DefaultAllocator allocator;
+    Array<Vector3> hullVertices(allocator);
+    Array<uint32> hullIndices(allocator);
+    Array<PolygonVertexArray::PolygonFace> hullFaces(allocator);
+    if(!QuickHull::computeConvexHull(points, nbPoints, allocator, hullVertices, hullIndices, hullFaces, maxVertices)){
+        return NULL;
+    }
+    return PolyhedronMeshUserdataFromPolyhedron(physicsCommon, &hullVertices[0], hullVertices.size(),
+                                                &hullIndices[0], hullIndices.size(), &hullFaces[0], hullFaces.size());
+}
+
+static uint32 CheckMaxVertices(lua_State *L, int index){
+    if(lua_gettop(L) < index || lua_isnil(L, index)) return 0;
+    int maxVertices = luaL_checkinteger(L, index);
+    //luaL_checkinteger truncates numbers in lua 5.1
+    if(lua_tonumber(L, index) != maxVertices) luaL_error(L,"maxVertices should be integer");
+    if(maxVertices < 4) luaL_error(L,"maxVertices should be >= 4");
+    return maxVertices;
+}
+
+PolyhedronMeshUserdata* PolyhedronMeshUserdataConvexHullFromLua(PhysicsCommon *physicsCommon,lua_State *L){
+    check_arg_count(L, 1, 2);
+    uint32 maxVertices = CheckMaxVertices(L, 2);
+
+    //parse vertices
+    if (!lua_istable(L, 1)) luaL_error(L,"vertices is not table");
+    int verticesSize = lua_objlen(L,1)+1; //start from 0
+    if (verticesSize % 3 != 0) luaL_error(L,"vertices size should be multiple of 3");
+    int nbPoints = verticesSize/3;
+    Vector3 *points = new Vector3[nbPoints];
+    for(int i=0;i<verticesSize;i++){
+        lua_pushnumber(L, i);
+        lua_gettable(L, 1);
+        if(!lua_isnumber(L, -1)){
+            delete[] points;
+            luaL_error(L,"vertices[%d] is not number",i);
+        }
+        points[i/3][i%3] = lua_tonumber(L,-1);
+        lua_pop(L,1);
+    }
+
+    PolyhedronMeshUserdata* result = PolyhedronMeshUserdataFromConvexHull(physicsCommon, points, nbPoints, maxVertices);
+    delete[] points;
+    if(result == NULL) luaL_error(L,"can't build convex hull. Need at least 4 not coplanar points");
+    return result;
+}
+
+PolyhedronMeshUserdata* PolyhedronMeshUserdataConvexHullFromBufferClone(PhysicsCommon *physicsCommon,lua_State *L){
+    check_arg_count(L, 1, 2);
+    uint32 maxVertices = CheckMaxVertices(L, 2);
+    dmBuffer::HBuffer buffer = dmScript::CheckBufferUnpack(L,1);
+    dmBuffer::Result validate = dmBuffer::ValidateBuffer(buffer);
+    if(validate!=dmBuffer::RESULT_OK ) luaL_error(L,"buffer invalid");
+    float* positions = 0x0;
+    uint32_t components = 0;
+    uint32_t stride = 0;
+    uint32_t count = 0;
+    dmBuffer::Result r = dmBuffer::GetStream(buffer, HASH_POSITION, (void**)&positions, &count, &components, &stride);
+    if (r != dmBuffer::RESULT_OK) luaL_error(L,"buffer can't get position");
+
+    Vector3 *points = new Vector3[count];
+    float *verticesIter = positions;
+    for (uint32_t i = 0; i < count; ++i){
+        points[i].setAllValues(verticesIter[0], verticesIter[1], verticesIter[2]);
+        verticesIter += stride;
+    }
+
+    PolyhedronMeshUserdata* result = PolyhedronMeshUserdataFromConvexHull(physicsCommon, points, count, maxVertices);
+    delete[] points;
+    if(result == NULL) luaL_error(L,"can't build convex hull. Need at least 4 not coplanar points");
+    return result;
+}
+
+static void ConvexDecompositionSettings_from_table(lua_State *L, int index, ConvexDecomposition::Settings &settings){
+    if (!lua_istable(L, index)) luaL_error(L,"ConvexDecompositionSettings should be table");
+    lua_pushvalue(L,index);
+    lua_pushnil(L);  /* first key */
+    while (lua_next(L, -2) != 0) {
+        const char* key = lua_tostring(L, -2);
+        switch (hash_string(key)){
+            case HASH_maxHulls:{
+                int maxHulls = luaL_checkinteger(L,-1);
+                if(maxHulls < 1) luaL_error(L,"maxHulls should be >= 1");
+                settings.maxNbHulls = maxHulls;
+                break;
+            }
+            case HASH_maxVerticesPerHull:{
+                int maxVerticesPerHull = luaL_checkinteger(L,-1);
+                if(maxVerticesPerHull < 4) luaL_error(L,"maxVerticesPerHull should be >= 4");
+                settings.maxNbVerticesPerHull = maxVerticesPerHull;
+                break;
+            }
+            case HASH_resolution:{
+                int resolution = luaL_checkinteger(L,-1);
+                if(resolution < 2 || resolution > 128) luaL_error(L,"resolution should be in [2,128]");
+                settings.resolution = resolution;
+                break;
+            }
+            case HASH_concavity:
+                settings.concavity = luaL_checknumber(L,-1);break;
+            default:
+                luaL_error(L, "unknown key:%s", key);
+                break;
+        }
+        lua_pop(L, 1);
+    }
+    lua_pop(L,1); //remove table
+}
+
+void PolyhedronMeshUserdataPushConvexDecompositionFromBufferClone(PhysicsCommon *physicsCommon,lua_State *L){
+    check_arg_count(L, 1, 2);
+    ConvexDecomposition::Settings settings;
+    if(lua_gettop(L) == 2 && !lua_isnil(L, 2)) ConvexDecompositionSettings_from_table(L, 2, settings);
+    dmBuffer::HBuffer buffer = dmScript::CheckBufferUnpack(L,1);
+    dmBuffer::Result validate = dmBuffer::ValidateBuffer(buffer);
+    if(validate!=dmBuffer::RESULT_OK ) luaL_error(L,"buffer invalid");
+    float* positions = 0x0;
+    uint32_t components = 0;
+    uint32_t stride = 0;
+    uint32_t count = 0;
+    dmBuffer::Result r = dmBuffer::GetStream(buffer, HASH_POSITION, (void**)&positions, &count, &components, &stride);
+    if (r != dmBuffer::RESULT_OK) luaL_error(L,"buffer can't get position");
+    if (count < 3 || count % 3 != 0) luaL_error(L,"buffer should contain triangles");
+
+    Vector3 *points = new Vector3[count];
+    uint32 *triangleIndices = new uint32[count];
+    float *verticesIter = positions;
+    for (uint32_t i = 0; i < count; ++i){
+        points[i].setAllValues(verticesIter[0], verticesIter[1], verticesIter[2]);
+        triangleIndices[i] = i;
+        verticesIter += stride;
+    }
+
+    DefaultAllocator allocator;
+    Array<Vector3> hullsVertices(allocator);
+    Array<uint32> hullsIndices(allocator);
+    Array<PolygonVertexArray::PolygonFace> hullsFaces(allocator);
+    Array<ConvexDecomposition::Hull> hulls(allocator);
+    bool decomposed = ConvexDecomposition::computeDecomposition(points, triangleIndices, count/3, allocator, settings,
+                                                                hullsVertices, hullsIndices, hullsFaces, hulls);
+    delete[] points;
+    delete[] triangleIndices;
+
+    lua_newtable(L);
+    int luaIndex = 1;
+    for (uint32 i = 0; decomposed && i < hulls.size(); ++i){
+        const ConvexDecomposition::Hull &hull = hulls[i];
+        PolyhedronMeshUserdata* mesh = PolyhedronMeshUserdataFromPolyhedron(physicsCommon,
+                &hullsVertices[hull.verticesStart], hull.nbVertices,
+                &hullsIndices[hull.indicesStart], hull.nbIndices,
+                &hullsFaces[hull.facesStart], hull.nbFaces);
+        if(mesh == NULL) continue;
+        mesh->Push(L);
+        lua_rawseti(L, -2, luaIndex++);
+    }
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,358 @@
+#include "objects/raycast_vehicle_userdata.h"
+#include "objects/collider_userdata.h"
+#include "objects/collision_body_userdata.h"
+#include "static_hash.h"
+#include "utils.h"
+
+#define META_NAME "rp3d::RaycastVehicle"
+#define USERDATA_TYPE "rp3d::RaycastVehicle"
+
+using namespace reactphysics3d;
+
+namespace rp3dDefold {
+
+RaycastVehicleUserdata::RaycastVehicleUserdata(PhysicsWorld *world, RaycastVehicle *vehicle): BaseUserData(USERDATA_TYPE){
+    this->metatable_name = META_NAME;
+    this->obj = vehicle;
+    this->world = world;
+    this->vehicle = vehicle;
+}
+
+RaycastVehicleUserdata::~RaycastVehicleUserdata() {
+
+}
+
+RaycastVehicleUserdata* RaycastVehicleUserdataCheck(lua_State *L, int index) {
+    RaycastVehicleUserdata *userdata = (RaycastVehicleUserdata*) BaseUserData_get_userdata(L, index, USERDATA_TYPE);
+	return userdata;
+}
+
+static Vector3 CheckDirection(lua_State *L, int index, const char* name){
+    Vector3 direction = checkRp3dVector3(L, index);
+    if(direction.lengthSquare() <= MACHINE_EPSILON){
+        luaL_error(L,"%s should not be zero", name);
+    }
+    return direction;
+}
+
+static decimal CheckNotNegative(lua_State *L, int index, const char* name){
+    decimal value = luaL_checknumber(L, index);
+    if(value < 0){
+        luaL_error(L,"%s should be >= 0", name);
+    }
+    return value;
+}
+
+static uint32 CheckWheelIndex(lua_State *L, RaycastVehicleUserdata *userdata, int index){
+    int idx = luaL_checknumber(L, index);
+    if(idx<0 || idx >= (int)userdata->vehicle->getNbWheels()){
+        luaL_error(L,"bad idx:%d. Size:%d",idx,userdata->vehicle->getNbWheels());
+    }
+    return idx;
+}
+
+RaycastVehicleSettings RaycastVehicleSettings_from_table(lua_State *L, int index){
+    RaycastVehicleSettings settings;
+    if (lua_istable(L, index)) {
+        lua_pushvalue(L,index);
+         lua_pushnil(L);  /* first key */
+         while (lua_next(L, -2) != 0) {
+            const char* key = lua_tostring(L, -2);
+            switch (hash_string(key)){
+                case HASH_forward:
+                    settings.forward = CheckDirection(L,-1,"forward");break;
+                case HASH_up:
+                    settings.up = CheckDirection(L,-1,"up");break;
+                case HASH_collideWithMaskBits:
+                    settings.collideWithMaskBits = luaL_checknumber(L,-1);break;
+                default:
+                    luaL_error(L, "unknown key:%s", key);
+                    break;
+            }
+           /* removes 'value'; keeps 'key' for next iteration */
+           lua_pop(L, 1);
+        }
+        lua_pop(L,1); //remove table
+    }else{
+        luaL_error(L,"RaycastVehicleSettings should be table");
+    }
+    if(settings.forward.cross(settings.up).lengthSquare() <= MACHINE_EPSILON){
+        luaL_error(L,"forward and up should not be parallel");
+    }
+    return settings;
+}
+
+WheelSettings WheelSettings_from_table(lua_State *L, int index){
+    WheelSettings settings;
+    if (lua_istable(L, index)) {
+        lua_pushvalue(L,index);
+         lua_pushnil(L);  /* first key */
+         while (lua_next(L, -2) != 0) {
+            const char* key = lua_tostring(L, -2);
+            switch (hash_string(key)){
+                case HASH_connectionPoint:
+                    settings.connectionPoint = checkRp3dVector3(L,-1);break;
+                case HASH_radius:
+                    settings.radius = luaL_checknumber(L,-1);break;
+                case HASH_suspensionRestLength:
+                    settings.suspensionRestLength = CheckNotNegative(L,-1,"suspensionRestLength");break;
+                case HASH_maxSuspensionTravel:
+                    settings.maxSuspensionTravel = CheckNotNegative(L,-1,"maxSuspensionTravel");break;
+                case HASH_suspensionStiffness:
+                    settings.suspensionStiffness = CheckNotNegative(L,-1,"suspensionStiffness");break;
+                case HASH_dampingCompression:
+                    settings.dampingCompression = CheckNotNegative(L,-1,"dampingCompression");break;
+                case HASH_dampingRelaxation:
+                    settings.dampingRelaxation = CheckNotNegative(L,-1,"dampingRelaxation");break;
+                case HASH_maxSuspensionForce:
+                    settings.maxSuspensionForce = CheckNotNegative(L,-1,"maxSuspensionForce");break;
+                case HASH_frictionSlip:
+                    settings.frictionSlip = CheckNotNegative(L,-1,"frictionSlip");break;
+                case HASH_rollInfluence:
+                    settings.rollInfluence = luaL_checknumber(L,-1);break;
+                default:
+                    luaL_error(L, "unknown key:%s", key);
+                    break;
+            }
+           /* removes 'value'; keeps 'key' for next iteration */
+           lua_pop(L, 1);
+        }
+        lua_pop(L,1); //remove table
+    }else{
+        luaL_error(L,"WheelSettings should be table");
+    }
+    if(settings.radius <= 0){
+        luaL_error(L,"radius should be > 0");
+    }
+    return settings;
+}
+
+static int AddWheel(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    WheelSettings settings;
+    if(!lua_isnoneornil(L, 2)){
+        settings = WheelSettings_from_table(L, 2);
+    }
+    lua_pushnumber(L, userdata->vehicle->addWheel(settings));
+	return 1;
+}
+
+static int GetNbWheels(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getNbWheels());
+	return 1;
+}
+
+static int GetBody(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    CollisionBodyPush(L, userdata->vehicle->getBody());
+	return 1;
+}
+
+static int GetSteering(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getSteering(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int SetSteering(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 3);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    userdata->vehicle->setSteering(CheckWheelIndex(L, userdata, 2), luaL_checknumber(L, 3));
+	return 0;
+}
+
+static int GetEngineForce(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getEngineForce(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int SetEngineForce(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 3);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    userdata->vehicle->setEngineForce(CheckWheelIndex(L, userdata, 2), luaL_checknumber(L, 3));
+	return 0;
+}
+
+static int GetBrake(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getBrake(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int SetBrake(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 3);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    uint32 wheelIndex = CheckWheelIndex(L, userdata, 2);
+    userdata->vehicle->setBrake(wheelIndex, CheckNotNegative(L, 3, "brake"));
+	return 0;
+}
+
+static int GetWheelRotation(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getWheelRotation(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int GetWheelTransform(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    pushRp3dTransform(L, userdata->vehicle->getWheelTransform(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int IsWheelInContact(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushboolean(L, userdata->vehicle->isWheelInContact(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int GetWheelContactPoint(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->vehicle->getWheelContactPoint(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int GetWheelContactNormal(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    pushRp3dVector3(L, userdata->vehicle->getWheelContactNormal(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int GetWheelGroundCollider(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    Collider* collider = userdata->vehicle->getWheelGroundCollider(CheckWheelIndex(L, userdata, 2));
+    if(collider != NULL){
+        ColliderPush(L, collider);
+    }else{
+        lua_pushnil(L);
+    }
+	return 1;
+}
+
+static int GetSuspensionLength(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getSuspensionLength(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int GetSuspensionForce(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getSuspensionForce(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int GetSkidInfo(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getSkidInfo(CheckWheelIndex(L, userdata, 2)));
+	return 1;
+}
+
+static int GetCurrentSpeed(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getCurrentSpeed());
+	return 1;
+}
+
+static int GetCollideWithMaskBits(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushnumber(L, userdata->vehicle->getCollideWithMaskBits());
+	return 1;
+}
+
+static int SetCollideWithMaskBits(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    userdata->vehicle->setCollideWithMaskBits(luaL_checknumber(L, 2));
+	return 0;
+}
+
+static int ToString(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    RaycastVehicleUserdata *userdata = RaycastVehicleUserdataCheck(L, 1);
+    lua_pushfstring( L, "rp3d::RaycastVehicle[%p]",(void *) userdata->vehicle);
+	return 1;
+}
+
+void RaycastVehicleUserdataInitMetaTable(lua_State *L){
+    int top = lua_gettop(L);
+    luaL_Reg functions[] = {
+        {"addWheel", AddWheel},
+        {"getNbWheels", GetNbWheels},
+        {"getBody", GetBody},
+        {"getSteering", GetSteering},
+        {"setSteering", SetSteering},
+        {"getEngineForce", GetEngineForce},
+        {"setEngineForce", SetEngineForce},
+        {"getBrake", GetBrake},
+        {"setBrake", SetBrake},
+        {"getWheelRotation", GetWheelRotation},
+        {"getWheelTransform", GetWheelTransform},
+        {"isWheelInContact", IsWheelInContact},
+        {"getWheelContactPoint", GetWheelContactPoint},
+        {"getWheelContactNormal", GetWheelContactNormal},
+        {"getWheelGroundCollider", GetWheelGroundCollider},
+        {"getSuspensionLength", GetSuspensionLength},
+        {"getSuspensionForce", GetSuspensionForce},
+        {"getSkidInfo", GetSkidInfo},
+        {"getCurrentSpeed", GetCurrentSpeed},
+        {"getCollideWithMaskBits", GetCollideWithMaskBits},
+        {"setCollideWithMaskBits", SetCollideWithMaskBits},
+        {"__tostring", ToString},
+        { 0, 0 }
+    };
+    luaL_newmetatable(L, META_NAME);
+    luaL_register (L, NULL,functions);
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -1, "__index");
+    lua_pop(L, 1);
+
+    assert(top == lua_gettop(L));
+}
+
+void RaycastVehicleUserdata::Destroy(lua_State *L){
+    world = NULL;
+    vehicle = NULL;
+    BaseUserData::Destroy(L);
+}
+
+}
@@ -56,6 +56,7 @@ int BoxShape_GetHalfExtents(lua_State *L){
 int BoxShape_SetHalfExtents(lua_State *L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 2);
+    CollisionShapeCheckNotShared(L,1);
     BoxShape* shape = BoxShapeCheck(L,1);
     dmVMath::Vector3* dmV3 = dmScript::CheckVector3(L, 2);
     Vector3 v3(dmV3->getX(),dmV3->getY(),dmV3->getZ());
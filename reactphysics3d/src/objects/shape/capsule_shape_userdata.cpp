@@ -36,6 +36,7 @@ int CapsuleShape_GetRadius(lua_State *L){
 int CapsuleShape_SetRadius(lua_State *L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 2);
+    CollisionShapeCheckNotShared(L,1);
     CapsuleShape* shape = CapsuleShapeCheck(L,1);
     shape->setRadius(luaL_checknumber(L,2));
     return 0;
@@ -51,6 +52,7 @@ int CapsuleShape_GetHeight(lua_State *L){
 int CapsuleShape_SetHeight(lua_State *L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 2);
+    CollisionShapeCheckNotShared(L,1);
     CapsuleShape* shape = CapsuleShapeCheck(L,1);
     shape->setHeight(luaL_checknumber(L,2));
     return 0;
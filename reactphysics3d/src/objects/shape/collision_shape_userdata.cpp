@@ -1,5 +1,6 @@
 #include "objects/base_userdata.h"
 #include "static_hash.h"
+#include <string.h>
 
 #include "objects/shape/box_shape_userdata.h"
 #include "objects/shape/sphere_shape_userdata.h"
@@ -67,6 +68,12 @@ CollisionShapeUserdata* CollisionShapeCheck(lua_State* L, int index){
     return userdata;
 }
 
+void CollisionShapeCheckNotShared(lua_State *L, int index){
+    if(CollisionShapeCheck(L,index)->isShared){
+        luaL_error(L,"shared shape can't be changed");
+    }
+}
+
 static const char * CollisionShapeNameEnumToString(CollisionShapeName name){
     switch(name){
         case CollisionShapeName::TRIANGLE:
@@ -188,6 +195,14 @@ int CollisionShape_ComputeAABB(lua_State *L){
     return 1;
 }
 
+int CollisionShape_IsShared(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    CollisionShapeUserdata* shape = CollisionShapeCheck(L,1);
+    lua_pushboolean(L,shape->isShared);
+    return 1;
+}
+
 int CollisionShape_ToString(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -221,6 +236,130 @@ CollisionShapeUserdata* CollisionShapePush(lua_State *L, CollisionShape* shape){
     }
 }
 
+static dmHashTable64<CollisionShapeUserdata*> sharedShapes;
+//released shapes that still used by colliders
+static dmArray<CollisionShapeUserdata*> releasedShapes;
+
+void CollisionShapeSharedKeyInit(CollisionShapeSharedKey &key, CollisionShapeName name,
+                                 float p1, float p2, float p3, void* mesh){
+    memset(&key, 0, sizeof(key));
+    key.name = (uint32_t)name;
+    key.params[0] = p1;
+    key.params[1] = p2;
+    key.params[2] = p3;
+    key.mesh = mesh;
+}
+
+CollisionShapeUserdata* CollisionShapeUserdataGetShared(const CollisionShapeSharedKey &key){
+    CollisionShapeUserdata** result = sharedShapes.Get(dmHashBuffer64(&key, sizeof(key)));
+    if(result == NULL || memcmp(&(*result)->sharedKey, &key, sizeof(key)) != 0){
+        return NULL;
+    }
+    CollisionShapeUserdata* userdata = *result;
+    if(userdata->refCount == 0){
+        for(uint32_t i=0;i<releasedShapes.Size();++i){
+            if(releasedShapes[i] == userdata){
+                releasedShapes.EraseSwap(i);
+                break;
+            }
+        }
+    }
+    userdata->refCount++;
+    return userdata;
+}
+
+void CollisionShapeUserdataAddShared(CollisionShapeUserdata* userdata, const CollisionShapeSharedKey &key){
+    userdata->isShared = true;
+    userdata->sharedKey = key;
+    dmhash_t hash = dmHashBuffer64(&key, sizeof(key));
+    //hash collision. Shape is still immutable but not cached
+    if(sharedShapes.Get(hash) != NULL) return;
+    if(sharedShapes.Full()){
+        uint32_t capacity = sharedShapes.Capacity() + 64;
+        sharedShapes.SetCapacity(capacity/2+1, capacity);
+    }
+    sharedShapes.Put(hash, userdata);
+}
+
+static void CollisionShapeUserdataCollectMeshShared(dmArray<dmhash_t>* hashes, const dmhash_t* key, CollisionShapeUserdata** value){
+    if(hashes->Full()){
+        hashes->OffsetCapacity(16);
+    }
+    hashes->Push(*key);
+}
+
+void CollisionShapeUserdataRemoveSharedMesh(void* mesh){
+    dmArray<dmhash_t> hashes;
+    sharedShapes.Iterate(CollisionShapeUserdataCollectMeshShared, &hashes);
+    for(uint32_t i=0;i<hashes.Size();++i){
+        CollisionShapeUserdata** cached = sharedShapes.Get(hashes[i]);
+        //shape is still immutable and alive while it have references or colliders
+        if((*cached)->sharedKey.mesh == mesh) sharedShapes.Erase(hashes[i]);
+    }
+}
+
+static void CollisionShapeUserdataFree(lua_State *L, CollisionShapeUserdata* userdata){
+    if(userdata->isShared){
+        dmhash_t hash = dmHashBuffer64(&userdata->sharedKey, sizeof(userdata->sharedKey));
+        CollisionShapeUserdata** cached = sharedShapes.Get(hash);
+        if(cached != NULL && *cached == userdata) sharedShapes.Erase(hash);
+    }
+    CollisionShape* shape = userdata->shape;
+    PhysicsCommon* physicsCommon = userdata->physicsCommon;
+    userdata->Destroy(L);
+    delete userdata;
+    assert(physicsCommon);
+    switch(shape->getName()){
+        case CollisionShapeName::SPHERE:
+            physicsCommon->destroySphereShape(static_cast<SphereShape*>(shape));
+            break;
+        case CollisionShapeName::CAPSULE:
+            physicsCommon->destroyCapsuleShape(static_cast<CapsuleShape*>(shape));
+            break;
+        case CollisionShapeName::BOX:
+            physicsCommon->destroyBoxShape(static_cast<BoxShape*>(shape));
+            break;
+        case CollisionShapeName::CONVEX_MESH:
+            physicsCommon->destroyConvexMeshShape(static_cast<ConvexMeshShape*>(shape));
+            break;
+        case CollisionShapeName::TRIANGLE_MESH:
+            physicsCommon->destroyConcaveMeshShape(static_cast<ConcaveMeshShape*>(shape));
+            break;
+        case CollisionShapeName::HEIGHTFIELD:
+            physicsCommon->destroyHeightFieldShape(static_cast<HeightFieldShape*>(shape));
+            break;
+        default:
+            assert(false);
+    }
+}
+
+void CollisionShapeUserdataRelease(lua_State *L, CollisionShapeUserdata* userdata){
+    if(userdata->refCount <= 0){
+        luaL_error(L,"shape was already destroyed");
+    }
+    userdata->refCount--;
+    if(userdata->refCount > 0) return;
+    if(userdata->shape->getNbColliders() == 0){
+        CollisionShapeUserdataFree(L, userdata);
+    }else{
+        //still used by colliders. Free it when last collider removed
+        if(releasedShapes.Full()){
+            releasedShapes.OffsetCapacity(16);
+        }
+        releasedShapes.Push(userdata);
+    }
+}
+
+void CollisionShapeUserdataFreeUnused(lua_State *L){
+    for(int i=releasedShapes.Size()-1;i>=0;--i){
+        CollisionShapeUserdata* userdata = releasedShapes[i];
+        if(userdata->shape->getNbColliders() == 0){
+            releasedShapes.EraseSwap(i);
+            CollisionShapeUserdataFree(L, userdata);
+        }
+    }
+}
+
 void CollisionShapeUserdata::Destroy(lua_State *L){
     shape->setUserData(NULL);
     shape = NULL;
@@ -39,6 +39,7 @@ int ConvexMeshShape_GetScale(lua_State *L){
 int ConvexMeshShape_SetScale(lua_State *L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 2);
+    CollisionShapeCheckNotShared(L,1);
     ConvexMeshShape* shape = ConvexMeshShapeCheck(L,1);
     dmVMath::Vector3* dmV3 = dmScript::CheckVector3(L, 2);
     Vector3 v3(dmV3->getX(),dmV3->getY(),dmV3->getZ());
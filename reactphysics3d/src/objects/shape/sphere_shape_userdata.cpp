@@ -36,6 +36,7 @@ int SphereShape_GetRadius(lua_State *L){
 int SphereShape_SetRadius(lua_State *L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 2);
+    CollisionShapeCheckNotShared(L,1);
     SphereShape* shape = SphereShapeCheck(L,1);
     shape->setRadius(luaL_checknumber(L,2));
     return 0;
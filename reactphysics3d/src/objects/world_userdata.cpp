@@ -1,8 +1,13 @@
 #include "objects/world_userdata.h"
 #include "objects/collision_body_userdata.h"
+#include "objects/body_pool_userdata.h"
+#include "objects/character_controller_userdata.h"
+#include "objects/raycast_vehicle_userdata.h"
+#include "objects/force_field_userdata.h"
 #include "objects/debug_renderer_userdata.h"
 #include "objects/collider_userdata.h"
 #include "objects/aabb.h"
+#include "objects/shape/collision_shape_userdata.h"
 #include "objects/joint/joint_info.h"
 #include "objects/joint/joint_userdata.h"
 #include "static_hash.h"
@@ -12,13 +17,26 @@
 #define META_NAME "rp3d::World"
 #define USERDATA_TYPE "rp3d::World"
 
+static const dmhash_t HASH_FROM  = dmHashString64("from");
+static const dmhash_t HASH_TO  = dmHashString64("to");
+static const dmhash_t HASH_FRACTION  = dmHashString64("fraction");
+static const dmhash_t HASH_POINT  = dmHashString64("point");
+static const dmhash_t HASH_NORMAL  = dmHashString64("normal");
+static const dmhash_t HASH_COLLIDER  = dmHashString64("collider");
+static const dmhash_t HASH_BODY  = dmHashString64("body");
+static const dmhash_t HASH_DISTANCE  = dmHashString64("distance");
+static const dmhash_t HASH_POINT1  = dmHashString64("point1");
+static const dmhash_t HASH_POINT2  = dmHashString64("point2");
+static const dmhash_t HASH_DISPLACEMENT  = dmHashString64("displacement");
+static const dmhash_t HASH_POSITION  = dmHashString64("position");
+
 
 using namespace reactphysics3d;
 
 namespace rp3dDefold {
 
 //should have table on top of stack
-static void PushCollisionCallbackData(lua_State *L,const CollisionCallback::CallbackData &callbackData){
+void PushCollisionCallbackData(lua_State *L,const CollisionCallback::CallbackData &callbackData){
     for(int i=0;i<callbackData.getNbContactPairs();i++){
         CollisionCallback::ContactPair pair = callbackData.getContactPair(i);
         lua_newtable(L);
@@ -71,7 +89,7 @@ static void PushCollisionCallbackData(lua_State *L,const CollisionCallback::Call
     }
 }
 //should have table on top of stack
-static void PushOverlapCallbackData(lua_State *L,const OverlapCallback::CallbackData &callbackData){
+void PushOverlapCallbackData(lua_State *L,const OverlapCallback::CallbackData &callbackData){
     for(int i=0;i<callbackData.getNbOverlappingPairs();i++){
         OverlapCallback::OverlapPair pair = callbackData.getOverlappingPair(i);
         lua_newtable(L);
@@ -92,6 +110,20 @@ static void PushOverlapCallbackData(lua_State *L,const OverlapCallback::Callback
 
     }
 }
+//should have table on top of stack
+void PushBrokenJoints(lua_State *L,const Array<Joint*> &joints){
+    for(uint32 i=0;i<joints.size();i++){
+        JointUserdataPush(L,joints[i]);
+        lua_rawseti(L, -2, i+1);
+    }
+}
+//should have table on top of stack
+void PushBodies(lua_State *L,const Array<RigidBody*> &bodies){
+    for(uint32 i=0;i<bodies.size();i++){
+        CollisionBodyPush(L,bodies[i]);
+        lua_rawseti(L, -2, i+1);
+    }
+}
 
 
 
@@ -183,6 +215,14 @@ static int GetNbIterationsVelocitySolver(lua_State *L){
 	return 1;
 }
 
+static int GetNbSubsteps(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    lua_pushnumber(L, data->world->getNbSubsteps());
+	return 1;
+}
+
 static int GetNbIterationsPositionSolver(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -287,6 +327,18 @@ static int SetNbIterationsVelocitySolver(lua_State *L){
 	return 0;
 }
 
+static int SetNbSubsteps(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    int nbSubsteps = luaL_checkinteger(L,2);
+    if(nbSubsteps < 1){
+        luaL_error(L,"nbSubsteps should be > 0");
+    }
+    data->world->setNbSubsteps(nbSubsteps);
+	return 0;
+}
+
 static int SetNbIterationsPositionSolver(lua_State *L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 2);
@@ -364,6 +416,22 @@ static int SetIsGravityEnabled(lua_State *L){
 	return 0;
 }
 
+static int IsArticulationSolverEnabled(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 1);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    lua_pushboolean(L,data->world->isArticulationSolverEnabled());
+	return 1;
+}
+
+static int SetIsArticulationSolverEnabled(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    data->world->setIsArticulationSolverEnabled(lua_toboolean(L,2));
+	return 0;
+}
+
 static int GetIsDebugRenderingEnabled(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 1);
@@ -418,10 +486,14 @@ static int DestroyCollisionBody(lua_State *L){
     if(body->isRigidBody){
         luaL_error(L,"can't destroy RigidBody.Need CollisionBody");
     }
+    if(body->pool != NULL){
+        luaL_error(L,"can't destroy body from BodyPool");
+    }
     CollisionBody* collisionBody = body->body;
     body->Destroy(L);
     delete body;
     data->world->destroyCollisionBody(collisionBody);
+    CollisionShapeUserdataFreeUnused(L);
    	return 0;
 }
 
@@ -433,12 +505,70 @@ static int DestroyRigidBody(lua_State *L){
     if(!body->isRigidBody){
         luaL_error(L,"can't destroy CollisionBody.Need RigidBody");
     }
+    if(body->pool != NULL){
+        luaL_error(L,"can't destroy body from BodyPool");
+    }
+    for(uint32_t i=0;i<data->characterControllers.Size();++i){
+        if(data->characterControllers[i]->controller->getBody() == body->body){
+            luaL_error(L,"can't destroy body of CharacterController");
+        }
+    }
     RigidBody* rigidBody = static_cast<RigidBody*>(body->body);
+    //vehicles destroyed with body
+    for(int i=data->raycastVehicles.Size()-1;i>=0;--i){
+        RaycastVehicleUserdata* vehicle = data->raycastVehicles[i];
+        if(vehicle->vehicle->getBody() == rigidBody){
+            data->raycastVehicles.EraseSwap(i);
+            data->world->destroyRaycastVehicle(vehicle->vehicle);
+            vehicle->Destroy(L);
+            delete vehicle;
+        }
+    }
     body->Destroy(L);
     delete body;
     //TODO DESTROY JOINS USERDATA
     data->world->rigidBodyRemoveJointsUserdata(L,rigidBody);
     data->world->destroyRigidBody(rigidBody);
+    CollisionShapeUserdataFreeUnused(L);
+   	return 0;
+}
+
+static int CreateBodyPool(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    CollisionBodyUserdata* templateBody = CollisionBodyUserdataCheck(L,2);
+    int size = luaL_checknumber(L,3);
+    if(&templateBody->body->getWorld() != data->world){
+        luaL_error(L,"template body from another world");
+    }
+    if(size<=0){
+        luaL_error(L,"pool size should be > 0");
+    }
+    BodyPoolUserdata* pool = BodyPoolUserdataCreate(L,data->world,templateBody->body,size);
+    if(data->bodyPools.Full()){
+        data->bodyPools.OffsetCapacity(4);
+    }
+    data->bodyPools.Push(pool);
+    pool->Push(L);
+	return 1;
+}
+
+static int DestroyBodyPool(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    BodyPoolUserdata* pool = BodyPoolUserdataCheck(L,2);
+    if(pool->world != data->world){
+        luaL_error(L,"pool from another world");
+    }
+    for(uint32_t i=0;i<data->bodyPools.Size();++i){
+        if(data->bodyPools[i] == pool){
+            data->bodyPools.EraseSwap(i);
+            break;
+        }
+    }
+    BodyPoolUserdataDestroyWithBodies(L,pool);
    	return 0;
 }
 
@@ -486,6 +616,286 @@ static int Raycast(lua_State *L){
     return 0;
 }
 
+static ConvexShape* ConvexShapeCheck(lua_State *L, int index){
+    CollisionShapeUserdata* shape = CollisionShapeCheck(L, index);
+    if (!shape->shape->isConvex()) luaL_error(L,"shape should be convex");
+    return static_cast<ConvexShape*>(shape->shape);
+}
+
+static int ShapeCast(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 4,5);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    ConvexShape* shape = ConvexShapeCheck(L, 2);
+    Transform transform = checkRp3dTransform(L, 3);
+    Vector3 to = checkRp3dVector3(L, 4);
+    unsigned short mask = lua_isnoneornil(L, 5) ? 0xFFFF : luaL_checknumber(L, 5);
+
+    ShapeCastInfo info;
+    if (data->world->shapeCast(shape, transform, to - transform.getPosition(), info, mask)){
+        pushRp3dShapeCastInfo(L, info);
+    }else{
+        lua_pushnil(L);
+    }
+	return 1;
+}
+
+//get float32 stream with at least "components" components. Return NULL if stream not exist and it is optional
+static float* Float32BufferStream(lua_State *L, dmBuffer::HBuffer buffer, dmhash_t hash, const char* name,
+                                    uint32_t minComponents, bool required, uint32_t &count, uint32_t &stride){
+    dmBuffer::ValueType type;
+    uint32_t components = 0;
+    dmBuffer::Result r = dmBuffer::GetStreamType(buffer, hash, &type, &components);
+    if (r != dmBuffer::RESULT_OK){
+        if (required) luaL_error(L,"buffer can't get %s", name);
+        return 0x0;
+    }
+    if (type != dmBuffer::VALUE_TYPE_FLOAT32 || components < minComponents){
+        luaL_error(L,"%s should be float32 with %d components", name, minComponents);
+    }
+    float* data = 0x0;
+    r = dmBuffer::GetStream(buffer, hash, (void**)&data, &count, &components, &stride);
+    if (r != dmBuffer::RESULT_OK) luaL_error(L,"buffer can't get %s", name);
+    return data;
+}
+
+static int ShapeCastBuffer(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 4,6);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    ConvexShape* shape = ConvexShapeCheck(L, 2);
+    dmVMath::Quat* dmQuat = dmScript::CheckQuat(L, 3);
+    Quaternion orientation(dmQuat->getX(), dmQuat->getY(), dmQuat->getZ(), dmQuat->getW());
+    dmBuffer::HBuffer buffer = dmScript::CheckBufferUnpack(L, 4);
+    bool fillColliders = !lua_isnoneornil(L, 5);
+    if (fillColliders && !lua_istable(L, 5)) luaL_error(L,"colliders should be table");
+    unsigned short mask = lua_isnoneornil(L, 6) ? 0xFFFF : luaL_checknumber(L, 6);
+
+    dmBuffer::Result validate = dmBuffer::ValidateBuffer(buffer);
+    if(validate!=dmBuffer::RESULT_OK ) luaL_error(L,"buffer invalid");
+
+    uint32_t count, fromStride, toStride, fractionStride, pointStride, normalStride;
+    uint32_t toCount, fractionCount, pointCount, normalCount;
+    float* from = Float32BufferStream(L, buffer, HASH_FROM, "from", 3, true, count, fromStride);
+    float* to = Float32BufferStream(L, buffer, HASH_TO, "to", 3, true, toCount, toStride);
+    float* fraction = Float32BufferStream(L, buffer, HASH_FRACTION, "fraction", 1, true, fractionCount, fractionStride);
+    float* point = Float32BufferStream(L, buffer, HASH_POINT, "point", 3, false, pointCount, pointStride);
+    float* normal = Float32BufferStream(L, buffer, HASH_NORMAL, "normal", 3, false, normalCount, normalStride);
+
+    uint32_t nbHits = 0;
+    for(uint32_t i=0;i<count;i++){
+        Vector3 fromPosition(from[0], from[1], from[2]);
+        Vector3 translation = Vector3(to[0], to[1], to[2]) - fromPosition;
+
+        ShapeCastInfo info;
+        bool hit = data->world->shapeCast(shape, Transform(fromPosition, orientation), translation, info, mask);
+        if (hit) nbHits++;
+
+        fraction[0] = hit ? info.hitFraction : -1;
+        if (point != 0x0){
+            point[0] = info.worldPoint.x; point[1] = info.worldPoint.y; point[2] = info.worldPoint.z;
+            point += pointStride;
+        }
+        if (normal != 0x0){
+            normal[0] = info.worldNormal.x; normal[1] = info.worldNormal.y; normal[2] = info.worldNormal.z;
+            normal += normalStride;
+        }
+        if (fillColliders){
+            if (hit){
+                ColliderPush(L, info.collider);
+            }else{
+                lua_pushboolean(L, false);
+            }
+            lua_rawseti(L, 5, i+1);
+        }
+
+        from += fromStride;
+        to += toStride;
+        fraction += fractionStride;
+    }
+    dmBuffer::UpdateContentVersion(buffer);
+
+    lua_pushnumber(L, nbHits);
+	return 1;
+}
+
+static int CreateCharacterController(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3,4);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    ConvexShape* shape = ConvexShapeCheck(L, 2);
+    Transform transform = checkRp3dTransform(L, 3);
+    CharacterControllerSettings settings;
+    if(!lua_isnoneornil(L, 4)){
+        settings = CharacterControllerSettings_from_table(L, 4);
+    }
+    CharacterController* controller = data->world->createCharacterController(shape, transform, settings);
+    CharacterControllerUserdata* userdata = new CharacterControllerUserdata(data->world, controller);
+    if(data->characterControllers.Full()){
+        data->characterControllers.OffsetCapacity(4);
+    }
+    data->characterControllers.Push(userdata);
+    userdata->Push(L);
+	return 1;
+}
+
+static int DestroyCharacterController(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    CharacterControllerUserdata* controller = CharacterControllerUserdataCheck(L,2);
+    if(controller->world != data->world){
+        luaL_error(L,"controller from another world");
+    }
+    for(uint32_t i=0;i<data->characterControllers.Size();++i){
+        if(data->characterControllers[i] == controller){
+            data->characterControllers.EraseSwap(i);
+            break;
+        }
+    }
+    CharacterControllerUserdataDestroyWithBody(L,controller);
+   	return 0;
+}
+
+static int MoveCharacterControllers(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    if (!lua_istable(L, 2)) luaL_error(L,"controllers should be table");
+    dmBuffer::HBuffer buffer = dmScript::CheckBufferUnpack(L, 3);
+
+    dmBuffer::Result validate = dmBuffer::ValidateBuffer(buffer);
+    if(validate!=dmBuffer::RESULT_OK ) luaL_error(L,"buffer invalid");
+
+    uint32_t count, displacementStride, positionStride, positionCount;
+    float* displacement = Float32BufferStream(L, buffer, HASH_DISPLACEMENT, "displacement", 3, true, count, displacementStride);
+    float* position = Float32BufferStream(L, buffer, HASH_POSITION, "position", 3, false, positionCount, positionStride);
+
+    uint32_t nbControllers = lua_objlen(L, 2);
+    if(nbControllers > count) luaL_error(L,"buffer count:%d less than controllers:%d", count, nbControllers);
+
+    for(uint32_t i=0;i<nbControllers;i++){
+        lua_rawgeti(L, 2, i+1);
+        CharacterControllerUserdata* controller = CharacterControllerUserdataCheck(L, -1);
+        lua_pop(L, 1);
+        if(controller->world != data->world){
+            luaL_error(L,"controller from another world");
+        }
+        controller->controller->move(Vector3(displacement[0], displacement[1], displacement[2]));
+        if (position != 0x0){
+            const Vector3& p = controller->controller->getPosition();
+            position[0] = p.x; position[1] = p.y; position[2] = p.z;
+            position += positionStride;
+        }
+        displacement += displacementStride;
+    }
+    dmBuffer::UpdateContentVersion(buffer);
+
+    lua_pushnumber(L, nbControllers);
+	return 1;
+}
+
+static int CreateRaycastVehicle(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2,3);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    CollisionBodyUserdata* body = CollisionBodyUserdataCheck(L,2);
+    if(!body->isRigidBody){
+        luaL_error(L,"can't create vehicle for CollisionBody.Need RigidBody");
+    }
+    if(&body->body->getWorld() != data->world){
+        luaL_error(L,"body from another world");
+    }
+    if(body->pool != NULL){
+        luaL_error(L,"can't create vehicle for body from BodyPool");
+    }
+    for(uint32_t i=0;i<data->characterControllers.Size();++i){
+        if(data->characterControllers[i]->controller->getBody() == body->body){
+            luaL_error(L,"can't create vehicle for body of CharacterController");
+        }
+    }
+    RaycastVehicleSettings settings;
+    if(!lua_isnoneornil(L, 3)){
+        settings = RaycastVehicleSettings_from_table(L, 3);
+    }
+    RaycastVehicle* vehicle = data->world->createRaycastVehicle(static_cast<RigidBody*>(body->body), settings);
+    RaycastVehicleUserdata* userdata = new RaycastVehicleUserdata(data->world, vehicle);
+    if(data->raycastVehicles.Full()){
+        data->raycastVehicles.OffsetCapacity(4);
+    }
+    data->raycastVehicles.Push(userdata);
+    userdata->Push(L);
+	return 1;
+}
+
+static int DestroyRaycastVehicle(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    RaycastVehicleUserdata* vehicle = RaycastVehicleUserdataCheck(L,2);
+    if(vehicle->world != data->world){
+        luaL_error(L,"vehicle from another world");
+    }
+    for(uint32_t i=0;i<data->raycastVehicles.Size();++i){
+        if(data->raycastVehicles[i] == vehicle){
+            data->raycastVehicles.EraseSwap(i);
+            break;
+        }
+    }
+    data->world->destroyRaycastVehicle(vehicle->vehicle);
+    vehicle->Destroy(L);
+    delete vehicle;
+   	return 0;
+}
+
+static int CreateForceField(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2,3);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    ForceFieldSettings settings;
+    if(!lua_isnoneornil(L, 3)){
+        settings = ForceFieldSettings_from_table(L, 3);
+    }
+    ForceField* field;
+    //volume is Collider or AABB
+    if(lua_istable(L, 2)){
+        Collider* collider = ColliderUserdataCheck(L, 2)->collider;
+        if(&collider->getBody()->getWorld() != data->world){
+            luaL_error(L,"collider from another world");
+        }
+        field = data->world->createForceField(collider, settings);
+    }else{
+        field = data->world->createForceField(AABBCheck(L, 2)->aabb, settings);
+    }
+    ForceFieldUserdata* userdata = new ForceFieldUserdata(data->world, field);
+    if(data->forceFields.Full()){
+        data->forceFields.OffsetCapacity(4);
+    }
+    data->forceFields.Push(userdata);
+    userdata->Push(L);
+	return 1;
+}
+
+static int DestroyForceField(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 0);
+    check_arg_count(L, 2);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    ForceFieldUserdata* field = ForceFieldUserdataCheck(L,2);
+    if(field->world != data->world){
+        luaL_error(L,"force field from another world");
+    }
+    for(uint32_t i=0;i<data->forceFields.Size();++i){
+        if(data->forceFields[i] == field){
+            data->forceFields.EraseSwap(i);
+            break;
+        }
+    }
+    data->world->destroyForceField(field->field);
+    field->Destroy(L);
+    delete field;
+   	return 0;
+}
+
 static int TestOverlap2Bodies(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 3);
@@ -517,6 +927,222 @@ static int TestOverlapList(lua_State *L){
 	return 1;
 }
 
+static int TestOverlapShape(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3,5);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    ConvexShape* shape = ConvexShapeCheck(L, 2);
+    Transform transform = checkRp3dTransform(L, 3);
+    unsigned short mask = lua_isnoneornil(L, 4) ? 0xFFFF : luaL_checknumber(L, 4);
+    bool reuseTable = !lua_isnoneornil(L, 5);
+    if (reuseTable && !lua_istable(L, 5)) luaL_error(L,"result should be table");
+
+    Array<Collider*> colliders(data->world->getMemoryManager().getHeapAllocator());
+    data->world->testOverlap(shape, transform, colliders, mask);
+
+    if (reuseTable){
+        lua_pushvalue(L, 5);
+    }else{
+        lua_createtable(L, colliders.size(), 0);
+    }
+    uint32_t nbColliders = colliders.size();
+    for(uint32_t i=0;i<nbColliders;i++){
+        ColliderPush(L, colliders[i]);
+        lua_rawseti(L, -2, i+1);
+    }
+    //clear values from previous query
+    if (reuseTable){
+        uint32_t prevSize = lua_objlen(L, -1);
+        for(uint32_t i = nbColliders+1; i<= prevSize; i++){
+            lua_pushnil(L);
+            lua_rawseti(L, -2, i);
+        }
+    }
+	return 1;
+}
+
+static int TestOverlapShapeBuffer(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 4,5);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    ConvexShape* shape = ConvexShapeCheck(L, 2);
+    Transform transform = checkRp3dTransform(L, 3);
+    unsigned short mask = lua_isnoneornil(L, 5) ? 0xFFFF : luaL_checknumber(L, 5);
+
+    Array<Collider*> colliders(data->world->getMemoryManager().getHeapAllocator());
+    data->world->testOverlap(shape, transform, colliders, mask);
+    QueryBufferWrite(L, 4, colliders);
+	return 1;
+}
+
+static Collider* ConvexColliderCheck(lua_State *L, int index, WorldUserdata *data){
+    Collider* collider = ColliderUserdataCheck(L, index)->collider;
+    if(&collider->getBody()->getWorld() != data->world){
+        luaL_error(L,"collider from another world");
+    }
+    if (!collider->getCollisionShape()->isConvex()) luaL_error(L,"collider shape should be convex");
+    return collider;
+}
+
+//return distance between colliders(0 if overlapping) and fill points and normal(from collider1 to collider2)
+static float ComputeCollidersDistance(WorldUserdata *data, Collider* collider1, Collider* collider2, Vector3 &point1, Vector3 &point2, Vector3 &normal){
+    if (!data->world->computeClosestPoints(collider1, collider2, point1, point2)) return 0;
+    normal = point2 - point1;
+    float distance = normal.length();
+    if (distance > MACHINE_EPSILON) normal /= distance;
+    return distance;
+}
+
+static int ComputeDistance(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 4);
+    check_arg_count(L, 3);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    Collider* collider1 = ConvexColliderCheck(L, 2, data);
+    Collider* collider2 = ConvexColliderCheck(L, 3, data);
+
+    Vector3 point1, point2, normal;
+    float distance = ComputeCollidersDistance(data, collider1, collider2, point1, point2, normal);
+    lua_pushnumber(L, distance);
+    if (distance > 0){
+        pushRp3dVector3(L, point1);
+        pushRp3dVector3(L, point2);
+        pushRp3dVector3(L, normal);
+    }else{
+        lua_pushnil(L);
+        lua_pushnil(L);
+        lua_pushnil(L);
+    }
+	return 4;
+}
+
+static int ComputeDistanceBuffer(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    if (!lua_istable(L, 2)) luaL_error(L,"colliders should be table");
+    dmBuffer::HBuffer buffer = dmScript::CheckBufferUnpack(L, 3);
+    dmBuffer::Result validate = dmBuffer::ValidateBuffer(buffer);
+    if(validate!=dmBuffer::RESULT_OK ) luaL_error(L,"buffer invalid");
+
+    uint32_t count, distanceStride, point1Stride, point2Stride, normalStride;
+    uint32_t point1Count, point2Count, normalCount;
+    float* distances = Float32BufferStream(L, buffer, HASH_DISTANCE, "distance", 1, true, count, distanceStride);
+    float* points1 = Float32BufferStream(L, buffer, HASH_POINT1, "point1", 3, false, point1Count, point1Stride);
+    float* points2 = Float32BufferStream(L, buffer, HASH_POINT2, "point2", 3, false, point2Count, point2Stride);
+    float* normals = Float32BufferStream(L, buffer, HASH_NORMAL, "normal", 3, false, normalCount, normalStride);
+
+    uint32_t nbPairs = lua_objlen(L, 2) / 2;
+    if (nbPairs > count) nbPairs = count;
+    for(uint32_t i=0;i<nbPairs;i++){
+        lua_rawgeti(L, 2, i * 2 + 1);
+        lua_rawgeti(L, 2, i * 2 + 2);
+        Collider* collider1 = ConvexColliderCheck(L, -2, data);
+        Collider* collider2 = ConvexColliderCheck(L, -1, data);
+        lua_pop(L, 2);
+
+        Vector3 point1(0, 0, 0), point2(0, 0, 0), normal(0, 0, 0);
+        distances[i * distanceStride] = ComputeCollidersDistance(data, collider1, collider2, point1, point2, normal);
+        if (points1 != 0x0){
+            float* p = points1 + i * point1Stride;
+            p[0] = point1.x; p[1] = point1.y; p[2] = point1.z;
+        }
+        if (points2 != 0x0){
+            float* p = points2 + i * point2Stride;
+            p[0] = point2.x; p[1] = point2.y; p[2] = point2.z;
+        }
+        if (normals != 0x0){
+            float* p = normals + i * normalStride;
+            p[0] = normal.x; p[1] = normal.y; p[2] = normal.z;
+        }
+    }
+    dmBuffer::UpdateContentVersion(buffer);
+
+    lua_pushnumber(L, nbPairs);
+	return 1;
+}
+
+//get uint32 stream with 1 component. Return NULL if stream not exist and it is optional
+static uint32_t* QueryBufferStream(lua_State *L, dmBuffer::HBuffer buffer, dmhash_t hash, const char* name,
+                                   bool required, uint32_t &count, uint32_t &stride){
+    dmBuffer::ValueType type;
+    uint32_t components = 0;
+    dmBuffer::Result r = dmBuffer::GetStreamType(buffer, hash, &type, &components);
+    if (r != dmBuffer::RESULT_OK){
+        if (required) luaL_error(L,"buffer can't get %s", name);
+        return 0x0;
+    }
+    if (type != dmBuffer::VALUE_TYPE_UINT32) luaL_error(L,"%s should be uint32", name);
+    uint32_t* data = 0x0;
+    r = dmBuffer::GetStream(buffer, hash, (void**)&data, &count, &components, &stride);
+    if (r != dmBuffer::RESULT_OK) luaL_error(L,"buffer can't get %s", name);
+    return data;
+}
+
+//write the entity ids of colliders and bodies into the buffer at index(if not nil). Push the number of colliders
+void QueryBufferWrite(lua_State *L, int index, const Array<Collider*> &colliders){
+    if (!lua_isnil(L, index)){
+        dmBuffer::HBuffer buffer = dmScript::CheckBufferUnpack(L, index);
+        dmBuffer::Result validate = dmBuffer::ValidateBuffer(buffer);
+        if(validate!=dmBuffer::RESULT_OK ) luaL_error(L,"buffer invalid");
+
+        uint32_t count, colliderStride, bodyCount, bodyStride;
+        uint32_t* colliderIds = QueryBufferStream(L, buffer, HASH_COLLIDER, "collider", true, count, colliderStride);
+        uint32_t* bodyIds = QueryBufferStream(L, buffer, HASH_BODY, "body", false, bodyCount, bodyStride);
+
+        uint32_t nbWrite = colliders.size() < count ? colliders.size() : count;
+        for(uint32_t i=0;i<nbWrite;i++){
+            colliderIds[i * colliderStride] = colliders[i]->getEntity().id;
+            if (bodyIds != 0x0) bodyIds[i * bodyStride] = colliders[i]->getBody()->getEntity().id;
+        }
+        dmBuffer::UpdateContentVersion(buffer);
+    }
+    lua_pushnumber(L, colliders.size());
+}
+
+static int QueryAABB(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3,4);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    AABBLua* aabb = AABBCheck(L, 2);
+    unsigned short mask = lua_isnoneornil(L, 4) ? 0xFFFF : luaL_checknumber(L, 4);
+
+    Array<Collider*> colliders(data->world->getMemoryManager().getHeapAllocator());
+    data->world->queryAABB(aabb->aabb, colliders, mask);
+    QueryBufferWrite(L, 3, colliders);
+	return 1;
+}
+
+static int QuerySphere(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 4,5);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    Vector3 center = checkRp3dVector3(L, 2);
+    float radius = luaL_checknumber(L, 3);
+    if (radius < 0) luaL_error(L,"radius must be >=0");
+    unsigned short mask = lua_isnoneornil(L, 5) ? 0xFFFF : luaL_checknumber(L, 5);
+
+    Array<Collider*> colliders(data->world->getMemoryManager().getHeapAllocator());
+    data->world->querySphere(center, radius, colliders, mask);
+    QueryBufferWrite(L, 4, colliders);
+	return 1;
+}
+
+static int ApplyRadialImpulse(lua_State *L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 4,7);
+    WorldUserdata *data = WorldUserdataCheck(L, 1);
+    Vector3 center = checkRp3dVector3(L, 2);
+    float radius = luaL_checknumber(L, 3);
+    if (radius <= 0) luaL_error(L,"radius must be >0");
+    float impulse = luaL_checknumber(L, 4);
+    RadialImpulseFalloff falloff = lua_isnoneornil(L, 5) ? RadialImpulseFalloff::LINEAR : RadialImpulseFalloffStringToEnum(L, luaL_checkstring(L, 5));
+    unsigned short mask = lua_isnoneornil(L, 6) ? 0xFFFF : luaL_checknumber(L, 6);
+    bool occlusion = lua_toboolean(L, 7);
+
+    lua_pushnumber(L, data->world->applyRadialImpulse(center, radius, impulse, falloff, mask, occlusion));
+	return 1;
+}
+
 static int TestCollision2Bodies(lua_State *L){
     DM_LUA_STACK_CHECK(L, 1);
     check_arg_count(L, 3);
@@ -642,6 +1268,170 @@ static int CreateJoint(lua_State* L){
     return 1;
 }
 
+//check that the table at index contains only different rigid bodies and return its size
+static int CheckRigidBodies(lua_State* L, int index){
+    if (!lua_istable(L, index)) luaL_error(L,"bodies is not table");
+    int size = lua_objlen(L,index);
+    //set of the bodies already seen. A joint between a body and itself is not valid
+    lua_createtable(L, 0, size);
+    for(int i=1;i<=size;i++){
+        lua_rawgeti(L, index, i);
+        CollisionBodyRigidUserdataCheck(L,-1);
+        lua_pushvalue(L,-1);
+        lua_rawget(L,-3);
+        if(!lua_isnil(L,-1)){
+            luaL_error(L,"bodies should not contain the same body twice");
+        }
+        lua_pop(L,1);
+        lua_pushboolean(L,1);
+        lua_rawset(L,-3);
+    }
+    lua_pop(L,1);
+    return size;
+}
+
+//add the rigid bodies of the table at index to the array. The table should be checked by CheckRigidBodies first
+//because a lua error raised while the array is alive leaks its memory
+static void GetRigidBodies(lua_State* L, int index, int size, dmArray<RigidBody*> &bodies){
+    bodies.SetCapacity(size);
+    for(int i=1;i<=size;i++){
+        lua_rawgeti(L, index, i);
+        bodies.Push((RigidBody*)CollisionBodyRigidUserdataCheck(L,-1)->body);
+        lua_pop(L,1);
+    }
+}
+
+//create a joint between two bodies with the settings of the template joint info
+//the world-space anchor point is placed between the centers of the two bodies
+static Joint* CreateJointFromTemplate(PhysicsWorld* world, JointInfo* info, RigidBody* body1, RigidBody* body2, decimal anchor){
+    info->body1 = body1;
+    info->body2 = body2;
+    const Vector3& position1 = body1->getTransform().getPosition();
+    const Vector3& position2 = body2->getTransform().getPosition();
+    const Vector3 anchorPointWorldSpace = position1 + (position2 - position1) * anchor;
+    switch(info->type){
+        case JointType::BALLSOCKETJOINT:
+            ((BallAndSocketJointInfo*)info)->anchorPointWorldSpace = anchorPointWorldSpace;
+            break;
+        case JointType::SLIDERJOINT:
+            ((SliderJointInfo*)info)->anchorPointWorldSpace = anchorPointWorldSpace;
+            break;
+        case JointType::HINGEJOINT:
+            ((HingeJointInfo*)info)->anchorPointWorldSpace = anchorPointWorldSpace;
+            break;
+        case JointType::FIXEDJOINT:
+            ((FixedJointInfo*)info)->anchorPointWorldSpace = anchorPointWorldSpace;
+            break;
+        default:
+            assert(false);
+    }
+    return world->createJoint(*info);
+}
+
+//push the created joints as an array of joints or as an array of entity ids (see World:getJoint())
+static void PushCreatedJoints(lua_State* L, const dmArray<Joint*> &joints, bool pushIds){
+    lua_createtable(L, joints.Size(), 0);
+    for(uint32_t i=0;i<joints.Size();i++){
+        if(pushIds){
+            lua_pushnumber(L,joints[i]->getEntity().id);
+        }else{
+            JointUserdataPush(L,joints[i]);
+        }
+        lua_rawseti(L, -2, i+1);
+    }
+}
+
+static int CreateJointChain(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 3, 5);
+
+    WorldUserdata *world = WorldUserdataCheck(L, 1);
+    int nbBodies = CheckRigidBodies(L, 2);
+    if(nbBodies < 2){
+        luaL_error(L,"bodies should contain at least 2 bodies");
+    }
+    decimal anchor = luaL_optnumber(L, 4, 0.5);
+    bool pushIds = lua_toboolean(L, 5);
+
+    lua_pushvalue(L, 3);
+    JointInfo* info = JointInfoCheck(L,-1);
+    lua_pop(L,1);
+
+    dmArray<RigidBody*> bodies;
+    GetRigidBodies(L, 2, nbBodies, bodies);
+    dmArray<Joint*> joints;
+    joints.SetCapacity(bodies.Size() - 1);
+    for(uint32_t i=1;i<bodies.Size();i++){
+        joints.Push(CreateJointFromTemplate(world->world, info, bodies[i-1], bodies[i], anchor));
+    }
+    delete info;
+
+    PushCreatedJoints(L, joints, pushIds);
+    return 1;
+}
+
+static int CreateJointGrid(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 4, 6);
+
+    WorldUserdata *world = WorldUserdataCheck(L, 1);
+    int nbBodies = CheckRigidBodies(L, 2);
+    int nbColumns = luaL_checkinteger(L, 3);
+    if(nbColumns < 1){
+        luaL_error(L,"nbColumns should be > 0");
+    }
+    if(nbBodies == 0 || nbBodies % nbColumns != 0){
+        luaL_error(L,"number of bodies should be a multiple of nbColumns");
+    }
+    int nbRows = nbBodies / nbColumns;
+    decimal anchor = luaL_optnumber(L, 5, 0.5);
+    bool pushIds = lua_toboolean(L, 6);
+
+    lua_pushvalue(L, 4);
+    JointInfo* info = JointInfoCheck(L,-1);
+    lua_pop(L,1);
+
+    dmArray<RigidBody*> bodies;
+    GetRigidBodies(L, 2, nbBodies, bodies);
+
+    //bodies are stored row by row. Each body is connected to the previous body of its column and of its row
+    dmArray<Joint*> joints;
+    joints.SetCapacity((nbRows - 1) * nbColumns + nbRows * (nbColumns - 1));
+    for(int row=0;row<nbRows;row++){
+        for(int column=0;column<nbColumns;column++){
+            RigidBody* body = bodies[row * nbColumns + column];
+            if(row > 0){
+                joints.Push(CreateJointFromTemplate(world->world, info, bodies[(row - 1) * nbColumns + column], body, anchor));
+            }
+            if(column > 0){
+                joints.Push(CreateJointFromTemplate(world->world, info, bodies[row * nbColumns + column - 1], body, anchor));
+            }
+        }
+    }
+    delete info;
+
+    PushCreatedJoints(L, joints, pushIds);
+    return 1;
+}
+
+static int GetJoint(lua_State* L){
+    DM_LUA_STACK_CHECK(L, 1);
+    check_arg_count(L, 2);
+
+    WorldUserdata *world = WorldUserdataCheck(L, 1);
+    lua_Number id = luaL_checknumber(L, 2);
+    Joint* joint = NULL;
+    if(id >= 0 && id <= UINT32_MAX && id == (uint32)id){
+        joint = world->world->getJoint((uint32)id);
+    }
+    if(joint == NULL){
+        lua_pushnil(L);
+    }else{
+        JointUserdataPush(L,joint);
+    }
+    return 1;
+}
+
 static int DestroyJoint(lua_State* L){
     DM_LUA_STACK_CHECK(L, 0);
     check_arg_count(L, 2);
@@ -666,6 +1456,10 @@ void WorldUserdataInitMetaTable(lua_State *L){
         {"setIsGravityEnabled",SetIsGravityEnabled},
         {"getNbIterationsVelocitySolver",GetNbIterationsVelocitySolver},
         {"setNbIterationsVelocitySolver",SetNbIterationsVelocitySolver},
+        {"getNbSubsteps",GetNbSubsteps},
+        {"setNbSubsteps",SetNbSubsteps},
+        {"isArticulationSolverEnabled",IsArticulationSolverEnabled},
+        {"setIsArticulationSolverEnabled",SetIsArticulationSolverEnabled},
         {"getNbIterationsPositionSolver",GetNbIterationsPositionSolver},
         {"setNbIterationsPositionSolver",SetNbIterationsPositionSolver},
         {"isSleepingEnabled",IsSleepingEnabled},
@@ -689,17 +1483,38 @@ void WorldUserdataInitMetaTable(lua_State *L){
         {"destroyCollisionBody",DestroyCollisionBody},
         {"createRigidBody",CreateRigidBody},
         {"destroyRigidBody",DestroyRigidBody},
+        {"createBodyPool",CreateBodyPool},
+        {"destroyBodyPool",DestroyBodyPool},
+        {"createCharacterController",CreateCharacterController},
+        {"destroyCharacterController",DestroyCharacterController},
+        {"moveCharacterControllers",MoveCharacterControllers},
+        {"createRaycastVehicle",CreateRaycastVehicle},
+        {"destroyRaycastVehicle",DestroyRaycastVehicle},
+        {"createForceField",CreateForceField},
+        {"destroyForceField",DestroyForceField},
         {"getDebugRenderer",GetDebugRenderer},
         {"raycast",Raycast},
+        {"shapeCast",ShapeCast},
+        {"shapeCastBuffer",ShapeCastBuffer},
         {"testOverlap2Bodies",TestOverlap2Bodies},
         {"testOverlapBodyList",TestOverlapBodyList},
         {"testOverlapList",TestOverlapList},
+        {"testOverlapShape",TestOverlapShape},
+        {"testOverlapShapeBuffer",TestOverlapShapeBuffer},
+        {"queryAABB",QueryAABB},
+        {"querySphere",QuerySphere},
+        {"applyRadialImpulse",ApplyRadialImpulse},
+        {"computeDistance",ComputeDistance},
+        {"computeDistanceBuffer",ComputeDistanceBuffer},
         {"testCollision2Bodies",TestCollision2Bodies},
         {"testCollisionBodyList",TestCollisionBodyList},
         {"testCollisionList",TestCollisionList},
         {"setEventListener",SetEventListener},
         {"getWorldAABB",GetWorldAABB},
         {"createJoint",CreateJoint},
+        {"createJointChain",CreateJointChain},
+        {"createJointGrid",CreateJointGrid},
+        {"getJoint",GetJoint},
         {"destroyJoint",DestroyJoint},
         {"__tostring",ToString},
         { 0, 0 }
@@ -715,6 +1530,30 @@ void WorldUserdataInitMetaTable(lua_State *L){
 
 void WorldUserdata::Destroy(lua_State *L){
     world = NULL;
+    //bodies of pools destroyed with world
+    for(uint32_t i=0;i<bodyPools.Size();++i){
+        bodyPools[i]->Destroy(L);
+        delete bodyPools[i];
+    }
+    bodyPools.SetSize(0);
+    //controllers destroyed with world
+    for(uint32_t i=0;i<characterControllers.Size();++i){
+        characterControllers[i]->Destroy(L);
+        delete characterControllers[i];
+    }
+    characterControllers.SetSize(0);
+    //vehicles destroyed with world
+    for(uint32_t i=0;i<raycastVehicles.Size();++i){
+        raycastVehicles[i]->Destroy(L);
+        delete raycastVehicles[i];
+    }
+    raycastVehicles.SetSize(0);
+    //force fields destroyed with world
+    for(uint32_t i=0;i<forceFields.Size();++i){
+        forceFields[i]->Destroy(L);
+        delete forceFields[i];
+    }
+    forceFields.SetSize(0);
     if(eventListener != NULL){
         eventListener->Destroy(L);
         delete eventListener;
@@ -755,6 +1594,16 @@ PhysicsWorld::WorldSettings WorldSettings_from_table(lua_State *L, int index){
                     settings.isSleepingEnabled = lua_toboolean(L,-1);break;
                 case HASH_defaultVelocitySolverNbIterations:
                     settings.defaultVelocitySolverNbIterations = luaL_checknumber(L,-1);break;
+                case HASH_defaultNbSubsteps:{
+                    int nbSubsteps = luaL_checkinteger(L,-1);
+                    if(nbSubsteps < 1){
+                        luaL_error(L,"defaultNbSubsteps should be > 0");
+                    }
+                    settings.defaultNbSubsteps = nbSubsteps;
+                    break;
+                }
+                case HASH_isArticulationSolverEnabled:
+                    settings.isArticulationSolverEnabled = lua_toboolean(L,-1);break;
                 case HASH_defaultPositionSolverNbIterations:
                     settings.defaultPositionSolverNbIterations = luaL_checknumber(L,-1);break;
                 case HASH_defaultTimeBeforeSleep:
@@ -806,4 +1655,19 @@ const char * OverlapPairEventTypeEnumToString(OverlapCallback::OverlapPair::Even
     }
 }
 
+RadialImpulseFalloff RadialImpulseFalloffStringToEnum(lua_State *L,const char* str){
+    switch (hash_string(str)){
+        case HASH_CONSTANT:
+            return RadialImpulseFalloff::CONSTANT;
+        case HASH_LINEAR:
+            return RadialImpulseFalloff::LINEAR;
+        case HASH_QUADRATIC:
+            return RadialImpulseFalloff::QUADRATIC;
+        default:
+            luaL_error(L, "unknown RadialImpulseFalloff:%s", str);
+            break;
+    }
+    return RadialImpulseFalloff::LINEAR; //luaL_error does not return
+}
+
 }
\ No newline at end of file
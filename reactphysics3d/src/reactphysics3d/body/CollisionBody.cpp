@@ -29,6 +29,7 @@
 #include <reactphysics3d/engine/PhysicsWorld.h>
 #include <reactphysics3d/collision/ContactManifold.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
 #include <reactphysics3d/utils/Logger.h>
 
 // We want to use the ReactPhysics3D namespace
@@ -41,7 +42,7 @@ using namespace reactphysics3d;
  * @param id ID of the body
  */
 CollisionBody::CollisionBody(PhysicsWorld& world, Entity entity)
-              : mEntity(entity), mWorld(world)  {
+              : mEntity(entity), mWorld(world), mCompoundTree(nullptr), mCompoundProxyCollider(nullptr)  {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -53,6 +54,12 @@ CollisionBody::CollisionBody(PhysicsWorld& world, Entity entity)
 // Destructor
 CollisionBody::~CollisionBody() {
 
+    if (mCompoundTree != nullptr) {
+
+        // Destroy the compound tree
+        mCompoundTree->~DynamicAABBTree();
+        mWorld.mMemoryManager.release(MemoryManager::AllocationType::Heap, mCompoundTree, sizeof(DynamicAABBTree));
+    }
 }
 
 // Create a new collider and add it to the body
@@ -114,7 +121,7 @@ Collider* CollisionBody::addCollider(CollisionShape* collisionShape, const Trans
     collisionShape->computeAABB(aabb, mWorld.mTransformComponents.getTransform(mEntity) * transform);
 
     // Notify the collision detection about this new collision shape
-    mWorld.mCollisionDetection.addCollider(collider, aabb);
+    addColliderToCollisionDetection(collider, aabb);
 
     RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
              "Body " + std::to_string(mEntity.id) + ": Collider " + std::to_string(collider->getBroadPhaseId()) + " added to body",  __FILE__, __LINE__);
@@ -173,10 +180,20 @@ void CollisionBody::removeCollider(Collider* collider) {
     RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
              "Body " + std::to_string(mEntity.id) + ": Collider " + std::to_string(collider->getBroadPhaseId()) + " removed from body",  __FILE__, __LINE__);
 
-    // Remove the collider from the broad-phase
-    if (collider->getBroadPhaseId() != -1) {
-        mWorld.mCollisionDetection.removeCollider(collider);
-    }
+    // Remove the collider from the broad-phase (or from the compound tree)
+    removeColliderFromCollisionDetection(collider);
+
+    // The collider cannot be inside a trigger anymore
+    mWorld.mCollisionDetection.removeColliderFromTriggers(collider->getEntity());
+
+    // The collider cannot be used anymore as the volume of a force field
+    mWorld.removeColliderFromForceFields(collider);
+
+    // The collider cannot be the ground of a character controller anymore
+    mWorld.removeColliderFromCharacterControllers(collider);
+
+    // The collider cannot be the ground of the wheels of a vehicle anymore
+    mWorld.removeColliderFromVehicles(collider);
 
     mWorld.mCollisionBodyComponents.removeColliderFromBody(mEntity, collider->getEntity());
 
@@ -258,6 +275,16 @@ void CollisionBody::setIsActive(bool isActive) {
 
             Collider* collider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
 
+            // The colliders of the compound tree share the broad-phase proxy of the compound body
+            if (mWorld.mCollidersComponents.getCompoundId(collider->getEntity()) != -1) {
+
+                if (collider == mCompoundProxyCollider) {
+                    mWorld.mCollisionDetection.addCollider(collider, getCompoundWorldAABB());
+                }
+
+                continue;
+            }
+
             // Compute the world-space AABB of the new collision shape
             AABB aabb;
             collider->getCollisionShape()->computeAABB(aabb, transform * mWorld.mCollidersComponents.getLocalToBodyTransform(collider->getEntity()));
@@ -466,6 +493,245 @@ Vector3 CollisionBody::getLocalVector(const Vector3& worldVector) const {
     return mWorld.mTransformComponents.getTransform(mEntity).getOrientation().getInverse() * worldVector;
 }
 
+// Set whether the colliders of the body share a single broad-phase proxy
+/// A compound body has a single node in the broad-phase. Its convex colliders that are
+/// not triggers are stored in a local tree of the body that is queried during the
+/// middle-phase. Concave colliders and triggers keep their own broad-phase proxy.
+/**
+ * @param isCompound True if the body must be a compound body
+ */
+void CollisionBody::setIsCompound(bool isCompound) {
+
+    // If the state does not change
+    if (isCompound == (mCompoundTree != nullptr)) return;
+
+    // Note that we need to copy the array of collider entities because the colliders are moved in a loop
+    const Array<Entity> colliderEntities = mWorld.mCollisionBodyComponents.getColliders(mEntity);
+
+    if (isCompound) {
+
+        // Create the compound tree of the body
+        mCompoundTree = new (mWorld.mMemoryManager.allocate(MemoryManager::AllocationType::Heap, sizeof(DynamicAABBTree)))
+                            DynamicAABBTree(mWorld.mMemoryManager.getHeapAllocator());
+
+        // Move the colliders from the broad-phase into the compound tree
+        for (uint32 i=0; i < colliderEntities.size(); i++) {
+
+            Collider* collider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
+
+            if (canBeCompoundChild(collider)) {
+
+                if (collider->getBroadPhaseId() != -1) {
+                    mWorld.mCollisionDetection.removeCollider(collider);
+                }
+
+                insertColliderIntoCompound(collider);
+            }
+        }
+
+        selectCompoundProxy();
+    }
+    else {
+
+        const bool isBodyActive = isActive();
+        const Transform& transform = mWorld.mTransformComponents.getTransform(mEntity);
+
+        // Move the colliders from the compound tree back into the broad-phase
+        for (uint32 i=0; i < colliderEntities.size(); i++) {
+
+            Collider* collider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
+            const int32 compoundId = mWorld.mCollidersComponents.getCompoundId(colliderEntities[i]);
+
+            if (compoundId != -1) {
+
+                if (collider->getBroadPhaseId() != -1) {
+                    mWorld.mCollisionDetection.removeCollider(collider);
+                }
+
+                mWorld.mCollidersComponents.setCompoundId(colliderEntities[i], -1);
+
+                if (isBodyActive) {
+
+                    AABB aabb;
+                    collider->getCollisionShape()->computeAABB(aabb, transform * collider->getLocalToBodyTransform());
+                    mWorld.mCollisionDetection.addCollider(collider, aabb);
+                }
+            }
+        }
+
+        mCompoundProxyCollider = nullptr;
+
+        // Destroy the compound tree
+        mCompoundTree->~DynamicAABBTree();
+        mWorld.mMemoryManager.release(MemoryManager::AllocationType::Heap, mCompoundTree, sizeof(DynamicAABBTree));
+        mCompoundTree = nullptr;
+    }
+
+    RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
+             "Body " + std::to_string(mEntity.id) + ": Set isCompound=" +
+             (isCompound ? "true" : "false"),  __FILE__, __LINE__);
+}
+
+// Add a new collider into the collision detection (or into the compound tree)
+void CollisionBody::addColliderToCollisionDetection(Collider* collider, const AABB& worldAABB) {
+
+    if (mCompoundTree != nullptr && canBeCompoundChild(collider)) {
+
+        insertColliderIntoCompound(collider);
+
+        if (mCompoundProxyCollider == nullptr) {
+            selectCompoundProxy();
+        }
+        else if (mCompoundProxyCollider->getBroadPhaseId() != -1) {
+
+            // The compound AABB might have grown, force the proxy to be reinserted in the broad-phase
+            mWorld.mCollidersComponents.setHasCollisionShapeChangedSize(mCompoundProxyCollider->getEntity(), true);
+            mWorld.mCollisionDetection.updateCollider(mCompoundProxyCollider->getEntity());
+        }
+    }
+    else {
+        mWorld.mCollisionDetection.addCollider(collider, worldAABB);
+    }
+}
+
+// Remove a collider from the collision detection (or from the compound tree)
+void CollisionBody::removeColliderFromCollisionDetection(Collider* collider) {
+
+    if (mWorld.mCollidersComponents.getCompoundId(collider->getEntity()) != -1) {
+        removeColliderFromCompound(collider);
+    }
+    else if (collider->getBroadPhaseId() != -1) {
+        mWorld.mCollisionDetection.removeCollider(collider);
+    }
+}
+
+// Return true if a collider can be stored in the compound tree of the body
+/// Only the convex colliders that are not triggers are stored in the compound tree.
+bool CollisionBody::canBeCompoundChild(const Collider* collider) const {
+    return collider->getCollisionShape()->isConvex() && !collider->getIsTrigger();
+}
+
+// Insert a collider into the compound tree of the body
+void CollisionBody::insertColliderIntoCompound(Collider* collider) {
+
+    assert(mCompoundTree != nullptr);
+    assert(mWorld.mCollidersComponents.getCompoundId(collider->getEntity()) == -1);
+
+    // Compute the AABB of the collider in the local-space of the body
+    AABB localAABB;
+    collider->getCollisionShape()->computeAABB(localAABB, collider->getLocalToBodyTransform());
+
+    const int32 compoundId = mCompoundTree->addObject(localAABB, collider);
+    mWorld.mCollidersComponents.setCompoundId(collider->getEntity(), compoundId);
+}
+
+// Remove a collider from the compound tree of the body
+void CollisionBody::removeColliderFromCompound(Collider* collider) {
+
+    assert(mCompoundTree != nullptr);
+
+    const int32 compoundId = mWorld.mCollidersComponents.getCompoundId(collider->getEntity());
+    assert(compoundId != -1);
+
+    mCompoundTree->removeObject(compoundId);
+    mWorld.mCollidersComponents.setCompoundId(collider->getEntity(), -1);
+
+    // The contact pairs of the collider in the compound tree are removed without OverlapExit event
+    mWorld.mCollisionDetection.askForTriggersUpdate(collider->getEntity());
+
+    // If the collider was holding the broad-phase proxy, another collider has to take it
+    if (collider == mCompoundProxyCollider) {
+
+        if (collider->getBroadPhaseId() != -1) {
+            mWorld.mCollisionDetection.removeCollider(collider);
+        }
+
+        mCompoundProxyCollider = nullptr;
+        selectCompoundProxy();
+    }
+}
+
+// Update the compound tree after the shape or the transform of a collider has changed
+void CollisionBody::updateColliderInCompound(Collider* collider) {
+
+    assert(mCompoundTree != nullptr);
+
+    const int32 compoundId = mWorld.mCollidersComponents.getCompoundId(collider->getEntity());
+    assert(compoundId != -1);
+
+    AABB localAABB;
+    collider->getCollisionShape()->computeAABB(localAABB, collider->getLocalToBodyTransform());
+    mCompoundTree->updateObject(compoundId, localAABB, true);
+
+    // Reinsert the proxy in the broad-phase with the new compound AABB
+    if (mCompoundProxyCollider != nullptr && mCompoundProxyCollider->getBroadPhaseId() != -1) {
+        mWorld.mCollidersComponents.setHasCollisionShapeChangedSize(mCompoundProxyCollider->getEntity(), true);
+        mWorld.mCollisionDetection.updateCollider(mCompoundProxyCollider->getEntity());
+    }
+}
+
+// Move a collider in or out of the compound tree if its properties have changed
+void CollisionBody::refreshColliderInCompound(Collider* collider) {
+
+    if (mCompoundTree == nullptr) return;
+
+    const bool isInCompound = mWorld.mCollidersComponents.getCompoundId(collider->getEntity()) != -1;
+    if (isInCompound == canBeCompoundChild(collider)) return;
+
+    if (isInCompound) {
+
+        // The collider gets its own broad-phase proxy
+        removeColliderFromCompound(collider);
+
+        if (isActive()) {
+            AABB aabb;
+            collider->getCollisionShape()->computeAABB(aabb, collider->getLocalToWorldTransform());
+            mWorld.mCollisionDetection.addCollider(collider, aabb);
+        }
+    }
+    else {
+
+        if (collider->getBroadPhaseId() != -1) {
+            mWorld.mCollisionDetection.removeCollider(collider);
+        }
+
+        addColliderToCollisionDetection(collider, collider->getWorldAABB());
+    }
+}
+
+// Select a collider to hold the broad-phase proxy of the compound body
+void CollisionBody::selectCompoundProxy() {
+
+    assert(mCompoundTree != nullptr);
+    assert(mCompoundProxyCollider == nullptr);
+
+    const Array<Entity>& colliderEntities = mWorld.mCollisionBodyComponents.getColliders(mEntity);
+    for (uint32 i=0; i < colliderEntities.size(); i++) {
+
+        if (mWorld.mCollidersComponents.getCompoundId(colliderEntities[i]) != -1) {
+
+            mCompoundProxyCollider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
+
+            if (isActive()) {
+                mWorld.mCollisionDetection.addCollider(mCompoundProxyCollider, getCompoundWorldAABB());
+            }
+
+            return;
+        }
+    }
+}
+
+// Return the world-space AABB of all the colliders of the compound tree
+AABB CollisionBody::getCompoundWorldAABB() const {
+
+    assert(mCompoundTree != nullptr);
+
+    AABB aabb = mCompoundTree->getRootAABB();
+    aabb.applyTransform(mWorld.mTransformComponents.getTransform(mEntity));
+
+    return aabb;
+}
+
 bool CollisionBody::isRigidBody()  {
     return false;
 }
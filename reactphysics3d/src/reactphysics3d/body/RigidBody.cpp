@@ -694,7 +694,7 @@ Collider* RigidBody::addCollider(CollisionShape* collisionShape, const Transform
     collisionShape->computeAABB(aabb, mWorld.mTransformComponents.getTransform(mEntity) * transform);
 
     // Notify the collision detection about this new collision shape
-    mWorld.mCollisionDetection.addCollider(collider, aabb);
+    addColliderToCollisionDetection(collider, aabb);
 
     RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
              "Body " + std::to_string(mEntity.id) + ": Collider " + std::to_string(collider->getBroadPhaseId()) + " added to body",  __FILE__, __LINE__);
@@ -1004,6 +1004,11 @@ void RigidBody::setIsSleeping(bool isSleeping) {
 
     mWorld.mRigidBodyComponents.setIsSleeping(mEntity, isSleeping);
 
+    // Record the change to report it to the event listener at the end of the next step
+    if (mWorld.mEventListener != nullptr) {
+        mWorld.mSleepChanges.add(Pair<Entity, bool>(mEntity, isSleeping));
+    }
+
     // Notify all the components
     mWorld.setBodyDisabled(mEntity, isSleeping);
 
@@ -1038,6 +1043,9 @@ void RigidBody::resetOverlappingPairs() {
 
             mWorld.mCollisionDetection.mOverlappingPairs.removePair(overlappingPairs[j]);
         }
+
+        // The pairs are removed without OverlapExit event
+        mWorld.mCollisionDetection.askForTriggersUpdate(colliderEntities[i]);
     }
 
     // Make sure we recompute the overlapping pairs with this body in the next frame
@@ -1084,9 +1092,19 @@ void RigidBody::setIsActive(bool isActive) {
     // If the state does not change
     if (mWorld.mCollisionBodyComponents.getIsActive(mEntity) == isActive) return;
 
-    setIsSleeping(!isActive);
+    if (isActive) {
+
+        // The body must be active before it can be woken up
+        CollisionBody::setIsActive(isActive);
+
+        setIsSleeping(false);
+    }
+    else {
 
-    CollisionBody::setIsActive(isActive);
+        setIsSleeping(true);
+
+        CollisionBody::setIsActive(isActive);
+    }
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -117,6 +117,11 @@ void Collider::setLocalToBodyTransform(const Transform& transform) {
         rigidBody->setIsSleeping(false);
     }
 
+    // Update the node of the collider in the compound tree of the body
+    if (mBody->mWorld.mCollidersComponents.getCompoundId(mEntity) != -1) {
+        mBody->updateColliderInCompound(this);
+    }
+
     mBody->mWorld.mCollisionDetection.updateCollider(mEntity);
 
     RP3D_LOG(mBody->mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Collider,
@@ -212,6 +217,11 @@ unsigned short Collider::getCollideWithMaskBits() const {
 // Notify the collider that the size of the collision shape has been changed by the user
 void Collider::setHasCollisionShapeChangedSize(bool hasCollisionShapeChangedSize) {
     mBody->mWorld.mCollidersComponents.setHasCollisionShapeChangedSize(mEntity, hasCollisionShapeChangedSize);
+
+    // Update the node of the collider in the compound tree of the body
+    if (hasCollisionShapeChangedSize && mBody->mWorld.mCollidersComponents.getCompoundId(mEntity) != -1) {
+        mBody->updateColliderInCompound(this);
+    }
 }
 
 // Set a new material for this rigid body
@@ -248,7 +258,35 @@ bool Collider::getIsTrigger() const {
  * @param isTrigger True if you want to set this collider as a trigger and false otherwise
  */
 void Collider::setIsTrigger(bool isTrigger) const {
+   const bool wasTrigger = mBody->mWorld.mCollidersComponents.getIsTrigger(mEntity);
    mBody->mWorld.mCollidersComponents.setIsTrigger(mEntity, isTrigger);
+
+   // The colliders inside the trigger are computed again at the next update
+   if (wasTrigger != isTrigger) {
+       mBody->mWorld.mCollisionDetection.askForTriggersUpdate(mEntity);
+   }
+
+   // Triggers are not stored in the compound tree of the body
+   mBody->refreshColliderInCompound(const_cast<Collider*>(this));
+}
+
+// Return the number of colliders inside the trigger
+/// The occupants are the colliders that overlap with the trigger in the last update of the world.
+/// A collider of a sleeping body is only an occupant of the trigger of an awake body.
+/**
+ * @return The number of colliders inside the trigger. 0 if the collider is not a trigger
+ */
+uint32 Collider::getNbTriggerOccupants() const {
+    return mBody->mWorld.mCollisionDetection.getTriggerOccupants(mEntity, nullptr);
+}
+
+// Add the colliders inside the trigger to an array
+/**
+ * @param occupants The array where the colliders inside the trigger are added
+ * @return The number of colliders added to the array
+ */
+uint32 Collider::getTriggerOccupants(Array<Collider*>& occupants) const {
+    return mBody->mWorld.mCollisionDetection.getTriggerOccupants(mEntity, &occupants);
 }
 
 // Return a reference to the material properties of the collider
@@ -235,3 +235,412 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
         gjkResults.add(GJKResult::INTERPENETRATE);
     }
 }
+
+// Compute the time of impact of a convex shape B moving along a translation against a convex shape A
+/// This method implements the GJK ray cast (conservative advancement) described by Gino van den
+/// Bergen in "Ray Casting against General Convex Objects with Application to Continuous Collision
+/// Detection". The shapes without margin are advanced along the translation until their distance
+/// is equal to the sum of their margins (or to a small skin distance for two polyhedra). The method
+/// returns false if the shapes do not touch before "maxFraction" of the translation. The hit
+/// normal is the world-space surface normal of shape A (pointing towards shape B) and the hit
+/// point is on the surface of shape A. If the shapes already overlap at the start of the
+/// translation, the hit fraction is zero. If they only touch and shape B moves away from shape A
+/// (or along its surface), there is no hit so that a shape can slide along a surface.
+bool GJKAlgorithm::shapeCast(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                             const Transform& transformB, const Vector3& translationB, decimal maxFraction,
+                             decimal& hitFraction, Vector3& hitPoint, Vector3& hitNormal) const {
+
+    RP3D_PROFILE("GJKAlgorithm::shapeCast()", mProfiler);
+
+    // The cast is computed in the local-space of shape A
+    const Transform transformBToA = transformA.getInverse() * transformB;
+    const Quaternion rotateToB = transformB.getOrientation().getInverse() * transformA.getOrientation();
+    const Vector3 r = transformA.getOrientation().getInverse() * translationB;
+
+    // Distance between the shapes without margin at the time of impact
+    const decimal marginA = shapeA->getMargin();
+    const decimal target = std::max(SHAPE_CAST_SKIN_DISTANCE, marginA + shapeB->getMargin());
+    const decimal tolerance = decimal(0.25) * SHAPE_CAST_SKIN_DISTANCE;
+
+    VoronoiSimplex simplex;
+    decimal lambda = decimal(0.0);
+    Vector3 normal(0, 0, 0);
+
+    // Initial search direction
+    Vector3 suppA = shapeA->getLocalSupportPointWithoutMargin(-r);
+    Vector3 suppB = transformBToA * shapeB->getLocalSupportPointWithoutMargin(rotateToB * r);
+    Vector3 v = suppA - suppB;
+
+    int nbIterations = 0;
+    while (nbIterations < MAX_ITERATIONS_GJK_RAYCAST && v.length() - target > tolerance) {
+
+        nbIterations++;
+
+        // Compute the support point of (A-B) in direction -v
+        suppA = shapeA->getLocalSupportPointWithoutMargin(-v);
+        suppB = transformBToA * shapeB->getLocalSupportPointWithoutMargin(rotateToB * v);
+        const Vector3 p = suppA - suppB;
+
+        const decimal distance = v.length();
+        v.normalize();
+
+        // If the separating plane of normal "v" is still in front of shape B at the current fraction
+        const decimal vDotP = v.dot(p);
+        const decimal vDotR = v.dot(r);
+        if (vDotP - target > lambda * vDotR) {
+
+            // If shape B moves away from the separating plane, there is no hit
+            if (vDotR <= decimal(0.0)) {
+                return false;
+            }
+
+            // Advance shape B until the plane
+            lambda = (vDotP - target) / vDotR;
+            if (lambda > maxFraction) {
+                return false;
+            }
+
+            normal = -v;
+            simplex.reset();
+        }
+
+        // Add the support point of (A-B) with shape B at its current position into the simplex.
+        // The support points of shape B are shifted so that the simplex stays valid after B moves.
+        const Vector3 suppBAtLambda = suppB + lambda * r;
+        const Vector3 w = suppA - suppBAtLambda;
+        const Vector3 direction = v;
+        bool isImproved = !simplex.isPointInSimplex(w);
+        if (isImproved) {
+            simplex.addPoint(w, suppA, suppBAtLambda);
+
+            // Compute the point of the simplex closest to the origin
+            isImproved = simplex.computeClosestPoint(v);
+        }
+
+        // If the closest point cannot be improved anymore (this happens with large shapes because of
+        // the numerical precision) and the shapes are still too far apart, shape B is advanced using
+        // the distance of the closest point instead of the separating plane
+        if (!isImproved) {
+
+            v = direction;
+            if (distance - target <= tolerance) {
+                break;
+            }
+            if (vDotR <= decimal(0.0)) {
+                return false;
+            }
+            lambda += (distance - target) / vDotR;
+            if (lambda > maxFraction) {
+                return false;
+            }
+
+            normal = -v;
+            simplex.reset();
+            continue;
+        }
+
+        // If the simplex is full, the origin is inside and the shapes without margin overlap
+        if (simplex.isFull()) {
+            v.setToZero();
+            break;
+        }
+    }
+
+    // Compute the surface normal of shape A
+    if (v.lengthSquare() > MACHINE_EPSILON) {
+        normal = -v.getUnit();
+    }
+    else if (normal.lengthSquare() < MACHINE_EPSILON) {
+        normal = r.lengthSquare() > MACHINE_EPSILON ? -r.getUnit() : Vector3(0, 1, 0);
+    }
+
+    // If the shapes only touch at the start and shape B does not move towards shape A (the normal
+    // of large shapes is not exact, so moving along the surface can approach it by a tiny distance)
+    if (lambda == decimal(0.0) && v.length() > target - tolerance && r.lengthSquare() > MACHINE_EPSILON &&
+        normal.dot(r) > -tolerance) {
+        return false;
+    }
+
+    // Compute the closest point on shape A without margin
+    Vector3 pointA = suppA;
+    if (!simplex.isEmpty() && !simplex.isFull()) {
+        Vector3 pointB;
+        simplex.computeClosestPointsOfAandB(pointA, pointB);
+    }
+
+    hitFraction = lambda;
+    hitPoint = transformA * (pointA + marginA * normal);
+    hitNormal = transformA.getOrientation() * normal;
+
+    return true;
+}
+
+// Run the GJK distance algorithm on two convex shapes without margin
+/// The shape B is expressed in the local-space of shape A. The method returns false if the
+/// shapes without margin overlap. Otherwise, "v" is the closest point of the Minkowski
+/// difference A-B to the origin and the simplex can be used to get the closest points.
+bool GJKAlgorithm::computeCoreDistance(const ConvexShape* shapeA, const ConvexShape* shapeB, const Transform& transformBToA,
+                                       VoronoiSimplex& simplex, Vector3& v) const {
+
+    const Quaternion rotateToB = transformBToA.getOrientation().getInverse();
+
+    v = -transformBToA.getPosition();
+    if (v.lengthSquare() < MACHINE_EPSILON) {
+        v.setAllValues(0, 1, 0);
+    }
+    decimal distSquare = DECIMAL_LARGEST;
+    decimal prevDistSquare;
+    int nbIterations = 0;
+
+    do {
+
+        nbIterations++;
+
+        // Compute the support point for the Minkowski difference A-B
+        const Vector3 suppA = shapeA->getLocalSupportPointWithoutMargin(-v);
+        const Vector3 suppB = transformBToA * shapeB->getLocalSupportPointWithoutMargin(rotateToB * v);
+        const Vector3 w = suppA - suppB;
+        const decimal vDotw = v.dot(w);
+
+        // If the closest point cannot be improved
+        if (simplex.isPointInSimplex(w) || distSquare - vDotw <= distSquare * REL_ERROR_SQUARE) {
+            break;
+        }
+
+        simplex.addPoint(w, suppA, suppB);
+
+        if (simplex.isAffinelyDependent() || !simplex.computeClosestPoint(v)) {
+            break;
+        }
+
+        // Store and update the squared distance of the closest point
+        prevDistSquare = distSquare;
+        distSquare = v.lengthSquare();
+
+        // If the distance to the closest point doesn't improve a lot
+        if (prevDistSquare - distSquare <= MACHINE_EPSILON * prevDistSquare) {
+            simplex.backupClosestPointInSimplex(v);
+            distSquare = v.lengthSquare();
+            break;
+        }
+
+    } while(!simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint() &&
+            nbIterations < MAX_ITERATIONS_GJK_RAYCAST);
+
+    // If the shapes without margin overlap
+    return !simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint();
+}
+
+// Return the number of edge directions of a convex shape for the separating axis test
+/// The edges of a polyhedron are stored as pairs of twin half-edges. The segment of a capsule
+/// is its only edge.
+static uint32 getNbEdgeDirections(const ConvexShape* shape) {
+
+    if (shape->isPolyhedron()) {
+        return static_cast<const ConvexPolyhedronShape*>(shape)->getNbHalfEdges() / 2;
+    }
+
+    return shape->getName() == CollisionShapeName::CAPSULE ? 1 : 0;
+}
+
+// Return an edge direction (in local-space) of a convex shape for the separating axis test
+static Vector3 getEdgeDirection(const ConvexShape* shape, uint32 edgeIndex) {
+
+    if (shape->isPolyhedron()) {
+        const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(shape);
+        const HalfEdgeStructure::Edge& edge = polyhedron->getHalfEdge(edgeIndex * 2);
+        const HalfEdgeStructure::Edge& nextEdge = polyhedron->getHalfEdge(edge.nextEdgeIndex);
+        return polyhedron->getVertexPosition(nextEdge.vertexIndex) - polyhedron->getVertexPosition(edge.vertexIndex);
+    }
+
+    // The segment of a capsule is along its local y axis
+    return Vector3(0, 1, 0);
+}
+
+// Compute the penetration depth of two convex shapes along both directions of an axis
+/// The shape B is expressed in the local-space of shape A and the axis must be a unit vector.
+/// The depth includes the margins of the shapes. If it is smaller than "depth", the depth and
+/// the direction (from shape A towards shape B) are stored in "depth" and "localNormal".
+void GJKAlgorithm::testPenetrationAxis(const ConvexShape* shapeA, const ConvexShape* shapeB, const Transform& transformBToA,
+                                       const Vector3& axis, Vector3& localNormal, decimal& depth) const {
+
+    const Quaternion rotateToB = transformBToA.getOrientation().getInverse();
+    const decimal margin = shapeA->getMargin() + shapeB->getMargin();
+
+    const decimal maxA = axis.dot(shapeA->getLocalSupportPointWithoutMargin(axis));
+    const decimal minA = axis.dot(shapeA->getLocalSupportPointWithoutMargin(-axis));
+    const decimal maxB = axis.dot(transformBToA * shapeB->getLocalSupportPointWithoutMargin(rotateToB * axis));
+    const decimal minB = axis.dot(transformBToA * shapeB->getLocalSupportPointWithoutMargin(rotateToB * (-axis)));
+
+    // Shape B moved along the axis
+    decimal axisDepth = maxA - minB + margin;
+    if (axisDepth < depth) {
+        depth = axisDepth;
+        localNormal = axis;
+    }
+
+    // Shape B moved against the axis
+    axisDepth = maxB - minA + margin;
+    if (axisDepth < depth) {
+        depth = axisDepth;
+        localNormal = -axis;
+    }
+}
+
+// Compute the axis of minimum penetration of two convex shapes with the separating axis test
+/// The shape B is expressed in the local-space of shape A. The tested axes are the face normals
+/// of the polyhedra, the cross products of the edges of the two shapes (the segment of a capsule
+/// is an edge) and the direction between the centers of the shapes. The depth includes the
+/// margins of the shapes and it is not positive if one of the axes separates the shapes.
+void GJKAlgorithm::computeMinPenetrationAxis(const ConvexShape* shapeA, const ConvexShape* shapeB, const Transform& transformBToA,
+                                             Vector3& localNormal, decimal& depth) const {
+
+    depth = DECIMAL_LARGEST;
+    localNormal.setAllValues(0, 1, 0);
+
+    const Quaternion& orientationB = transformBToA.getOrientation();
+
+    // Face normals
+    if (shapeA->isPolyhedron()) {
+        const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(shapeA);
+        const uint32 nbFaces = polyhedron->getNbFaces();
+        for (uint32 f=0; f < nbFaces; f++) {
+            testPenetrationAxis(shapeA, shapeB, transformBToA, polyhedron->getFaceNormal(f), localNormal, depth);
+        }
+    }
+    if (shapeB->isPolyhedron()) {
+        const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(shapeB);
+        const uint32 nbFaces = polyhedron->getNbFaces();
+        for (uint32 f=0; f < nbFaces; f++) {
+            testPenetrationAxis(shapeA, shapeB, transformBToA, orientationB * polyhedron->getFaceNormal(f), localNormal, depth);
+        }
+    }
+
+    // Cross products of the edges (parallel edges are skipped)
+    const uint32 nbEdgesA = getNbEdgeDirections(shapeA);
+    const uint32 nbEdgesB = getNbEdgeDirections(shapeB);
+    for (uint32 a=0; a < nbEdgesA; a++) {
+        const Vector3 edgeA = getEdgeDirection(shapeA, a);
+        for (uint32 b=0; b < nbEdgesB; b++) {
+            Vector3 axis = edgeA.cross(orientationB * getEdgeDirection(shapeB, b));
+            if (axis.lengthSquare() > MACHINE_EPSILON * edgeA.lengthSquare()) {
+                axis.normalize();
+                testPenetrationAxis(shapeA, shapeB, transformBToA, axis, localNormal, depth);
+            }
+        }
+    }
+
+    // Direction between the centers (the only axis of two spheres)
+    Vector3 centersAxis = transformBToA.getPosition();
+    if (centersAxis.lengthSquare() > MACHINE_EPSILON) {
+        centersAxis.normalize();
+        testPenetrationAxis(shapeA, shapeB, transformBToA, centersAxis, localNormal, depth);
+    }
+    else if (depth == DECIMAL_LARGEST) {
+        testPenetrationAxis(shapeA, shapeB, transformBToA, Vector3(0, 1, 0), localNormal, depth);
+    }
+}
+
+// Compute the closest points of two separated convex shapes
+/// This method runs the GJK distance algorithm on the shapes without margin and then
+/// moves the closest points to the surface of the shapes with margin. It returns false
+/// if the shapes (with margin) overlap, in which case the points are not computed.
+/// Otherwise the world-space closest points on shape A and shape B are returned.
+bool GJKAlgorithm::computeClosestPoints(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                                        const Transform& transformB, Vector3& pointA, Vector3& pointB) const {
+
+    RP3D_PROFILE("GJKAlgorithm::computeClosestPoints()", mProfiler);
+
+    // The distance is computed in the local-space of shape A
+    VoronoiSimplex simplex;
+    Vector3 v;
+    if (!computeCoreDistance(shapeA, shapeB, transformA.getInverse() * transformB, simplex, v)) {
+        return false;
+    }
+
+    // If the shapes overlap in their margins
+    const decimal marginA = shapeA->getMargin();
+    const decimal marginB = shapeB->getMargin();
+    const decimal distance = v.length();
+    if (distance <= marginA + marginB) {
+        return false;
+    }
+
+    // Move the closest points of the shapes without margin to the surface of the shapes
+    Vector3 localPointA;
+    Vector3 localPointB;
+    simplex.computeClosestPointsOfAandB(localPointA, localPointB);
+    const Vector3 normal = -v / distance;
+    pointA = transformA * (localPointA + marginA * normal);
+    pointB = transformA * (localPointB - marginB * normal);
+
+    return true;
+}
+
+// Compute the penetration of two overlapping convex shapes
+/// The method returns false if the shapes do not overlap. Otherwise, "normal" is the world-space
+/// direction (from shape A towards shape B) along which shape B must be moved by "depth" to
+/// separate the shapes. If the shapes only overlap in their margins, the result of the GJK
+/// distance algorithm is exact. If the shapes without margin overlap, the separating axis
+/// test gives the axis of minimum penetration (exact for two polyhedra).
+bool GJKAlgorithm::computePenetration(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                                      const Transform& transformB, Vector3& normal, decimal& depth) const {
+
+    RP3D_PROFILE("GJKAlgorithm::computePenetration()", mProfiler);
+
+    // The penetration is computed in the local-space of shape A
+    const Transform transformBToA = transformA.getInverse() * transformB;
+    const decimal margin = shapeA->getMargin() + shapeB->getMargin();
+
+    VoronoiSimplex simplex;
+    Vector3 v;
+    if (computeCoreDistance(shapeA, shapeB, transformBToA, simplex, v)) {
+
+        // If the shapes overlap only in their margins
+        const decimal distance = v.length();
+        if (distance >= margin) {
+            return false;
+        }
+        normal = transformA.getOrientation() * (-v / distance);
+        depth = margin - distance;
+
+        return true;
+    }
+
+    // The cores of the shapes overlap, find the axis of minimum penetration
+    Vector3 localNormal;
+    computeMinPenetrationAxis(shapeA, shapeB, transformBToA, localNormal, depth);
+    normal = transformA.getOrientation() * localNormal;
+
+    return depth > decimal(0.0);
+}
+
+// Return true if two convex shapes overlap
+/// The GJK distance algorithm is run on the shapes without margin. The shapes overlap if their
+/// cores overlap or if the distance between the cores is smaller than the sum of the margins.
+/// There is no skin distance, so shapes that are separated by a tiny gap do not overlap.
+bool GJKAlgorithm::testOverlap(const ConvexShape* shapeA, const Transform& transformA, const ConvexShape* shapeB,
+                               const Transform& transformB) const {
+
+    RP3D_PROFILE("GJKAlgorithm::testOverlap()", mProfiler);
+
+    const Transform transformBToA = transformA.getInverse() * transformB;
+
+    VoronoiSimplex simplex;
+    Vector3 v;
+    if (!computeCoreDistance(shapeA, shapeB, transformBToA, simplex, v)) {
+
+        // The GJK algorithm reports two polyhedra separated by a gap smaller than its relative
+        // tolerance as overlapping, so the separating axis test is used for them
+        if (shapeA->isPolyhedron() && shapeB->isPolyhedron()) {
+            Vector3 localNormal;
+            decimal depth;
+            computeMinPenetrationAxis(shapeA, shapeB, transformBToA, localNormal, depth);
+            return depth > decimal(0.0);
+        }
+
+        return true;
+    }
+
+    return v.length() < shapeA->getMargin() + shapeB->getMargin();
+}
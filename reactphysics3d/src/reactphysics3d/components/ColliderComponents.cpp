@@ -35,7 +35,7 @@ using namespace reactphysics3d;
 
 // Constructor
 ColliderComponents::ColliderComponents(MemoryAllocator& allocator)
-                    :Components(allocator, sizeof(Entity) + sizeof(Entity) + sizeof(Collider*) + sizeof(int32) +
+                    :Components(allocator, sizeof(Entity) + sizeof(Entity) + sizeof(Collider*) + sizeof(int32) + sizeof(int32) +
                 sizeof(Transform) + sizeof(CollisionShape*) + sizeof(unsigned short) +
                 sizeof(unsigned short) + sizeof(Transform) + sizeof(Array<uint64>) + sizeof(bool) +
                 sizeof(bool) + sizeof(Material)) {
@@ -61,7 +61,8 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
     Entity* newBodiesEntities = reinterpret_cast<Entity*>(newCollidersEntities + nbComponentsToAllocate);
     Collider** newColliders = reinterpret_cast<Collider**>(newBodiesEntities + nbComponentsToAllocate);
     int32* newBroadPhaseIds = reinterpret_cast<int32*>(newColliders + nbComponentsToAllocate);
-    Transform* newLocalToBodyTransforms = reinterpret_cast<Transform*>(newBroadPhaseIds + nbComponentsToAllocate);
+    int32* newCompoundIds = reinterpret_cast<int32*>(newBroadPhaseIds + nbComponentsToAllocate);
+    Transform* newLocalToBodyTransforms = reinterpret_cast<Transform*>(newCompoundIds + nbComponentsToAllocate);
     CollisionShape** newCollisionShapes = reinterpret_cast<CollisionShape**>(newLocalToBodyTransforms + nbComponentsToAllocate);
     unsigned short* newCollisionCategoryBits = reinterpret_cast<unsigned short*>(newCollisionShapes + nbComponentsToAllocate);
     unsigned short* newCollideWithMaskBits = reinterpret_cast<unsigned short*>(newCollisionCategoryBits + nbComponentsToAllocate);
@@ -79,6 +80,7 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newBodiesEntities, mBodiesEntities, mNbComponents * sizeof(Entity));
         memcpy(newColliders, mColliders, mNbComponents * sizeof(Collider*));
         memcpy(newBroadPhaseIds, mBroadPhaseIds, mNbComponents * sizeof(int32));
+        memcpy(newCompoundIds, mCompoundIds, mNbComponents * sizeof(int32));
         memcpy(newLocalToBodyTransforms, mLocalToBodyTransforms, mNbComponents * sizeof(Transform));
         memcpy(newCollisionShapes, mCollisionShapes, mNbComponents * sizeof(CollisionShape*));
         memcpy(newCollisionCategoryBits, mCollisionCategoryBits, mNbComponents * sizeof(unsigned short));
@@ -99,6 +101,7 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
     mCollidersEntities = newCollidersEntities;
     mColliders = newColliders;
     mBroadPhaseIds = newBroadPhaseIds;
+    mCompoundIds = newCompoundIds;
     mLocalToBodyTransforms = newLocalToBodyTransforms;
     mCollisionShapes = newCollisionShapes;
     mCollisionCategoryBits = newCollisionCategoryBits;
@@ -123,6 +126,7 @@ void ColliderComponents::addComponent(Entity colliderEntity, bool isSleeping, co
     new (mBodiesEntities + index) Entity(component.bodyEntity);
     mColliders[index] = component.collider;
     new (mBroadPhaseIds + index) int32(-1);
+    new (mCompoundIds + index) int32(-1);
     new (mLocalToBodyTransforms + index) Transform(component.localToBodyTransform);
     mCollisionShapes[index] = component.collisionShape;
     new (mCollisionCategoryBits + index) unsigned short(component.collisionCategoryBits);
@@ -152,6 +156,7 @@ void ColliderComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex)
     new (mBodiesEntities + destIndex) Entity(mBodiesEntities[srcIndex]);
     mColliders[destIndex] = mColliders[srcIndex];
     new (mBroadPhaseIds + destIndex) int32(mBroadPhaseIds[srcIndex]);
+    new (mCompoundIds + destIndex) int32(mCompoundIds[srcIndex]);
     new (mLocalToBodyTransforms + destIndex) Transform(mLocalToBodyTransforms[srcIndex]);
     mCollisionShapes[destIndex] = mCollisionShapes[srcIndex];
     new (mCollisionCategoryBits + destIndex) unsigned short(mCollisionCategoryBits[srcIndex]);
@@ -181,6 +186,7 @@ void ColliderComponents::swapComponents(uint32 index1, uint32 index2) {
     Entity bodyEntity1(mBodiesEntities[index1]);
     Collider* collider1 = mColliders[index1];
     int32 broadPhaseId1 = mBroadPhaseIds[index1];
+    int32 compoundId1 = mCompoundIds[index1];
     Transform localToBodyTransform1 = mLocalToBodyTransforms[index1];
     CollisionShape* collisionShape1 = mCollisionShapes[index1];
     unsigned short collisionCategoryBits1 = mCollisionCategoryBits[index1];
@@ -201,6 +207,7 @@ void ColliderComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mBodiesEntities + index2) Entity(bodyEntity1);
     mColliders[index2] = collider1;
     new (mBroadPhaseIds + index2) int32(broadPhaseId1);
+    new (mCompoundIds + index2) int32(compoundId1);
     new (mLocalToBodyTransforms + index2) Transform(localToBodyTransform1);
     mCollisionShapes[index2] = collisionShape1;
     new (mCollisionCategoryBits + index2) unsigned short(collisionCategoryBits1);
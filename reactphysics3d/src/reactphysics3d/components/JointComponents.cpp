@@ -35,7 +35,7 @@ using namespace reactphysics3d;
 JointComponents::JointComponents(MemoryAllocator& allocator)
                     :Components(allocator, sizeof(Entity) + sizeof(Entity) + sizeof(Entity) + sizeof(Joint*) +
                                 sizeof(JointType) + sizeof(JointsPositionCorrectionTechnique) + sizeof(bool) +
-                                sizeof(bool)) {
+                                sizeof(bool) + sizeof(decimal) + sizeof(decimal) + sizeof(bool)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -62,6 +62,9 @@ void JointComponents::allocate(uint32 nbComponentsToAllocate) {
     JointsPositionCorrectionTechnique* newPositionCorrectionTechniques = reinterpret_cast<JointsPositionCorrectionTechnique*>(newTypes + nbComponentsToAllocate);
     bool* newIsCollisionEnabled = reinterpret_cast<bool*>(newPositionCorrectionTechniques + nbComponentsToAllocate);
     bool* newIsAlreadyInIsland = reinterpret_cast<bool*>(newIsCollisionEnabled + nbComponentsToAllocate);
+    decimal* newBreakForces = reinterpret_cast<decimal*>(newIsAlreadyInIsland + nbComponentsToAllocate);
+    decimal* newBreakTorques = reinterpret_cast<decimal*>(newBreakForces + nbComponentsToAllocate);
+    bool* newIsBroken = reinterpret_cast<bool*>(newBreakTorques + nbComponentsToAllocate);
 
     // If there was already components before
     if (mNbComponents > 0) {
@@ -75,6 +78,9 @@ void JointComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newPositionCorrectionTechniques, mPositionCorrectionTechniques, mNbComponents * sizeof(JointsPositionCorrectionTechnique));
         memcpy(newIsCollisionEnabled, mIsCollisionEnabled, mNbComponents * sizeof(bool));
         memcpy(newIsAlreadyInIsland, mIsAlreadyInIsland, mNbComponents * sizeof(bool));
+        memcpy(newBreakForces, mBreakForces, mNbComponents * sizeof(decimal));
+        memcpy(newBreakTorques, mBreakTorques, mNbComponents * sizeof(decimal));
+        memcpy(newIsBroken, mIsBroken, mNbComponents * sizeof(bool));
 
         // Deallocate previous memory
         mMemoryAllocator.release(mBuffer, mNbAllocatedComponents * mComponentDataSize);
@@ -90,6 +96,9 @@ void JointComponents::allocate(uint32 nbComponentsToAllocate) {
     mPositionCorrectionTechniques = newPositionCorrectionTechniques;
     mIsCollisionEnabled = newIsCollisionEnabled;
     mIsAlreadyInIsland = newIsAlreadyInIsland;
+    mBreakForces = newBreakForces;
+    mBreakTorques = newBreakTorques;
+    mIsBroken = newIsBroken;
 }
 
 // Add a component
@@ -107,6 +116,9 @@ void JointComponents::addComponent(Entity jointEntity, bool isSleeping, const Jo
     new (mPositionCorrectionTechniques + index) JointsPositionCorrectionTechnique(component.positionCorrectionTechnique);
     mIsCollisionEnabled[index] = component.isCollisionEnabled;
     mIsAlreadyInIsland[index] = false;
+    mBreakForces[index] = component.breakForce;
+    mBreakTorques[index] = component.breakTorque;
+    mIsBroken[index] = false;
 
     // Map the entity with the new component lookup index
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(jointEntity, index));
@@ -132,6 +144,9 @@ void JointComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex) {
     new (mPositionCorrectionTechniques + destIndex) JointsPositionCorrectionTechnique(mPositionCorrectionTechniques[srcIndex]);
     mIsCollisionEnabled[destIndex] = mIsCollisionEnabled[srcIndex];
     mIsAlreadyInIsland[destIndex] = mIsAlreadyInIsland[srcIndex];
+    mBreakForces[destIndex] = mBreakForces[srcIndex];
+    mBreakTorques[destIndex] = mBreakTorques[srcIndex];
+    mIsBroken[destIndex] = mIsBroken[srcIndex];
 
     // Destroy the source component
     destroyComponent(srcIndex);
@@ -156,6 +171,9 @@ void JointComponents::swapComponents(uint32 index1, uint32 index2) {
     JointsPositionCorrectionTechnique positionCorrectionTechnique1(mPositionCorrectionTechniques[index1]);
     bool isCollisionEnabled1 = mIsCollisionEnabled[index1];
     bool isAlreadyInIsland = mIsAlreadyInIsland[index1];
+    decimal breakForce1 = mBreakForces[index1];
+    decimal breakTorque1 = mBreakTorques[index1];
+    bool isBroken1 = mIsBroken[index1];
 
     // Destroy component 1
     destroyComponent(index1);
@@ -171,6 +189,9 @@ void JointComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mPositionCorrectionTechniques + index2) JointsPositionCorrectionTechnique(positionCorrectionTechnique1);
     mIsCollisionEnabled[index2] = isCollisionEnabled1;
     mIsAlreadyInIsland[index2] = isAlreadyInIsland;
+    mBreakForces[index2] = breakForce1;
+    mBreakTorques[index2] = breakTorque1;
+    mIsBroken[index2] = isBroken1;
 
     // Update the entity to component index mapping
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(jointEntity1, index2));
@@ -70,6 +70,53 @@ bool Joint::isCollisionEnabled() const {
     return mWorld.mJointsComponents.getIsCollisionEnabled(mEntity);
 }
 
+// Return the force above which the joint breaks
+/**
+ * @return The force (in Newtons) above which the joint breaks
+ */
+decimal Joint::getBreakForce() const {
+    return mWorld.mJointsComponents.getBreakForce(mEntity);
+}
+
+// Set the force above which the joint breaks
+/// The force applied by the joint is compared with this value at the end of each
+/// step. Use DECIMAL_LARGEST (the default value) for a joint that never breaks.
+/**
+ * @param breakForce The force (in Newtons) above which the joint breaks
+ */
+void Joint::setBreakForce(decimal breakForce) {
+    assert(breakForce >= decimal(0.0));
+    mWorld.mJointsComponents.setBreakForce(mEntity, breakForce);
+}
+
+// Return the torque above which the joint breaks
+/**
+ * @return The torque (in Newtons * meters) above which the joint breaks
+ */
+decimal Joint::getBreakTorque() const {
+    return mWorld.mJointsComponents.getBreakTorque(mEntity);
+}
+
+// Set the torque above which the joint breaks
+/// The torque applied by the joint is compared with this value at the end of each
+/// step. Use DECIMAL_LARGEST (the default value) for a joint that never breaks.
+/**
+ * @param breakTorque The torque (in Newtons * meters) above which the joint breaks
+ */
+void Joint::setBreakTorque(decimal breakTorque) {
+    assert(breakTorque >= decimal(0.0));
+    mWorld.mJointsComponents.setBreakTorque(mEntity, breakTorque);
+}
+
+// Return true if the joint has been broken
+/// A broken joint stays disabled until it is destroyed
+/**
+ * @return True if the force or the torque of the joint has exceeded its break threshold
+ */
+bool Joint::isBroken() const {
+    return mWorld.mJointsComponents.getIsBroken(mEntity);
+}
+
 // Awake the two bodies of the joint
 void Joint::awakeBodies() const {
 
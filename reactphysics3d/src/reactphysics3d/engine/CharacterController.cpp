@@ -0,0 +1,325 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/CharacterController.h>
+#include <reactphysics3d/engine/PhysicsWorld.h>
+#include <reactphysics3d/body/RigidBody.h>
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/collision/ShapeCastInfo.h>
+#include <reactphysics3d/collision/shapes/ConvexShape.h>
+
+using namespace reactphysics3d;
+
+// Minimal cosine used to compute the back off distance of a grazing hit
+static constexpr decimal MIN_BACK_OFF_COSINE = decimal(0.1);
+
+// Constructor
+CharacterController::CharacterController(PhysicsWorld& world, RigidBody* body, Collider* collider,
+                                         const CharacterControllerSettings& settings)
+                    : mWorld(world), mBody(body), mCollider(collider),
+                      mShape(static_cast<const ConvexShape*>(collider->getCollisionShape())),
+                      mUp(settings.up.getUnit()), mStepHeight(settings.stepHeight), mSnapDistance(settings.snapDistance),
+                      mSkinWidth(settings.skinWidth), mPushForce(settings.pushForce),
+                      mCollideWithMaskBits(settings.collideWithMaskBits), mIsOnGround(false), mGroundNormal(settings.up.getUnit()),
+                      mGroundCollider(nullptr), mDisplacement(0, 0, 0) {
+
+    setMaxSlopeAngle(settings.maxSlopeAngle);
+}
+
+// Move the character
+/// The overlaps of the character are resolved first. Then the horizontal part of the displacement
+/// is applied (with step up if the character is blocked by an obstacle) and then the vertical part
+/// of the displacement is applied. Finally, the ground under the character is updated. If the
+/// character was on the ground before the move and does not move up, it is moved down (up to the
+/// snap distance) to stay on the ground. The dynamic bodies hit by the character are pushed only
+/// along the path that is kept (the bodies hit by a rejected step up are not pushed).
+/**
+ * @param displacement World-space displacement of the character
+ */
+void CharacterController::move(const Vector3& displacement) {
+
+    const Transform& transform = mBody->getTransform();
+    const Quaternion orientation = transform.getOrientation();
+    const Vector3 startPosition = transform.getPosition();
+    Vector3 position = startPosition;
+    const bool wasOnGround = mIsOnGround;
+
+    depenetrate(position, orientation);
+
+    const decimal verticalDistance = displacement.dot(mUp);
+    const Vector3 horizontalDisplacement = displacement - verticalDistance * mUp;
+
+    // Horizontal move
+    if (horizontalDisplacement.lengthSquare() > MACHINE_EPSILON) {
+
+        ShapeCastInfo slideHits[MAX_CHARACTER_SLIDE_ITERATIONS];
+        int nbSlideHits = 0;
+        Vector3 slidePosition = position;
+        const bool isBlocked = slide(slidePosition, orientation, horizontalDisplacement, true, slideHits, nbSlideHits);
+        const ShapeCastInfo* hits = slideHits;
+        int nbHits = nbSlideHits;
+
+        // If the character is blocked by an obstacle, try to step on it
+        ShapeCastInfo stepHits[MAX_CHARACTER_SLIDE_ITERATIONS];
+        if (isBlocked && wasOnGround && mStepHeight > decimal(0.0)) {
+
+            int nbStepHits = 0;
+            Vector3 stepPosition = position;
+            if (stepUp(stepPosition, orientation, horizontalDisplacement, stepHits, nbStepHits) &&
+                (stepPosition - position).dot(horizontalDisplacement) > (slidePosition - position).dot(horizontalDisplacement)) {
+                slidePosition = stepPosition;
+                hits = stepHits;
+                nbHits = nbStepHits;
+            }
+        }
+
+        position = slidePosition;
+        pushBodies(hits, nbHits);
+    }
+
+    // Vertical move
+    if (std::abs(verticalDistance) > MACHINE_EPSILON) {
+        ShapeCastInfo hits[MAX_CHARACTER_SLIDE_ITERATIONS];
+        int nbHits = 0;
+        slide(position, orientation, verticalDistance * mUp, false, hits, nbHits);
+        pushBodies(hits, nbHits);
+    }
+
+    updateGround(position, orientation, wasOnGround && verticalDistance <= decimal(0.0));
+
+    mBody->setTransform(Transform(position, orientation));
+    mDisplacement = position - startPosition;
+}
+
+// Move the character out of the colliders it overlaps with
+/// The deepest overlap is resolved at each iteration and the character is moved one skin
+/// width further so that the next shape casts do not start in contact.
+void CharacterController::depenetrate(Vector3& position, const Quaternion& orientation) const {
+
+    for (int i=0; i < MAX_CHARACTER_DEPENETRATION_ITERATIONS; i++) {
+
+        Vector3 translation;
+        if (!mWorld.computePenetration(mShape, Transform(position, orientation), translation, mCollideWithMaskBits, mBody)) {
+            break;
+        }
+
+        const decimal depth = translation.length();
+        position += translation * ((depth + mSkinWidth) / depth);
+    }
+}
+
+// Move the character along a displacement and slide along the surfaces that are hit
+/// The character stops one skin width before each hit and the rest of the displacement is
+/// projected on the hit surface. For an horizontal move, the surfaces that are not walkable
+/// are considered as vertical walls so that the character cannot climb steep slopes. For a
+/// vertical move down, the character stops on a walkable surface. The hits are stored in the
+/// "hits" array (at most MAX_CHARACTER_SLIDE_ITERATIONS). The method returns true if the
+/// character has hit a surface that is not walkable.
+bool CharacterController::slide(Vector3& position, const Quaternion& orientation, const Vector3& displacement, bool isHorizontal,
+                                ShapeCastInfo* hits, int& nbHits) const {
+
+    nbHits = 0;
+    bool isBlocked = false;
+    Vector3 remaining = displacement;
+
+    for (int i=0; i < MAX_CHARACTER_SLIDE_ITERATIONS; i++) {
+
+        const decimal length = remaining.length();
+        if (length <= MACHINE_EPSILON) {
+            break;
+        }
+
+        // The cast is one skin width longer than the move so that the character never ends closer
+        // than the skin width to a surface
+        const Vector3 direction = remaining / length;
+        const decimal castLength = length + mSkinWidth;
+        ShapeCastInfo& shapeCastInfo = hits[nbHits];
+        if (!mWorld.shapeCast(mShape, Transform(position, orientation), direction * castLength, shapeCastInfo,
+                              mCollideWithMaskBits, mBody)) {
+            position += remaining;
+            break;
+        }
+
+        // Move the character to the hit while keeping the skin width
+        Vector3 normal = shapeCastInfo.worldNormal;
+        const decimal backOff = mSkinWidth / std::max(-direction.dot(normal), MIN_BACK_OFF_COSINE);
+        const decimal distance = std::max(shapeCastInfo.hitFraction * castLength - backOff, decimal(0.0));
+        if (distance >= length) {
+            position += remaining;
+            break;
+        }
+        position += direction * distance;
+        remaining = direction * (length - distance);
+
+        nbHits++;
+
+        const bool isSurfaceWalkable = isWalkable(normal);
+        if (isHorizontal) {
+
+            // A surface that is not walkable is a wall
+            if (!isSurfaceWalkable) {
+                isBlocked = true;
+                normal -= normal.dot(mUp) * mUp;
+                if (normal.lengthSquare() <= MACHINE_EPSILON) {
+                    break;
+                }
+                normal.normalize();
+            }
+        }
+        else if (isSurfaceWalkable && direction.dot(mUp) < decimal(0.0)) {
+
+            // The character lands on the ground
+            break;
+        }
+
+        // Slide along the surface
+        remaining -= remaining.dot(normal) * normal;
+
+        // Never slide backward
+        if (remaining.dot(displacement) <= decimal(0.0)) {
+            break;
+        }
+    }
+
+    return isBlocked;
+}
+
+// Try to move the character horizontally over an obstacle
+/// The character is moved up (at most the step height), then horizontally and then down on
+/// the obstacle. The hits of the horizontal move are stored in the "hits" array. The method
+/// returns false if the character does not land on a walkable surface.
+bool CharacterController::stepUp(Vector3& position, const Quaternion& orientation, const Vector3& displacement,
+                                 ShapeCastInfo* hits, int& nbHits) const {
+
+    ShapeCastInfo shapeCastInfo;
+
+    // Move up
+    decimal upDistance = mStepHeight;
+    if (mWorld.shapeCast(mShape, Transform(position, orientation), (mStepHeight + mSkinWidth) * mUp, shapeCastInfo,
+                         mCollideWithMaskBits, mBody)) {
+        upDistance = clamp(shapeCastInfo.hitFraction * (mStepHeight + mSkinWidth) - mSkinWidth, decimal(0.0), mStepHeight);
+    }
+    if (upDistance <= mSkinWidth) {
+        return false;
+    }
+    position += upDistance * mUp;
+
+    // Move horizontally
+    slide(position, orientation, displacement, true, hits, nbHits);
+
+    // Move down on the obstacle
+    const Vector3 down = -upDistance * mUp;
+    if (!mWorld.shapeCast(mShape, Transform(position, orientation), down, shapeCastInfo, mCollideWithMaskBits, mBody) ||
+        !isWalkable(shapeCastInfo.worldNormal)) {
+        return false;
+    }
+    const decimal backOff = mSkinWidth / std::max(shapeCastInfo.worldNormal.dot(mUp), MIN_BACK_OFF_COSINE);
+    position += std::max(shapeCastInfo.hitFraction * upDistance - backOff, decimal(0.0)) * (-mUp);
+
+    return true;
+}
+
+// Reset the ground state (the character is not on the ground anymore)
+void CharacterController::resetGround() {
+    mIsOnGround = false;
+    mGroundCollider = nullptr;
+    mGroundNormal = mUp;
+}
+
+// Find the ground under the character and snap the character to it
+/// If "snapToGround" is true, the ground is searched up to the snap distance under the
+/// character and the character is moved down on it.
+void CharacterController::updateGround(Vector3& position, const Quaternion& orientation, bool snapToGround) {
+
+    resetGround();
+
+    const decimal probeDistance = snapToGround ? std::max(mSnapDistance, decimal(2.0) * mSkinWidth) : decimal(2.0) * mSkinWidth;
+
+    ShapeCastInfo shapeCastInfo;
+    if (!mWorld.shapeCast(mShape, Transform(position, orientation), -probeDistance * mUp, shapeCastInfo, mCollideWithMaskBits, mBody) ||
+        !isWalkable(shapeCastInfo.worldNormal)) {
+        return;
+    }
+
+    mIsOnGround = true;
+    mGroundNormal = shapeCastInfo.worldNormal;
+    mGroundCollider = shapeCastInfo.collider;
+
+    if (snapToGround) {
+        const decimal backOff = mSkinWidth / std::max(shapeCastInfo.worldNormal.dot(mUp), MIN_BACK_OFF_COSINE);
+        position -= std::max(shapeCastInfo.hitFraction * probeDistance - backOff, decimal(0.0)) * mUp;
+    }
+}
+
+// Apply the push force to the dynamic bodies hit by the character
+void CharacterController::pushBodies(const ShapeCastInfo* hits, int nbHits) const {
+
+    if (mPushForce <= decimal(0.0)) {
+        return;
+    }
+
+    for (int i=0; i < nbHits; i++) {
+
+        const Entity bodyEntity = hits[i].body->getEntity();
+        if (!mWorld.mRigidBodyComponents.hasComponent(bodyEntity) ||
+            mWorld.mRigidBodyComponents.getBodyType(bodyEntity) != BodyType::DYNAMIC) {
+            continue;
+        }
+
+        RigidBody* rigidBody = static_cast<RigidBody*>(hits[i].body);
+        rigidBody->applyWorldForceAtWorldPosition(-mPushForce * hits[i].worldNormal, hits[i].worldPoint);
+    }
+}
+
+// Return the world-space position of the character
+const Vector3& CharacterController::getPosition() const {
+    return mBody->getTransform().getPosition();
+}
+
+// Teleport the character to a world-space position
+/// The character is not on the ground anymore until the next move.
+void CharacterController::setPosition(const Vector3& position) {
+
+    mBody->setTransform(Transform(position, mBody->getTransform().getOrientation()));
+    resetGround();
+    mDisplacement.setToZero();
+}
+
+// Set the up direction of the character
+/**
+ * @param up The up direction (it does not need to be normalized)
+ */
+void CharacterController::setUp(const Vector3& up) {
+    assert(up.lengthSquare() > MACHINE_EPSILON);
+    mUp = up.getUnit();
+}
+
+// Set the maximum walkable slope angle (in radians)
+void CharacterController::setMaxSlopeAngle(decimal maxSlopeAngle) {
+    assert(maxSlopeAngle >= decimal(0.0) && maxSlopeAngle <= PI_RP3D);
+    mMaxSlopeAngle = maxSlopeAngle;
+    mCosMaxSlopeAngle = std::cos(maxSlopeAngle);
+}
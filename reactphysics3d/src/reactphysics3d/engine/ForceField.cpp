@@ -0,0 +1,224 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/ForceField.h>
+#include <reactphysics3d/engine/PhysicsWorld.h>
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/collision/shapes/SphereShape.h>
+#include <reactphysics3d/containers/Set.h>
+
+using namespace reactphysics3d;
+
+// Constructor
+ForceField::ForceField(PhysicsWorld& world, Collider* collider, const AABB& aabb, const ForceFieldSettings& settings)
+           : mWorld(world), mIsColliderVolume(collider != nullptr), mCollider(collider), mAABB(aabb), mIsEnabled(true),
+             mType(settings.type), mDirection(settings.direction.getUnit()), mStrength(settings.strength),
+             mCenter(settings.center), mRadius(settings.radius), mFluidDensity(settings.fluidDensity),
+             mLinearDrag(settings.linearDrag), mAngularDrag(settings.angularDrag),
+             mCollideWithMaskBits(settings.collideWithMaskBits) {
+
+}
+
+// Return the world-space AABB of the volume
+AABB ForceField::getAABB() const {
+
+    if (mIsColliderVolume) {
+        return mCollider != nullptr ? mCollider->getWorldAABB() : AABB();
+    }
+
+    return mAABB;
+}
+
+// Return true if a world-space point is inside the volume
+bool ForceField::isPointInside(const Vector3& point) const {
+
+    if (mIsColliderVolume) {
+        return mCollider->testPointInside(point);
+    }
+
+    return mAABB.contains(point);
+}
+
+// Add the forces of the field to the external forces of the bodies inside the volume
+/// The forces are added once per update of the world and are integrated with the gravity
+void ForceField::applyForces(decimal timeStep) {
+
+    // The collider of the volume has been removed
+    if (!mIsEnabled || (mIsColliderVolume && mCollider == nullptr)) return;
+
+    const AABB volumeAABB = getAABB();
+    const CollisionBody* volumeBody = mIsColliderVolume ? mCollider->getBody() : nullptr;
+
+    MemoryAllocator& allocator = mWorld.mMemoryManager.getHeapAllocator();
+    Array<Entity> colliders(allocator, 16);
+    mWorld.mCollisionDetection.computeQueryColliders(volumeAABB, mCollideWithMaskBits, false, colliders, volumeBody);
+
+    // The fluid surface is the top of the volume along the gravity
+    const Vector3& gravity = mWorld.mConfig.gravity;
+    const decimal gravityLength = mWorld.mIsGravityEnabled ? gravity.length() : decimal(0.0);
+    const Vector3 up = gravity.lengthSquare() > MACHINE_EPSILON ? -gravity / gravity.length() : Vector3(0, 1, 0);
+    decimal surfaceHeight = decimal(0.0);
+    if (mType == ForceFieldType::BUOYANCY) {
+        const Vector3& min = volumeAABB.getMin();
+        const Vector3& max = volumeAABB.getMax();
+        surfaceHeight = (up.x > 0 ? max.x : min.x) * up.x + (up.y > 0 ? max.y : min.y) * up.y +
+                        (up.z > 0 ? max.z : min.z) * up.z;
+    }
+
+    Set<Entity> processedBodies(allocator);
+
+    const uint32 nbColliders = static_cast<uint32>(colliders.size());
+    for (uint32 i=0; i < nbColliders; i++) {
+
+        const Entity bodyEntity = mWorld.mCollidersComponents.getBody(colliders[i]);
+
+        // Only the awake dynamic bodies are affected
+        if (!mWorld.mRigidBodyComponents.hasComponent(bodyEntity) ||
+            mWorld.mRigidBodyComponents.getBodyType(bodyEntity) != BodyType::DYNAMIC ||
+            mWorld.mRigidBodyComponents.getIsSleeping(bodyEntity)) {
+            continue;
+        }
+
+        if (mType == ForceFieldType::BUOYANCY) {
+            applyBuoyancy(colliders[i], up, gravityLength, surfaceHeight, timeStep);
+            continue;
+        }
+
+        // The wind and the attractor act once on each body
+        if (processedBodies.contains(bodyEntity)) continue;
+        processedBodies.add(bodyEntity);
+
+        const Vector3& centerOfMass = mWorld.mRigidBodyComponents.getCenterOfMassWorld(bodyEntity);
+        if (!isPointInside(centerOfMass)) continue;
+
+        const Vector3 force = computeBodyForce(bodyEntity, centerOfMass);
+        mWorld.mRigidBodyComponents.setExternalForce(bodyEntity, mWorld.mRigidBodyComponents.getExternalForce(bodyEntity) + force);
+    }
+}
+
+// Compute the force of a wind or an attractor on a body
+Vector3 ForceField::computeBodyForce(Entity bodyEntity, const Vector3& centerOfMass) const {
+
+    if (mType == ForceFieldType::WIND) {
+        return mDirection * mStrength;
+    }
+
+    Vector3 toCenter = mCenter - centerOfMass;
+    const decimal distance = toCenter.length();
+    if (distance < MACHINE_EPSILON) return Vector3::zero();
+
+    // The acceleration decreases linearly with the distance to the center
+    decimal factor = decimal(1.0);
+    if (mRadius > decimal(0.0)) {
+        factor = std::max(decimal(0.0), decimal(1.0) - distance / mRadius);
+    }
+
+    return toCenter / distance * (mStrength * mWorld.mRigidBodyComponents.getMass(bodyEntity) * factor);
+}
+
+// Add the buoyancy force and the drag of the fluid on a collider
+/// The submerged volume is exact for a sphere. For the other convex shapes, it is the
+/// volume of the shape multiplied by the submerged fraction of its extent along the gravity.
+/// The force is applied at the middle of the submerged part of the collider. The drag
+/// coefficients are clamped so that the drag never removes more than the current velocity
+/// of the body during the time step (a large drag would otherwise reverse the velocity).
+void ForceField::applyBuoyancy(Entity colliderEntity, const Vector3& up, decimal gravityLength, decimal surfaceHeight,
+                               decimal timeStep) {
+
+    const CollisionShape* shape = mWorld.mCollidersComponents.getCollisionShape(colliderEntity);
+    if (!shape->isConvex()) return;
+    const ConvexShape* convexShape = static_cast<const ConvexShape*>(shape);
+
+    // Extent of the collider along the up direction
+    const Transform& colliderTransform = mWorld.mCollidersComponents.getLocalToWorldTransform(colliderEntity);
+    const Vector3 localUp = colliderTransform.getOrientation().getInverse() * up;
+    const decimal top = up.dot(colliderTransform * convexShape->getLocalSupportPointWithMargin(localUp));
+    const decimal bottom = up.dot(colliderTransform * convexShape->getLocalSupportPointWithMargin(-localUp));
+    if (bottom >= surfaceHeight || top - bottom < MACHINE_EPSILON) return;
+
+    const decimal submergedTop = std::min(top, surfaceHeight);
+    const decimal depth = submergedTop - bottom;
+
+    decimal submergedVolume;
+    if (shape->getName() == CollisionShapeName::SPHERE) {
+
+        // Volume of the spherical cap under the surface
+        const decimal radius = static_cast<const SphereShape*>(shape)->getRadius();
+        submergedVolume = PI_RP3D * depth * depth * (decimal(3.0) * radius - depth) / decimal(3.0);
+    }
+    else {
+        submergedVolume = shape->getVolume() * depth / (top - bottom);
+    }
+    if (submergedVolume <= decimal(0.0)) return;
+
+    // Middle of the submerged part of the collider
+    const Vector3& colliderCenter = colliderTransform.getPosition();
+    const Vector3 point = colliderCenter + up * ((bottom + submergedTop) * decimal(0.5) - up.dot(colliderCenter));
+    if (!isPointInside(point)) return;
+
+    const Entity bodyEntity = mWorld.mCollidersComponents.getBody(colliderEntity);
+
+    // Part of the body under the surface used to weight the drag
+    decimal bodyVolume = decimal(0.0);
+    const Array<Entity>& bodyColliders = mWorld.mCollisionBodyComponents.getColliders(bodyEntity);
+    for (uint32 i=0; i < bodyColliders.size(); i++) {
+        const CollisionShape* bodyShape = mWorld.mCollidersComponents.getCollisionShape(bodyColliders[i]);
+        if (bodyShape->isConvex() && !mWorld.mCollidersComponents.getIsTrigger(bodyColliders[i])) {
+            bodyVolume += bodyShape->getVolume();
+        }
+    }
+    const decimal weight = bodyVolume > decimal(0.0) ? std::min(decimal(1.0), submergedVolume / bodyVolume) : decimal(0.0);
+
+    const Vector3& centerOfMass = mWorld.mRigidBodyComponents.getCenterOfMassWorld(bodyEntity);
+    const Vector3& linearVelocity = mWorld.mRigidBodyComponents.getLinearVelocity(bodyEntity);
+    const Vector3& angularVelocity = mWorld.mRigidBodyComponents.getAngularVelocity(bodyEntity);
+    const Vector3 r = point - centerOfMass;
+    const decimal mass = mWorld.mRigidBodyComponents.getMass(bodyEntity);
+
+    // The weights of the colliders of a body sum to at most one, so the drag of the body is clamped too
+    const decimal maxDrag = decimal(1.0) / timeStep;
+    const decimal linearDrag = std::min(mLinearDrag, maxDrag);
+    const decimal angularDrag = std::min(mAngularDrag, maxDrag);
+
+    Vector3 force = -linearDrag * mass * weight * (linearVelocity + angularVelocity.cross(r));
+
+    // The buoyancy force is not applied on a body that ignores the gravity
+    if (mWorld.mRigidBodyComponents.getIsGravityEnabled(bodyEntity)) {
+        force += up * (mFluidDensity * submergedVolume * gravityLength);
+    }
+
+    // Angular drag proportional to the angular momentum of the body
+    const Quaternion& orientation = mWorld.mTransformComponents.getTransform(bodyEntity).getOrientation();
+    const Vector3& inertiaLocal = mWorld.mRigidBodyComponents.getLocalInertiaTensor(bodyEntity);
+    const Vector3 localAngularVelocity = orientation.getInverse() * angularVelocity;
+    const Vector3 angularMomentum = orientation * Vector3(inertiaLocal.x * localAngularVelocity.x,
+                                                          inertiaLocal.y * localAngularVelocity.y,
+                                                          inertiaLocal.z * localAngularVelocity.z);
+    const Vector3 torque = r.cross(force) - angularDrag * weight * angularMomentum;
+
+    mWorld.mRigidBodyComponents.setExternalForce(bodyEntity, mWorld.mRigidBodyComponents.getExternalForce(bodyEntity) + force);
+    mWorld.mRigidBodyComponents.setExternalTorque(bodyEntity, mWorld.mRigidBodyComponents.getExternalTorque(bodyEntity) + torque);
+}
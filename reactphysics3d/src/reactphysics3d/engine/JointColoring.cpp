@@ -0,0 +1,126 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+// Libraries
+#include <reactphysics3d/engine/JointColoring.h>
+#include <reactphysics3d/memory/MemoryManager.h>
+#include <reactphysics3d/components/JointComponents.h>
+#include <reactphysics3d/components/RigidBodyComponents.h>
+#include <cstring>
+
+using namespace reactphysics3d;
+
+// Compute the colors of the joints
+/**
+ * @param memoryManager The memory manager (the arrays are allocated with the frame allocator)
+ * @param jointEntities The entities of the enabled joint components of a joint type
+ * @param nbJointEntities The number of enabled joint components
+ * @param jointComponents The joint components
+ * @param rigidBodyComponents The rigid body components
+ */
+void JointColoring::compute(MemoryManager& memoryManager, const Entity* jointEntities, uint32 nbJointEntities,
+                            JointComponents& jointComponents, RigidBodyComponents& rigidBodyComponents) {
+
+    nbJoints = nbJointEntities;
+    nbColors = 0;
+
+    if (nbJoints == 0) return;
+
+    jointComponentIndices = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+    rigidBodyComponentIndicesBody1 = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+    rigidBodyComponentIndicesBody2 = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+    sortedJoints = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+
+    // There are at most as many colors as joints
+    colorsEndIndex = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+    std::memset(colorsEndIndex, 0, sizeof(uint32) * nbJoints);
+
+    // Number of colors already used by the joints of each body
+    const uint32 nbRigidBodies = rigidBodyComponents.getNbComponents();
+    uint32* bodiesNbColors = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbRigidBodies));
+    std::memset(bodiesNbColors, 0, sizeof(uint32) * nbRigidBodies);
+
+    // Color of each joint
+    uint32* jointsColors = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+
+    // For each joint
+    for (uint32 i=0; i < nbJoints; i++) {
+
+        const uint32 jointIndex = jointComponents.getEntityIndex(jointEntities[i]);
+        const uint32 body1Index = rigidBodyComponents.getEntityIndex(jointComponents.mBody1Entities[jointIndex]);
+        const uint32 body2Index = rigidBodyComponents.getEntityIndex(jointComponents.mBody2Entities[jointIndex]);
+
+        jointComponentIndices[i] = jointIndex;
+        rigidBodyComponentIndicesBody1[i] = body1Index;
+        rigidBodyComponentIndicesBody2[i] = body2Index;
+
+        const uint32 color = std::max(bodiesNbColors[body1Index], bodiesNbColors[body2Index]);
+        bodiesNbColors[body1Index] = color + 1;
+        bodiesNbColors[body2Index] = color + 1;
+
+        jointsColors[i] = color;
+        colorsEndIndex[color]++;
+        nbColors = std::max(nbColors, color + 1);
+    }
+
+    // Compute the index of the first joint of each color
+    uint32* colorsStartIndex = static_cast<uint32*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbColors));
+    uint32 startIndex = 0;
+    for (uint32 color=0; color < nbColors; color++) {
+        colorsStartIndex[color] = startIndex;
+        startIndex += colorsEndIndex[color];
+        colorsEndIndex[color] = startIndex;
+    }
+
+    // Sort the joints by color (the joints of a color keep their order)
+    for (uint32 i=0; i < nbJoints; i++) {
+        sortedJoints[colorsStartIndex[jointsColors[i]]++] = i;
+    }
+
+    memoryManager.release(MemoryManager::AllocationType::Frame, colorsStartIndex, sizeof(uint32) * nbColors);
+    memoryManager.release(MemoryManager::AllocationType::Frame, jointsColors, sizeof(uint32) * nbJoints);
+    memoryManager.release(MemoryManager::AllocationType::Frame, bodiesNbColors, sizeof(uint32) * nbRigidBodies);
+}
+
+// Release the arrays allocated by the last call to compute()
+void JointColoring::release(MemoryManager& memoryManager) {
+
+    if (nbJoints > 0) {
+        memoryManager.release(MemoryManager::AllocationType::Frame, jointComponentIndices, sizeof(uint32) * nbJoints);
+        memoryManager.release(MemoryManager::AllocationType::Frame, rigidBodyComponentIndicesBody1, sizeof(uint32) * nbJoints);
+        memoryManager.release(MemoryManager::AllocationType::Frame, rigidBodyComponentIndicesBody2, sizeof(uint32) * nbJoints);
+        memoryManager.release(MemoryManager::AllocationType::Frame, sortedJoints, sizeof(uint32) * nbJoints);
+        memoryManager.release(MemoryManager::AllocationType::Frame, colorsEndIndex, sizeof(uint32) * nbJoints);
+    }
+
+    nbJoints = 0;
+    nbColors = 0;
+    sortedJoints = nullptr;
+    colorsEndIndex = nullptr;
+    jointComponentIndices = nullptr;
+    rigidBodyComponentIndicesBody1 = nullptr;
+    rigidBodyComponentIndicesBody2 = nullptr;
+}
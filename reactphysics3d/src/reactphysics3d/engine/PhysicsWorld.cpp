@@ -37,7 +37,9 @@
 #include <reactphysics3d/engine/EventListener.h>
 #include <reactphysics3d/engine/Island.h>
 #include <reactphysics3d/collision/ContactManifold.h>
+#include <reactphysics3d/collision/RaycastInfo.h>
 #include <reactphysics3d/containers/Stack.h>
+#include <reactphysics3d/containers/Set.h>
 
 // Namespaces
 using namespace reactphysics3d;
@@ -70,15 +72,19 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, PhysicsCommon& physicsC
                 mName(worldSettings.worldName),  mIslands(mMemoryManager.getSingleFrameAllocator()), mProcessContactPairsOrderIslands(mMemoryManager.getSingleFrameAllocator()),
                 mContactSolverSystem(mMemoryManager, *this, mIslands, mCollisionBodyComponents, mRigidBodyComponents,
                                mCollidersComponents, mConfig.restitutionVelocityThreshold),
-                mConstraintSolverSystem(*this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
+                mConstraintSolverSystem(mMemoryManager, *this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
                                         mBallAndSocketJointsComponents, mFixedJointsComponents, mHingeJointsComponents,
                                         mSliderJointsComponents),
                 mDynamicsSystem(*this, mCollisionBodyComponents, mRigidBodyComponents, mTransformComponents, mCollidersComponents, mIsGravityEnabled, mConfig.gravity),
                 mNbVelocitySolverIterations(mConfig.defaultVelocitySolverNbIterations),
                 mNbPositionSolverIterations(mConfig.defaultPositionSolverNbIterations), 
+                mNbSubsteps(std::max(mConfig.defaultNbSubsteps, uint16(1))),
                 mIsSleepingEnabled(mConfig.isSleepingEnabled), mRigidBodies(mMemoryManager.getPoolAllocator()),
                 mIsGravityEnabled(true), mSleepLinearVelocity(mConfig.defaultSleepLinearVelocity),
-                mSleepAngularVelocity(mConfig.defaultSleepAngularVelocity), mTimeBeforeSleep(mConfig.defaultTimeBeforeSleep) {
+                mSleepAngularVelocity(mConfig.defaultSleepAngularVelocity), mTimeBeforeSleep(mConfig.defaultTimeBeforeSleep),
+                mBrokenJoints(mMemoryManager.getHeapAllocator()), mSleepChanges(mMemoryManager.getHeapAllocator()),
+                mCharacterControllers(mMemoryManager.getHeapAllocator()),
+                mVehicles(mMemoryManager.getHeapAllocator()), mForceFields(mMemoryManager.getHeapAllocator()) {
 
     // Automatically generate a name for the world
     if (mName == "") {
@@ -107,6 +113,8 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, PhysicsCommon& physicsC
 
 #endif
 
+    mConstraintSolverSystem.setIsArticulationSolverActive(mConfig.isArticulationSolverEnabled);
+
     mNbWorlds++;
 
     RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
@@ -125,8 +133,29 @@ PhysicsWorld::~PhysicsWorld() {
     RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
              "Physics World: Physics world " + mName + " has been destroyed",  __FILE__, __LINE__);
 
+    // Destroy all the character controllers that have not been removed
+    uint32 i = static_cast<uint32>(mCharacterControllers.size());
+    while (i != 0) {
+        i--;
+        destroyCharacterController(mCharacterControllers[i]);
+    }
+
+    // Destroy all the raycast vehicles that have not been removed
+    i = static_cast<uint32>(mVehicles.size());
+    while (i != 0) {
+        i--;
+        destroyRaycastVehicle(mVehicles[i]);
+    }
+
+    // Destroy all the force fields that have not been removed
+    i = static_cast<uint32>(mForceFields.size());
+    while (i != 0) {
+        i--;
+        destroyForceField(mForceFields[i]);
+    }
+
     // Destroy all the collision bodies that have not been removed
-    uint32 i = static_cast<uint32>(mCollisionBodies.size());
+    i = static_cast<uint32>(mCollisionBodies.size());
     while (i != 0) {
         i--;
         destroyCollisionBody(mCollisionBodies[i]);
@@ -256,6 +285,25 @@ void PhysicsWorld::setBodyDisabled(Entity bodyEntity, bool isDisabled) {
 
         mCollidersComponents.setIsEntityDisabled(collidersEntities[i], isDisabled);
     }
+
+    // A joint is enabled only if both of its bodies are enabled. Updating the joints
+    // of the body here avoids a scan of all the joints of the world at each step
+    const Array<Entity>& jointsEntities = mRigidBodyComponents.getJoints(bodyEntity);
+    const uint32 nbJointsEntities = static_cast<uint32>(jointsEntities.size());
+    for (uint32 i=0; i < nbJointsEntities; i++) {
+
+        setJointDisabled(jointsEntities[i], isJointDisabled(jointsEntities[i]));
+    }
+}
+
+// Return true if a joint is broken or if one of its two bodies is disabled
+bool PhysicsWorld::isJointDisabled(Entity jointEntity) const {
+
+    const uint32 jointEntityIndex = mJointsComponents.getEntityIndex(jointEntity);
+
+    return mJointsComponents.mIsBroken[jointEntityIndex] ||
+           mCollisionBodyComponents.getIsEntityDisabled(mJointsComponents.mBody1Entities[jointEntityIndex]) ||
+           mCollisionBodyComponents.getIsEntityDisabled(mJointsComponents.mBody2Entities[jointEntityIndex]);
 }
 
 // Notify the world whether a joint is disabled or not
@@ -298,6 +346,12 @@ bool PhysicsWorld::testOverlap(CollisionBody* body1, CollisionBody* body2) {
  */
 AABB PhysicsWorld::getWorldAABB(const Collider* collider) const {
 
+    // The colliders of a compound body share the broad-phase proxy of the body. The AABB of
+    // each collider is computed from its shape and its local-to-world transform
+    if (mCollidersComponents.getCompoundId(collider->getEntity()) != -1) {
+        return collider->getWorldAABB();
+    }
+
     if (collider->getBroadPhaseId() == -1) {
         return AABB();
     }
@@ -324,6 +378,9 @@ void PhysicsWorld::update(decimal timeStep) {
         mDebugRenderer.reset();
     }
 
+    // Apply the forces of the vehicles before the sleeping bodies are woken up by the collision detection
+    updateVehicles(timeStep);
+
     // Compute the collision detection
     mCollisionDetection.computeCollisionDetection();
 
@@ -339,21 +396,59 @@ void PhysicsWorld::update(decimal timeStep) {
     // Recompute the inverse inertia tensors of rigid bodies
     updateBodiesInverseWorldInertiaTensors();
 
-    // Enable or disable the joints
-    enableDisableJoints();
+    // Add the forces of the force fields (integrated with the gravity)
+    applyForceFields(timeStep);
+
+    // With substeps, the contacts computed by the collision detection and the joints are
+    // initialized once and reused in each substep
+    const decimal substepTimeStep = timeStep / mNbSubsteps;
+
+    // For each substep
+    for (uint32 s=0; s < mNbSubsteps; s++) {
+
+        // The bodies have been rotated during the previous substep
+        if (s > 0) {
+            updateBodiesInverseWorldInertiaTensors();
+        }
+
+        // Integrate the velocities
+        mDynamicsSystem.integrateRigidBodiesVelocities(substepTimeStep);
+
+        // Solve the contacts and constraints
+        solveContactsAndConstraints(substepTimeStep, s);
+
+        // Integrate the position and orientation of each body
+        mDynamicsSystem.integrateRigidBodiesPositions(substepTimeStep, mContactSolverSystem.isSplitImpulseActive());
+
+        // With substeps, solve the velocities again without the penetration bias
+        if (mNbSubsteps > 1) {
+            relaxContactsAndConstraints();
+        }
+
+        // The contact solver is reset after the last substep
+        if (s + 1 == mNbSubsteps) {
 
-    // Integrate the velocities
-    mDynamicsSystem.integrateRigidBodiesVelocities(timeStep);
+            mContactSolverSystem.storeImpulses();
 
-    // Solve the contacts and constraints
-    solveContactsAndConstraints(timeStep);
+            // Reset the contact solver
+            mContactSolverSystem.reset();
+        }
 
-    // Integrate the position and orientation of each body
-    mDynamicsSystem.integrateRigidBodiesPositions(timeStep, mContactSolverSystem.isSplitImpulseActive());
+        // Update the state of the bodies for the next substep
+        if (s + 1 < mNbSubsteps) {
+            mDynamicsSystem.updateBodiesState();
+        }
+    }
 
     // Solve the position correction for constraints
     solvePositionCorrection();
 
+    // Release the memory allocated by the joints solver
+    mConstraintSolverSystem.reset();
+
+    // Disable the joints that have been broken by the forces applied during this step
+    breakJoints();
+
     // Update the state (positions and velocities) of the bodies
     mDynamicsSystem.updateBodiesState();
 
@@ -362,6 +457,19 @@ void PhysicsWorld::update(decimal timeStep) {
 
     if (mIsSleepingEnabled) updateSleepingBodies(timeStep);
 
+    // Report the joints broken during this step to the user
+    if (mBrokenJoints.size() > 0) {
+
+        if (mEventListener != nullptr) {
+            mEventListener->onJointBreak(mBrokenJoints);
+        }
+
+        mBrokenJoints.clear();
+    }
+
+    // Report the bodies that have fallen asleep or have been woken up to the user
+    reportSleepChanges();
+
     // Reset the external force and torque applied to the bodies
     mDynamicsSystem.resetBodiesForceAndTorque();
 
@@ -390,31 +498,52 @@ void PhysicsWorld::updateBodiesInverseWorldInertiaTensors() {
     }
 }
 
-// Solve the contacts and constraints
-void PhysicsWorld::solveContactsAndConstraints(decimal timeStep) {
+// Solve the contacts and constraints in a substep
+/// The contacts and the joints are initialized in the first substep. In the next substeps,
+/// the impulses of the previous substep are applied again (warm starting).
+void PhysicsWorld::solveContactsAndConstraints(decimal timeStep, uint32 substep) {
 
     RP3D_PROFILE("PhysicsWorld::solveContactsAndConstraints()", mProfiler);
 
     // ---------- Solve velocity constraints for joints and contacts ---------- //
 
-    // Initialize the contact solver
-    mContactSolverSystem.init(mCollisionDetection.mCurrentContactManifolds, mCollisionDetection.mCurrentContactPoints, timeStep);
+    if (substep == 0) {
+
+        // Initialize the contact solver
+        mContactSolverSystem.init(mCollisionDetection.mCurrentContactManifolds, mCollisionDetection.mCurrentContactPoints, timeStep);
 
-    // Initialize the constraint solver
-    mConstraintSolverSystem.initialize(timeStep);
+        // Initialize the constraint solver
+        mConstraintSolverSystem.initialize(timeStep);
+    }
+    else {
+
+        // Update the contacts and warm start the solvers
+        mContactSolverSystem.initializeSubstep();
+        mConstraintSolverSystem.warmStart();
+    }
+
+    // With substeps, each substep solves a single iteration (followed by a relax iteration)
+    const uint32 nbIterations = mNbSubsteps > 1 ? 1 : mNbVelocitySolverIterations;
 
     // For each iteration of the velocity solver
-    for (uint32 i=0; i<mNbVelocitySolverIterations; i++) {
+    for (uint32 i=0; i<nbIterations; i++) {
 
         mConstraintSolverSystem.solveVelocityConstraints();
 
         mContactSolverSystem.solve();
     }
+}
+
+// Solve the velocities of the contacts and constraints again after the positions of a substep are integrated
+/// The penetration of the contacts is not corrected in this iteration. It removes the velocity added by the
+/// penetration bias so that it is not carried to the next substep or to the velocities of the bodies.
+void PhysicsWorld::relaxContactsAndConstraints() {
 
-    mContactSolverSystem.storeImpulses();
+    RP3D_PROFILE("PhysicsWorld::relaxContactsAndConstraints()", mProfiler);
 
-    // Reset the contact solver
-    mContactSolverSystem.reset();
+    mConstraintSolverSystem.solveVelocityConstraints();
+
+    mContactSolverSystem.solve(false);
 }
 
 // Solve the position error correction of the constraints
@@ -432,7 +561,127 @@ void PhysicsWorld::solvePositionCorrection() {
     }
 }
 
-// Enable or disable the joints
+// Apply the suspension and tire forces of the raycast vehicles
+/// The forces are applied once per update and are used by all the substeps
+void PhysicsWorld::updateVehicles(decimal timeStep) {
+
+    RP3D_PROFILE("PhysicsWorld::updateVehicles()", mProfiler);
+
+    for (uint32 i=0; i < mVehicles.size(); i++) {
+        mVehicles[i]->update(timeStep);
+    }
+}
+
+// Add the forces of the force fields to the external forces of the bodies
+/// The forces are added once per update and are used by all the substeps
+void PhysicsWorld::applyForceFields(decimal timeStep) {
+
+    RP3D_PROFILE("PhysicsWorld::applyForceFields()", mProfiler);
+
+    for (uint32 i=0; i < mForceFields.size(); i++) {
+        mForceFields[i]->applyForces(timeStep);
+    }
+}
+
+// Remove a collider that is destroyed from the volumes of the force fields
+/// The force fields of the collider are disabled until a new volume is set
+void PhysicsWorld::removeColliderFromForceFields(const Collider* collider) {
+
+    for (uint32 i=0; i < mForceFields.size(); i++) {
+        if (mForceFields[i]->mCollider == collider) {
+            mForceFields[i]->mCollider = nullptr;
+        }
+    }
+}
+
+// Remove a collider that is destroyed from the ground of the character controllers
+/// A character standing on the collider is not on the ground anymore until its next move
+void PhysicsWorld::removeColliderFromCharacterControllers(const Collider* collider) {
+
+    for (uint32 i=0; i < mCharacterControllers.size(); i++) {
+        if (mCharacterControllers[i]->mGroundCollider == collider) {
+            mCharacterControllers[i]->resetGround();
+        }
+    }
+}
+
+// Remove a collider that is destroyed from the ground of the wheels of the vehicles
+void PhysicsWorld::removeColliderFromVehicles(const Collider* collider) {
+
+    for (uint32 i=0; i < mVehicles.size(); i++) {
+        mVehicles[i]->removeGroundCollider(collider);
+    }
+}
+
+// Disable the joints whose force or torque exceeds their break threshold
+/// A broken joint stays disabled (even if its bodies are woken up) until it is destroyed
+void PhysicsWorld::breakJoints() {
+
+    Array<Entity> brokenJoints(mMemoryManager.getHeapAllocator(), 0);
+    mConstraintSolverSystem.findBrokenJoints(brokenJoints);
+
+    const uint32 nbBrokenJoints = static_cast<uint32>(brokenJoints.size());
+    for (uint32 i=0; i < nbBrokenJoints; i++) {
+
+        mJointsComponents.setIsBroken(brokenJoints[i], true);
+        setJointDisabled(brokenJoints[i], true);
+
+        mBrokenJoints.add(mJointsComponents.getJoint(brokenJoints[i]));
+
+        RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::Joint,
+                 "Joint " + std::to_string(brokenJoints[i].id) + ": joint broken",  __FILE__, __LINE__);
+    }
+}
+
+// Report the bodies whose sleeping state has changed since the previous step to the event listener
+/// The changes made between two steps (by the user or by the simulation) are reported together.
+/// A body that has fallen asleep and has been woken up again (or the opposite) is not reported.
+void PhysicsWorld::reportSleepChanges() {
+
+    if (mSleepChanges.size() == 0) return;
+
+    if (mEventListener != nullptr) {
+
+        Array<RigidBody*> sleepingBodies(mMemoryManager.getHeapAllocator());
+        Array<RigidBody*> awakeBodies(mMemoryManager.getHeapAllocator());
+        Set<Entity> reportedBodies(mMemoryManager.getHeapAllocator());
+
+        const uint32 nbSleepChanges = static_cast<uint32>(mSleepChanges.size());
+        for (uint32 i=0; i < nbSleepChanges; i++) {
+
+            const Entity bodyEntity = mSleepChanges[i].first;
+
+            // The body might have been destroyed after its state has changed
+            if (!mRigidBodyComponents.hasComponent(bodyEntity)) continue;
+
+            // The first change of the body gives its state at the previous step
+            if (reportedBodies.contains(bodyEntity)) continue;
+            reportedBodies.add(bodyEntity);
+
+            const bool wasSleeping = !mSleepChanges[i].second;
+            const bool isSleeping = mRigidBodyComponents.getIsSleeping(bodyEntity);
+            if (isSleeping == wasSleeping) continue;
+
+            RigidBody* body = mRigidBodyComponents.getRigidBody(bodyEntity);
+            if (isSleeping) {
+                sleepingBodies.add(body);
+            }
+            else {
+                awakeBodies.add(body);
+            }
+        }
+
+        if (sleepingBodies.size() > 0 || awakeBodies.size() > 0) {
+            mEventListener->onSleepChange(sleepingBodies, awakeBodies);
+        }
+    }
+
+    mSleepChanges.clear();
+}
+
+// Enable or disable all the joints of the world
+/// The joints are already enabled or disabled when the state of their bodies changes.
+/// This method recomputes the state of every joint from scratch.
 void PhysicsWorld::enableDisableJoints() {
 
     const uint32 nbJointComponents = mJointsComponents.getNbComponents();
@@ -447,22 +696,7 @@ void PhysicsWorld::enableDisableJoints() {
     // For each joint
     for (uint32 i = 0; i < nbJointComponents; i++) {
 
-        uint32 jointEntityIndex = mJointsComponents.getEntityIndex(jointsEntites[i]);
-
-        Entity body1 = mJointsComponents.mBody1Entities[jointEntityIndex];
-        Entity body2 = mJointsComponents.mBody2Entities[jointEntityIndex];
-
-        // If both bodies of the joint are disabled
-        if (mCollisionBodyComponents.getIsEntityDisabled(body1) || mCollisionBodyComponents.getIsEntityDisabled(body2)) {
-
-            // Disable the joint
-            setJointDisabled(jointsEntites[i], true);
-        }
-        else {
-
-            // Enable the joint
-            setJointDisabled(jointsEntites[i], false);
-        }
+        setJointDisabled(jointsEntites[i], isJointDisabled(jointsEntites[i]));
     }
 }
 
@@ -523,6 +757,15 @@ void PhysicsWorld::destroyRigidBody(RigidBody* rigidBody) {
     RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
              "Body " + std::to_string(rigidBody->getEntity().id) + ": rigid body destroyed",  __FILE__, __LINE__);
 
+    // Destroy the vehicles of the body
+    uint32 i = static_cast<uint32>(mVehicles.size());
+    while (i != 0) {
+        i--;
+        if (mVehicles[i]->getBody() == rigidBody) {
+            destroyRaycastVehicle(mVehicles[i]);
+        }
+    }
+
     // Remove all the collision shapes of the body
     rigidBody->removeAllColliders();
 
@@ -548,6 +791,320 @@ void PhysicsWorld::destroyRigidBody(RigidBody* rigidBody) {
     mMemoryManager.release(MemoryManager::AllocationType::Pool, rigidBody, sizeof(RigidBody));
 }
 
+// Create a kinematic character controller with a convex shape
+/// A kinematic rigid body with a single collider is created for the character.
+/// The body is destroyed with the character controller.
+/**
+ * @param shape Convex shape of the character (usually a capsule)
+ * @param transform Initial transform of the character
+ * @param settings Settings of the character controller
+ * @return A pointer to the character controller that has been created in the world
+ */
+CharacterController* PhysicsWorld::createCharacterController(ConvexShape* shape, const Transform& transform,
+                                                       const CharacterControllerSettings& settings) {
+
+    assert(settings.up.lengthSquare() > MACHINE_EPSILON);
+    assert(settings.skinWidth > decimal(0.0));
+
+    RigidBody* body = createRigidBody(transform);
+    body->setType(BodyType::KINEMATIC);
+    Collider* collider = body->addCollider(shape, Transform::identity());
+
+    CharacterController* controller = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool,
+                                           sizeof(CharacterController)))
+                                           CharacterController(*this, body, collider, settings);
+    mCharacterControllers.add(controller);
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
+             "Body " + std::to_string(body->getEntity().id) + ": New character controller created",  __FILE__, __LINE__);
+
+    return controller;
+}
+
+// Destroy a character controller and its body
+/**
+ * @param controller Pointer to the character controller you want to destroy
+ */
+void PhysicsWorld::destroyCharacterController(CharacterController* controller) {
+
+    RigidBody* body = controller->getBody();
+
+    // Call the destructor of the character controller
+    controller->~CharacterController();
+
+    mCharacterControllers.remove(controller);
+
+    // Free the object from the memory allocator
+    mMemoryManager.release(MemoryManager::AllocationType::Pool, controller, sizeof(CharacterController));
+
+    destroyRigidBody(body);
+}
+
+// Create a raycast vehicle with a dynamic chassis body
+/// The wheels are added with RaycastVehicle::addWheel(). The vehicle is destroyed with its chassis body.
+/**
+ * @param chassisBody Dynamic rigid body of the chassis
+ * @param settings Settings of the vehicle
+ * @return A pointer to the raycast vehicle that has been created in the world
+ */
+RaycastVehicle* PhysicsWorld::createRaycastVehicle(RigidBody* chassisBody, const RaycastVehicleSettings& settings) {
+
+    assert(&chassisBody->getWorld() == this);
+    assert(settings.forward.lengthSquare() > MACHINE_EPSILON);
+    assert(settings.up.lengthSquare() > MACHINE_EPSILON);
+
+    RaycastVehicle* vehicle = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool,
+                                   sizeof(RaycastVehicle)))
+                                   RaycastVehicle(*this, chassisBody, settings, mMemoryManager.getHeapAllocator());
+    mVehicles.add(vehicle);
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
+             "Body " + std::to_string(chassisBody->getEntity().id) + ": New raycast vehicle created",  __FILE__, __LINE__);
+
+    return vehicle;
+}
+
+// Destroy a raycast vehicle (the chassis body is not destroyed)
+/**
+ * @param vehicle Pointer to the raycast vehicle you want to destroy
+ */
+void PhysicsWorld::destroyRaycastVehicle(RaycastVehicle* vehicle) {
+
+    // Call the destructor of the raycast vehicle
+    vehicle->~RaycastVehicle();
+
+    mVehicles.remove(vehicle);
+
+    // Free the object from the memory allocator
+    mMemoryManager.release(MemoryManager::AllocationType::Pool, vehicle, sizeof(RaycastVehicle));
+}
+
+// Create a force field whose volume is a collider
+/// The forces are applied to the dynamic bodies (other than the body of the volume) that are
+/// inside the collider. The volume is usually a trigger collider of a static body. If the
+/// collider is removed, the field does nothing until a new volume is set with ForceField::setAABB().
+/**
+ * @param volume Collider of the volume of the field
+ * @param settings Settings of the force field
+ * @return A pointer to the force field that has been created in the world
+ */
+ForceField* PhysicsWorld::createForceField(Collider* volume, const ForceFieldSettings& settings) {
+
+    assert(volume != nullptr);
+    assert(&volume->getBody()->getWorld() == this);
+    assert(settings.direction.lengthSquare() > MACHINE_EPSILON);
+
+    ForceField* field = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ForceField)))
+                            ForceField(*this, volume, AABB(), settings);
+    mForceFields.add(field);
+
+    return field;
+}
+
+// Create a force field whose volume is a world-space AABB
+/**
+ * @param volume World-space AABB of the volume of the field
+ * @param settings Settings of the force field
+ * @return A pointer to the force field that has been created in the world
+ */
+ForceField* PhysicsWorld::createForceField(const AABB& volume, const ForceFieldSettings& settings) {
+
+    assert(settings.direction.lengthSquare() > MACHINE_EPSILON);
+
+    ForceField* field = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ForceField)))
+                            ForceField(*this, nullptr, volume, settings);
+    mForceFields.add(field);
+
+    return field;
+}
+
+// Destroy a force field (the collider of the volume is not destroyed)
+/**
+ * @param field Pointer to the force field you want to destroy
+ */
+void PhysicsWorld::destroyForceField(ForceField* field) {
+
+    // Call the destructor of the force field
+    field->~ForceField();
+
+    mForceFields.remove(field);
+
+    // Free the object from the memory allocator
+    mMemoryManager.release(MemoryManager::AllocationType::Pool, field, sizeof(ForceField));
+}
+
+// Raycast callback that tells if a collider of another body blocks a radial impulse
+class RadialImpulseOcclusionCallback : public RaycastCallback {
+
+    public:
+
+        /// Body that receives the impulse
+        const CollisionBody* targetBody;
+
+        /// True if a collider of another body is hit
+        bool isOccluded = false;
+
+        RadialImpulseOcclusionCallback(const CollisionBody* body) : targetBody(body) {
+
+        }
+
+        virtual decimal notifyRaycastHit(const RaycastInfo& raycastInfo) override {
+
+            if (raycastInfo.body == targetBody || raycastInfo.collider->getIsTrigger()) {
+                return decimal(-1.0);
+            }
+
+            // Stop the raycast at the first blocking hit
+            isOccluded = true;
+            return decimal(0.0);
+        }
+};
+
+// Apply an impulse away from a center to the dynamic bodies in a radius (explosion)
+/// The impulse is applied at the center of mass of each dynamic body that has a collider whose AABB
+/// is in the radius. The distance used for the falloff is the distance between the center and the
+/// closest collider AABB of the body. If the occlusion is enabled, a body is not affected if a ray
+/// from the center to its center of mass hits a collider of another body (triggers are ignored).
+/// The velocities of the bodies are changed directly and the sleeping bodies are woken up.
+/**
+ * @param center World-space center of the impulse
+ * @param radius Radius of the impulse
+ * @param impulse Impulse (in Newtons * seconds) applied to a body at the center
+ * @param falloff Decrease of the impulse with the distance to the center
+ * @param collideWithMaskBits Bits mask corresponding to the category of colliders that are affected
+ * @param isOcclusionEnabled True if the bodies behind other bodies are not affected
+ * @return The number of bodies that have received an impulse
+ */
+uint32 PhysicsWorld::applyRadialImpulse(const Vector3& center, decimal radius, decimal impulse,
+                                        RadialImpulseFalloff falloff, unsigned short collideWithMaskBits,
+                                        bool isOcclusionEnabled) {
+
+    RP3D_PROFILE("PhysicsWorld::applyRadialImpulse()", mProfiler);
+
+    assert(radius > decimal(0.0));
+
+    MemoryAllocator& allocator = mMemoryManager.getHeapAllocator();
+    const Vector3 extent(radius, radius, radius);
+    Array<Entity> colliders(allocator, 32);
+    mCollisionDetection.computeQueryColliders(AABB(center - extent, center + extent), collideWithMaskBits, false, colliders);
+
+    // Distance between the center and the closest collider AABB of each dynamic body
+    Map<Entity, decimal> bodiesDistances(allocator);
+    const uint32 nbColliders = static_cast<uint32>(colliders.size());
+    for (uint32 i=0; i < nbColliders; i++) {
+
+        const Entity bodyEntity = mCollidersComponents.getBody(colliders[i]);
+        if (!mRigidBodyComponents.hasComponent(bodyEntity) ||
+            mRigidBodyComponents.getBodyType(bodyEntity) != BodyType::DYNAMIC) {
+            continue;
+        }
+
+        AABB colliderAABB;
+        mCollidersComponents.getCollisionShape(colliders[i])->computeAABB(colliderAABB, mCollidersComponents.getLocalToWorldTransform(colliders[i]));
+        const Vector3& min = colliderAABB.getMin();
+        const Vector3& max = colliderAABB.getMax();
+        const Vector3 closestPoint(clamp(center.x, min.x, max.x), clamp(center.y, min.y, max.y), clamp(center.z, min.z, max.z));
+        const decimal distance = (closestPoint - center).length();
+        if (distance > radius) continue;
+
+        auto it = bodiesDistances.find(bodyEntity);
+        if (it == bodiesDistances.end()) {
+            bodiesDistances.add(Pair<Entity, decimal>(bodyEntity, distance));
+        }
+        else if (distance < it->second) {
+            it->second = distance;
+        }
+    }
+
+    uint32 nbAffectedBodies = 0;
+    for (auto it = bodiesDistances.begin(); it != bodiesDistances.end(); ++it) {
+
+        const Entity bodyEntity = it->first;
+        RigidBody* body = mRigidBodyComponents.getRigidBody(bodyEntity);
+        const Vector3& centerOfMass = mRigidBodyComponents.getCenterOfMassWorld(bodyEntity);
+
+        if (isOcclusionEnabled && (centerOfMass - center).lengthSquare() > MACHINE_EPSILON) {
+            RadialImpulseOcclusionCallback callback(body);
+            raycast(Ray(center, centerOfMass), &callback);
+            if (callback.isOccluded) continue;
+        }
+
+        decimal factor = decimal(1.0);
+        const decimal ratio = it->second / radius;
+        if (falloff == RadialImpulseFalloff::LINEAR) {
+            factor = decimal(1.0) - ratio;
+        }
+        else if (falloff == RadialImpulseFalloff::QUADRATIC) {
+            factor = (decimal(1.0) - ratio) * (decimal(1.0) - ratio);
+        }
+
+        // A body at the center is pushed up
+        Vector3 direction = centerOfMass - center;
+        const decimal length = direction.length();
+        direction = length > MACHINE_EPSILON ? direction / length : Vector3(0, 1, 0);
+
+        const Vector3 deltaVelocity = direction * (impulse * factor * mRigidBodyComponents.getMassInverse(bodyEntity));
+        body->setIsSleeping(false);
+        mRigidBodyComponents.setLinearVelocity(bodyEntity, mRigidBodyComponents.getLinearVelocity(bodyEntity) +
+                                              deltaVelocity * mRigidBodyComponents.getLinearLockAxisFactor(bodyEntity));
+
+        nbAffectedBodies++;
+    }
+
+    return nbAffectedBodies;
+}
+
+// Create a copy of a body with a new transform
+/// The colliders (shapes, local transforms, materials, collision filtering and
+/// trigger flag) and the settings of the body are copied. The mass properties of a
+/// rigid body are copied as they are, so they are not computed again from the colliders.
+/// The velocities, forces and user data of the body are not copied.
+/**
+ * @param body The body to copy
+ * @param transform The transform (position and orientation) of the new body in world-space
+ * @return A pointer to the new body (a RigidBody if the body to copy is a RigidBody)
+ */
+CollisionBody* PhysicsWorld::cloneBody(CollisionBody* body, const Transform& transform) {
+
+    CollisionBody* clone;
+    if (body->isRigidBody()) {
+        RigidBody* rigidBody = static_cast<RigidBody*>(body);
+        RigidBody* rigidClone = createRigidBody(transform);
+        rigidClone->setType(rigidBody->getType());
+        rigidClone->setMass(rigidBody->getMass());
+        rigidClone->setLocalInertiaTensor(rigidBody->getLocalInertiaTensor());
+        rigidClone->setLocalCenterOfMass(rigidBody->getLocalCenterOfMass());
+        rigidClone->setLinearDamping(rigidBody->getLinearDamping());
+        rigidClone->setAngularDamping(rigidBody->getAngularDamping());
+        rigidClone->setLinearLockAxisFactor(rigidBody->getLinearLockAxisFactor());
+        rigidClone->setAngularLockAxisFactor(rigidBody->getAngularLockAxisFactor());
+        rigidClone->enableGravity(rigidBody->isGravityEnabled());
+        rigidClone->setIsAllowedToSleep(rigidBody->isAllowedToSleep());
+        clone = rigidClone;
+    }
+    else {
+        clone = createCollisionBody(transform);
+    }
+
+    clone->setIsCompound(body->isCompound());
+
+    const uint32 nbColliders = body->getNbColliders();
+    for (uint32 i = 0; i < nbColliders; i++) {
+        Collider* collider = body->getCollider(i);
+        Collider* colliderClone = clone->addCollider(collider->getCollisionShape(), collider->getLocalToBodyTransform());
+        colliderClone->setMaterial(collider->getMaterial());
+        colliderClone->setCollisionCategoryBits(collider->getCollisionCategoryBits());
+        colliderClone->setCollideWithMaskBits(collider->getCollideWithMaskBits());
+        colliderClone->setIsTrigger(collider->getIsTrigger());
+    }
+
+    if (!body->isActive()) {
+        clone->setIsActive(false);
+    }
+
+    return clone;
+}
+
 // Create a joint between two bodies in the world and return a pointer to the new joint
 /**
  * @param jointInfo The information that is necessary to create the joint
@@ -560,8 +1117,10 @@ Joint* PhysicsWorld::createJoint(const JointInfo& jointInfo) {
 
     Joint* newJoint = nullptr;
 
-    const bool isJointDisabled = mRigidBodyComponents.getIsEntityDisabled(jointInfo.body1->getEntity()) &&
-                                 mRigidBodyComponents.getIsEntityDisabled(jointInfo.body2->getEntity());
+    // The joint is disabled if one of its bodies is disabled (the joint state is then
+    // updated when one of its bodies is enabled or disabled)
+    const bool isDisabled = mRigidBodyComponents.getIsEntityDisabled(jointInfo.body1->getEntity()) ||
+                            mRigidBodyComponents.getIsEntityDisabled(jointInfo.body2->getEntity());
 
     // Allocate memory to create the new joint
     switch(jointInfo.type) {
@@ -571,7 +1130,7 @@ Joint* PhysicsWorld::createJoint(const JointInfo& jointInfo) {
         {
             // Create a BallAndSocketJoint component
             BallAndSocketJointComponents::BallAndSocketJointComponent ballAndSocketJointComponent(false, PI_RP3D);
-            mBallAndSocketJointsComponents.addComponent(entity, isJointDisabled, ballAndSocketJointComponent);
+            mBallAndSocketJointsComponents.addComponent(entity, isDisabled, ballAndSocketJointComponent);
 
             void* allocatedMemory = mMemoryManager.allocate(MemoryManager::AllocationType::Pool,
                                                             sizeof(BallAndSocketJoint));
@@ -592,7 +1151,7 @@ Joint* PhysicsWorld::createJoint(const JointInfo& jointInfo) {
             SliderJointComponents::SliderJointComponent sliderJointComponent(info.isLimitEnabled, info.isMotorEnabled,
                                                                              info.minTranslationLimit, info.maxTranslationLimit,
                                                                              info.motorSpeed, info.maxMotorForce);
-            mSliderJointsComponents.addComponent(entity, isJointDisabled, sliderJointComponent);
+            mSliderJointsComponents.addComponent(entity, isDisabled, sliderJointComponent);
 
             void* allocatedMemory = mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(SliderJoint));
             SliderJoint* joint = new (allocatedMemory) SliderJoint(entity, *this, info);
@@ -612,7 +1171,7 @@ Joint* PhysicsWorld::createJoint(const JointInfo& jointInfo) {
             HingeJointComponents::HingeJointComponent hingeJointComponent(info.isLimitEnabled, info.isMotorEnabled,
                                                                           info.minAngleLimit, info.maxAngleLimit,
                                                                           info.motorSpeed, info.maxMotorTorque);
-            mHingeJointsComponents.addComponent(entity, isJointDisabled, hingeJointComponent);
+            mHingeJointsComponents.addComponent(entity, isDisabled, hingeJointComponent);
 
             void* allocatedMemory = mMemoryManager.allocate(MemoryManager::AllocationType::Pool,
                                                             sizeof(HingeJoint));
@@ -628,7 +1187,7 @@ Joint* PhysicsWorld::createJoint(const JointInfo& jointInfo) {
         {
             // Create a BallAndSocketJoint component
             FixedJointComponents::FixedJointComponent fixedJointComponent;
-            mFixedJointsComponents.addComponent(entity, isJointDisabled, fixedJointComponent);
+            mFixedJointsComponents.addComponent(entity, isDisabled, fixedJointComponent);
 
             void* allocatedMemory = mMemoryManager.allocate(MemoryManager::AllocationType::Pool,
                                                             sizeof(FixedJoint));
@@ -650,8 +1209,9 @@ Joint* PhysicsWorld::createJoint(const JointInfo& jointInfo) {
     }
 
     JointComponents::JointComponent jointComponent(jointInfo.body1->getEntity(), jointInfo.body2->getEntity(), newJoint, jointInfo.type,
-                                                   jointInfo.positionCorrectionTechnique, jointInfo.isCollisionEnabled);
-    mJointsComponents.addComponent(entity, isJointDisabled, jointComponent);
+                                                   jointInfo.positionCorrectionTechnique, jointInfo.isCollisionEnabled,
+                                                   jointInfo.breakForce, jointInfo.breakTorque);
+    mJointsComponents.addComponent(entity, isDisabled, jointComponent);
 
     // If the collision between the two bodies of the constraint is disabled
     if (!jointInfo.isCollisionEnabled) {
@@ -728,6 +1288,23 @@ void PhysicsWorld::destroyJoint(Joint* joint) {
     mMemoryManager.release(MemoryManager::AllocationType::Pool, joint, nbBytes);
 }
 
+// Return the joint with a given entity id
+/**
+ * @param jointEntityId Id of the entity of the joint (see Joint::getEntity())
+ * @return A pointer to the joint or nullptr if there is no joint with this id in the world
+ */
+Joint* PhysicsWorld::getJoint(uint32 jointEntityId) {
+
+    Entity jointEntity(0, 0);
+    jointEntity.id = jointEntityId;
+
+    if (!mJointsComponents.hasComponent(jointEntity)) {
+        return nullptr;
+    }
+
+    return mJointsComponents.getJoint(jointEntity);
+}
+
 
 // Set the number of iterations for the velocity constraint solver
 /**
@@ -888,6 +1465,9 @@ void PhysicsWorld::createIslands() {
                 // Check if the current joint has already been added into an island
                 if (mJointsComponents.mIsAlreadyInIsland[jointComponentIndex]) continue;
 
+                // A broken joint does not connect its two bodies anymore
+                if (mJointsComponents.mIsBroken[jointComponentIndex]) continue;
+
                 // Add the joint into the island
                 mJointsComponents.mIsAlreadyInIsland[jointComponentIndex] = true;
 
@@ -918,9 +1498,9 @@ void PhysicsWorld::createIslands() {
         staticBodiesAddedToIsland.clear();
     }
 
-    // Clear the associated contacts pairs of rigid bodies
-    const uint32 nbRigidBodyEnabledComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 b=0; b < nbRigidBodyEnabledComponents; b++) {
+    // Clear the associated contacts pairs of rigid bodies (a sleeping body that is only in contact
+    // with triggers is not woken up above but its contact pair indices are not valid at the next frame)
+    for (uint32 b=0; b < nbRigidBodyComponents; b++) {
         mRigidBodyComponents.mContactPairs[b].clear();
     }
 }
@@ -1022,6 +1602,42 @@ void PhysicsWorld::setNbIterationsPositionSolver(uint32 nbIterations) {
              "Physics World: Set nb iterations position solver to " + std::to_string(nbIterations),  __FILE__, __LINE__);
 }
 
+// Set the number of substeps of a simulation step
+/// The collision detection, the contacts and the joints are computed once per step. Each
+/// substep integrates the velocities, solves them with a single iteration, integrates the
+/// positions and solves the velocities again without the penetration bias (relax). The
+/// number of iterations of the velocity solver is only used without substeps. The position
+/// correction of the joints is done once at the end of the step.
+/**
+ * @param nbSubsteps Number of substeps (at least one)
+ */
+void PhysicsWorld::setNbSubsteps(uint16 nbSubsteps) {
+
+    assert(nbSubsteps > 0);
+
+    mNbSubsteps = std::max(nbSubsteps, uint16(1));
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set nb substeps to " + std::to_string(nbSubsteps),  __FILE__, __LINE__);
+}
+
+// Enable/Disable the articulation solver for the joints connected in a tree
+/// The ball-and-socket and hinge joints that connect dynamic bodies without any loop (and
+/// with at most one joint attached to a static or kinematic body) are solved exactly with a
+/// linear-time direct solver. Long chains and ragdolls do not stretch anymore, even with few
+/// velocity iterations. The other joints, the limits and the motors are still solved by the
+/// iterative solver.
+/**
+ * @param isEnabled True if the articulation solver must be used
+ */
+void PhysicsWorld::setIsArticulationSolverEnabled(bool isEnabled) {
+
+    mConstraintSolverSystem.setIsArticulationSolverActive(isEnabled);
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set articulation solver enabled to " + (isEnabled ? std::string("true") : std::string("false")),  __FILE__, __LINE__);
+}
+
 // Set the gravity vector of the world
 /**
  * @param gravity The gravity vector (in meter per seconds squared)
@@ -0,0 +1,345 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/RaycastVehicle.h>
+#include <reactphysics3d/engine/PhysicsWorld.h>
+#include <reactphysics3d/body/RigidBody.h>
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/collision/RaycastInfo.h>
+
+using namespace reactphysics3d;
+
+// Minimal cosine between the contact normal and the suspension used to compute the suspension force
+static constexpr decimal MIN_SUSPENSION_COSINE = decimal(0.1);
+
+// Damping of the rotation of a wheel that does not touch the ground
+static constexpr decimal WHEEL_ROTATION_DAMPING = decimal(0.99);
+
+// Raycast callback that returns the closest hit ignoring the chassis and the triggers
+class WheelRaycastCallback : public RaycastCallback {
+
+    public:
+
+        /// Body of the chassis
+        const CollisionBody* chassisBody;
+
+        /// True if a collider is hit
+        bool isHit = false;
+
+        /// Hit point (world-space)
+        Vector3 point;
+
+        /// Hit normal (world-space)
+        Vector3 normal;
+
+        /// Hit fraction of the ray
+        decimal hitFraction = decimal(1.0);
+
+        /// Hit collider
+        Collider* collider = nullptr;
+
+        WheelRaycastCallback(const CollisionBody* body) : chassisBody(body) {
+
+        }
+
+        virtual decimal notifyRaycastHit(const RaycastInfo& raycastInfo) override {
+
+            if (raycastInfo.body == chassisBody || raycastInfo.collider->getIsTrigger()) {
+                return decimal(-1.0);
+            }
+
+            isHit = true;
+            point = raycastInfo.worldPoint;
+            normal = raycastInfo.worldNormal;
+            hitFraction = raycastInfo.hitFraction;
+            collider = raycastInfo.collider;
+
+            // Clip the ray to the hit so that only the closer hits are reported
+            return raycastInfo.hitFraction;
+        }
+};
+
+// Constructor of a wheel
+RaycastVehicle::Wheel::Wheel(const WheelSettings& wheelSettings)
+               : settings(wheelSettings), steering(0), engineForce(0), brake(0), rotation(0), deltaRotation(0),
+                 suspensionLength(wheelSettings.suspensionRestLength), isInContact(false), contactPoint(0, 0, 0),
+                 contactNormal(0, 0, 0), groundCollider(nullptr), suspensionForce(0), skidInfo(1) {
+
+}
+
+// Constructor
+RaycastVehicle::RaycastVehicle(PhysicsWorld& world, RigidBody* body, const RaycastVehicleSettings& settings,
+                               MemoryAllocator& allocator)
+               : mWorld(world), mBody(body), mForward(settings.forward.getUnit()), mUp(settings.up.getUnit()),
+                 mRight(mForward.cross(mUp).getUnit()), mCollideWithMaskBits(settings.collideWithMaskBits),
+                 mWheels(allocator), mCurrentSpeed(0) {
+
+}
+
+// Add a wheel to the vehicle and return its index
+/**
+ * @param settings Settings of the wheel
+ * @return Index of the wheel
+ */
+uint32 RaycastVehicle::addWheel(const WheelSettings& settings) {
+
+    assert(settings.radius > decimal(0.0));
+    assert(settings.suspensionRestLength >= decimal(0.0));
+    assert(settings.maxSuspensionTravel >= decimal(0.0));
+
+    mWheels.add(Wheel(settings));
+
+    return static_cast<uint32>(mWheels.size() - 1);
+}
+
+// Return the world-space transform of a wheel (center and orientation)
+/// The wheel is rotated by its steering angle around the up direction of the vehicle and
+/// by its rotation angle around its axle.
+Transform RaycastVehicle::getWheelTransform(uint32 wheelIndex) const {
+
+    assert(wheelIndex < mWheels.size());
+
+    const Wheel& wheel = mWheels[wheelIndex];
+    const Transform& chassisTransform = mBody->getTransform();
+    const Vector3 center = chassisTransform * (wheel.settings.connectionPoint - mUp * wheel.suspensionLength);
+
+    const decimal halfSteering = wheel.steering * decimal(0.5);
+    const decimal halfRotation = -wheel.rotation * decimal(0.5);
+    const Quaternion steeringRotation(mUp * std::sin(halfSteering), std::cos(halfSteering));
+    const Quaternion axleRotation(mRight * std::sin(halfRotation), std::cos(halfRotation));
+
+    return Transform(center, chassisTransform.getOrientation() * steeringRotation * axleRotation);
+}
+
+// Cast the suspension ray of a wheel and update its contact
+/// The ray starts at the top of the suspension and its length is the rest length of the
+/// suspension plus the radius of the wheel.
+void RaycastVehicle::castWheel(Wheel& wheel, const Transform& chassisTransform, const Vector3& up) {
+
+    const WheelSettings& settings = wheel.settings;
+    const Vector3 start = chassisTransform * settings.connectionPoint;
+    const decimal rayLength = settings.suspensionRestLength + settings.radius;
+
+    WheelRaycastCallback callback(mBody);
+    mWorld.raycast(Ray(start, start - up * rayLength), &callback, mCollideWithMaskBits);
+
+    wheel.isInContact = callback.isHit;
+    if (!callback.isHit) {
+        wheel.suspensionLength = settings.suspensionRestLength;
+        wheel.contactPoint = start - up * rayLength;
+        wheel.contactNormal = up;
+        wheel.groundCollider = nullptr;
+        return;
+    }
+
+    const decimal minSuspensionLength = settings.suspensionRestLength - settings.maxSuspensionTravel;
+    wheel.suspensionLength = std::max(callback.hitFraction * rayLength - settings.radius, minSuspensionLength);
+    wheel.contactPoint = callback.point;
+    wheel.contactNormal = callback.normal;
+    wheel.groundCollider = callback.collider;
+}
+
+// Remove a collider that is destroyed from the ground of the wheels
+/// The wheels standing on the collider are not in contact anymore and a sleeping
+/// chassis is woken up so that the suspension rays are cast again at the next update
+void RaycastVehicle::removeGroundCollider(const Collider* collider) {
+
+    bool isGroundRemoved = false;
+    for (uint32 i=0; i < mWheels.size(); i++) {
+        Wheel& wheel = mWheels[i];
+        if (wheel.groundCollider == collider) {
+            wheel.groundCollider = nullptr;
+            wheel.isInContact = false;
+            wheel.suspensionForce = decimal(0.0);
+            isGroundRemoved = true;
+        }
+    }
+
+    if (isGroundRemoved && mBody->isSleeping()) {
+        mBody->setIsSleeping(false);
+    }
+}
+
+// Return the effective mass of the chassis at a point along a direction
+decimal RaycastVehicle::computeEffectiveMass(const Vector3& relativePosition, const Vector3& direction) const {
+
+    const Entity bodyEntity = mBody->getEntity();
+    const Vector3 angularDirection = relativePosition.cross(direction);
+    const Matrix3x3& inverseInertiaTensor = mWorld.mRigidBodyComponents.getInertiaTensorWorldInverse(bodyEntity);
+    const decimal inverseMass = mWorld.mRigidBodyComponents.getMassInverse(bodyEntity) +
+                                angularDirection.dot(inverseInertiaTensor * angularDirection);
+
+    return inverseMass > decimal(0.0) ? decimal(1.0) / inverseMass : decimal(0.0);
+}
+
+// Compute the suspension, the tire forces and apply them to the chassis
+/// The side friction force and the brake force try to stop the sliding of the tires during the
+/// time step. They are shared between the wheels in contact. The total tire force of a wheel is
+/// limited by the friction slip times the suspension force.
+void RaycastVehicle::update(decimal timeStep) {
+
+    if (!mBody->isActive() || mBody->getType() != BodyType::DYNAMIC) {
+        return;
+    }
+
+    // A sleeping vehicle is only woken up by the engine
+    if (mBody->isSleeping()) {
+
+        bool hasEngineForce = false;
+        for (uint32 i=0; i < mWheels.size(); i++) {
+            hasEngineForce |= mWheels[i].engineForce != decimal(0.0);
+        }
+        if (!hasEngineForce) {
+            return;
+        }
+        mBody->setIsSleeping(false);
+    }
+
+    const Transform& chassisTransform = mBody->getTransform();
+    const Quaternion& orientation = chassisTransform.getOrientation();
+    const Vector3 up = orientation * mUp;
+    const Vector3 right = orientation * mRight;
+    const Vector3 centerOfMass = mWorld.mRigidBodyComponents.getCenterOfMassWorld(mBody->getEntity());
+    const Vector3 linearVelocity = mBody->getLinearVelocity();
+    const Vector3 angularVelocity = mBody->getAngularVelocity();
+    const decimal mass = mBody->getMass();
+
+    mCurrentSpeed = linearVelocity.dot(orientation * mForward);
+
+    // Cast the suspension rays
+    uint32 nbWheelsInContact = 0;
+    for (uint32 i=0; i < mWheels.size(); i++) {
+        castWheel(mWheels[i], chassisTransform, up);
+        if (mWheels[i].isInContact) {
+            nbWheelsInContact++;
+        }
+    }
+
+    for (uint32 i=0; i < mWheels.size(); i++) {
+
+        Wheel& wheel = mWheels[i];
+        const WheelSettings& settings = wheel.settings;
+
+        if (!wheel.isInContact) {
+            wheel.suspensionForce = decimal(0.0);
+            wheel.skidInfo = decimal(1.0);
+            wheel.deltaRotation *= WHEEL_ROTATION_DAMPING;
+            wheel.rotation += wheel.deltaRotation;
+            continue;
+        }
+
+        const Vector3& normal = wheel.contactNormal;
+        const Vector3 relativePosition = wheel.contactPoint - centerOfMass;
+        Vector3 velocity = linearVelocity + angularVelocity.cross(relativePosition);
+
+        // Velocity relative to a moving ground
+        RigidBody* groundBody = nullptr;
+        const Entity groundEntity = wheel.groundCollider->getBody()->getEntity();
+        if (mWorld.mRigidBodyComponents.hasComponent(groundEntity) &&
+            mWorld.mRigidBodyComponents.getBodyType(groundEntity) != BodyType::STATIC) {
+
+            groundBody = static_cast<RigidBody*>(wheel.groundCollider->getBody());
+            const Vector3 groundRelativePosition = wheel.contactPoint -
+                                                   mWorld.mRigidBodyComponents.getCenterOfMassWorld(groundEntity);
+            velocity -= groundBody->getLinearVelocity() + groundBody->getAngularVelocity().cross(groundRelativePosition);
+            if (groundBody->getType() != BodyType::DYNAMIC) {
+                groundBody = nullptr;
+            }
+        }
+
+        // ---------- Suspension ---------- //
+
+        const decimal normalDotUp = normal.dot(up);
+        decimal inverseNormalDotUp = decimal(1.0) / MIN_SUSPENSION_COSINE;
+        decimal suspensionVelocity = decimal(0.0);
+        if (normalDotUp >= MIN_SUSPENSION_COSINE) {
+            inverseNormalDotUp = decimal(1.0) / normalDotUp;
+            suspensionVelocity = normal.dot(velocity) * inverseNormalDotUp;
+        }
+
+        const decimal compression = settings.suspensionRestLength - wheel.suspensionLength;
+        const decimal damping = suspensionVelocity < decimal(0.0) ? settings.dampingCompression : settings.dampingRelaxation;
+        decimal suspensionForce = (settings.suspensionStiffness * compression * inverseNormalDotUp -
+                                   damping * suspensionVelocity) * mass;
+        suspensionForce = clamp(suspensionForce, decimal(0.0), settings.maxSuspensionForce);
+        wheel.suspensionForce = suspensionForce;
+
+        mBody->applyWorldForceAtWorldPosition(normal * suspensionForce, wheel.contactPoint);
+
+        // ---------- Tire ---------- //
+
+        // Axle and forward directions of the wheel on the ground plane
+        const decimal halfSteering = wheel.steering * decimal(0.5);
+        const Quaternion steeringRotation(up * std::sin(halfSteering), std::cos(halfSteering));
+        Vector3 side = steeringRotation * right;
+        side -= side.dot(normal) * normal;
+        if (side.lengthSquare() <= MACHINE_EPSILON) {
+            wheel.skidInfo = decimal(1.0);
+            continue;
+        }
+        side.normalize();
+        const Vector3 forward = normal.cross(side);
+
+        const decimal forwardVelocity = velocity.dot(forward);
+        const decimal sideVelocity = velocity.dot(side);
+
+        // Side friction
+        const decimal invNbWheelsInContact = decimal(1.0) / decimal(nbWheelsInContact);
+        decimal sideForce = -sideVelocity * computeEffectiveMass(relativePosition, side) * invNbWheelsInContact / timeStep;
+
+        // Engine and brake
+        decimal forwardForce = wheel.engineForce;
+        if (wheel.brake > decimal(0.0)) {
+            const decimal brakeForce = -forwardVelocity * computeEffectiveMass(relativePosition, forward) *
+                                       invNbWheelsInContact / timeStep;
+            forwardForce += clamp(brakeForce, -wheel.brake, wheel.brake);
+        }
+
+        // Limit the tire force with the friction slip
+        wheel.skidInfo = decimal(1.0);
+        const decimal maxTireForce = settings.frictionSlip * suspensionForce;
+        const decimal tireForce = std::sqrt(sideForce * sideForce + forwardForce * forwardForce);
+        if (tireForce > maxTireForce) {
+            wheel.skidInfo = tireForce > decimal(0.0) ? maxTireForce / tireForce : decimal(0.0);
+            sideForce *= wheel.skidInfo;
+            forwardForce *= wheel.skidInfo;
+        }
+
+        // The tire force is applied closer to the height of the center of mass to reduce the roll
+        const Vector3 tireForceVector = forward * forwardForce + side * sideForce;
+        const Vector3 tireForcePoint = wheel.contactPoint + up * (relativePosition.dot(-up) * (decimal(1.0) - settings.rollInfluence));
+        mBody->applyWorldForceAtWorldPosition(tireForceVector, tireForcePoint);
+
+        // Reaction of the ground
+        if (groundBody != nullptr) {
+            groundBody->applyWorldForceAtWorldPosition(-(normal * suspensionForce + tireForceVector), wheel.contactPoint);
+        }
+
+        // The wheel rolls on the ground
+        wheel.deltaRotation = forwardVelocity * timeStep / settings.radius;
+        wheel.rotation += wheel.deltaRotation;
+    }
+}
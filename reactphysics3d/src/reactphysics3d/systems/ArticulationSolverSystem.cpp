@@ -0,0 +1,666 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+// Libraries
+#include <reactphysics3d/systems/ArticulationSolverSystem.h>
+#include <reactphysics3d/memory/MemoryManager.h>
+#include <reactphysics3d/engine/JointColoring.h>
+#include <reactphysics3d/components/RigidBodyComponents.h>
+#include <reactphysics3d/components/BallAndSocketJointComponents.h>
+#include <reactphysics3d/components/HingeJointComponents.h>
+#include <cstring>
+
+using namespace reactphysics3d;
+
+// Return the representative of the set of a body (union-find with path halving)
+static uint32 findBodySet(uint32* setParents, uint32 bodyIndex) {
+
+    while (setParents[bodyIndex] != bodyIndex) {
+        setParents[bodyIndex] = setParents[setParents[bodyIndex]];
+        bodyIndex = setParents[bodyIndex];
+    }
+
+    return bodyIndex;
+}
+
+// Compute the inverse of a square matrix with the Gauss-Jordan elimination and return false if it is singular
+static bool computeInverse(const decimal matrix[6][6], uint32 dimension, decimal inverse[6][6]) {
+
+    decimal a[6][6];
+    decimal maxElement = decimal(0.0);
+    for (uint32 r=0; r < dimension; r++) {
+        for (uint32 c=0; c < dimension; c++) {
+            a[r][c] = matrix[r][c];
+            inverse[r][c] = r == c ? decimal(1.0) : decimal(0.0);
+            maxElement = std::max(maxElement, std::abs(a[r][c]));
+        }
+    }
+
+    const decimal epsilon = maxElement * MACHINE_EPSILON;
+
+    for (uint32 c=0; c < dimension; c++) {
+
+        // Find the pivot of the column
+        uint32 pivotRow = c;
+        for (uint32 r=c+1; r < dimension; r++) {
+            if (std::abs(a[r][c]) > std::abs(a[pivotRow][c])) pivotRow = r;
+        }
+        if (std::abs(a[pivotRow][c]) <= epsilon) return false;
+
+        if (pivotRow != c) {
+            for (uint32 k=0; k < dimension; k++) {
+                std::swap(a[c][k], a[pivotRow][k]);
+                std::swap(inverse[c][k], inverse[pivotRow][k]);
+            }
+        }
+
+        const decimal pivotInverse = decimal(1.0) / a[c][c];
+        for (uint32 k=0; k < dimension; k++) {
+            a[c][k] *= pivotInverse;
+            inverse[c][k] *= pivotInverse;
+        }
+
+        for (uint32 r=0; r < dimension; r++) {
+            if (r == c) continue;
+            const decimal factor = a[r][c];
+            if (factor == decimal(0.0)) continue;
+            for (uint32 k=0; k < dimension; k++) {
+                a[r][k] -= factor * a[c][k];
+                inverse[r][k] -= factor * inverse[c][k];
+            }
+        }
+    }
+
+    return true;
+}
+
+// Write the rows of the Jacobian of a point constraint (x2 + r2 - x1 - r1 = 0) starting at a given row
+static void setPointConstraintJacobians(const Vector3& r1World, const Vector3& r2World, uint32 startRow,
+                                        decimal jacobianBody1[6][6], decimal jacobianBody2[6][6]) {
+
+    // Skew-symmetric matrices of the cross products r1 x w and r2 x w
+    const decimal skew1[3][3] = {{0, -r1World.z, r1World.y}, {r1World.z, 0, -r1World.x}, {-r1World.y, r1World.x, 0}};
+    const decimal skew2[3][3] = {{0, -r2World.z, r2World.y}, {r2World.z, 0, -r2World.x}, {-r2World.y, r2World.x, 0}};
+
+    for (uint32 r=0; r < 3; r++) {
+        for (uint32 c=0; c < 3; c++) {
+
+            // J1 = [-I  [r1]x] and J2 = [I  -[r2]x]
+            jacobianBody1[startRow + r][c] = r == c ? decimal(-1.0) : decimal(0.0);
+            jacobianBody1[startRow + r][3 + c] = skew1[r][c];
+            jacobianBody2[startRow + r][c] = r == c ? decimal(1.0) : decimal(0.0);
+            jacobianBody2[startRow + r][3 + c] = -skew2[r][c];
+        }
+    }
+}
+
+// Constructor
+ArticulationSolverSystem::ArticulationSolverSystem(MemoryManager& memoryManager, RigidBodyComponents& rigidBodyComponents,
+                                                   BallAndSocketJointComponents& ballAndSocketJointComponents,
+                                                   HingeJointComponents& hingeJointComponents)
+                         :mMemoryManager(memoryManager), mRigidBodyComponents(rigidBodyComponents),
+                          mBallAndSocketJointComponents(ballAndSocketJointComponents), mHingeJointComponents(hingeJointComponents),
+                          mNodes(nullptr), mNbNodes(0), mNbAllocatedNodes(0), mArticulationsStartIndex(nullptr), mNbArticulations(0),
+                          mIsBallAndSocketJointArticulated(nullptr), mIsHingeJointArticulated(nullptr), mNbJoints(0) {
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    mProfiler = nullptr;
+
+#endif
+
+}
+
+// Release the memory allocated for the articulations (no joint is articulated)
+void ArticulationSolverSystem::reset() {
+
+    if (mNbAllocatedNodes > 0) {
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mNodes, sizeof(ArticulationNode) * mNbAllocatedNodes);
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mArticulationsStartIndex, sizeof(uint32) * mNbAllocatedNodes);
+    }
+    if (mNbJoints > 0) {
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mIsBallAndSocketJointArticulated, sizeof(bool) * mNbJoints);
+    }
+
+    mNodes = nullptr;
+    mNbNodes = 0;
+    mNbAllocatedNodes = 0;
+    mArticulationsStartIndex = nullptr;
+    mNbArticulations = 0;
+    mIsBallAndSocketJointArticulated = nullptr;
+    mIsHingeJointArticulated = nullptr;
+    mNbJoints = 0;
+}
+
+// Return true if a body can be part of an articulation
+/// The body must be dynamic with a finite mass and inertia and without any locked axis
+/// because the mass matrix of the body is used in the system.
+bool ArticulationSolverSystem::isBodyArticulable(uint32 rigidBodyComponentIndex) const {
+
+    const uint32 i = rigidBodyComponentIndex;
+    const Vector3& inverseInertiaLocal = mRigidBodyComponents.mInverseInertiaTensorsLocal[i];
+
+    return mRigidBodyComponents.mBodyTypes[i] == BodyType::DYNAMIC &&
+           mRigidBodyComponents.mInverseMasses[i] > decimal(0.0) &&
+           inverseInertiaLocal.x > decimal(0.0) && inverseInertiaLocal.y > decimal(0.0) && inverseInertiaLocal.z > decimal(0.0) &&
+           mRigidBodyComponents.mLinearLockAxisFactors[i] == Vector3(1, 1, 1) &&
+           mRigidBodyComponents.mAngularLockAxisFactors[i] == Vector3(1, 1, 1);
+}
+
+// Find the articulations and factorize their systems
+/// This method must be called after the initialization of the ball-and-socket and hinge joints
+/// solvers because it uses the world-space anchor points, axis and inertia tensors they compute.
+void ArticulationSolverSystem::initialize(const JointColoring& ballAndSocketJointColoring, const JointColoring& hingeJointColoring) {
+
+    RP3D_PROFILE("ArticulationSolverSystem::initialize()", mProfiler);
+
+    reset();
+
+    const uint32 nbBallAndSocketJoints = ballAndSocketJointColoring.nbJoints;
+    const uint32 nbJoints = nbBallAndSocketJoints + hingeJointColoring.nbJoints;
+    if (nbJoints == 0) return;
+
+    const uint32 nbBodies = mRigidBodyComponents.getNbComponents();
+    const BodyType* bodyTypes = mRigidBodyComponents.mBodyTypes;
+
+    // The joints are numbered with the ball-and-socket joints first and then the hinge joints
+    uint32* jointsBody1 = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+    uint32* jointsBody2 = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbJoints));
+    for (uint32 i=0; i < nbBallAndSocketJoints; i++) {
+        jointsBody1[i] = ballAndSocketJointColoring.rigidBodyComponentIndicesBody1[i];
+        jointsBody2[i] = ballAndSocketJointColoring.rigidBodyComponentIndicesBody2[i];
+    }
+    for (uint32 i=0; i < hingeJointColoring.nbJoints; i++) {
+        jointsBody1[nbBallAndSocketJoints + i] = hingeJointColoring.rigidBodyComponentIndicesBody1[i];
+        jointsBody2[nbBallAndSocketJoints + i] = hingeJointColoring.rigidBodyComponentIndicesBody2[i];
+    }
+
+    // ---------- Find the groups of bodies connected by the joints ---------- //
+
+    uint32* setParents = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbBodies));
+    uint32* setsNbGroundedJoints = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbBodies));
+    uint32* setsGroundedJoint = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbBodies));
+    bool* isSetArticulable = static_cast<bool*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(bool) * nbBodies));
+    for (uint32 b=0; b < nbBodies; b++) {
+        setParents[b] = b;
+        setsNbGroundedJoints[b] = 0;
+        isSetArticulable[b] = isBodyArticulable(b);
+    }
+
+    for (uint32 g=0; g < nbJoints; g++) {
+
+        const bool isBody1Dynamic = bodyTypes[jointsBody1[g]] == BodyType::DYNAMIC;
+        const bool isBody2Dynamic = bodyTypes[jointsBody2[g]] == BodyType::DYNAMIC;
+
+        if (isBody1Dynamic && isBody2Dynamic) {
+
+            const uint32 set1 = findBodySet(setParents, jointsBody1[g]);
+            const uint32 set2 = findBodySet(setParents, jointsBody2[g]);
+
+            // If the bodies are already connected, the joints contain a loop
+            if (set1 == set2) {
+                isSetArticulable[set1] = false;
+            }
+            else {
+                setParents[set2] = set1;
+                if (setsNbGroundedJoints[set2] > 0) setsGroundedJoint[set1] = setsGroundedJoint[set2];
+                setsNbGroundedJoints[set1] += setsNbGroundedJoints[set2];
+                isSetArticulable[set1] = isSetArticulable[set1] && isSetArticulable[set2];
+            }
+        }
+        else if (isBody1Dynamic || isBody2Dynamic) {
+
+            // The joint attaches the group to a static or kinematic body
+            const uint32 set = findBodySet(setParents, isBody1Dynamic ? jointsBody1[g] : jointsBody2[g]);
+            setsNbGroundedJoints[set]++;
+            setsGroundedJoint[set] = g;
+        }
+    }
+
+    // ---------- Select the articulated joints ---------- //
+
+    // Two joints attached to static or kinematic bodies make a loop through those bodies
+    mNbJoints = nbJoints;
+    mIsBallAndSocketJointArticulated = static_cast<bool*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(bool) * nbJoints));
+    mIsHingeJointArticulated = mIsBallAndSocketJointArticulated + nbBallAndSocketJoints;
+    uint32* bodiesJointsStartIndex = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * (nbBodies + 1)));
+    std::memset(bodiesJointsStartIndex, 0, sizeof(uint32) * (nbBodies + 1));
+    uint32 nbArticulatedJoints = 0;
+    for (uint32 g=0; g < nbJoints; g++) {
+
+        const bool isBody1Dynamic = bodyTypes[jointsBody1[g]] == BodyType::DYNAMIC;
+        const bool isBody2Dynamic = bodyTypes[jointsBody2[g]] == BodyType::DYNAMIC;
+
+        bool isArticulated = false;
+        if (isBody1Dynamic || isBody2Dynamic) {
+            const uint32 set = findBodySet(setParents, isBody1Dynamic ? jointsBody1[g] : jointsBody2[g]);
+            isArticulated = isSetArticulable[set] && setsNbGroundedJoints[set] <= 1;
+        }
+
+        mIsBallAndSocketJointArticulated[g] = isArticulated;
+        if (isArticulated) {
+            nbArticulatedJoints++;
+            if (isBody1Dynamic) bodiesJointsStartIndex[jointsBody1[g]]++;
+            if (isBody2Dynamic) bodiesJointsStartIndex[jointsBody2[g]]++;
+        }
+    }
+
+    if (nbArticulatedJoints > 0) {
+
+        // Compute the joints adjacent to each body (the joints of the body b are in
+        // the range [bodiesJointsStartIndex[b], bodiesJointsStartIndex[b+1]) of the adjacency array)
+        uint32 nbArticulatedBodies = 0;
+        uint32 nbAdjacentJoints = 0;
+        for (uint32 b=0; b <= nbBodies; b++) {
+            const uint32 nbBodyJoints = bodiesJointsStartIndex[b];
+            if (nbBodyJoints > 0) nbArticulatedBodies++;
+            bodiesJointsStartIndex[b] = nbAdjacentJoints;
+            nbAdjacentJoints += nbBodyJoints;
+        }
+        uint32* adjacentJoints = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbAdjacentJoints));
+        uint32* bodiesNbAdjacentJoints = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * nbBodies));
+        std::memset(bodiesNbAdjacentJoints, 0, sizeof(uint32) * nbBodies);
+        for (uint32 g=0; g < nbJoints; g++) {
+            if (!mIsBallAndSocketJointArticulated[g]) continue;
+            const uint32 body1 = jointsBody1[g];
+            const uint32 body2 = jointsBody2[g];
+            if (bodyTypes[body1] == BodyType::DYNAMIC) adjacentJoints[bodiesJointsStartIndex[body1] + bodiesNbAdjacentJoints[body1]++] = g;
+            if (bodyTypes[body2] == BodyType::DYNAMIC) adjacentJoints[bodiesJointsStartIndex[body2] + bodiesNbAdjacentJoints[body2]++] = g;
+        }
+
+        // ---------- Build the tree of each articulation ---------- //
+
+        mNbAllocatedNodes = nbArticulatedJoints + nbArticulatedBodies;
+        mNodes = static_cast<ArticulationNode*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(ArticulationNode) * mNbAllocatedNodes));
+        mArticulationsStartIndex = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(uint32) * mNbAllocatedNodes));
+
+        int32* bodiesNodeIndex = static_cast<int32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(int32) * nbBodies));
+        int32* jointsNodeIndex = static_cast<int32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame, sizeof(int32) * nbJoints));
+        std::memset(bodiesNodeIndex, -1, sizeof(int32) * nbBodies);
+        std::memset(jointsNodeIndex, -1, sizeof(int32) * nbJoints);
+
+        for (uint32 g=0; g < nbJoints; g++) {
+
+            if (!mIsBallAndSocketJointArticulated[g] || jointsNodeIndex[g] >= 0) continue;
+
+            const uint32 firstBody = bodyTypes[jointsBody1[g]] == BodyType::DYNAMIC ? jointsBody1[g] : jointsBody2[g];
+            const uint32 set = findBodySet(setParents, firstBody);
+
+            // The root of the tree is the joint attached to a static or kinematic body (if any) or a body
+            const uint32 articulationStartIndex = mNbNodes;
+            ArticulationNode& rootNode = mNodes[mNbNodes];
+            rootNode.parentIndex = -1;
+            if (setsNbGroundedJoints[set] == 1) {
+                rootNode.isBody = false;
+                rootNode.componentIndex = setsGroundedJoint[set];
+                jointsNodeIndex[setsGroundedJoint[set]] = mNbNodes;
+            }
+            else {
+                rootNode.isBody = true;
+                rootNode.componentIndex = firstBody;
+                bodiesNodeIndex[firstBody] = mNbNodes;
+            }
+            mNbNodes++;
+
+            // Add the nodes in breadth-first order (each node is added after its parent)
+            for (uint32 n=articulationStartIndex; n < mNbNodes; n++) {
+
+                if (mNodes[n].isBody) {
+
+                    const uint32 body = mNodes[n].componentIndex;
+                    for (uint32 a=bodiesJointsStartIndex[body]; a < bodiesJointsStartIndex[body + 1]; a++) {
+                        const uint32 joint = adjacentJoints[a];
+                        if (jointsNodeIndex[joint] >= 0) continue;
+                        jointsNodeIndex[joint] = mNbNodes;
+                        mNodes[mNbNodes].isBody = false;
+                        mNodes[mNbNodes].componentIndex = joint;
+                        mNodes[mNbNodes].parentIndex = n;
+                        mNbNodes++;
+                    }
+                }
+                else {
+
+                    const uint32 jointBodies[2] = {jointsBody1[mNodes[n].componentIndex], jointsBody2[mNodes[n].componentIndex]};
+                    for (uint32 k=0; k < 2; k++) {
+                        const uint32 body = jointBodies[k];
+                        if (bodyTypes[body] != BodyType::DYNAMIC || bodiesNodeIndex[body] >= 0) continue;
+                        bodiesNodeIndex[body] = mNbNodes;
+                        mNodes[mNbNodes].isBody = true;
+                        mNodes[mNbNodes].componentIndex = body;
+                        mNodes[mNbNodes].parentIndex = n;
+                        mNbNodes++;
+                    }
+                }
+            }
+
+            // Initialize the blocks of the matrix H = [M J^T ; J 0] of the nodes
+            for (uint32 n=articulationStartIndex; n < mNbNodes; n++) {
+
+                ArticulationNode& node = mNodes[n];
+                std::memset(node.D, 0, sizeof(node.D));
+
+                if (node.isBody) {
+
+                    // The block of a body is its mass matrix
+                    node.dimension = 6;
+                    node.isHingeJoint = false;
+                    const decimal mass = decimal(1.0) / mRigidBodyComponents.mInverseMasses[node.componentIndex];
+                    const Matrix3x3 inertiaTensor = mRigidBodyComponents.mInverseInertiaTensorsWorld[node.componentIndex].getInverse();
+                    for (uint32 r=0; r < 3; r++) {
+                        node.D[r][r] = mass;
+                        for (uint32 c=0; c < 3; c++) {
+                            node.D[3 + r][3 + c] = inertiaTensor[r][c];
+                        }
+                    }
+                }
+                else {
+
+                    // Convert the joint number into the index of the joint in the components of its type
+                    const uint32 joint = node.componentIndex;
+                    node.isHingeJoint = joint >= nbBallAndSocketJoints;
+                    node.componentIndex = node.isHingeJoint ? joint - nbBallAndSocketJoints : joint;
+                    node.dimension = node.isHingeJoint ? 5 : 3;
+                    node.rigidBodyComponentIndexBody1 = jointsBody1[joint];
+                    node.rigidBodyComponentIndexBody2 = jointsBody2[joint];
+                    computeJacobians(node);
+                }
+            }
+
+            // If the system of the articulation is singular (redundant constraints for instance),
+            // its joints are solved by the iterative solver
+            if (!factorize(articulationStartIndex, mNbNodes)) {
+                setJointsArticulated(articulationStartIndex, mNbNodes, false);
+                mNbNodes = articulationStartIndex;
+                continue;
+            }
+
+            mArticulationsStartIndex[mNbArticulations] = articulationStartIndex;
+            mNbArticulations++;
+        }
+
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, jointsNodeIndex, sizeof(int32) * nbJoints);
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, bodiesNodeIndex, sizeof(int32) * nbBodies);
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, bodiesNbAdjacentJoints, sizeof(uint32) * nbBodies);
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, adjacentJoints, sizeof(uint32) * nbAdjacentJoints);
+    }
+
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, bodiesJointsStartIndex, sizeof(uint32) * (nbBodies + 1));
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, isSetArticulable, sizeof(bool) * nbBodies);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, setsGroundedJoint, sizeof(uint32) * nbBodies);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, setsNbGroundedJoints, sizeof(uint32) * nbBodies);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, setParents, sizeof(uint32) * nbBodies);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, jointsBody2, sizeof(uint32) * nbJoints);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, jointsBody1, sizeof(uint32) * nbJoints);
+
+    // If no articulation has been found, all the joints are solved by the iterative solver
+    if (mNbArticulations == 0) {
+        reset();
+    }
+}
+
+// Compute the Jacobian of the constraints of a joint node
+void ArticulationSolverSystem::computeJacobians(ArticulationNode& node) const {
+
+    assert(!node.isBody);
+
+    const uint32 i = node.componentIndex;
+    std::memset(node.jacobianBody1, 0, sizeof(node.jacobianBody1));
+    std::memset(node.jacobianBody2, 0, sizeof(node.jacobianBody2));
+
+    if (node.isHingeJoint) {
+
+        // The two rotation constraints (rows 0 and 1) and the three translation constraints (rows 2 to 4)
+        const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+        const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+        for (uint32 c=0; c < 3; c++) {
+            node.jacobianBody1[0][3 + c] = -b2CrossA1[c];
+            node.jacobianBody1[1][3 + c] = -c2CrossA1[c];
+            node.jacobianBody2[0][3 + c] = b2CrossA1[c];
+            node.jacobianBody2[1][3 + c] = c2CrossA1[c];
+        }
+        setPointConstraintJacobians(mHingeJointComponents.mR1World[i], mHingeJointComponents.mR2World[i], 2,
+                                    node.jacobianBody1, node.jacobianBody2);
+    }
+    else {
+        setPointConstraintJacobians(mBallAndSocketJointComponents.mR1World[i], mBallAndSocketJointComponents.mR2World[i], 0,
+                                    node.jacobianBody1, node.jacobianBody2);
+    }
+}
+
+// Compute the block H(node, parent) of the matrix of the system
+/// The block between a joint and one of its bodies is the Jacobian of the joint for this body
+/// (and its transpose between a body and its joint).
+void ArticulationSolverSystem::computeParentBlock(const ArticulationNode& node, const ArticulationNode& parent,
+                                                  decimal block[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION]) const {
+
+    if (node.isBody) {
+
+        assert(!parent.isBody);
+        const decimal (*jacobian)[MAX_NODE_DIMENSION] = parent.rigidBodyComponentIndexBody1 == node.componentIndex ?
+                                                        parent.jacobianBody1 : parent.jacobianBody2;
+        for (uint32 r=0; r < node.dimension; r++) {
+            for (uint32 c=0; c < parent.dimension; c++) {
+                block[r][c] = jacobian[c][r];
+            }
+        }
+    }
+    else {
+
+        assert(parent.isBody);
+        const decimal (*jacobian)[MAX_NODE_DIMENSION] = node.rigidBodyComponentIndexBody1 == parent.componentIndex ?
+                                                        node.jacobianBody1 : node.jacobianBody2;
+        for (uint32 r=0; r < node.dimension; r++) {
+            for (uint32 c=0; c < parent.dimension; c++) {
+                block[r][c] = jacobian[r][c];
+            }
+        }
+    }
+}
+
+// Compute the LDL^T factorization of an articulation and return false if it is singular
+/// The nodes are eliminated from the leaves to the root. When a node is eliminated, its
+/// contribution is removed from the diagonal block of its parent.
+bool ArticulationSolverSystem::factorize(uint32 startIndex, uint32 endIndex) {
+
+    decimal block[MAX_NODE_DIMENSION][MAX_NODE_DIMENSION];
+
+    for (uint32 n=endIndex; n-- > startIndex; ) {
+
+        ArticulationNode& node = mNodes[n];
+
+        if (!computeInverse(node.D, node.dimension, node.inverseD)) return false;
+
+        if (node.parentIndex < 0) continue;
+
+        ArticulationNode& parent = mNodes[node.parentIndex];
+        computeParentBlock(node, parent, block);
+
+        // L = D^-1 * H(node, parent)
+        for (uint32 r=0; r < node.dimension; r++) {
+            for (uint32 c=0; c < parent.dimension; c++) {
+                decimal sum = decimal(0.0);
+                for (uint32 k=0; k < node.dimension; k++) {
+                    sum += node.inverseD[r][k] * block[k][c];
+                }
+                node.L[r][c] = sum;
+            }
+        }
+
+        // D(parent) = D(parent) - H(node, parent)^T * L
+        for (uint32 r=0; r < parent.dimension; r++) {
+            for (uint32 c=0; c < parent.dimension; c++) {
+                decimal sum = decimal(0.0);
+                for (uint32 k=0; k < node.dimension; k++) {
+                    sum += block[k][r] * node.L[k][c];
+                }
+                parent.D[r][c] -= sum;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Mark the joints of an articulation as solved (or not) by this solver
+void ArticulationSolverSystem::setJointsArticulated(uint32 startIndex, uint32 endIndex, bool isArticulated) {
+
+    for (uint32 n=startIndex; n < endIndex; n++) {
+        const ArticulationNode& node = mNodes[n];
+        if (node.isBody) continue;
+        if (node.isHingeJoint) {
+            mIsHingeJointArticulated[node.componentIndex] = isArticulated;
+        }
+        else {
+            mIsBallAndSocketJointArticulated[node.componentIndex] = isArticulated;
+        }
+    }
+}
+
+// Solve the velocity constraints of the articulated joints
+/// The system H * [deltaV ; -lambda] = [0 ; -(J * v + b)] is solved with the factorization
+/// of each articulation. The velocity changes are applied to the bodies and the impulses are
+/// accumulated in the joints (for warm starting).
+void ArticulationSolverSystem::solveVelocityConstraints() {
+
+    RP3D_PROFILE("ArticulationSolverSystem::solveVelocityConstraints()", mProfiler);
+
+    Vector3* linearVelocities = mRigidBodyComponents.mConstrainedLinearVelocities;
+    Vector3* angularVelocities = mRigidBodyComponents.mConstrainedAngularVelocities;
+
+    // For each articulation
+    for (uint32 a=0; a < mNbArticulations; a++) {
+
+        const uint32 startIndex = mArticulationsStartIndex[a];
+        const uint32 endIndex = a + 1 < mNbArticulations ? mArticulationsStartIndex[a + 1] : mNbNodes;
+
+        // Compute the right-hand side of the system (the velocity error of the joints)
+        for (uint32 n=startIndex; n < endIndex; n++) {
+
+            ArticulationNode& node = mNodes[n];
+
+            if (node.isBody) {
+                std::memset(node.x, 0, sizeof(node.x));
+                continue;
+            }
+
+            const Vector3& v1 = linearVelocities[node.rigidBodyComponentIndexBody1];
+            const Vector3& w1 = angularVelocities[node.rigidBodyComponentIndexBody1];
+            const Vector3& v2 = linearVelocities[node.rigidBodyComponentIndexBody2];
+            const Vector3& w2 = angularVelocities[node.rigidBodyComponentIndexBody2];
+            const decimal velocities1[6] = {v1.x, v1.y, v1.z, w1.x, w1.y, w1.z};
+            const decimal velocities2[6] = {v2.x, v2.y, v2.z, w2.x, w2.y, w2.z};
+
+            decimal bias[MAX_NODE_DIMENSION];
+            if (node.isHingeJoint) {
+                const Vector2& biasRotation = mHingeJointComponents.mBiasRotation[node.componentIndex];
+                const Vector3& biasTranslation = mHingeJointComponents.mBiasTranslation[node.componentIndex];
+                bias[0] = biasRotation.x;
+                bias[1] = biasRotation.y;
+                bias[2] = biasTranslation.x;
+                bias[3] = biasTranslation.y;
+                bias[4] = biasTranslation.z;
+            }
+            else {
+                const Vector3& biasVector = mBallAndSocketJointComponents.mBiasVector[node.componentIndex];
+                bias[0] = biasVector.x;
+                bias[1] = biasVector.y;
+                bias[2] = biasVector.z;
+            }
+
+            for (uint32 r=0; r < node.dimension; r++) {
+                decimal Jv = bias[r];
+                for (uint32 c=0; c < 6; c++) {
+                    Jv += node.jacobianBody1[r][c] * velocities1[c] + node.jacobianBody2[r][c] * velocities2[c];
+                }
+                node.x[r] = -Jv;
+            }
+        }
+
+        // Forward substitution (from the leaves to the root)
+        for (uint32 n=endIndex; n-- > startIndex; ) {
+
+            const ArticulationNode& node = mNodes[n];
+            if (node.parentIndex < 0) continue;
+
+            ArticulationNode& parent = mNodes[node.parentIndex];
+            for (uint32 c=0; c < parent.dimension; c++) {
+                decimal sum = decimal(0.0);
+                for (uint32 r=0; r < node.dimension; r++) {
+                    sum += node.L[r][c] * node.x[r];
+                }
+                parent.x[c] -= sum;
+            }
+        }
+
+        // Diagonal and backward substitution (from the root to the leaves)
+        for (uint32 n=startIndex; n < endIndex; n++) {
+
+            ArticulationNode& node = mNodes[n];
+
+            decimal y[MAX_NODE_DIMENSION];
+            for (uint32 r=0; r < node.dimension; r++) {
+                decimal sum = decimal(0.0);
+                for (uint32 k=0; k < node.dimension; k++) {
+                    sum += node.inverseD[r][k] * node.x[k];
+                }
+                y[r] = sum;
+            }
+
+            if (node.parentIndex >= 0) {
+                const ArticulationNode& parent = mNodes[node.parentIndex];
+                for (uint32 r=0; r < node.dimension; r++) {
+                    decimal sum = decimal(0.0);
+                    for (uint32 c=0; c < parent.dimension; c++) {
+                        sum += node.L[r][c] * parent.x[c];
+                    }
+                    y[r] -= sum;
+                }
+            }
+
+            for (uint32 r=0; r < node.dimension; r++) {
+                node.x[r] = y[r];
+            }
+        }
+
+        // Apply the velocity changes to the bodies and accumulate the impulses of the joints
+        for (uint32 n=startIndex; n < endIndex; n++) {
+
+            const ArticulationNode& node = mNodes[n];
+
+            if (node.isBody) {
+                linearVelocities[node.componentIndex] += Vector3(node.x[0], node.x[1], node.x[2]);
+                angularVelocities[node.componentIndex] += Vector3(node.x[3], node.x[4], node.x[5]);
+            }
+            else if (node.isHingeJoint) {
+                mHingeJointComponents.mImpulseRotation[node.componentIndex] -= Vector2(node.x[0], node.x[1]);
+                mHingeJointComponents.mImpulseTranslation[node.componentIndex] -= Vector3(node.x[2], node.x[3], node.x[4]);
+            }
+            else {
+                mBallAndSocketJointComponents.mImpulse[node.componentIndex] -= Vector3(node.x[0], node.x[1], node.x[2]);
+            }
+        }
+    }
+}
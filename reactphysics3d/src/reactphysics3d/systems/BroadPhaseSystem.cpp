@@ -178,9 +178,15 @@ void BroadPhaseSystem::updateCollidersComponents(uint32 startIndex, uint32 nbIte
             const Entity& bodyEntity = mCollidersComponents.mBodiesEntities[i];
             const Transform& transform = mTransformsComponents.getTransform(bodyEntity);
 
-            // Recompute the world-space AABB of the collision shape
+            // Recompute the world-space AABB of the collision shape (or of the whole compound
+            // tree if the collider holds the broad-phase proxy of a compound body)
             AABB aabb;
-            mCollidersComponents.mCollisionShapes[i]->computeAABB(aabb, transform * mCollidersComponents.mLocalToBodyTransforms[i]);
+            if (mCollidersComponents.mCompoundIds[i] != -1) {
+                aabb = mCollidersComponents.mColliders[i]->getBody()->getCompoundWorldAABB();
+            }
+            else {
+                mCollidersComponents.mCollisionShapes[i]->computeAABB(aabb, transform * mCollidersComponents.mLocalToBodyTransforms[i]);
+            }
 
             // If the size of the collision shape has been changed by the user,
             // we need to reset the broad-phase AABB to its new size
@@ -238,6 +244,11 @@ decimal BroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ra
     // Get the collider from the node
     Collider* collider = static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(nodeId));
 
+    // If the node is the proxy of a compound body, raycast against the colliders of its compound tree
+    if (collider->getBody()->isCompound() && collider == collider->getBody()->mCompoundProxyCollider) {
+        return raycastCompound(collider->getBody(), ray);
+    }
+
     // Check if the raycast filtering mask allows raycast against this shape
     if ((mRaycastWithCategoryMaskBits & collider->getCollisionCategoryBits()) != 0) {
 
@@ -249,3 +260,41 @@ decimal BroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ra
 
     return hitFraction;
 }
+
+// Raycast against the colliders in the compound tree of a body
+decimal BroadPhaseRaycastCallback::raycastCompound(CollisionBody* body, const Ray& ray) {
+
+    // Convert the ray into the local-space of the body
+    const Transform worldToBodyTransform = body->getTransform().getInverse();
+    Ray rayLocal(worldToBodyTransform * ray.point1, worldToBodyTransform * ray.point2, ray.maxFraction);
+
+    CompoundRaycastCallback compoundRaycastCallback(*body->mCompoundTree, ray, mRaycastWithCategoryMaskBits, mRaycastTest);
+    body->mCompoundTree->raycast(rayLocal, compoundRaycastCallback);
+
+    return compoundRaycastCallback.getHitFraction();
+}
+
+// Called for a collider of the compound tree that has to be tested for raycast
+decimal CompoundRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ray& ray) {
+
+    Collider* collider = static_cast<Collider*>(mCompoundTree.getNodeDataPointer(nodeId));
+
+    // Check if the raycast filtering mask allows raycast against this shape
+    if ((mRaycastWithCategoryMaskBits & collider->getCollisionCategoryBits()) == 0) {
+        return decimal(-1.0);
+    }
+
+    // The ray of the tree is in the local-space of the body but the fraction is the same in world-space
+    const Ray worldRay(mWorldRay.point1, mWorldRay.point2, ray.maxFraction);
+    const decimal hitFraction = mRaycastTest.raycastAgainstShape(collider, worldRay);
+
+    // Keep the fraction to report to the broad-phase tree
+    if (hitFraction == decimal(0.0)) {
+        mHitFraction = decimal(0.0);
+    }
+    else if (hitFraction > decimal(0.0) && (mHitFraction < decimal(0.0) || hitFraction < mHitFraction)) {
+        mHitFraction = hitFraction;
+    }
+
+    return hitFraction;
+}
@@ -40,6 +40,8 @@
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/engine/EventListener.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/collision/ShapeCastInfo.h>
+#include <reactphysics3d/collision/narrowphase/GJK/GJKAlgorithm.h>
 #include <reactphysics3d/containers/Pair.h>
 #include <cassert>
 #include <iostream>
@@ -63,7 +65,9 @@ CollisionDetectionSystem::CollisionDetectionSystem(PhysicsWorld* world, Collider
                      mNarrowPhaseInput(mMemoryManager.getSingleFrameAllocator(), mOverlappingPairs), mPotentialContactPoints(mMemoryManager.getSingleFrameAllocator()),
                      mPotentialContactManifolds(mMemoryManager.getSingleFrameAllocator()), mContactPairs1(mMemoryManager.getPoolAllocator()),
                      mContactPairs2(mMemoryManager.getPoolAllocator()), mPreviousContactPairs(&mContactPairs1), mCurrentContactPairs(&mContactPairs2),
-                     mLostContactPairs(mMemoryManager.getSingleFrameAllocator()), mPreviousMapPairIdToContactPairIndex(mMemoryManager.getHeapAllocator()),
+                     mLostContactPairs(mMemoryManager.getSingleFrameAllocator()), mTriggerOccupants(mMemoryManager.getHeapAllocator()),
+                     mOccupiedTriggers(mMemoryManager.getHeapAllocator()), mCollidersToUpdateInTriggers(mMemoryManager.getHeapAllocator()),
+                     mCollidersToUpdateInNextTriggers(mMemoryManager.getHeapAllocator()), mIsReportPending(false), mPreviousMapPairIdToContactPairIndex(mMemoryManager.getHeapAllocator()),
                      mContactManifolds1(mMemoryManager.getPoolAllocator()), mContactManifolds2(mMemoryManager.getPoolAllocator()),
                      mPreviousContactManifolds(&mContactManifolds1), mCurrentContactManifolds(&mContactManifolds2),
                      mContactPoints1(mMemoryManager.getPoolAllocator()), mContactPoints2(mMemoryManager.getPoolAllocator()),
@@ -94,6 +98,8 @@ void CollisionDetectionSystem::computeCollisionDetection() {
     
     // Compute the narrow-phase collision detection
     computeNarrowPhase();
+
+    mIsReportPending = true;
 }
 
 // Compute the broad-phase collision detection
@@ -163,8 +169,9 @@ void CollisionDetectionSystem::removeNonOverlappingPairs() {
             }
             else {
 
-                // If the two colliders of the pair were colliding in the previous frame
-                if (overlappingPair.collidingInPreviousFrame) {
+                // If the two colliders of the pair were colliding in the previous frame (the lost
+                // contact pairs of the colliders of a compound body are computed in computeLostContactPairs())
+                if (overlappingPair.collidingInPreviousFrame && !isCompoundPair(overlappingPair)) {
 
                     // Create a new lost contact pair
                     addLostContactPair(overlappingPair);
@@ -225,6 +232,11 @@ void CollisionDetectionSystem::addNoCollisionPair(Entity body1Entity, Entity bod
     for (uint32 i = 0; i < toBeRemoved.size(); ++i) {
         mOverlappingPairs.removePair(toBeRemoved[i]);
     }
+
+    // The pairs are removed without OverlapExit event
+    for (uint32 i = 0; i < colliderEntities.size(); ++i) {
+        askForTriggersUpdate(colliderEntities[i]);
+    }
 }
 
 // Take an array of overlapping nodes in the broad-phase and create new overlapping pairs if necessary
@@ -287,6 +299,11 @@ void CollisionDetectionSystem::updateOverlappingPairs(const Array<Pair<int32, in
                         OverlappingPairs::OverlappingPair* overlappingPair = mOverlappingPairs.getOverlappingPair(pairId);
                         if (overlappingPair == nullptr) {
 
+                            // The collision filtering of a compound body is done for each collider of
+                            // its compound tree during the middle-phase
+                            const bool isCollider1Compound = mCollidersComponents.mCompoundIds[collider1Index] != -1;
+                            const bool isCollider2Compound = mCollidersComponents.mCompoundIds[collider2Index] != -1;
+
                             const unsigned short shape1CollideWithMaskBits = mCollidersComponents.mCollideWithMaskBits[collider1Index];
                             const unsigned short shape2CollideWithMaskBits = mCollidersComponents.mCollideWithMaskBits[collider2Index];
 
@@ -294,8 +311,9 @@ void CollisionDetectionSystem::updateOverlappingPairs(const Array<Pair<int32, in
                             const unsigned short shape2CollisionCategoryBits = mCollidersComponents.mCollisionCategoryBits[collider2Index];
 
                             // Check if the collision filtering allows collision between the two shapes
-                            if ((shape1CollideWithMaskBits & shape2CollisionCategoryBits) != 0 &&
-                                (shape1CollisionCategoryBits & shape2CollideWithMaskBits) != 0) {
+                            if (isCollider1Compound || isCollider2Compound ||
+                                ((shape1CollideWithMaskBits & shape2CollisionCategoryBits) != 0 &&
+                                 (shape1CollisionCategoryBits & shape2CollideWithMaskBits) != 0)) {
 
                                 Collider* shape1 = mCollidersComponents.mColliders[collider1Index];
                                 Collider* shape2 = mCollidersComponents.mColliders[collider2Index];
@@ -305,8 +323,10 @@ void CollisionDetectionSystem::updateOverlappingPairs(const Array<Pair<int32, in
                                 const bool isShape2Convex = shape2->getCollisionShape()->isConvex();
                                 if (isShape1Convex || isShape2Convex) {
 
-                                    // Add the new overlapping pair
-                                    mOverlappingPairs.addPair(collider1Index, collider2Index, isShape1Convex && isShape2Convex);
+                                    // Add the new overlapping pair (a pair with a compound body can produce several
+                                    // narrow-phase tests and is therefore handled like a concave pair)
+                                    mOverlappingPairs.addPair(collider1Index, collider2Index, isShape1Convex && isShape2Convex &&
+                                                              !isCollider1Compound && !isCollider2Compound);
                                 }
                             }
                         }
@@ -380,7 +400,12 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
         assert(mCollidersComponents.getBroadPhaseId(overlappingPair.collider2) != -1);
         assert(mCollidersComponents.getBroadPhaseId(overlappingPair.collider1) != mCollidersComponents.getBroadPhaseId(overlappingPair.collider2));
 
-        computeConvexVsConcaveMiddlePhase(overlappingPair, mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, needToReportContacts);
+        if (isCompoundPair(overlappingPair)) {
+            computeCompoundMiddlePhase(overlappingPair, mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, needToReportContacts);
+        }
+        else {
+            computeConvexVsConcaveMiddlePhase(overlappingPair, mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, needToReportContacts);
+        }
 
         overlappingPair.collidingInCurrentFrame = false;
     }
@@ -442,17 +467,28 @@ void CollisionDetectionSystem::computeMiddlePhaseCollisionSnapshot(Array<uint64>
         assert(mCollidersComponents.getBroadPhaseId(mOverlappingPairs.mConcavePairs[pairIndex].collider2) != -1);
         assert(mCollidersComponents.getBroadPhaseId(mOverlappingPairs.mConcavePairs[pairIndex].collider1) != mCollidersComponents.getBroadPhaseId(mOverlappingPairs.mConcavePairs[pairIndex].collider2));
 
-        computeConvexVsConcaveMiddlePhase(mOverlappingPairs.mConcavePairs[pairIndex], mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, reportContacts);
+        if (isCompoundPair(mOverlappingPairs.mConcavePairs[pairIndex])) {
+            computeCompoundMiddlePhase(mOverlappingPairs.mConcavePairs[pairIndex], mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, reportContacts);
+        }
+        else {
+            computeConvexVsConcaveMiddlePhase(mOverlappingPairs.mConcavePairs[pairIndex], mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, reportContacts);
+        }
     }
 }
 
 // Compute the concave vs convex middle-phase algorithm for a given pair of bodies
 void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator, NarrowPhaseInput& narrowPhaseInput, bool reportContacts) {
 
-    RP3D_PROFILE("CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase()", mProfiler);
+    computeConvexVsConcaveMiddlePhase(overlappingPair, overlappingPair.collider1, overlappingPair.collider2, overlappingPair.isShape1Convex,
+                                      overlappingPair.narrowPhaseAlgorithmType, allocator, narrowPhaseInput, reportContacts);
+}
 
-    const Entity collider1 = overlappingPair.collider1;
-    const Entity collider2 = overlappingPair.collider2;
+// Compute the concave vs convex middle-phase algorithm for two given colliders of an overlapping pair
+void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, Entity collider1, Entity collider2,
+                                                                 bool isShape1Convex, NarrowPhaseAlgorithmType algorithmType, MemoryAllocator& allocator,
+                                                                 NarrowPhaseInput& narrowPhaseInput, bool reportContacts) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase()", mProfiler);
 
     const uint32 collider1Index = mCollidersComponents.getEntityIndex(collider1);
     const uint32 collider2Index = mCollidersComponents.getEntityIndex(collider2);
@@ -465,7 +501,7 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
     // Collision shape 1 is convex, collision shape 2 is concave
     ConvexShape* convexShape;
     ConcaveShape* concaveShape;
-    if (overlappingPair.isShape1Convex) {
+    if (isShape1Convex) {
         convexShape = static_cast<ConvexShape*>(mCollidersComponents.mCollisionShapes[collider1Index]);
         concaveShape = static_cast<ConcaveShape*>(mCollidersComponents.mCollisionShapes[collider2Index]);
         convexToConcaveTransform = shape2LocalToWorldTransform.getInverse() * shape1LocalToWorldTransform;
@@ -478,7 +514,7 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
 
     assert(convexShape->isConvex());
     assert(!concaveShape->isConvex());
-    assert(overlappingPair.narrowPhaseAlgorithmType != NarrowPhaseAlgorithmType::None);
+    assert(algorithmType != NarrowPhaseAlgorithmType::None);
 
     // Compute the convex shape AABB in the local-space of the concave shape
     AABB aabb;
@@ -499,10 +535,12 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
     const bool isCollider2Trigger = mCollidersComponents.mIsTrigger[collider2Index];
     reportContacts = reportContacts && !isCollider1Trigger && !isCollider2Trigger;
 
+    const uint32 convexColliderId = isShape1Convex ? collider1.id : collider2.id;
+
     CollisionShape* shape1 = nullptr;
     CollisionShape* shape2 = nullptr;
 
-    if (overlappingPair.isShape1Convex) {
+    if (isShape1Convex) {
         shape1 = convexShape;
     }
     else {
@@ -526,20 +564,134 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
 
     #endif
 
-        if (overlappingPair.isShape1Convex) {
+        if (isShape1Convex) {
             shape2 = triangleShape;
         }
         else {
             shape1 = triangleShape;
         }
 
-        // Add a collision info for the two collision shapes into the overlapping pair (if not present yet)
-        LastFrameCollisionInfo* lastFrameInfo = overlappingPair.addLastFrameInfoIfNecessary(shape1->getId(), shape2->getId());
+        // Add a collision info for the convex collider and the triangle into the overlapping pair (if not present yet).
+        // The convex collider is identified by its entity and not by its shape because several children of a
+        // compound body can share the same shape
+        LastFrameCollisionInfo* lastFrameInfo = overlappingPair.addLastFrameInfoIfNecessary(convexColliderId, triangleShape->getId());
 
         // Create a narrow phase info for the narrow-phase collision detection
         narrowPhaseInput.addNarrowPhaseTest(overlappingPair.pairID, collider1, collider2, shape1, shape2,
                                             shape1LocalToWorldTransform, shape2LocalToWorldTransform,
-                                            overlappingPair.narrowPhaseAlgorithmType, reportContacts, lastFrameInfo, allocator);
+                                            algorithmType, reportContacts, lastFrameInfo, allocator);
+    }
+}
+
+// Compute the middle-phase for an overlapping pair involving the proxy of a compound body
+/// The colliders of a compound body are stored in a local tree of the body. This tree is queried
+/// with the AABB of the other side of the pair and a narrow-phase test is created for each pair
+/// of colliders that passes the collision filtering.
+void CollisionDetectionSystem::computeCompoundMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator,
+                                                          NarrowPhaseInput& narrowPhaseInput, bool reportContacts) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::computeCompoundMiddlePhase()", mProfiler);
+
+    const uint32 collider1Index = mCollidersComponents.getEntityIndex(overlappingPair.collider1);
+    const uint32 collider2Index = mCollidersComponents.getEntityIndex(overlappingPair.collider2);
+
+    Array<Entity> colliders1(allocator, 16);
+    Array<Entity> colliders2(allocator, 16);
+    Array<int32> overlappingNodes(allocator, 16);
+
+    // Compute the world-space AABB of the second side of the pair
+    AABB aabb2;
+    if (mCollidersComponents.mCompoundIds[collider2Index] != -1) {
+        aabb2 = mCollidersComponents.mColliders[collider2Index]->getBody()->getCompoundWorldAABB();
+    }
+    else {
+        mCollidersComponents.mCollisionShapes[collider2Index]->computeAABB(aabb2, mCollidersComponents.mLocalToWorldTransforms[collider2Index]);
+    }
+
+    // Get the colliders of the first side that overlap with the second side
+    computeCompoundOverlappingColliders(collider1Index, aabb2, colliders1, overlappingNodes);
+
+    // For each collider of the first side
+    const uint32 nbColliders1 = static_cast<uint32>(colliders1.size());
+    for (uint32 i=0; i < nbColliders1; i++) {
+
+        const uint32 child1Index = mCollidersComponents.getEntityIndex(colliders1[i]);
+
+        AABB aabb1;
+        mCollidersComponents.mCollisionShapes[child1Index]->computeAABB(aabb1, mCollidersComponents.mLocalToWorldTransforms[child1Index]);
+
+        // Get the colliders of the second side that overlap with this collider
+        colliders2.clear();
+        computeCompoundOverlappingColliders(collider2Index, aabb1, colliders2, overlappingNodes);
+
+        // For each collider of the second side
+        const uint32 nbColliders2 = static_cast<uint32>(colliders2.size());
+        for (uint32 j=0; j < nbColliders2; j++) {
+
+            const uint32 child2Index = mCollidersComponents.getEntityIndex(colliders2[j]);
+
+            // Check if the collision filtering allows collision between the two colliders
+            if ((mCollidersComponents.mCollideWithMaskBits[child1Index] & mCollidersComponents.mCollisionCategoryBits[child2Index]) == 0 ||
+                (mCollidersComponents.mCollisionCategoryBits[child1Index] & mCollidersComponents.mCollideWithMaskBits[child2Index]) == 0) {
+                continue;
+            }
+
+            CollisionShape* shape1 = mCollidersComponents.mCollisionShapes[child1Index];
+            CollisionShape* shape2 = mCollidersComponents.mCollisionShapes[child2Index];
+            const bool isShape1Convex = shape1->isConvex();
+            const bool isShape2Convex = shape2->isConvex();
+
+            if (isShape1Convex && isShape2Convex) {
+
+                const bool reportChildContacts = reportContacts && !mCollidersComponents.mIsTrigger[child1Index] &&
+                                                 !mCollidersComponents.mIsTrigger[child2Index];
+
+                NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(shape1->getType(), shape2->getType());
+
+                // Add a collision info for the two colliders into the overlapping pair (if not present yet)
+                LastFrameCollisionInfo* lastFrameInfo = overlappingPair.addLastFrameInfoIfNecessary(colliders1[i].id, colliders2[j].id);
+
+                narrowPhaseInput.addNarrowPhaseTest(overlappingPair.pairID, colliders1[i], colliders2[j], shape1, shape2,
+                                                    mCollidersComponents.mLocalToWorldTransforms[child1Index],
+                                                    mCollidersComponents.mLocalToWorldTransforms[child2Index],
+                                                    algorithmType, reportChildContacts, lastFrameInfo, allocator);
+            }
+            else if (isShape1Convex || isShape2Convex) {
+
+                NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(isShape1Convex ? shape1->getType() : shape2->getType(),
+                                                                                                       CollisionShapeType::CONVEX_POLYHEDRON);
+
+                computeConvexVsConcaveMiddlePhase(overlappingPair, colliders1[i], colliders2[j], isShape1Convex, algorithmType,
+                                                  allocator, narrowPhaseInput, reportContacts);
+            }
+        }
+    }
+}
+
+// Add the colliders of a compound tree overlapping a world-space AABB (or the collider itself if not compound)
+void CollisionDetectionSystem::computeCompoundOverlappingColliders(uint32 colliderIndex, const AABB& worldAABB, Array<Entity>& colliders,
+                                                                   Array<int32>& overlappingNodes) const {
+
+    // If the collider is not the proxy of a compound body
+    if (mCollidersComponents.mCompoundIds[colliderIndex] == -1) {
+        colliders.add(mCollidersComponents.mCollidersEntities[colliderIndex]);
+        return;
+    }
+
+    const CollisionBody* body = mCollidersComponents.mColliders[colliderIndex]->getBody();
+
+    // Convert the AABB into the local-space of the body
+    AABB localAABB = worldAABB;
+    localAABB.applyTransform(body->getTransform().getInverse());
+
+    // Query the compound tree of the body
+    overlappingNodes.clear();
+    body->mCompoundTree->reportAllShapesOverlappingWithAABB(localAABB, overlappingNodes);
+
+    const uint32 nbNodes = static_cast<uint32>(overlappingNodes.size());
+    for (uint32 i=0; i < nbNodes; i++) {
+        const Collider* collider = static_cast<Collider*>(body->mCompoundTree->getNodeDataPointer(overlappingNodes[i]));
+        colliders.add(collider->getEntity());
     }
 }
 
@@ -946,6 +1098,9 @@ void CollisionDetectionSystem::computeLostContactPairs() {
     const uint32 nbConcavePairs = static_cast<uint32>(mOverlappingPairs.mConcavePairs.size());
     for (uint32 i=0; i < nbConcavePairs; i++) {
 
+        // The lost contact pairs of the colliders of a compound body are computed below
+        if (isCompoundPair(mOverlappingPairs.mConcavePairs[i])) continue;
+
         // If the two colliders of the pair were colliding in the previous frame but not in the current one
         if (mOverlappingPairs.mConcavePairs[i].collidingInPreviousFrame && !mOverlappingPairs.mConcavePairs[i].collidingInCurrentFrame) {
 
@@ -957,6 +1112,44 @@ void CollisionDetectionSystem::computeLostContactPairs() {
             }
         }
     }
+
+    // The colliders of a compound body have their own contact pairs. A contact pair of the previous
+    // frame that is not in the current frame anymore is lost (even if its overlapping pair still exists)
+    Set<uint64> currentCompoundContactPairs(mMemoryManager.getSingleFrameAllocator());
+    const uint32 nbCurrentContactPairs = static_cast<uint32>(mCurrentContactPairs->size());
+    for (uint32 i=0; i < nbCurrentContactPairs; i++) {
+        if (isCompoundContactPairId((*mCurrentContactPairs)[i].pairId)) {
+            currentCompoundContactPairs.add((*mCurrentContactPairs)[i].pairId);
+        }
+    }
+
+    const uint32 nbPreviousContactPairs = static_cast<uint32>(mPreviousContactPairs->size());
+    for (uint32 i=0; i < nbPreviousContactPairs; i++) {
+
+        const ContactPair& previousContactPair = (*mPreviousContactPairs)[i];
+        if (!isCompoundContactPairId(previousContactPair.pairId) || currentCompoundContactPairs.contains(previousContactPair.pairId)) continue;
+
+        // If both colliders still exist
+        if (!mCollidersComponents.hasComponent(previousContactPair.collider1Entity) ||
+            !mCollidersComponents.hasComponent(previousContactPair.collider2Entity)) continue;
+
+        // The pairs of a body that has been put to sleep are removed without lost contact pairs
+        if (mWorld->mCollisionBodyComponents.getIsEntityDisabled(previousContactPair.body1Entity) ||
+            mWorld->mCollisionBodyComponents.getIsEntityDisabled(previousContactPair.body2Entity)) {
+
+            // But the collider might not be inside the trigger anymore
+            if (previousContactPair.isTrigger) {
+                askForTriggersUpdate(previousContactPair.collider1Entity);
+                askForTriggersUpdate(previousContactPair.collider2Entity);
+            }
+
+            continue;
+        }
+
+        mLostContactPairs.emplace(previousContactPair.pairId, previousContactPair.body1Entity, previousContactPair.body2Entity,
+                                  previousContactPair.collider1Entity, previousContactPair.collider2Entity,
+                                  static_cast<uint32>(mLostContactPairs.size()), true, previousContactPair.isTrigger);
+    }
 }
 
 // Create the actual contact manifolds and contacts points for testCollision() methods
@@ -1125,6 +1318,12 @@ void CollisionDetectionSystem::removeCollider(Collider* collider) {
         mOverlappingPairs.removePair(overlappingPairs[0]);
     }
 
+    // The pairs are removed without OverlapExit event (the pairs of a compound proxy are the pairs of all the colliders of the body)
+    const Array<Entity>& bodyColliderEntities = mWorld->mCollisionBodyComponents.getColliders(mCollidersComponents.getBody(collider->getEntity()));
+    for (uint32 i=0; i < bodyColliderEntities.size(); i++) {
+        askForTriggersUpdate(bodyColliderEntities[i]);
+    }
+
     mMapBroadPhaseIdToColliderEntity.remove(colliderBroadPhaseId);
 
     // Remove the body from the broad-phase
@@ -1143,6 +1342,476 @@ void CollisionDetectionSystem::raycast(RaycastCallback* raycastCallback, const R
     mBroadPhaseSystem.raycast(ray, rayCastTest, raycastWithCategoryMaskBits);
 }
 
+// Compute the colliders whose broad-phase AABB overlaps with a world-space AABB for a query
+/// The colliders of compound bodies are expanded and the colliders that are filtered out by
+/// the mask (or that are triggers if "reportTriggers" is false) are not reported. The colliders
+/// of the "ignoredBody" (if not null) are not reported either.
+void CollisionDetectionSystem::computeQueryColliders(const AABB& worldAABB, unsigned short collideWithMaskBits, bool reportTriggers,
+                                                     Array<Entity>& colliders, const CollisionBody* ignoredBody) const {
+
+    MemoryAllocator& allocator = mMemoryManager.getHeapAllocator();
+
+    Array<int32> broadPhaseNodes(allocator, 32);
+    Array<int32> compoundNodes(allocator);
+    Array<Entity> candidates(allocator, 32);
+    mBroadPhaseSystem.reportAllShapesOverlappingWithAABB(worldAABB, broadPhaseNodes);
+    const uint32 nbNodes = static_cast<uint32>(broadPhaseNodes.size());
+    for (uint32 i=0; i < nbNodes; i++) {
+        const Collider* collider = mBroadPhaseSystem.getColliderForBroadPhaseId(broadPhaseNodes[i]);
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(collider->getEntity());
+        computeCompoundOverlappingColliders(colliderIndex, worldAABB, candidates, compoundNodes);
+    }
+
+    const uint32 nbCandidates = static_cast<uint32>(candidates.size());
+    for (uint32 i=0; i < nbCandidates; i++) {
+
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(candidates[i]);
+
+        // Check if the filtering mask allows a hit with this collider
+        if ((collideWithMaskBits & mCollidersComponents.mCollisionCategoryBits[colliderIndex]) == 0 ||
+            (!reportTriggers && mCollidersComponents.mIsTrigger[colliderIndex]) ||
+            (ignoredBody != nullptr && mCollidersComponents.mBodiesEntities[colliderIndex] == ignoredBody->getEntity())) {
+            continue;
+        }
+
+        colliders.add(candidates[i]);
+    }
+}
+
+// Cast a convex shape along a translation and report the first collider hit
+/// The shape keeps the orientation of "transform" during the whole cast. The method
+/// returns true if a collider is hit and fills the "shapeCastInfo" with the closest hit.
+/// Triggers are ignored.
+bool CollisionDetectionSystem::shapeCast(const ConvexShape* shape, const Transform& transform, const Vector3& translation,
+                                         ShapeCastInfo& shapeCastInfo, unsigned short collideWithMaskBits,
+                                         const CollisionBody* ignoredBody) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::shapeCast()", mProfiler);
+
+    MemoryAllocator& allocator = mMemoryManager.getHeapAllocator();
+
+    GJKAlgorithm gjkAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    gjkAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    // Compute the AABB swept by the shape
+    AABB startAABB;
+    shape->computeAABB(startAABB, transform);
+    AABB sweptAABB(startAABB.getMin() + translation, startAABB.getMax() + translation);
+    sweptAABB.mergeWithAABB(startAABB);
+
+    // Get the colliders overlapping with the swept AABB
+    Array<Entity> colliders(allocator, 32);
+    computeQueryColliders(sweptAABB, collideWithMaskBits, false, colliders, ignoredBody);
+
+    Array<Vector3> triangleVertices(allocator);
+    Array<Vector3> triangleVerticesNormals(allocator);
+    Array<uint> shapeIds(allocator);
+
+    bool isHit = false;
+    decimal closestFraction = decimal(1.0);
+    decimal hitFraction;
+    Vector3 hitPoint;
+    Vector3 hitNormal;
+
+    // For each collider that can be hit
+    const uint32 nbColliders = static_cast<uint32>(colliders.size());
+    for (uint32 i=0; i < nbColliders; i++) {
+
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(colliders[i]);
+        const CollisionShape* colliderShape = mCollidersComponents.mCollisionShapes[colliderIndex];
+        const Transform& colliderTransform = mCollidersComponents.mLocalToWorldTransforms[colliderIndex];
+        bool isColliderHit = false;
+
+        if (colliderShape->isConvex()) {
+
+            if (gjkAlgorithm.shapeCast(static_cast<const ConvexShape*>(colliderShape), colliderTransform, shape, transform,
+                                       translation, closestFraction, hitFraction, hitPoint, hitNormal)) {
+
+                isColliderHit = true;
+                closestFraction = hitFraction;
+                shapeCastInfo.worldPoint = hitPoint;
+                shapeCastInfo.worldNormal = hitNormal;
+            }
+        }
+        else {
+
+            const ConcaveShape* concaveShape = static_cast<const ConcaveShape*>(colliderShape);
+
+            // Compute the triangles of the concave shape that overlap with the swept AABB
+            AABB localAABB = sweptAABB;
+            localAABB.applyTransform(colliderTransform.getInverse());
+            triangleVertices.clear();
+            triangleVerticesNormals.clear();
+            shapeIds.clear();
+            concaveShape->computeOverlappingTriangles(localAABB, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
+
+            // For each overlapping triangle
+            const uint32 nbTriangles = static_cast<uint32>(shapeIds.size());
+            for (uint32 t=0; t < nbTriangles; t++) {
+
+                TriangleShape triangleShape(&(triangleVertices[t * 3]), &(triangleVerticesNormals[t * 3]), shapeIds[t],
+                                            mTriangleHalfEdgeStructure, allocator);
+
+                if (gjkAlgorithm.shapeCast(&triangleShape, colliderTransform, shape, transform, translation,
+                                           closestFraction, hitFraction, hitPoint, hitNormal)) {
+
+                    isColliderHit = true;
+                    closestFraction = hitFraction;
+                    shapeCastInfo.worldPoint = hitPoint;
+                    shapeCastInfo.worldNormal = hitNormal;
+                }
+            }
+        }
+
+        if (isColliderHit) {
+            isHit = true;
+            shapeCastInfo.hitFraction = closestFraction;
+            shapeCastInfo.collider = mCollidersComponents.mColliders[colliderIndex];
+            shapeCastInfo.body = shapeCastInfo.collider->getBody();
+        }
+    }
+
+    return isHit;
+}
+
+// Compute the translation that moves a convex shape out of its deepest overlapping collider
+/// The method returns false if the shape does not overlap with any collider. For a concave
+/// collider, the deepest overlapping triangle is used. Triggers are ignored.
+bool CollisionDetectionSystem::computePenetration(const ConvexShape* shape, const Transform& transform, Vector3& translation,
+                                                  unsigned short collideWithMaskBits, const CollisionBody* ignoredBody) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::computePenetration()", mProfiler);
+
+    MemoryAllocator& allocator = mMemoryManager.getHeapAllocator();
+
+    GJKAlgorithm gjkAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    gjkAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    AABB aabb;
+    shape->computeAABB(aabb, transform);
+
+    // Get the colliders overlapping with the AABB of the shape
+    Array<Entity> candidates(allocator, 32);
+    computeQueryColliders(aabb, collideWithMaskBits, false, candidates, ignoredBody);
+
+    Array<Vector3> triangleVertices(allocator);
+    Array<Vector3> triangleVerticesNormals(allocator);
+    Array<uint> shapeIds(allocator);
+
+    decimal maxDepth = decimal(0.0);
+    Vector3 normal;
+    decimal depth;
+
+    const uint32 nbCandidates = static_cast<uint32>(candidates.size());
+    for (uint32 i=0; i < nbCandidates; i++) {
+
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(candidates[i]);
+        const CollisionShape* colliderShape = mCollidersComponents.mCollisionShapes[colliderIndex];
+        const Transform& colliderTransform = mCollidersComponents.mLocalToWorldTransforms[colliderIndex];
+
+        if (colliderShape->isConvex()) {
+
+            if (gjkAlgorithm.computePenetration(static_cast<const ConvexShape*>(colliderShape), colliderTransform, shape, transform,
+                                                normal, depth) && depth > maxDepth) {
+                maxDepth = depth;
+                translation = normal * depth;
+            }
+        }
+        else {
+
+            const ConcaveShape* concaveShape = static_cast<const ConcaveShape*>(colliderShape);
+
+            // Compute the triangles of the concave shape that overlap with the AABB of the shape
+            AABB localAABB = aabb;
+            localAABB.applyTransform(colliderTransform.getInverse());
+            triangleVertices.clear();
+            triangleVerticesNormals.clear();
+            shapeIds.clear();
+            concaveShape->computeOverlappingTriangles(localAABB, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
+
+            const uint32 nbTriangles = static_cast<uint32>(shapeIds.size());
+            for (uint32 t=0; t < nbTriangles; t++) {
+
+                TriangleShape triangleShape(&(triangleVertices[t * 3]), &(triangleVerticesNormals[t * 3]), shapeIds[t],
+                                            mTriangleHalfEdgeStructure, allocator);
+
+                if (gjkAlgorithm.computePenetration(&triangleShape, colliderTransform, shape, transform, normal, depth) &&
+                    depth > maxDepth) {
+                    maxDepth = depth;
+                    translation = normal * depth;
+                }
+            }
+        }
+    }
+
+    return maxDepth > decimal(0.0);
+}
+
+// Report all the colliders that overlap with a convex shape at a given transform
+/// This query does not create any body or overlapping pair. Triggers are ignored.
+void CollisionDetectionSystem::testOverlap(const ConvexShape* shape, const Transform& transform, Array<Collider*>& colliders,
+                                           unsigned short collideWithMaskBits) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::testOverlap()", mProfiler);
+
+    MemoryAllocator& allocator = mMemoryManager.getHeapAllocator();
+
+    GJKAlgorithm gjkAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    gjkAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    AABB aabb;
+    shape->computeAABB(aabb, transform);
+
+    // Get the colliders overlapping with the AABB of the shape
+    Array<Entity> candidates(allocator, 32);
+    computeQueryColliders(aabb, collideWithMaskBits, false, candidates);
+
+    Array<Vector3> triangleVertices(allocator);
+    Array<Vector3> triangleVerticesNormals(allocator);
+    Array<uint> shapeIds(allocator);
+
+    const uint32 nbCandidates = static_cast<uint32>(candidates.size());
+    for (uint32 i=0; i < nbCandidates; i++) {
+
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(candidates[i]);
+        const CollisionShape* colliderShape = mCollidersComponents.mCollisionShapes[colliderIndex];
+        const Transform& colliderTransform = mCollidersComponents.mLocalToWorldTransforms[colliderIndex];
+        bool isOverlapping = false;
+
+        if (colliderShape->isConvex()) {
+            isOverlapping = gjkAlgorithm.testOverlap(static_cast<const ConvexShape*>(colliderShape), colliderTransform, shape, transform);
+        }
+        else {
+
+            const ConcaveShape* concaveShape = static_cast<const ConcaveShape*>(colliderShape);
+
+            // Compute the triangles of the concave shape that overlap with the AABB of the shape
+            AABB localAABB = aabb;
+            localAABB.applyTransform(colliderTransform.getInverse());
+            triangleVertices.clear();
+            triangleVerticesNormals.clear();
+            shapeIds.clear();
+            concaveShape->computeOverlappingTriangles(localAABB, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
+
+            const uint32 nbTriangles = static_cast<uint32>(shapeIds.size());
+            for (uint32 t=0; t < nbTriangles && !isOverlapping; t++) {
+
+                TriangleShape triangleShape(&(triangleVertices[t * 3]), &(triangleVerticesNormals[t * 3]), shapeIds[t],
+                                            mTriangleHalfEdgeStructure, allocator);
+
+                isOverlapping = gjkAlgorithm.testOverlap(&triangleShape, colliderTransform, shape, transform);
+            }
+        }
+
+        if (isOverlapping) {
+            colliders.add(mCollidersComponents.mColliders[colliderIndex]);
+        }
+    }
+}
+
+// Report all the colliders whose AABB overlaps with a world-space AABB
+/// This is a coarse query that does not run the narrow-phase. Triggers are reported.
+void CollisionDetectionSystem::queryAABB(const AABB& aabb, Array<Collider*>& colliders, unsigned short collideWithMaskBits) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::queryAABB()", mProfiler);
+
+    Array<Entity> candidates(mMemoryManager.getHeapAllocator(), 32);
+    computeQueryColliders(aabb, collideWithMaskBits, true, candidates);
+
+    const uint32 nbCandidates = static_cast<uint32>(candidates.size());
+    for (uint32 i=0; i < nbCandidates; i++) {
+
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(candidates[i]);
+
+        // The broad-phase AABB is fat so we test the actual AABB of the collider
+        AABB colliderAABB;
+        mCollidersComponents.mCollisionShapes[colliderIndex]->computeAABB(colliderAABB, mCollidersComponents.mLocalToWorldTransforms[colliderIndex]);
+        if (aabb.testCollision(colliderAABB)) {
+            colliders.add(mCollidersComponents.mColliders[colliderIndex]);
+        }
+    }
+}
+
+// Report all the colliders whose AABB overlaps with a world-space sphere
+/// This is a coarse query that does not run the narrow-phase. Triggers are reported.
+void CollisionDetectionSystem::querySphere(const Vector3& center, decimal radius, Array<Collider*>& colliders,
+                                           unsigned short collideWithMaskBits) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::querySphere()", mProfiler);
+
+    const Vector3 extent(radius, radius, radius);
+    Array<Entity> candidates(mMemoryManager.getHeapAllocator(), 32);
+    computeQueryColliders(AABB(center - extent, center + extent), collideWithMaskBits, true, candidates);
+
+    const decimal radiusSquare = radius * radius;
+    const uint32 nbCandidates = static_cast<uint32>(candidates.size());
+    for (uint32 i=0; i < nbCandidates; i++) {
+
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(candidates[i]);
+
+        AABB colliderAABB;
+        mCollidersComponents.mCollisionShapes[colliderIndex]->computeAABB(colliderAABB, mCollidersComponents.mLocalToWorldTransforms[colliderIndex]);
+
+        // Compute the point of the AABB closest to the center of the sphere
+        const Vector3& min = colliderAABB.getMin();
+        const Vector3& max = colliderAABB.getMax();
+        const Vector3 closestPoint(clamp(center.x, min.x, max.x), clamp(center.y, min.y, max.y), clamp(center.z, min.z, max.z));
+        if ((closestPoint - center).lengthSquare() <= radiusSquare) {
+            colliders.add(mCollidersComponents.mColliders[colliderIndex]);
+        }
+    }
+}
+
+// Report the colliders that overlap with a trigger collider in the last update
+/// A collider is an occupant of the trigger between its OverlapStart and OverlapExit events. The
+/// occupants are added to the array if it is not null. Return the number of occupants.
+uint32 CollisionDetectionSystem::getTriggerOccupants(Entity triggerColliderEntity, Array<Collider*>* occupants) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::getTriggerOccupants()", mProfiler);
+
+    if (!mCollidersComponents.getIsTrigger(triggerColliderEntity)) return 0;
+
+    auto it = mTriggerOccupants.find(triggerColliderEntity);
+    if (it == mTriggerOccupants.end()) return 0;
+
+    if (occupants != nullptr) {
+        for (auto occupantIt = it->second.begin(); occupantIt != it->second.end(); ++occupantIt) {
+            occupants->add(mCollidersComponents.getCollider(*occupantIt));
+        }
+    }
+
+    return static_cast<uint32>(it->second.size());
+}
+
+// Remove a collider from the triggers and remove the colliders inside it
+/// This method is called when a collider is destroyed
+void CollisionDetectionSystem::removeColliderFromTriggers(Entity colliderEntity) {
+
+    mCollidersToUpdateInTriggers.remove(colliderEntity);
+    mCollidersToUpdateInNextTriggers.remove(colliderEntity);
+
+    // Remove the collider from the triggers it is inside
+    auto it = mOccupiedTriggers.find(colliderEntity);
+    if (it != mOccupiedTriggers.end()) {
+        for (auto triggerIt = it->second.begin(); triggerIt != it->second.end(); ++triggerIt) {
+            auto occupantsIt = mTriggerOccupants.find(*triggerIt);
+            occupantsIt->second.remove(colliderEntity);
+            if (occupantsIt->second.size() == 0) {
+                mTriggerOccupants.remove(occupantsIt);
+            }
+        }
+        mOccupiedTriggers.remove(it);
+    }
+
+    // Remove the colliders inside the collider if it is a trigger
+    it = mTriggerOccupants.find(colliderEntity);
+    if (it != mTriggerOccupants.end()) {
+        for (auto occupantIt = it->second.begin(); occupantIt != it->second.end(); ++occupantIt) {
+            auto triggersIt = mOccupiedTriggers.find(*occupantIt);
+            triggersIt->second.remove(colliderEntity);
+            if (triggersIt->second.size() == 0) {
+                mOccupiedTriggers.remove(triggersIt);
+            }
+        }
+        mTriggerOccupants.remove(it);
+    }
+}
+
+// Ask for the triggers of a collider to be computed again at the next update
+/// This method is called when the overlapping pairs of a collider are removed without OverlapExit
+/// event (body put to sleep, collider moved into a compound tree, ...). The pairs that are created
+/// again are not colliding in the previous frame, so a pair that stops colliding has no lost contact pair.
+void CollisionDetectionSystem::askForTriggersUpdate(Entity colliderEntity) {
+
+    mCollidersToUpdateInTriggers.add(colliderEntity);
+
+    // The contact pairs of the current frame have already been computed with the removed pairs
+    if (mIsReportPending) {
+        mCollidersToUpdateInNextTriggers.add(colliderEntity);
+    }
+}
+
+// Add a collider to the colliders inside a trigger
+void CollisionDetectionSystem::addTriggerOccupant(Entity triggerColliderEntity, Entity colliderEntity) {
+
+    if (!mCollidersComponents.getIsTrigger(triggerColliderEntity)) return;
+
+    auto it = mTriggerOccupants.find(triggerColliderEntity);
+    if (it == mTriggerOccupants.end()) {
+        mTriggerOccupants.add(Pair<Entity, Set<Entity>>(triggerColliderEntity, Set<Entity>(mMemoryManager.getHeapAllocator())));
+        it = mTriggerOccupants.find(triggerColliderEntity);
+    }
+    if (!it->second.add(colliderEntity)) return;
+
+    it = mOccupiedTriggers.find(colliderEntity);
+    if (it == mOccupiedTriggers.end()) {
+        mOccupiedTriggers.add(Pair<Entity, Set<Entity>>(colliderEntity, Set<Entity>(mMemoryManager.getHeapAllocator())));
+        it = mOccupiedTriggers.find(colliderEntity);
+    }
+    it->second.add(triggerColliderEntity);
+}
+
+// Remove a collider from the colliders inside a trigger
+void CollisionDetectionSystem::removeTriggerOccupant(Entity triggerColliderEntity, Entity colliderEntity) {
+
+    auto it = mTriggerOccupants.find(triggerColliderEntity);
+    if (it == mTriggerOccupants.end() || !it->second.contains(colliderEntity)) return;
+
+    it->second.remove(colliderEntity);
+    if (it->second.size() == 0) {
+        mTriggerOccupants.remove(it);
+    }
+
+    it = mOccupiedTriggers.find(colliderEntity);
+    it->second.remove(triggerColliderEntity);
+    if (it->second.size() == 0) {
+        mOccupiedTriggers.remove(it);
+    }
+}
+
+// Compute the closest points between two colliders with convex shapes
+/// The method returns false if the colliders overlap. Otherwise, it returns true and the
+/// world-space closest points on both colliders. No contact is created.
+bool CollisionDetectionSystem::computeClosestPoints(const Collider* collider1, const Collider* collider2,
+                                                    Vector3& worldPoint1, Vector3& worldPoint2) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::computeClosestPoints()", mProfiler);
+
+    const uint32 collider1Index = mCollidersComponents.getEntityIndex(collider1->getEntity());
+    const uint32 collider2Index = mCollidersComponents.getEntityIndex(collider2->getEntity());
+
+    const CollisionShape* shape1 = mCollidersComponents.mCollisionShapes[collider1Index];
+    const CollisionShape* shape2 = mCollidersComponents.mCollisionShapes[collider2Index];
+    assert(shape1->isConvex() && shape2->isConvex());
+
+    GJKAlgorithm gjkAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    gjkAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    return gjkAlgorithm.computeClosestPoints(static_cast<const ConvexShape*>(shape1), mCollidersComponents.mLocalToWorldTransforms[collider1Index],
+                                             static_cast<const ConvexShape*>(shape2), mCollidersComponents.mLocalToWorldTransforms[collider2Index],
+                                             worldPoint1, worldPoint2);
+}
+
 // Convert the potential contact into actual contacts
 void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, bool updateLastFrameInfo,
                                                         Array<ContactPointInfo>& potentialContactPoints,
@@ -1181,6 +1850,15 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
             const Entity collider1Entity = narrowPhaseInfoBatch.narrowPhaseInfos[i].colliderEntity1;
             const Entity collider2Entity = narrowPhaseInfoBatch.narrowPhaseInfos[i].colliderEntity2;
 
+            // The colliders of a compound body share the overlapping pair of the proxy of the body. Each pair
+            // of colliders gets its own contact pair so that it keeps its own manifolds, materials and events
+            const bool isCompound = isCompoundPair(*overlappingPair);
+            const uint64 contactPairId = isCompound ? computeCompoundContactPairId(collider1Entity, collider2Entity) : pairId;
+
+            // The colliders of a compound pair were colliding in the previous frame if they had a contact pair
+            const bool collidingInPreviousFrame = isCompound ? mPreviousMapPairIdToContactPairIndex.containsKey(contactPairId) :
+                                                               overlappingPair->collidingInPreviousFrame;
+
             const uint32 collider1Index = mCollidersComponents.getEntityIndex(collider1Entity);
             const uint32 collider2Index = mCollidersComponents.getEntityIndex(collider2Entity);
 
@@ -1198,14 +1876,14 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
 
                 const uint32 newContactPairIndex = static_cast<uint32>(contactPairs->size());
 
-                contactPairs->emplace(pairId, body1Entity, body2Entity, collider1Entity, collider2Entity,
-                                      newContactPairIndex, overlappingPair->collidingInPreviousFrame, isTrigger);
+                contactPairs->emplace(contactPairId, body1Entity, body2Entity, collider1Entity, collider2Entity,
+                                      newContactPairIndex, collidingInPreviousFrame, isTrigger);
 
                 ContactPair* pairContact = &((*contactPairs)[newContactPairIndex]);
 
                 // Create a new potential contact manifold for the overlapping pair
                 uint32 contactManifoldIndex = static_cast<uint>(potentialContactManifolds.size());
-                potentialContactManifolds.emplace(pairId);
+                potentialContactManifolds.emplace(contactPairId);
                 ContactManifoldInfo& contactManifoldInfo = potentialContactManifolds[contactManifoldIndex];
 
                 const uint32 contactPointIndexStart = static_cast<uint>(potentialContactPoints.size());
@@ -1227,14 +1905,14 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                 }
 
                 // Add the contact manifold to the overlapping pair contact
-                assert(pairId == contactManifoldInfo.pairId);
+                assert(contactPairId == contactManifoldInfo.pairId);
                 pairContact->potentialContactManifoldsIndices[0] = contactManifoldIndex;
                 pairContact->nbPotentialContactManifolds = 1;
             }
             else {
 
                 // If there is not already a contact pair for this overlapping pair
-                auto it = mapPairIdToContactPairIndex.find(pairId);
+                auto it = mapPairIdToContactPairIndex.find(contactPairId);
                 ContactPair* pairContact = nullptr;
                 if (it == mapPairIdToContactPairIndex.end()) {
 
@@ -1245,15 +1923,15 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                     assert(!mWorld->mCollisionBodyComponents.getIsEntityDisabled(body1Entity) || !mWorld->mCollisionBodyComponents.getIsEntityDisabled(body2Entity));
 
                     const uint32 newContactPairIndex = static_cast<uint32>(contactPairs->size());
-                    contactPairs->emplace(pairId, body1Entity, body2Entity, collider1Entity, collider2Entity,
-                                                       newContactPairIndex, overlappingPair->collidingInPreviousFrame , isTrigger);
+                    contactPairs->emplace(contactPairId, body1Entity, body2Entity, collider1Entity, collider2Entity,
+                                                       newContactPairIndex, collidingInPreviousFrame, isTrigger);
                     pairContact = &((*contactPairs)[newContactPairIndex]);
-                    mapPairIdToContactPairIndex.add(Pair<uint64, uint>(pairId, newContactPairIndex));
+                    mapPairIdToContactPairIndex.add(Pair<uint64, uint>(contactPairId, newContactPairIndex));
 
                 }
                 else { // If a ContactPair already exists for this overlapping pair, we use this one
 
-                    assert(it->first == pairId);
+                    assert(it->first == contactPairId);
 
                     const uint32 pairContactIndex = it->second;
                     pairContact = &((*contactPairs)[pairContactIndex]);
@@ -1305,7 +1983,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
 
                         // Create a new potential contact manifold for the overlapping pair
                         uint32 contactManifoldIndex = static_cast<uint32>(potentialContactManifolds.size());
-                        potentialContactManifolds.emplace(pairId);
+                        potentialContactManifolds.emplace(contactPairId);
                         ContactManifoldInfo& contactManifoldInfo = potentialContactManifolds[contactManifoldIndex];
 
                         // Add the contact point to the manifold
@@ -1640,6 +2318,8 @@ void CollisionDetectionSystem::removeDuplicatedContactPointsInManifold(ContactMa
 // Report contacts and triggers
 void CollisionDetectionSystem::reportContactsAndTriggers() {
 
+    updateTriggerOccupants();
+
     // Report contacts and triggers to the user
     if (mWorld->mEventListener != nullptr) {
 
@@ -1658,6 +2338,97 @@ void CollisionDetectionSystem::reportContactsAndTriggers() {
     mLostContactPairs.clear(true);
 }
 
+// Update the colliders inside the triggers with the trigger contact pairs that start or are lost
+/// Only the OverlapStart and OverlapExit events change the occupants, except for the colliders whose
+/// overlapping pairs have been removed without OverlapExit event since the last update. The triggers
+/// of those colliders are computed again with the trigger contact pairs of the current frame.
+void CollisionDetectionSystem::updateTriggerOccupants() {
+
+    RP3D_PROFILE("CollisionDetectionSystem::updateTriggerOccupants()", mProfiler);
+
+    // OverlapExit events
+    const uint32 nbLostContactPairs = static_cast<uint32>(mLostContactPairs.size());
+    for (uint32 i=0; i < nbLostContactPairs; i++) {
+
+        const ContactPair& lostContactPair = mLostContactPairs[i];
+        if (!lostContactPair.isTrigger) continue;
+
+        removeTriggerOccupant(lostContactPair.collider1Entity, lostContactPair.collider2Entity);
+        removeTriggerOccupant(lostContactPair.collider2Entity, lostContactPair.collider1Entity);
+    }
+
+    // Trigger contact pairs of the current frame with a collider to update
+    Set<Pair<Entity, Entity>> currentTriggerPairs(mMemoryManager.getSingleFrameAllocator());
+
+    // OverlapStart events
+    const bool hasCollidersToUpdate = mCollidersToUpdateInTriggers.size() > 0;
+    const uint32 nbContactPairs = static_cast<uint32>(mCurrentContactPairs->size());
+    for (uint32 i=0; i < nbContactPairs; i++) {
+
+        const ContactPair& contactPair = (*mCurrentContactPairs)[i];
+        if (!contactPair.isTrigger) continue;
+
+        if (hasCollidersToUpdate && (mCollidersToUpdateInTriggers.contains(contactPair.collider1Entity) ||
+                                     mCollidersToUpdateInTriggers.contains(contactPair.collider2Entity))) {
+            if (mCollidersComponents.getIsTrigger(contactPair.collider1Entity)) {
+                currentTriggerPairs.add(Pair<Entity, Entity>(contactPair.collider1Entity, contactPair.collider2Entity));
+            }
+            if (mCollidersComponents.getIsTrigger(contactPair.collider2Entity)) {
+                currentTriggerPairs.add(Pair<Entity, Entity>(contactPair.collider2Entity, contactPair.collider1Entity));
+            }
+        }
+        else if (contactPair.collidingInPreviousFrame) {
+            continue;
+        }
+
+        addTriggerOccupant(contactPair.collider1Entity, contactPair.collider2Entity);
+        addTriggerOccupant(contactPair.collider2Entity, contactPair.collider1Entity);
+    }
+
+    for (auto it = mCollidersToUpdateInTriggers.begin(); it != mCollidersToUpdateInTriggers.end(); ++it) {
+        removeLostTriggerOccupants(*it, currentTriggerPairs);
+    }
+
+    mCollidersToUpdateInTriggers.clear();
+    for (auto it = mCollidersToUpdateInNextTriggers.begin(); it != mCollidersToUpdateInNextTriggers.end(); ++it) {
+        mCollidersToUpdateInTriggers.add(*it);
+    }
+    mCollidersToUpdateInNextTriggers.clear();
+
+    mIsReportPending = false;
+}
+
+// Remove the triggers of a collider that are not in the trigger contact pairs of the current frame
+void CollisionDetectionSystem::removeLostTriggerOccupants(Entity colliderEntity, const Set<Pair<Entity, Entity>>& currentTriggerPairs) {
+
+    Array<Entity> lostTriggers(mMemoryManager.getSingleFrameAllocator());
+    auto it = mOccupiedTriggers.find(colliderEntity);
+    if (it != mOccupiedTriggers.end()) {
+        for (auto triggerIt = it->second.begin(); triggerIt != it->second.end(); ++triggerIt) {
+            if (!currentTriggerPairs.contains(Pair<Entity, Entity>(*triggerIt, colliderEntity))) {
+                lostTriggers.add(*triggerIt);
+            }
+        }
+    }
+    for (uint32 i=0; i < lostTriggers.size(); i++) {
+        removeTriggerOccupant(lostTriggers[i], colliderEntity);
+    }
+
+    // Colliders inside the collider if it is a trigger
+    Array<Entity> lostOccupants(mMemoryManager.getSingleFrameAllocator());
+    it = mTriggerOccupants.find(colliderEntity);
+    if (it != mTriggerOccupants.end()) {
+        for (auto occupantIt = it->second.begin(); occupantIt != it->second.end(); ++occupantIt) {
+            if (!currentTriggerPairs.contains(Pair<Entity, Entity>(colliderEntity, *occupantIt))) {
+                lostOccupants.add(*occupantIt);
+            }
+        }
+    }
+    for (uint32 i=0; i < lostOccupants.size(); i++) {
+        removeTriggerOccupant(colliderEntity, lostOccupants[i]);
+    }
+}
+
 // Report all contacts to the user
 void CollisionDetectionSystem::reportContacts(CollisionCallback& callback, Array<ContactPair>* contactPairs,
                                               Array<ContactManifold>* manifolds, Array<ContactPoint>* contactPoints, Array<ContactPair>& lostContactPairs) {
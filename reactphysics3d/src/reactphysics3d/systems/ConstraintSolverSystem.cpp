@@ -26,6 +26,7 @@
 // Libraries
 #include <reactphysics3d/systems/ConstraintSolverSystem.h>
 #include <reactphysics3d/components/JointComponents.h>
+#include <reactphysics3d/constraint/Joint.h>
 #include <reactphysics3d/components/BallAndSocketJointComponents.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/engine/Island.h>
@@ -33,19 +34,20 @@
 using namespace reactphysics3d;
 
 // Constructor
-ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+ConstraintSolverSystem::ConstraintSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                                TransformComponents& transformComponents,
                                                JointComponents& jointComponents,
                                                BallAndSocketJointComponents& ballAndSocketJointComponents,
                                                FixedJointComponents& fixedJointComponents,
                                                HingeJointComponents& hingeJointComponents,
                                                SliderJointComponents& sliderJointComponents)
-                 : mIsWarmStartingActive(true), mIslands(islands),
+                 : mIsWarmStartingActive(true), mIsArticulationSolverActive(false), mIslands(islands),
                    mConstraintSolverData(rigidBodyComponents, jointComponents),
-                   mSolveBallAndSocketJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, ballAndSocketJointComponents),
-                   mSolveFixedJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, fixedJointComponents),
-                   mSolveHingeJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, hingeJointComponents),
-                   mSolveSliderJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents) {
+                   mSolveBallAndSocketJointSystem(memoryManager, world, rigidBodyComponents, transformComponents, jointComponents, ballAndSocketJointComponents),
+                   mSolveFixedJointSystem(memoryManager, world, rigidBodyComponents, transformComponents, jointComponents, fixedJointComponents),
+                   mSolveHingeJointSystem(memoryManager, world, rigidBodyComponents, transformComponents, jointComponents, hingeJointComponents),
+                   mSolveSliderJointSystem(memoryManager, world, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents),
+                   mArticulationSolverSystem(memoryManager, rigidBodyComponents, ballAndSocketJointComponents, hingeJointComponents) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -82,6 +84,24 @@ void ConstraintSolverSystem::initialize(decimal dt) {
     mSolveHingeJointSystem.initBeforeSolve();
     mSolveSliderJointSystem.initBeforeSolve();
 
+    // Find the joints connected in a tree and factorize their systems
+    if (mIsArticulationSolverActive) {
+        mArticulationSolverSystem.initialize(mSolveBallAndSocketJointSystem.getColoring(), mSolveHingeJointSystem.getColoring());
+    }
+    else {
+        mArticulationSolverSystem.reset();
+    }
+    mSolveBallAndSocketJointSystem.setArticulatedJoints(mArticulationSolverSystem.getArticulatedBallAndSocketJoints());
+    mSolveHingeJointSystem.setArticulatedJoints(mArticulationSolverSystem.getArticulatedHingeJoints());
+
+    warmStart();
+}
+
+// Apply the impulses of the previous substep to the bodies again
+/// With substeps, the joints are initialized once per step and warm started at the
+/// beginning of each substep.
+void ConstraintSolverSystem::warmStart() {
+
     if (mIsWarmStartingActive) {
         mSolveBallAndSocketJointSystem.warmstart();
         mSolveFixedJointSystem.warmstart();
@@ -99,6 +119,11 @@ void ConstraintSolverSystem::solveVelocityConstraints() {
     mSolveFixedJointSystem.solveVelocityConstraint();
     mSolveHingeJointSystem.solveVelocityConstraint();
     mSolveSliderJointSystem.solveVelocityConstraint();
+
+    // The articulations are solved last so that their joints are exactly satisfied after each iteration
+    if (mArticulationSolverSystem.getNbArticulations() > 0) {
+        mArticulationSolverSystem.solveVelocityConstraints();
+    }
 }
 
 // Solve the position constraints
@@ -111,3 +136,44 @@ void ConstraintSolverSystem::solvePositionConstraints() {
     mSolveHingeJointSystem.solvePositionConstraint();
     mSolveSliderJointSystem.solvePositionConstraint();
 }
+
+// Add the enabled joints whose force or torque exceeds their break threshold into an array
+/// The forces and torques are computed from the impulses accumulated by the velocity solver
+/// during the last (sub)step.
+void ConstraintSolverSystem::findBrokenJoints(Array<Entity>& brokenJoints) const {
+
+    RP3D_PROFILE("ConstraintSolverSystem::findBrokenJoints()", mProfiler);
+
+    const JointComponents& jointComponents = mConstraintSolverData.jointComponents;
+
+    const uint32 nbEnabledJoints = jointComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbEnabledJoints; i++) {
+
+        const decimal breakForce = jointComponents.mBreakForces[i];
+        const decimal breakTorque = jointComponents.mBreakTorques[i];
+
+        // Most joints never break
+        if (breakForce == DECIMAL_LARGEST && breakTorque == DECIMAL_LARGEST) continue;
+
+        const Joint* joint = jointComponents.mJoints[i];
+
+        if ((breakForce < DECIMAL_LARGEST && joint->getReactionForce(mTimeStep).lengthSquare() > breakForce * breakForce) ||
+            (breakTorque < DECIMAL_LARGEST && joint->getReactionTorque(mTimeStep).lengthSquare() > breakTorque * breakTorque)) {
+
+            brokenJoints.add(jointComponents.mJointEntities[i]);
+        }
+    }
+}
+
+// Release the memory allocated to solve the constraints
+void ConstraintSolverSystem::reset() {
+
+    mArticulationSolverSystem.reset();
+    mSolveBallAndSocketJointSystem.setArticulatedJoints(nullptr);
+    mSolveHingeJointSystem.setArticulatedJoints(nullptr);
+
+    mSolveBallAndSocketJointSystem.reset();
+    mSolveFixedJointSystem.reset();
+    mSolveHingeJointSystem.reset();
+    mSolveSliderJointSystem.reset();
+}
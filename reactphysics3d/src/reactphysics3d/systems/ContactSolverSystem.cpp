@@ -35,6 +35,7 @@
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/collision/ContactManifold.h>
 #include <algorithm>
+#include <cstring>
 
 using namespace reactphysics3d;
 using namespace std;
@@ -43,6 +44,7 @@ using namespace std;
 const decimal ContactSolverSystem::BETA = decimal(0.2);
 const decimal ContactSolverSystem::BETA_SPLIT_IMPULSE = decimal(0.2);
 const decimal ContactSolverSystem::SLOP = decimal(0.01);
+const uint32 ContactSolverSystem::NB_BATCH_LANES;
 
 // Constructor
 ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands,
@@ -50,6 +52,8 @@ ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWo
                                          ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold)
               :mMemoryManager(memoryManager), mWorld(world), mRestitutionVelocityThreshold(restitutionVelocityThreshold),
                mContactConstraints(nullptr), mContactPoints(nullptr),
+               mContactManifoldBatches(nullptr), mContactPointBatches(nullptr),
+               mNbContactManifoldBatches(0), mNbContactPointBatches(0),
                mIslands(islands), mAllContactManifolds(nullptr), mAllContactPoints(nullptr),
                mBodyComponents(bodyComponents), mRigidBodyComponents(rigidBodyComponents),
                mColliderComponents(colliderComponents), mIsSplitImpulseActive(true) {
@@ -80,6 +84,11 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
     mContactConstraints = nullptr;
     mContactPoints = nullptr;
 
+    mNbContactManifoldBatches = 0;
+    mNbContactPointBatches = 0;
+    mContactManifoldBatches = nullptr;
+    mContactPointBatches = nullptr;
+
     if (nbContactManifolds == 0 || nbContactPoints == 0) return;
 
     mContactPoints = static_cast<ContactPointSolver*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
@@ -101,6 +110,9 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
 
     // Warmstarting
     warmStart();
+
+    // Group the contact manifolds into batches for the solver
+    createBatches();
 }
 
 // Release allocated memory
@@ -108,6 +120,80 @@ void ContactSolverSystem::reset() {
 
     if (mAllContactPoints->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactPoints, sizeof(ContactPointSolver) * mAllContactPoints->size());
     if (mAllContactManifolds->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactConstraints, sizeof(ContactManifoldSolver) * mAllContactManifolds->size());
+    if (mNbContactManifoldBatches > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactManifoldBatches, sizeof(ContactManifoldBatch) * mNbContactManifoldBatches);
+    if (mNbContactPointBatches > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactPointBatches, sizeof(ContactPointBatch) * mNbContactPointBatches);
+}
+
+// Update the penetration depths and warm start the solver at the beginning of a substep
+/// With substeps, the contact constraints are initialized once per step. At the beginning of
+/// each next substep, the penetration depth of the contact points is updated with the motion
+/// of the two points along the contact normal and the impulses of the previous substep are
+/// applied to the bodies again (warm starting).
+void ContactSolverSystem::initializeSubstep() {
+
+    RP3D_PROFILE("ContactSolver::initializeSubstep()", mProfiler);
+
+    const Transform* localToWorldTransforms = mColliderComponents.mLocalToWorldTransforms;
+    Vector3* linearVelocities = mRigidBodyComponents.mConstrainedLinearVelocities;
+    Vector3* angularVelocities = mRigidBodyComponents.mConstrainedAngularVelocities;
+
+    // For each batch of contact manifolds
+    for (uint32 b=0; b < mNbContactManifoldBatches; b++) {
+
+        const ContactManifoldBatch& batch = mContactManifoldBatches[b];
+
+        for (uint32 l=0; l < batch.nbLanes; l++) {
+
+            const ContactManifoldSolver& manifold = mContactConstraints[batch.contactConstraintIndices[l]];
+
+            const Transform& collider1LocalToWorldTransform = localToWorldTransforms[manifold.colliderComponentIndex1];
+            const Transform& collider2LocalToWorldTransform = localToWorldTransforms[manifold.colliderComponentIndex2];
+
+            Vector3& v1 = linearVelocities[manifold.rigidBodyComponentIndexBody1];
+            Vector3& w1 = angularVelocities[manifold.rigidBodyComponentIndexBody1];
+            Vector3& v2 = linearVelocities[manifold.rigidBodyComponentIndexBody2];
+            Vector3& w2 = angularVelocities[manifold.rigidBodyComponentIndexBody2];
+
+            // For each contact point of the manifold
+            for (short int i=0; i < manifold.nbContacts; i++) {
+
+                const ContactPointSolver& contactPoint = mContactPoints[manifold.contactPointsIndex + i];
+                ContactPointBatch& pointBatch = mContactPointBatches[batch.contactPointBatchesIndex + i];
+
+                // Update the penetration depth with the motion of the two contact points along the normal
+                const Vector3 p1 = collider1LocalToWorldTransform * contactPoint.externalContact->getLocalPointOnShape1();
+                const Vector3 p2 = collider2LocalToWorldTransform * contactPoint.externalContact->getLocalPointOnShape2();
+                const decimal penetrationDepth = contactPoint.penetrationDepth + (p1 - p2).dot(contactPoint.normal) - contactPoint.separation;
+                pointBatch.biasPenetrationDepth[l] = computeBiasPenetrationDepth(penetrationDepth);
+                pointBatch.penetrationSplitImpulse[l] = decimal(0.0);
+
+                // The restitution is only applied in the first substep
+                pointBatch.restitutionBias[l] = decimal(0.0);
+
+                // Apply the penetration impulse of the previous substep
+                const decimal penetrationImpulse = pointBatch.penetrationImpulse[l];
+                const Vector3 linearImpulse = contactPoint.normal * penetrationImpulse;
+                v1 -= manifold.massInverseBody1 * linearImpulse * manifold.linearLockAxisFactorBody1;
+                w1 -= contactPoint.i1TimesR1CrossN * manifold.angularLockAxisFactorBody1 * penetrationImpulse;
+                v2 += manifold.massInverseBody2 * linearImpulse * manifold.linearLockAxisFactorBody2;
+                w2 += contactPoint.i2TimesR2CrossN * manifold.angularLockAxisFactorBody2 * penetrationImpulse;
+            }
+
+            // Apply the friction impulses of the previous substep
+            const decimal friction1Impulse = batch.friction1Impulse[l];
+            const decimal friction2Impulse = batch.friction2Impulse[l];
+            const decimal frictionTwistImpulse = batch.frictionTwistImpulse[l];
+            const Vector3 linearImpulseBody2 = manifold.frictionVector1 * friction1Impulse + manifold.frictionVector2 * friction2Impulse;
+            const Vector3 angularImpulseBody1 = -manifold.r1CrossT1 * friction1Impulse - manifold.r1CrossT2 * friction2Impulse -
+                                                manifold.normal * frictionTwistImpulse;
+            const Vector3 angularImpulseBody2 = manifold.r2CrossT1 * friction1Impulse + manifold.r2CrossT2 * friction2Impulse +
+                                                manifold.normal * frictionTwistImpulse;
+            v1 -= manifold.massInverseBody1 * linearImpulseBody2 * manifold.linearLockAxisFactorBody1;
+            w1 += manifold.angularLockAxisFactorBody1 * (manifold.inverseInertiaTensorBody1 * angularImpulseBody1);
+            v2 += manifold.massInverseBody2 * linearImpulseBody2 * manifold.linearLockAxisFactorBody2;
+            w2 += manifold.angularLockAxisFactorBody2 * (manifold.inverseInertiaTensorBody2 * angularImpulseBody2);
+        }
+    }
 }
 
 // Initialize the constraint solver for a given island
@@ -145,6 +231,8 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
         new (mContactConstraints + mNbContactManifolds) ContactManifoldSolver();
         mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody1 = rigidBodyIndex1;
         mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody2 = rigidBodyIndex2;
+        mContactConstraints[mNbContactManifolds].colliderComponentIndex1 = collider1Index;
+        mContactConstraints[mNbContactManifolds].colliderComponentIndex2 = collider2Index;
         mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex1];
         mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex2];
         mContactConstraints[mNbContactManifolds].massInverseBody1 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex1];
@@ -154,6 +242,7 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
         mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody1 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex1];
         mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody2 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex2];
         mContactConstraints[mNbContactManifolds].nbContacts = externalManifold.nbContactPoints;
+        mContactConstraints[mNbContactManifolds].contactPointsIndex = mNbContactPoints;
         mContactConstraints[mNbContactManifolds].frictionCoefficient = computeMixedFrictionCoefficient(mColliderComponents.mMaterials[collider1Index], mColliderComponents.mMaterials[collider2Index]);
         mContactConstraints[mNbContactManifolds].externalContactManifold = &externalManifold;
         mContactConstraints[mNbContactManifolds].normal.setToZero();
@@ -192,6 +281,7 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
             mContactPoints[mNbContactPoints].r2.y = p2.y - x2.y;
             mContactPoints[mNbContactPoints].r2.z = p2.z - x2.z;
             mContactPoints[mNbContactPoints].penetrationDepth = externalContact.getPenetrationDepth();
+            mContactPoints[mNbContactPoints].separation = (p1 - p2).dot(externalContact.getNormal());
             mContactPoints[mNbContactPoints].isRestingContact = externalContact.getIsRestingContact();
             externalContact.setIsRestingContact(true);
             mContactPoints[mNbContactPoints].penetrationImpulse = externalContact.getPenetrationImpulse();
@@ -478,286 +568,532 @@ void ContactSolverSystem::warmStart() {
     }
 }
 
-// Solve the contacts
-void ContactSolverSystem::solve() {
+// Color the contact manifolds and group them into batches
+/// The color of a contact manifold is one more than the highest color of the previous
+/// manifolds that share a dynamic body with it. Therefore, two manifolds of the same color
+/// never share a dynamic body and two manifolds that share a dynamic body are solved in the
+/// same order as in the contact manifolds array. Solving the colors one after the other
+/// gives exactly the same result as solving the manifolds sequentially. The manifolds of a
+/// color are grouped into batches of NB_BATCH_LANES manifolds that are solved together.
+void ContactSolverSystem::createBatches() {
 
-    RP3D_PROFILE("ContactSolverSystem::solve()", mProfiler);
+    RP3D_PROFILE("ContactSolver::createBatches()", mProfiler);
 
-    decimal deltaLambda;
-    decimal lambdaTemp;
-    uint32 contactPointIndex = 0;
+    assert(mNbContactManifolds > 0);
 
-    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+    const uint32 nbRigidBodies = mRigidBodyComponents.getNbComponents();
 
-    // For each contact manifold
-    for (uint32 c=0; c<mNbContactManifolds; c++) {
+    // Number of colors already used by the contact manifolds of each body
+    uint32* bodiesNbColors = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                          sizeof(uint32) * nbRigidBodies));
+    std::memset(bodiesNbColors, 0, sizeof(uint32) * nbRigidBodies);
+
+    // Color of each contact manifold and number of manifolds of each color (there
+    // are at most as many colors as contact manifolds)
+    uint32* manifoldsColors = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                           sizeof(uint32) * mNbContactManifolds));
+    uint32* colorsStartIndex = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                            sizeof(uint32) * mNbContactManifolds));
+    std::memset(colorsStartIndex, 0, sizeof(uint32) * mNbContactManifolds);
+    uint32 nbColors = 0;
 
-        decimal sumPenetrationImpulse = 0.0;
+    // For each contact manifold
+    for (uint32 c=0; c < mNbContactManifolds; c++) {
 
         const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
         const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
 
-        // Get the constrained velocities
-        const Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index];
-        const Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index];
-        const Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index];
-        const Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index];
+        // Static and kinematic bodies are not modified by the solver and can be shared in a batch
+        const bool isBody1Dynamic = mRigidBodyComponents.mBodyTypes[rigidBody1Index] == BodyType::DYNAMIC;
+        const bool isBody2Dynamic = mRigidBodyComponents.mBodyTypes[rigidBody2Index] == BodyType::DYNAMIC;
 
-        for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
+        const uint32 color = std::max(isBody1Dynamic ? bodiesNbColors[rigidBody1Index] : 0,
+                                      isBody2Dynamic ? bodiesNbColors[rigidBody2Index] : 0);
+        if (isBody1Dynamic) bodiesNbColors[rigidBody1Index] = color + 1;
+        if (isBody2Dynamic) bodiesNbColors[rigidBody2Index] = color + 1;
+
+        manifoldsColors[c] = color;
+        colorsStartIndex[color]++;
+        nbColors = std::max(nbColors, color + 1);
+    }
+
+    // Compute the number of batches and the index of the first manifold of each color
+    // in the sorted manifolds array
+    uint32 startIndex = 0;
+    for (uint32 color=0; color < nbColors; color++) {
+
+        const uint32 nbManifolds = colorsStartIndex[color];
+        mNbContactManifoldBatches += (nbManifolds + NB_BATCH_LANES - 1) / NB_BATCH_LANES;
+
+        colorsStartIndex[color] = startIndex;
+        startIndex += nbManifolds;
+    }
+
+    // Sort the manifolds by color (the manifolds of a color keep their order)
+    uint32* sortedManifolds = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                           sizeof(uint32) * mNbContactManifolds));
+    for (uint32 c=0; c < mNbContactManifolds; c++) {
+        sortedManifolds[colorsStartIndex[manifoldsColors[c]]++] = c;
+    }
+
+    mContactManifoldBatches = static_cast<ContactManifoldBatch*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                                         sizeof(ContactManifoldBatch) * mNbContactManifoldBatches));
+    assert(mContactManifoldBatches != nullptr);
+
+    // The unused lanes of the batches are left to zero so that they do not apply any impulse
+    std::memset(mContactManifoldBatches, 0, sizeof(ContactManifoldBatch) * mNbContactManifoldBatches);
+
+    // Assign the manifolds to the lanes of the batches (after the sort, colorsStartIndex
+    // contains the index of the end of each color)
+    uint32 batchIndex = 0;
+    startIndex = 0;
+    for (uint32 color=0; color < nbColors; color++) {
+
+        const uint32 endIndex = colorsStartIndex[color];
+        for (uint32 m=startIndex; m < endIndex; m += NB_BATCH_LANES) {
+
+            ContactManifoldBatch& batch = mContactManifoldBatches[batchIndex];
+            batch.nbLanes = std::min(NB_BATCH_LANES, endIndex - m);
+            batch.contactPointBatchesIndex = mNbContactPointBatches;
+
+            for (uint32 l=0; l < batch.nbLanes; l++) {
+
+                const uint32 contactConstraintIndex = sortedManifolds[m + l];
+                batch.contactConstraintIndices[l] = contactConstraintIndex;
+                batch.nbContactPointBatches = std::max(batch.nbContactPointBatches,
+                                                       static_cast<uint32>(mContactConstraints[contactConstraintIndex].nbContacts));
+            }
+
+            mNbContactPointBatches += batch.nbContactPointBatches;
+            batchIndex++;
+        }
+
+        startIndex = endIndex;
+    }
+    assert(batchIndex == mNbContactManifoldBatches);
+
+    mContactPointBatches = static_cast<ContactPointBatch*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                                   sizeof(ContactPointBatch) * mNbContactPointBatches));
+    assert(mContactPointBatches != nullptr);
+    std::memset(mContactPointBatches, 0, sizeof(ContactPointBatch) * mNbContactPointBatches);
+
+    // Copy the data of the contact manifolds into the lanes of the batches
+    for (uint32 b=0; b < mNbContactManifoldBatches; b++) {
+        for (uint32 l=0; l < mContactManifoldBatches[b].nbLanes; l++) {
+            initializeBatchLane(mContactManifoldBatches[b], l, mContactManifoldBatches[b].contactConstraintIndices[l]);
+        }
+    }
+
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, sortedManifolds, sizeof(uint32) * mNbContactManifolds);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, colorsStartIndex, sizeof(uint32) * mNbContactManifolds);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, manifoldsColors, sizeof(uint32) * mNbContactManifolds);
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, bodiesNbColors, sizeof(uint32) * nbRigidBodies);
+}
+
+// Initialize a lane of a batch with a contact manifold
+void ContactSolverSystem::initializeBatchLane(ContactManifoldBatch& batch, uint32 lane, uint32 contactConstraintIndex) {
+
+    const ContactManifoldSolver& manifold = mContactConstraints[contactConstraintIndex];
+
+    batch.rigidBodyComponentIndexBody1[lane] = manifold.rigidBodyComponentIndexBody1;
+    batch.rigidBodyComponentIndexBody2[lane] = manifold.rigidBodyComponentIndexBody2;
+    batch.massInverseBody1[lane] = manifold.massInverseBody1;
+    batch.massInverseBody2[lane] = manifold.massInverseBody2;
+    batch.linearLockAxisFactorBody1.x[lane] = manifold.linearLockAxisFactorBody1.x;
+    batch.linearLockAxisFactorBody1.y[lane] = manifold.linearLockAxisFactorBody1.y;
+    batch.linearLockAxisFactorBody1.z[lane] = manifold.linearLockAxisFactorBody1.z;
+    batch.linearLockAxisFactorBody2.x[lane] = manifold.linearLockAxisFactorBody2.x;
+    batch.linearLockAxisFactorBody2.y[lane] = manifold.linearLockAxisFactorBody2.y;
+    batch.linearLockAxisFactorBody2.z[lane] = manifold.linearLockAxisFactorBody2.z;
+    batch.angularLockAxisFactorBody1.x[lane] = manifold.angularLockAxisFactorBody1.x;
+    batch.angularLockAxisFactorBody1.y[lane] = manifold.angularLockAxisFactorBody1.y;
+    batch.angularLockAxisFactorBody1.z[lane] = manifold.angularLockAxisFactorBody1.z;
+    batch.angularLockAxisFactorBody2.x[lane] = manifold.angularLockAxisFactorBody2.x;
+    batch.angularLockAxisFactorBody2.y[lane] = manifold.angularLockAxisFactorBody2.y;
+    batch.angularLockAxisFactorBody2.z[lane] = manifold.angularLockAxisFactorBody2.z;
+    for (int i=0; i < 3; i++) {
+        for (int j=0; j < 3; j++) {
+            batch.inverseInertiaTensorBody1.m[i][j][lane] = manifold.inverseInertiaTensorBody1[i][j];
+            batch.inverseInertiaTensorBody2.m[i][j][lane] = manifold.inverseInertiaTensorBody2[i][j];
+        }
+    }
+    batch.frictionCoefficient[lane] = manifold.frictionCoefficient;
+    batch.normal.x[lane] = manifold.normal.x;
+    batch.normal.y[lane] = manifold.normal.y;
+    batch.normal.z[lane] = manifold.normal.z;
+    batch.r1Friction.x[lane] = manifold.r1Friction.x;
+    batch.r1Friction.y[lane] = manifold.r1Friction.y;
+    batch.r1Friction.z[lane] = manifold.r1Friction.z;
+    batch.r2Friction.x[lane] = manifold.r2Friction.x;
+    batch.r2Friction.y[lane] = manifold.r2Friction.y;
+    batch.r2Friction.z[lane] = manifold.r2Friction.z;
+    batch.r1CrossT1.x[lane] = manifold.r1CrossT1.x;
+    batch.r1CrossT1.y[lane] = manifold.r1CrossT1.y;
+    batch.r1CrossT1.z[lane] = manifold.r1CrossT1.z;
+    batch.r1CrossT2.x[lane] = manifold.r1CrossT2.x;
+    batch.r1CrossT2.y[lane] = manifold.r1CrossT2.y;
+    batch.r1CrossT2.z[lane] = manifold.r1CrossT2.z;
+    batch.r2CrossT1.x[lane] = manifold.r2CrossT1.x;
+    batch.r2CrossT1.y[lane] = manifold.r2CrossT1.y;
+    batch.r2CrossT1.z[lane] = manifold.r2CrossT1.z;
+    batch.r2CrossT2.x[lane] = manifold.r2CrossT2.x;
+    batch.r2CrossT2.y[lane] = manifold.r2CrossT2.y;
+    batch.r2CrossT2.z[lane] = manifold.r2CrossT2.z;
+    batch.frictionVector1.x[lane] = manifold.frictionVector1.x;
+    batch.frictionVector1.y[lane] = manifold.frictionVector1.y;
+    batch.frictionVector1.z[lane] = manifold.frictionVector1.z;
+    batch.frictionVector2.x[lane] = manifold.frictionVector2.x;
+    batch.frictionVector2.y[lane] = manifold.frictionVector2.y;
+    batch.frictionVector2.z[lane] = manifold.frictionVector2.z;
+    batch.inverseFriction1Mass[lane] = manifold.inverseFriction1Mass;
+    batch.inverseFriction2Mass[lane] = manifold.inverseFriction2Mass;
+    batch.inverseTwistFrictionMass[lane] = manifold.inverseTwistFrictionMass;
+    batch.friction1Impulse[lane] = manifold.friction1Impulse;
+    batch.friction2Impulse[lane] = manifold.friction2Impulse;
+    batch.frictionTwistImpulse[lane] = manifold.frictionTwistImpulse;
+
+    // For each contact point of the manifold
+    for (short int i=0; i < manifold.nbContacts; i++) {
+
+        const ContactPointSolver& contactPoint = mContactPoints[manifold.contactPointsIndex + i];
+        ContactPointBatch& pointBatch = mContactPointBatches[batch.contactPointBatchesIndex + i];
+
+        pointBatch.normal.x[lane] = contactPoint.normal.x;
+        pointBatch.normal.y[lane] = contactPoint.normal.y;
+        pointBatch.normal.z[lane] = contactPoint.normal.z;
+        pointBatch.r1.x[lane] = contactPoint.r1.x;
+        pointBatch.r1.y[lane] = contactPoint.r1.y;
+        pointBatch.r1.z[lane] = contactPoint.r1.z;
+        pointBatch.r2.x[lane] = contactPoint.r2.x;
+        pointBatch.r2.y[lane] = contactPoint.r2.y;
+        pointBatch.r2.z[lane] = contactPoint.r2.z;
+        pointBatch.i1TimesR1CrossN.x[lane] = contactPoint.i1TimesR1CrossN.x;
+        pointBatch.i1TimesR1CrossN.y[lane] = contactPoint.i1TimesR1CrossN.y;
+        pointBatch.i1TimesR1CrossN.z[lane] = contactPoint.i1TimesR1CrossN.z;
+        pointBatch.i2TimesR2CrossN.x[lane] = contactPoint.i2TimesR2CrossN.x;
+        pointBatch.i2TimesR2CrossN.y[lane] = contactPoint.i2TimesR2CrossN.y;
+        pointBatch.i2TimesR2CrossN.z[lane] = contactPoint.i2TimesR2CrossN.z;
+
+        // Compute the bias "b" of the penetration constraint
+        pointBatch.biasPenetrationDepth[lane] = computeBiasPenetrationDepth(contactPoint.penetrationDepth);
+
+        pointBatch.restitutionBias[lane] = contactPoint.restitutionBias;
+        pointBatch.inversePenetrationMass[lane] = contactPoint.inversePenetrationMass;
+        pointBatch.penetrationImpulse[lane] = contactPoint.penetrationImpulse;
+        pointBatch.penetrationSplitImpulse[lane] = contactPoint.penetrationSplitImpulse;
+    }
+}
+
+// Solve the contacts
+/// If useBias is false (relax iteration of a substep), the penetration depth is not corrected: the
+/// penetration bias is not added to the velocity constraint and the split impulses are not solved.
+void ContactSolverSystem::solve(bool useBias) {
+
+    RP3D_PROFILE("ContactSolverSystem::solve()", mProfiler);
+
+    const bool isSplitImpulseActive = mIsSplitImpulseActive && useBias;
+
+    // Without split impulses, the penetration depth bias is added to the velocity constraint
+    const decimal biasPenetrationDepthFactor = (mIsSplitImpulseActive || !useBias) ? decimal(0.0) : decimal(1.0);
+
+    Vector3* linearVelocities = mRigidBodyComponents.mConstrainedLinearVelocities;
+    Vector3* angularVelocities = mRigidBodyComponents.mConstrainedAngularVelocities;
+    Vector3* splitLinearVelocities = mRigidBodyComponents.mSplitLinearVelocities;
+    Vector3* splitAngularVelocities = mRigidBodyComponents.mSplitAngularVelocities;
+
+    // For each batch of contact manifolds
+    for (uint32 b=0; b < mNbContactManifoldBatches; b++) {
+
+        ContactManifoldBatch& batch = mContactManifoldBatches[b];
+        const uint32 nbLanes = batch.nbLanes;
+
+        // Gather the constrained velocities of the bodies (the unused lanes stay to zero)
+        Vector3Lanes v1, w1, v2, w2;
+        std::memset(&v1, 0, sizeof(Vector3Lanes));
+        std::memset(&w1, 0, sizeof(Vector3Lanes));
+        std::memset(&v2, 0, sizeof(Vector3Lanes));
+        std::memset(&w2, 0, sizeof(Vector3Lanes));
+        for (uint32 l=0; l < nbLanes; l++) {
+
+            const Vector3& linearVelocity1 = linearVelocities[batch.rigidBodyComponentIndexBody1[l]];
+            const Vector3& angularVelocity1 = angularVelocities[batch.rigidBodyComponentIndexBody1[l]];
+            const Vector3& linearVelocity2 = linearVelocities[batch.rigidBodyComponentIndexBody2[l]];
+            const Vector3& angularVelocity2 = angularVelocities[batch.rigidBodyComponentIndexBody2[l]];
+            v1.x[l] = linearVelocity1.x; v1.y[l] = linearVelocity1.y; v1.z[l] = linearVelocity1.z;
+            w1.x[l] = angularVelocity1.x; w1.y[l] = angularVelocity1.y; w1.z[l] = angularVelocity1.z;
+            v2.x[l] = linearVelocity2.x; v2.y[l] = linearVelocity2.y; v2.z[l] = linearVelocity2.z;
+            w2.x[l] = angularVelocity2.x; w2.y[l] = angularVelocity2.y; w2.z[l] = angularVelocity2.z;
+        }
+
+        // Gather the split velocities of the bodies
+        Vector3Lanes v1Split, w1Split, v2Split, w2Split;
+        if (isSplitImpulseActive) {
+
+            std::memset(&v1Split, 0, sizeof(Vector3Lanes));
+            std::memset(&w1Split, 0, sizeof(Vector3Lanes));
+            std::memset(&v2Split, 0, sizeof(Vector3Lanes));
+            std::memset(&w2Split, 0, sizeof(Vector3Lanes));
+            for (uint32 l=0; l < nbLanes; l++) {
+
+                const Vector3& linearVelocity1 = splitLinearVelocities[batch.rigidBodyComponentIndexBody1[l]];
+                const Vector3& angularVelocity1 = splitAngularVelocities[batch.rigidBodyComponentIndexBody1[l]];
+                const Vector3& linearVelocity2 = splitLinearVelocities[batch.rigidBodyComponentIndexBody2[l]];
+                const Vector3& angularVelocity2 = splitAngularVelocities[batch.rigidBodyComponentIndexBody2[l]];
+                v1Split.x[l] = linearVelocity1.x; v1Split.y[l] = linearVelocity1.y; v1Split.z[l] = linearVelocity1.z;
+                w1Split.x[l] = angularVelocity1.x; w1Split.y[l] = angularVelocity1.y; w1Split.z[l] = angularVelocity1.z;
+                v2Split.x[l] = linearVelocity2.x; v2Split.y[l] = linearVelocity2.y; v2Split.z[l] = linearVelocity2.z;
+                w2Split.x[l] = angularVelocity2.x; w2Split.y[l] = angularVelocity2.y; w2Split.z[l] = angularVelocity2.z;
+            }
+        }
+
+        decimal sumPenetrationImpulse[NB_BATCH_LANES];
+        for (uint32 l=0; l < NB_BATCH_LANES; l++) {
+            sumPenetrationImpulse[l] = decimal(0.0);
+        }
+
+        // For each contact point of the manifolds
+        for (uint32 p=0; p < batch.nbContactPointBatches; p++) {
+
+            ContactPointBatch& points = mContactPointBatches[batch.contactPointBatchesIndex + p];
 
             // --------- Penetration --------- //
 
-            // Compute J*v
-            //Vector3 deltaV = v2 + w2.cross(mContactPoints[contactPointIndex].r2) - v1 - w1.cross(mContactPoints[contactPointIndex].r1);
-            Vector3 deltaV(v2.x + w2.y * mContactPoints[contactPointIndex].r2.z - w2.z * mContactPoints[contactPointIndex].r2.y - v1.x -
-                           w1.y * mContactPoints[contactPointIndex].r1.z + w1.z * mContactPoints[contactPointIndex].r1.y,
-                           v2.y + w2.z * mContactPoints[contactPointIndex].r2.x - w2.x * mContactPoints[contactPointIndex].r2.z - v1.y -
-                           w1.z * mContactPoints[contactPointIndex].r1.x + w1.x * mContactPoints[contactPointIndex].r1.z,
-                           v2.z + w2.x * mContactPoints[contactPointIndex].r2.y - w2.y * mContactPoints[contactPointIndex].r2.x - v1.z -
-                           w1.x * mContactPoints[contactPointIndex].r1.y + w1.y * mContactPoints[contactPointIndex].r1.x);
-            decimal deltaVDotN = deltaV.x * mContactPoints[contactPointIndex].normal.x + deltaV.y * mContactPoints[contactPointIndex].normal.y +
-                                 deltaV.z * mContactPoints[contactPointIndex].normal.z;
-            decimal Jv = deltaVDotN;
-
-            // Compute the bias "b" of the constraint
-            decimal biasPenetrationDepth = 0.0;
-            if (mContactPoints[contactPointIndex].penetrationDepth > SLOP) {
-                biasPenetrationDepth = -(beta/mTimeStep) * std::max(0.0f, float(mContactPoints[contactPointIndex].penetrationDepth - SLOP));
+            // The new accumulated impulses are computed in local arrays (that cannot alias the
+            // batches data) and copied back after the loop so that the loop can be vectorized
+            decimal penetrationImpulse[NB_BATCH_LANES];
+
+            for (uint32 l=0; l < NB_BATCH_LANES; l++) {
+
+                // Compute J*v
+                //Vector3 deltaV = v2 + w2.cross(r2) - v1 - w1.cross(r1);
+                const decimal deltaVX = v2.x[l] + w2.y[l] * points.r2.z[l] - w2.z[l] * points.r2.y[l] - v1.x[l] -
+                                        w1.y[l] * points.r1.z[l] + w1.z[l] * points.r1.y[l];
+                const decimal deltaVY = v2.y[l] + w2.z[l] * points.r2.x[l] - w2.x[l] * points.r2.z[l] - v1.y[l] -
+                                        w1.z[l] * points.r1.x[l] + w1.x[l] * points.r1.z[l];
+                const decimal deltaVZ = v2.z[l] + w2.x[l] * points.r2.y[l] - w2.y[l] * points.r2.x[l] - v1.z[l] -
+                                        w1.x[l] * points.r1.y[l] + w1.y[l] * points.r1.x[l];
+                const decimal Jv = deltaVX * points.normal.x[l] + deltaVY * points.normal.y[l] + deltaVZ * points.normal.z[l];
+
+                // Compute the Lagrange multiplier lambda
+                const decimal b = points.restitutionBias[l] + biasPenetrationDepthFactor * points.biasPenetrationDepth[l];
+                decimal deltaLambda = - (Jv + b) * points.inversePenetrationMass[l];
+                const decimal lambdaTemp = points.penetrationImpulse[l];
+                penetrationImpulse[l] = std::max(lambdaTemp + deltaLambda, decimal(0.0));
+                deltaLambda = penetrationImpulse[l] - lambdaTemp;
+
+                const decimal linearImpulseX = points.normal.x[l] * deltaLambda;
+                const decimal linearImpulseY = points.normal.y[l] * deltaLambda;
+                const decimal linearImpulseZ = points.normal.z[l] * deltaLambda;
+
+                // Update the velocities of the body 1 by applying the impulse P
+                v1.x[l] -= batch.massInverseBody1[l] * linearImpulseX * batch.linearLockAxisFactorBody1.x[l];
+                v1.y[l] -= batch.massInverseBody1[l] * linearImpulseY * batch.linearLockAxisFactorBody1.y[l];
+                v1.z[l] -= batch.massInverseBody1[l] * linearImpulseZ * batch.linearLockAxisFactorBody1.z[l];
+                w1.x[l] -= points.i1TimesR1CrossN.x[l] * batch.angularLockAxisFactorBody1.x[l] * deltaLambda;
+                w1.y[l] -= points.i1TimesR1CrossN.y[l] * batch.angularLockAxisFactorBody1.y[l] * deltaLambda;
+                w1.z[l] -= points.i1TimesR1CrossN.z[l] * batch.angularLockAxisFactorBody1.z[l] * deltaLambda;
+
+                // Update the velocities of the body 2 by applying the impulse P
+                v2.x[l] += batch.massInverseBody2[l] * linearImpulseX * batch.linearLockAxisFactorBody2.x[l];
+                v2.y[l] += batch.massInverseBody2[l] * linearImpulseY * batch.linearLockAxisFactorBody2.y[l];
+                v2.z[l] += batch.massInverseBody2[l] * linearImpulseZ * batch.linearLockAxisFactorBody2.z[l];
+                w2.x[l] += points.i2TimesR2CrossN.x[l] * batch.angularLockAxisFactorBody2.x[l] * deltaLambda;
+                w2.y[l] += points.i2TimesR2CrossN.y[l] * batch.angularLockAxisFactorBody2.y[l] * deltaLambda;
+                w2.z[l] += points.i2TimesR2CrossN.z[l] * batch.angularLockAxisFactorBody2.z[l] * deltaLambda;
+
+                sumPenetrationImpulse[l] += penetrationImpulse[l];
             }
-            decimal b = biasPenetrationDepth + mContactPoints[contactPointIndex].restitutionBias;
 
-            // Compute the Lagrange multiplier lambda
-            if (mIsSplitImpulseActive) {
-                deltaLambda = - (Jv + mContactPoints[contactPointIndex].restitutionBias) *
-                        mContactPoints[contactPointIndex].inversePenetrationMass;
+            std::memcpy(points.penetrationImpulse, penetrationImpulse, sizeof(penetrationImpulse));
+
+            // If the split impulse position correction is active
+            if (isSplitImpulseActive) {
+
+                decimal penetrationSplitImpulse[NB_BATCH_LANES];
+
+                for (uint32 l=0; l < NB_BATCH_LANES; l++) {
+
+                    // Split impulse (position correction)
+                    //Vector3 deltaVSplit = v2Split + w2Split.cross(r2) - v1Split - w1Split.cross(r1);
+                    const decimal deltaVSplitX = v2Split.x[l] + w2Split.y[l] * points.r2.z[l] - w2Split.z[l] * points.r2.y[l] - v1Split.x[l] -
+                                                 w1Split.y[l] * points.r1.z[l] + w1Split.z[l] * points.r1.y[l];
+                    const decimal deltaVSplitY = v2Split.y[l] + w2Split.z[l] * points.r2.x[l] - w2Split.x[l] * points.r2.z[l] - v1Split.y[l] -
+                                                 w1Split.z[l] * points.r1.x[l] + w1Split.x[l] * points.r1.z[l];
+                    const decimal deltaVSplitZ = v2Split.z[l] + w2Split.x[l] * points.r2.y[l] - w2Split.y[l] * points.r2.x[l] - v1Split.z[l] -
+                                                 w1Split.x[l] * points.r1.y[l] + w1Split.y[l] * points.r1.x[l];
+                    const decimal JvSplit = deltaVSplitX * points.normal.x[l] + deltaVSplitY * points.normal.y[l] +
+                                            deltaVSplitZ * points.normal.z[l];
+                    decimal deltaLambdaSplit = - (JvSplit + points.biasPenetrationDepth[l]) * points.inversePenetrationMass[l];
+                    const decimal lambdaTempSplit = points.penetrationSplitImpulse[l];
+                    penetrationSplitImpulse[l] = std::max(lambdaTempSplit + deltaLambdaSplit, decimal(0.0));
+                    deltaLambdaSplit = penetrationSplitImpulse[l] - lambdaTempSplit;
+
+                    const decimal linearImpulseX = points.normal.x[l] * deltaLambdaSplit;
+                    const decimal linearImpulseY = points.normal.y[l] * deltaLambdaSplit;
+                    const decimal linearImpulseZ = points.normal.z[l] * deltaLambdaSplit;
+
+                    // Update the velocities of the body 1 by applying the impulse P
+                    v1Split.x[l] -= batch.massInverseBody1[l] * linearImpulseX * batch.linearLockAxisFactorBody1.x[l];
+                    v1Split.y[l] -= batch.massInverseBody1[l] * linearImpulseY * batch.linearLockAxisFactorBody1.y[l];
+                    v1Split.z[l] -= batch.massInverseBody1[l] * linearImpulseZ * batch.linearLockAxisFactorBody1.z[l];
+                    w1Split.x[l] -= points.i1TimesR1CrossN.x[l] * batch.angularLockAxisFactorBody1.x[l] * deltaLambdaSplit;
+                    w1Split.y[l] -= points.i1TimesR1CrossN.y[l] * batch.angularLockAxisFactorBody1.y[l] * deltaLambdaSplit;
+                    w1Split.z[l] -= points.i1TimesR1CrossN.z[l] * batch.angularLockAxisFactorBody1.z[l] * deltaLambdaSplit;
+
+                    // Update the velocities of the body 2 by applying the impulse P
+                    v2Split.x[l] += batch.massInverseBody2[l] * linearImpulseX * batch.linearLockAxisFactorBody2.x[l];
+                    v2Split.y[l] += batch.massInverseBody2[l] * linearImpulseY * batch.linearLockAxisFactorBody2.y[l];
+                    v2Split.z[l] += batch.massInverseBody2[l] * linearImpulseZ * batch.linearLockAxisFactorBody2.z[l];
+                    w2Split.x[l] += points.i2TimesR2CrossN.x[l] * batch.angularLockAxisFactorBody2.x[l] * deltaLambdaSplit;
+                    w2Split.y[l] += points.i2TimesR2CrossN.y[l] * batch.angularLockAxisFactorBody2.y[l] * deltaLambdaSplit;
+                    w2Split.z[l] += points.i2TimesR2CrossN.z[l] * batch.angularLockAxisFactorBody2.z[l] * deltaLambdaSplit;
+                }
+
+                std::memcpy(points.penetrationSplitImpulse, penetrationSplitImpulse, sizeof(penetrationSplitImpulse));
             }
-            else {
-                deltaLambda = - (Jv + b) * mContactPoints[contactPointIndex].inversePenetrationMass;
+        }
+
+        // ------ First and second friction constraints at the center of the contact manifold ------ //
+
+        for (int f=0; f < 2; f++) {
+
+            const Vector3Lanes& frictionVector = f == 0 ? batch.frictionVector1 : batch.frictionVector2;
+            const Vector3Lanes& r1CrossT = f == 0 ? batch.r1CrossT1 : batch.r1CrossT2;
+            const Vector3Lanes& r2CrossT = f == 0 ? batch.r2CrossT1 : batch.r2CrossT2;
+            const decimal* inverseFrictionMass = f == 0 ? batch.inverseFriction1Mass : batch.inverseFriction2Mass;
+            decimal* frictionImpulse = f == 0 ? batch.friction1Impulse : batch.friction2Impulse;
+            decimal newFrictionImpulse[NB_BATCH_LANES];
+
+            for (uint32 l=0; l < NB_BATCH_LANES; l++) {
+
+                // Compute J*v
+                // deltaV = v2 + w2.cross(r2Friction) - v1 - w1.cross(r1Friction);
+                const decimal deltaVX = v2.x[l] + w2.y[l] * batch.r2Friction.z[l] - w2.z[l] * batch.r2Friction.y[l] - v1.x[l] -
+                                        w1.y[l] * batch.r1Friction.z[l] + w1.z[l] * batch.r1Friction.y[l];
+                const decimal deltaVY = v2.y[l] + w2.z[l] * batch.r2Friction.x[l] - w2.x[l] * batch.r2Friction.z[l] - v1.y[l] -
+                                        w1.z[l] * batch.r1Friction.x[l] + w1.x[l] * batch.r1Friction.z[l];
+                const decimal deltaVZ = v2.z[l] + w2.x[l] * batch.r2Friction.y[l] - w2.y[l] * batch.r2Friction.x[l] - v1.z[l] -
+                                        w1.x[l] * batch.r1Friction.y[l] + w1.y[l] * batch.r1Friction.x[l];
+                const decimal Jv = deltaVX * frictionVector.x[l] + deltaVY * frictionVector.y[l] + deltaVZ * frictionVector.z[l];
+
+                // Compute the Lagrange multiplier lambda
+                decimal deltaLambda = -Jv * inverseFrictionMass[l];
+                const decimal frictionLimit = batch.frictionCoefficient[l] * sumPenetrationImpulse[l];
+                const decimal lambdaTemp = frictionImpulse[l];
+                newFrictionImpulse[l] = std::max(-frictionLimit, std::min(lambdaTemp + deltaLambda, frictionLimit));
+                deltaLambda = newFrictionImpulse[l] - lambdaTemp;
+
+                // Compute the impulse P=J^T * lambda
+                const decimal angularImpulseBody1X = -r1CrossT.x[l] * deltaLambda;
+                const decimal angularImpulseBody1Y = -r1CrossT.y[l] * deltaLambda;
+                const decimal angularImpulseBody1Z = -r1CrossT.z[l] * deltaLambda;
+                const decimal linearImpulseBody2X = frictionVector.x[l] * deltaLambda;
+                const decimal linearImpulseBody2Y = frictionVector.y[l] * deltaLambda;
+                const decimal linearImpulseBody2Z = frictionVector.z[l] * deltaLambda;
+                const decimal angularImpulseBody2X = r2CrossT.x[l] * deltaLambda;
+                const decimal angularImpulseBody2Y = r2CrossT.y[l] * deltaLambda;
+                const decimal angularImpulseBody2Z = r2CrossT.z[l] * deltaLambda;
+
+                // Update the velocities of the body 1 by applying the impulse P
+                v1.x[l] -= batch.massInverseBody1[l] * linearImpulseBody2X * batch.linearLockAxisFactorBody1.x[l];
+                v1.y[l] -= batch.massInverseBody1[l] * linearImpulseBody2Y * batch.linearLockAxisFactorBody1.y[l];
+                v1.z[l] -= batch.massInverseBody1[l] * linearImpulseBody2Z * batch.linearLockAxisFactorBody1.z[l];
+
+                const decimal (&i1)[3][3][NB_BATCH_LANES] = batch.inverseInertiaTensorBody1.m;
+                w1.x[l] += batch.angularLockAxisFactorBody1.x[l] * (i1[0][0][l] * angularImpulseBody1X + i1[0][1][l] * angularImpulseBody1Y + i1[0][2][l] * angularImpulseBody1Z);
+                w1.y[l] += batch.angularLockAxisFactorBody1.y[l] * (i1[1][0][l] * angularImpulseBody1X + i1[1][1][l] * angularImpulseBody1Y + i1[1][2][l] * angularImpulseBody1Z);
+                w1.z[l] += batch.angularLockAxisFactorBody1.z[l] * (i1[2][0][l] * angularImpulseBody1X + i1[2][1][l] * angularImpulseBody1Y + i1[2][2][l] * angularImpulseBody1Z);
+
+                // Update the velocities of the body 2 by applying the impulse P
+                v2.x[l] += batch.massInverseBody2[l] * linearImpulseBody2X * batch.linearLockAxisFactorBody2.x[l];
+                v2.y[l] += batch.massInverseBody2[l] * linearImpulseBody2Y * batch.linearLockAxisFactorBody2.y[l];
+                v2.z[l] += batch.massInverseBody2[l] * linearImpulseBody2Z * batch.linearLockAxisFactorBody2.z[l];
+
+                const decimal (&i2)[3][3][NB_BATCH_LANES] = batch.inverseInertiaTensorBody2.m;
+                w2.x[l] += batch.angularLockAxisFactorBody2.x[l] * (i2[0][0][l] * angularImpulseBody2X + i2[0][1][l] * angularImpulseBody2Y + i2[0][2][l] * angularImpulseBody2Z);
+                w2.y[l] += batch.angularLockAxisFactorBody2.y[l] * (i2[1][0][l] * angularImpulseBody2X + i2[1][1][l] * angularImpulseBody2Y + i2[1][2][l] * angularImpulseBody2Z);
+                w2.z[l] += batch.angularLockAxisFactorBody2.z[l] * (i2[2][0][l] * angularImpulseBody2X + i2[2][1][l] * angularImpulseBody2Y + i2[2][2][l] * angularImpulseBody2Z);
             }
-            lambdaTemp = mContactPoints[contactPointIndex].penetrationImpulse;
-            mContactPoints[contactPointIndex].penetrationImpulse = std::max(mContactPoints[contactPointIndex].penetrationImpulse +
-                                                       deltaLambda, decimal(0.0));
-            deltaLambda = mContactPoints[contactPointIndex].penetrationImpulse - lambdaTemp;
 
-            Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambda,
-                                  mContactPoints[contactPointIndex].normal.y * deltaLambda,
-                                  mContactPoints[contactPointIndex].normal.z * deltaLambda);
+            std::memcpy(frictionImpulse, newFrictionImpulse, sizeof(newFrictionImpulse));
+        }
 
-            // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+        // ------ Twist friction constraint at the center of the contact manifold ------ //
+
+        decimal frictionTwistImpulse[NB_BATCH_LANES];
+
+        for (uint32 l=0; l < NB_BATCH_LANES; l++) {
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambda;
+            // Compute J*v
+            const decimal Jv = (w2.x[l] - w1.x[l]) * batch.normal.x[l] + (w2.y[l] - w1.y[l]) * batch.normal.y[l] +
+                               (w2.z[l] - w1.z[l]) * batch.normal.z[l];
+
+            decimal deltaLambda = -Jv * batch.inverseTwistFrictionMass[l];
+            const decimal frictionLimit = batch.frictionCoefficient[l] * sumPenetrationImpulse[l];
+            const decimal lambdaTemp = batch.frictionTwistImpulse[l];
+            frictionTwistImpulse[l] = std::max(-frictionLimit, std::min(lambdaTemp + deltaLambda, frictionLimit));
+            deltaLambda = frictionTwistImpulse[l] - lambdaTemp;
+
+            // Compute the impulse P=J^T * lambda
+            const decimal angularImpulseX = batch.normal.x[l] * deltaLambda;
+            const decimal angularImpulseY = batch.normal.y[l] * deltaLambda;
+            const decimal angularImpulseZ = batch.normal.z[l] * deltaLambda;
+
+            // Update the velocities of the body 1 by applying the impulse P
+            const decimal (&i1)[3][3][NB_BATCH_LANES] = batch.inverseInertiaTensorBody1.m;
+            w1.x[l] -= batch.angularLockAxisFactorBody1.x[l] * (i1[0][0][l] * angularImpulseX + i1[0][1][l] * angularImpulseY + i1[0][2][l] * angularImpulseZ);
+            w1.y[l] -= batch.angularLockAxisFactorBody1.y[l] * (i1[1][0][l] * angularImpulseX + i1[1][1][l] * angularImpulseY + i1[1][2][l] * angularImpulseZ);
+            w1.z[l] -= batch.angularLockAxisFactorBody1.z[l] * (i1[2][0][l] * angularImpulseX + i1[2][1][l] * angularImpulseY + i1[2][2][l] * angularImpulseZ);
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+            const decimal (&i2)[3][3][NB_BATCH_LANES] = batch.inverseInertiaTensorBody2.m;
+            w2.x[l] += batch.angularLockAxisFactorBody2.x[l] * (i2[0][0][l] * angularImpulseX + i2[0][1][l] * angularImpulseY + i2[0][2][l] * angularImpulseZ);
+            w2.y[l] += batch.angularLockAxisFactorBody2.y[l] * (i2[1][0][l] * angularImpulseX + i2[1][1][l] * angularImpulseY + i2[1][2][l] * angularImpulseZ);
+            w2.z[l] += batch.angularLockAxisFactorBody2.z[l] * (i2[2][0][l] * angularImpulseX + i2[2][1][l] * angularImpulseY + i2[2][2][l] * angularImpulseZ);
+        }
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambda;
+        std::memcpy(batch.frictionTwistImpulse, frictionTwistImpulse, sizeof(frictionTwistImpulse));
 
-            sumPenetrationImpulse += mContactPoints[contactPointIndex].penetrationImpulse;
+        // Scatter the velocities back to the bodies
+        for (uint32 l=0; l < nbLanes; l++) {
 
-            // If the split impulse position correction is active
-            if (mIsSplitImpulseActive) {
-
-                // Split impulse (position correction)
-                const Vector3& v1Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index];
-                const Vector3& w1Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index];
-                const Vector3& v2Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index];
-                const Vector3& w2Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index];
-
-                //Vector3 deltaVSplit = v2Split + w2Split.cross(mContactPoints[contactPointIndex].r2) - v1Split - w1Split.cross(mContactPoints[contactPointIndex].r1);
-                Vector3 deltaVSplit(v2Split.x + w2Split.y * mContactPoints[contactPointIndex].r2.z - w2Split.z * mContactPoints[contactPointIndex].r2.y - v1Split.x -
-                                    w1Split.y * mContactPoints[contactPointIndex].r1.z + w1Split.z * mContactPoints[contactPointIndex].r1.y,
-                                    v2Split.y + w2Split.z * mContactPoints[contactPointIndex].r2.x - w2Split.x * mContactPoints[contactPointIndex].r2.z - v1Split.y -
-                                    w1Split.z * mContactPoints[contactPointIndex].r1.x + w1Split.x * mContactPoints[contactPointIndex].r1.z,
-                                    v2Split.z + w2Split.x * mContactPoints[contactPointIndex].r2.y - w2Split.y * mContactPoints[contactPointIndex].r2.x - v1Split.z -
-                                    w1Split.x * mContactPoints[contactPointIndex].r1.y + w1Split.y * mContactPoints[contactPointIndex].r1.x);
-                decimal JvSplit = deltaVSplit.x * mContactPoints[contactPointIndex].normal.x +
-                                  deltaVSplit.y * mContactPoints[contactPointIndex].normal.y +
-                                  deltaVSplit.z * mContactPoints[contactPointIndex].normal.z;
-                decimal deltaLambdaSplit = - (JvSplit + biasPenetrationDepth) *
-                        mContactPoints[contactPointIndex].inversePenetrationMass;
-                decimal lambdaTempSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse;
-                mContactPoints[contactPointIndex].penetrationSplitImpulse = std::max(
-                            mContactPoints[contactPointIndex].penetrationSplitImpulse +
-                            deltaLambdaSplit, decimal(0.0));
-                deltaLambdaSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse - lambdaTempSplit;
-
-                Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambdaSplit,
-                                      mContactPoints[contactPointIndex].normal.y * deltaLambdaSplit,
-                                      mContactPoints[contactPointIndex].normal.z * deltaLambdaSplit);
+            linearVelocities[batch.rigidBodyComponentIndexBody1[l]].setAllValues(v1.x[l], v1.y[l], v1.z[l]);
+            angularVelocities[batch.rigidBodyComponentIndexBody1[l]].setAllValues(w1.x[l], w1.y[l], w1.z[l]);
+            linearVelocities[batch.rigidBodyComponentIndexBody2[l]].setAllValues(v2.x[l], v2.y[l], v2.z[l]);
+            angularVelocities[batch.rigidBodyComponentIndexBody2[l]].setAllValues(w2.x[l], w2.y[l], w2.z[l]);
+        }
 
-                // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+        if (isSplitImpulseActive) {
+            for (uint32 l=0; l < nbLanes; l++) {
 
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambdaSplit;
+                splitLinearVelocities[batch.rigidBodyComponentIndexBody1[l]].setAllValues(v1Split.x[l], v1Split.y[l], v1Split.z[l]);
+                splitAngularVelocities[batch.rigidBodyComponentIndexBody1[l]].setAllValues(w1Split.x[l], w1Split.y[l], w1Split.z[l]);
+                splitLinearVelocities[batch.rigidBodyComponentIndexBody2[l]].setAllValues(v2Split.x[l], v2Split.y[l], v2Split.z[l]);
+                splitAngularVelocities[batch.rigidBodyComponentIndexBody2[l]].setAllValues(w2Split.x[l], w2Split.y[l], w2Split.z[l]);
+            }
+        }
+    }
+}
 
-                // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+// Copy the impulses of the batches back into the contact constraints
+void ContactSolverSystem::storeBatchesImpulses() {
 
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambdaSplit;
+    for (uint32 b=0; b < mNbContactManifoldBatches; b++) {
+
+        const ContactManifoldBatch& batch = mContactManifoldBatches[b];
+
+        for (uint32 l=0; l < batch.nbLanes; l++) {
+
+            ContactManifoldSolver& manifold = mContactConstraints[batch.contactConstraintIndices[l]];
+
+            for (short int i=0; i < manifold.nbContacts; i++) {
+                mContactPoints[manifold.contactPointsIndex + i].penetrationImpulse = mContactPointBatches[batch.contactPointBatchesIndex + i].penetrationImpulse[l];
             }
 
-            contactPointIndex++;
+            manifold.friction1Impulse = batch.friction1Impulse[l];
+            manifold.friction2Impulse = batch.friction2Impulse[l];
+            manifold.frictionTwistImpulse = batch.frictionTwistImpulse[l];
         }
-
-        // ------ First friction constraint at the center of the contact manifold ------ //
-
-        // Compute J*v
-        // deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
-        Vector3 deltaV(v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y - v1.x -
-                       w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y,
-
-                       v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z - v1.y -
-                       w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z,
-
-                       v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x - v1.z -
-                       w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x);
-        decimal Jv = deltaV.x * mContactConstraints[c].frictionVector1.x +
-                     deltaV.y * mContactConstraints[c].frictionVector1.y +
-                     deltaV.z * mContactConstraints[c].frictionVector1.z;
-
-        // Compute the Lagrange multiplier lambda
-        decimal deltaLambda = -Jv * mContactConstraints[c].inverseFriction1Mass;
-        decimal frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].friction1Impulse;
-        mContactConstraints[c].friction1Impulse = std::max(-frictionLimit,
-                                                    std::min(mContactConstraints[c].friction1Impulse +
-                                                             deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].friction1Impulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        Vector3 angularImpulseBody1(-mContactConstraints[c].r1CrossT1.x * deltaLambda,
-                                    -mContactConstraints[c].r1CrossT1.y * deltaLambda,
-                                    -mContactConstraints[c].r1CrossT1.z * deltaLambda);
-        Vector3 linearImpulseBody2(mContactConstraints[c].frictionVector1.x * deltaLambda,
-                                   mContactConstraints[c].frictionVector1.y * deltaLambda,
-                                   mContactConstraints[c].frictionVector1.z * deltaLambda);
-        Vector3 angularImpulseBody2(mContactConstraints[c].r2CrossT1.x * deltaLambda,
-                                    mContactConstraints[c].r2CrossT1.y * deltaLambda,
-                                    mContactConstraints[c].r2CrossT1.z * deltaLambda);
-
-        // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
-
-        Vector3 angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x += angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y += angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z += angularVelocity1.z;
-
-        // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
-
-        Vector3 angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
-
-        // ------ Second friction constraint at the center of the contact manifold ----- //
-
-        // Compute J*v
-        //deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
-        deltaV.x = v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y  - v1.x -
-                   w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y;
-        deltaV.y = v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z  - v1.y -
-                   w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z;
-        deltaV.z = v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x  - v1.z -
-                   w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x;
-        Jv = deltaV.x * mContactConstraints[c].frictionVector2.x + deltaV.y * mContactConstraints[c].frictionVector2.y +
-             deltaV.z * mContactConstraints[c].frictionVector2.z;
-
-        // Compute the Lagrange multiplier lambda
-        deltaLambda = -Jv * mContactConstraints[c].inverseFriction2Mass;
-        frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].friction2Impulse;
-        mContactConstraints[c].friction2Impulse = std::max(-frictionLimit,
-                                                    std::min(mContactConstraints[c].friction2Impulse +
-                                                             deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].friction2Impulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        angularImpulseBody1.x = -mContactConstraints[c].r1CrossT2.x * deltaLambda;
-        angularImpulseBody1.y = -mContactConstraints[c].r1CrossT2.y * deltaLambda;
-        angularImpulseBody1.z = -mContactConstraints[c].r1CrossT2.z * deltaLambda;
-
-        linearImpulseBody2.x = mContactConstraints[c].frictionVector2.x * deltaLambda;
-        linearImpulseBody2.y = mContactConstraints[c].frictionVector2.y * deltaLambda;
-        linearImpulseBody2.z = mContactConstraints[c].frictionVector2.z * deltaLambda;
-
-        angularImpulseBody2.x = mContactConstraints[c].r2CrossT2.x * deltaLambda;
-        angularImpulseBody2.y = mContactConstraints[c].r2CrossT2.y * deltaLambda;
-        angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * deltaLambda;
-
-        // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
-
-        angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x += angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y += angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z += angularVelocity1.z;
-
-        // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
-
-        angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
-
-        // ------ Twist friction constraint at the center of the contact manifol ------ //
-
-        // Compute J*v
-        deltaV = w2 - w1;
-        Jv = deltaV.x * mContactConstraints[c].normal.x + deltaV.y * mContactConstraints[c].normal.y +
-             deltaV.z * mContactConstraints[c].normal.z;
-
-        deltaLambda = -Jv * (mContactConstraints[c].inverseTwistFrictionMass);
-        frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].frictionTwistImpulse;
-        mContactConstraints[c].frictionTwistImpulse = std::max(-frictionLimit,
-                                                        std::min(mContactConstraints[c].frictionTwistImpulse
-                                                                 + deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].frictionTwistImpulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        angularImpulseBody2.x = mContactConstraints[c].normal.x * deltaLambda;
-        angularImpulseBody2.y = mContactConstraints[c].normal.y * deltaLambda;
-        angularImpulseBody2.z = mContactConstraints[c].normal.z * deltaLambda;
-
-        // Update the velocities of the body 1 by applying the impulse P
-        angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= angularVelocity1.z;
-
-        // Update the velocities of the body 1 by applying the impulse P
-        angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
     }
 }
 
@@ -767,6 +1103,9 @@ void ContactSolverSystem::storeImpulses() {
 
     RP3D_PROFILE("ContactSolver::storeImpulses()", mProfiler);
 
+    // Get the impulses computed by the solver in the batches
+    storeBatchesImpulses();
+
     uint32 contactPointIndex = 0;
 
     // For each contact manifold
@@ -27,6 +27,7 @@
 #include <reactphysics3d/systems/DynamicsSystem.h>
 #include <reactphysics3d/body/RigidBody.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
+#include <cstring>
 
 using namespace reactphysics3d;
 
@@ -46,27 +47,36 @@ void DynamicsSystem::integrateRigidBodiesPositions(decimal timeStep, bool isSpli
     RP3D_PROFILE("DynamicsSystem::integrateRigidBodiesPositions()", mProfiler);
 
     const decimal isSplitImpulseFactor = isSplitImpulseActive ? decimal(1.0) : decimal(0.0);
+    const decimal halfTimeStep = decimal(0.5) * timeStep;
+
+    // Raw arrays of the components (the compiler does not have to reload them at each iteration)
+    const Vector3* constrainedLinearVelocities = mRigidBodyComponents.mConstrainedLinearVelocities;
+    const Vector3* constrainedAngularVelocities = mRigidBodyComponents.mConstrainedAngularVelocities;
+    const Vector3* splitLinearVelocities = mRigidBodyComponents.mSplitLinearVelocities;
+    const Vector3* splitAngularVelocities = mRigidBodyComponents.mSplitAngularVelocities;
+    const Vector3* centersOfMassWorld = mRigidBodyComponents.mCentersOfMassWorld;
+    const Entity* bodiesEntities = mRigidBodyComponents.mBodiesEntities;
+    Vector3* constrainedPositions = mRigidBodyComponents.mConstrainedPositions;
+    Quaternion* constrainedOrientations = mRigidBodyComponents.mConstrainedOrientations;
 
     const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbRigidBodyComponents; i++) {
 
-        // Get the constrained velocity
-        Vector3 newLinVelocity = mRigidBodyComponents.mConstrainedLinearVelocities[i];
-        Vector3 newAngVelocity = mRigidBodyComponents.mConstrainedAngularVelocities[i];
+        // Get the constrained velocity and add the split impulse velocity
+        // from Contact Solver (only used to update the position)
+        const Vector3 newLinVelocity = constrainedLinearVelocities[i] + isSplitImpulseFactor * splitLinearVelocities[i];
+        const Vector3 newAngVelocity = constrainedAngularVelocities[i] + isSplitImpulseFactor * splitAngularVelocities[i];
 
-        // Add the split impulse velocity from Contact Solver (only used
-        // to update the position)
-        newLinVelocity += isSplitImpulseFactor * mRigidBodyComponents.mSplitLinearVelocities[i];
-        newAngVelocity += isSplitImpulseFactor * mRigidBodyComponents.mSplitAngularVelocities[i];
-
-        // Get current position and orientation of the body
-        const Vector3& currentPosition = mRigidBodyComponents.mCentersOfMassWorld[i];
-        const Quaternion& currentOrientation = mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]).getOrientation();
+        // Get current orientation of the body
+        const Quaternion& currentOrientation = mTransformComponents.getTransform(bodiesEntities[i]).getOrientation();
 
         // Update the new constrained position and orientation of the body
-        mRigidBodyComponents.mConstrainedPositions[i] = currentPosition + newLinVelocity * timeStep;
-        mRigidBodyComponents.mConstrainedOrientations[i] = currentOrientation + Quaternion(0, newAngVelocity) *
-                                                           currentOrientation * decimal(0.5) * timeStep;
+        constrainedPositions[i] = centersOfMassWorld[i] + newLinVelocity * timeStep;
+        constrainedOrientations[i] = currentOrientation + Quaternion(0, newAngVelocity) * currentOrientation * halfTimeStep;
+
+        // Normalize the orientation because the position solver of the joints rotates the
+        // anchor points and the axes with it (a large angular velocity makes it very long)
+        constrainedOrientations[i].normalize();
     }
 }
 
@@ -75,28 +85,27 @@ void DynamicsSystem::updateBodiesState() {
 
     RP3D_PROFILE("DynamicsSystem::updateBodiesState()", mProfiler);
 
+    // The velocities are copied in bulk (the arrays of the enabled components are contiguous)
     const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
+    std::memcpy(mRigidBodyComponents.mLinearVelocities, mRigidBodyComponents.mConstrainedLinearVelocities, nbRigidBodyComponents * sizeof(Vector3));
+    std::memcpy(mRigidBodyComponents.mAngularVelocities, mRigidBodyComponents.mConstrainedAngularVelocities, nbRigidBodyComponents * sizeof(Vector3));
+    std::memcpy(mRigidBodyComponents.mCentersOfMassWorld, mRigidBodyComponents.mConstrainedPositions, nbRigidBodyComponents * sizeof(Vector3));
+
+    const Quaternion* constrainedOrientations = mRigidBodyComponents.mConstrainedOrientations;
+    const Vector3* centersOfMassWorld = mRigidBodyComponents.mCentersOfMassWorld;
+    const Vector3* centersOfMassLocal = mRigidBodyComponents.mCentersOfMassLocal;
+    const Entity* bodiesEntities = mRigidBodyComponents.mBodiesEntities;
 
-        // Update the linear and angular velocity of the body
-        mRigidBodyComponents.mLinearVelocities[i] = mRigidBodyComponents.mConstrainedLinearVelocities[i];
-        mRigidBodyComponents.mAngularVelocities[i] = mRigidBodyComponents.mConstrainedAngularVelocities[i];
+    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
 
-        // Update the position of the center of mass of the body
-        mRigidBodyComponents.mCentersOfMassWorld[i] = mRigidBodyComponents.mConstrainedPositions[i];
+        Transform& transform = mTransformComponents.getTransform(bodiesEntities[i]);
 
         // Update the orientation of the body
-        const Quaternion& constrainedOrientation = mRigidBodyComponents.mConstrainedOrientations[i];
-        mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]).setOrientation(constrainedOrientation.getUnit());
-    }
-
-    // Update the position of the body (using the new center of mass and new orientation)
-    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
+        const Quaternion orientation = constrainedOrientations[i].getUnit();
+        transform.setOrientation(orientation);
 
-        Transform& transform = mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]);
-        const Vector3& centerOfMassWorld = mRigidBodyComponents.mCentersOfMassWorld[i];
-        const Vector3& centerOfMassLocal = mRigidBodyComponents.mCentersOfMassLocal[i];
-        transform.setPosition(centerOfMassWorld - transform.getOrientation() * centerOfMassLocal);
+        // Update the position of the body (using the new center of mass and new orientation)
+        transform.setPosition(centersOfMassWorld[i] - orientation * centersOfMassLocal[i]);
     }
 
     // Update the local-to-world transform of the colliders
@@ -118,42 +127,29 @@ void DynamicsSystem::integrateRigidBodiesVelocities(decimal timeStep) {
 
     RP3D_PROFILE("DynamicsSystem::integrateRigidBodiesVelocities()", mProfiler);
 
-    // Reset the split velocities of the bodies
-    resetSplitVelocities();
-
-    // Integration component velocities using force/torque
-    const uint32 nbEnabledRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbEnabledRigidBodyComponents; i++) {
-
-        assert(mRigidBodyComponents.mSplitLinearVelocities[i] == Vector3(0, 0, 0));
-        assert(mRigidBodyComponents.mSplitAngularVelocities[i] == Vector3(0, 0, 0));
-
-        const Vector3& linearVelocity = mRigidBodyComponents.mLinearVelocities[i];
-        const Vector3& angularVelocity = mRigidBodyComponents.mAngularVelocities[i];
-
-        // Integrate the external force to get the new velocity of the body
-        mRigidBodyComponents.mConstrainedLinearVelocities[i] = linearVelocity + timeStep * mRigidBodyComponents.mInverseMasses[i] *
-                                                               mRigidBodyComponents.mLinearLockAxisFactors[i] * mRigidBodyComponents.mExternalForces[i];
-        mRigidBodyComponents.mConstrainedAngularVelocities[i] = angularVelocity + timeStep * mRigidBodyComponents.mAngularLockAxisFactors[i] *
-                                                                (mRigidBodyComponents.mInverseInertiaTensorsWorld[i] * mRigidBodyComponents.mExternalTorques[i]);
-    }
-
-    // Apply gravity force
-    if (mIsGravityEnabled) {
-
-        const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-        for (uint32 i=0; i < nbRigidBodyComponents; i++) {
-
-            // If the gravity has to be applied to this rigid body
-            if (mRigidBodyComponents.mIsGravityEnabled[i]) {
-
-                // Integrate the gravity force
-                mRigidBodyComponents.mConstrainedLinearVelocities[i] = mRigidBodyComponents.mConstrainedLinearVelocities[i] + timeStep *
-                                                                       mRigidBodyComponents.mInverseMasses[i] * mRigidBodyComponents.mLinearLockAxisFactors[i] *
-                                                                       mRigidBodyComponents.mMasses[i] * mGravity;
-            }
-        }
-    }
+    // The external forces, the gravity and the damping are integrated in a single pass over the
+    // components. The split velocities of the bodies are reset in the same pass.
+
+    const bool isGravityEnabled = mIsGravityEnabled;
+    const Vector3 gravity = mGravity;
+
+    // Raw arrays of the components (the compiler does not have to reload them at each iteration)
+    const Vector3* linearVelocities = mRigidBodyComponents.mLinearVelocities;
+    const Vector3* angularVelocities = mRigidBodyComponents.mAngularVelocities;
+    const Vector3* externalForces = mRigidBodyComponents.mExternalForces;
+    const Vector3* externalTorques = mRigidBodyComponents.mExternalTorques;
+    const Vector3* linearLockAxisFactors = mRigidBodyComponents.mLinearLockAxisFactors;
+    const Vector3* angularLockAxisFactors = mRigidBodyComponents.mAngularLockAxisFactors;
+    const Matrix3x3* inverseInertiaTensorsWorld = mRigidBodyComponents.mInverseInertiaTensorsWorld;
+    const decimal* inverseMasses = mRigidBodyComponents.mInverseMasses;
+    const decimal* masses = mRigidBodyComponents.mMasses;
+    const decimal* linearDampings = mRigidBodyComponents.mLinearDampings;
+    const decimal* angularDampings = mRigidBodyComponents.mAngularDampings;
+    const bool* isBodyGravityEnabled = mRigidBodyComponents.mIsGravityEnabled;
+    Vector3* constrainedLinearVelocities = mRigidBodyComponents.mConstrainedLinearVelocities;
+    Vector3* constrainedAngularVelocities = mRigidBodyComponents.mConstrainedAngularVelocities;
+    Vector3* splitLinearVelocities = mRigidBodyComponents.mSplitLinearVelocities;
+    Vector3* splitAngularVelocities = mRigidBodyComponents.mSplitAngularVelocities;
 
     // Apply the velocity damping
     // Damping force : F_c = -c' * v (c=damping factor)
@@ -173,12 +169,27 @@ void DynamicsSystem::integrateRigidBodiesVelocities(decimal timeStep) {
     const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbRigidBodyComponents; i++) {
 
-        const decimal linDampingFactor = mRigidBodyComponents.mLinearDampings[i];
-        const decimal angDampingFactor = mRigidBodyComponents.mAngularDampings[i];
-        const decimal linearDamping = decimal(1.0) / (decimal(1.0) + linDampingFactor * timeStep);
-        const decimal angularDamping = decimal(1.0) / (decimal(1.0) + angDampingFactor * timeStep);
-        mRigidBodyComponents.mConstrainedLinearVelocities[i] = mRigidBodyComponents.mConstrainedLinearVelocities[i] * linearDamping;
-        mRigidBodyComponents.mConstrainedAngularVelocities[i] = mRigidBodyComponents.mConstrainedAngularVelocities[i] * angularDamping;
+        // Reset the split velocities of the body
+        splitLinearVelocities[i].setToZero();
+        splitAngularVelocities[i].setToZero();
+
+        const decimal inverseMassTimeStep = timeStep * inverseMasses[i];
+
+        // Integrate the external force to get the new velocity of the body
+        Vector3 linearVelocity = linearVelocities[i] + inverseMassTimeStep * linearLockAxisFactors[i] * externalForces[i];
+        const Vector3 angularVelocity = angularVelocities[i] + timeStep * angularLockAxisFactors[i] *
+                                        (inverseInertiaTensorsWorld[i] * externalTorques[i]);
+
+        // Integrate the gravity force (if the gravity has to be applied to this rigid body)
+        if (isGravityEnabled && isBodyGravityEnabled[i]) {
+            linearVelocity = linearVelocity + inverseMassTimeStep * linearLockAxisFactors[i] * masses[i] * gravity;
+        }
+
+        // Apply the velocity damping
+        const decimal linearDamping = decimal(1.0) / (decimal(1.0) + linearDampings[i] * timeStep);
+        const decimal angularDamping = decimal(1.0) / (decimal(1.0) + angularDampings[i] * timeStep);
+        constrainedLinearVelocities[i] = linearVelocity * linearDamping;
+        constrainedAngularVelocities[i] = angularVelocity * angularDamping;
     }
 }
 
@@ -193,13 +204,3 @@ void DynamicsSystem::resetBodiesForceAndTorque() {
     }
 }
 
-// Reset the split velocities of the bodies
-void DynamicsSystem::resetSplitVelocities() {
-
-    const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for(uint32 i=0; i < nbRigidBodyComponents; i++) {
-        mRigidBodyComponents.mSplitLinearVelocities[i].setToZero();
-        mRigidBodyComponents.mSplitAngularVelocities[i].setToZero();
-    }
-}
-
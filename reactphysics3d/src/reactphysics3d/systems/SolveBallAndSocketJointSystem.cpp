@@ -35,13 +35,13 @@ using namespace reactphysics3d;
 const decimal SolveBallAndSocketJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
                                                              TransformComponents& transformComponents,
                                                              JointComponents& jointComponents,
                                                              BallAndSocketJointComponents& ballAndSocketJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mMemoryManager(memoryManager), mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mBallAndSocketJointComponents(ballAndSocketJointComponents),
-               mTimeStep(0), mIsWarmStartingActive(true) {
+               mTimeStep(0), mIsWarmStartingActive(true), mArticulatedJoints(nullptr) {
 
 }
 
@@ -50,19 +50,21 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
 
     const decimal biasFactor = (BETA / mTimeStep);
 
+    // Compute the colors of the joints and the components indices of their bodies
+    mColoring.compute(mMemoryManager, mBallAndSocketJointComponents.mJointEntities, mBallAndSocketJointComponents.getNbEnabledComponents(),
+                      mJointComponents, mRigidBodyComponents);
+
     // For each joint
-    const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    for (uint32 i=0; i < mColoring.nbJoints; i++) {
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
         // Get the bodies entities
         const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
         const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+        const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
@@ -162,285 +164,289 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
 void SolveBallAndSocketJointSystem::warmstart() {
 
-    // For each joint component
-    const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
-        const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
+            const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
+            const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
 
-        const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
-        const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
+            const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
+            const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
 
-        // Compute the impulse P=J^T * lambda for the body 1
-        Vector3 linearImpulseBody1 = -mBallAndSocketJointComponents.mImpulse[i];
-        Vector3 angularImpulseBody1 = mBallAndSocketJointComponents.mImpulse[i].cross(r1World);
+            // Compute the impulse P=J^T * lambda for the body 1
+            Vector3 linearImpulseBody1 = -mBallAndSocketJointComponents.mImpulse[i];
+            Vector3 angularImpulseBody1 = mBallAndSocketJointComponents.mImpulse[i].cross(r1World);
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
-        const Vector3 coneLimitImpulse = mBallAndSocketJointComponents.mConeLimitImpulse[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+            // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
+            const Vector3 coneLimitImpulse = mBallAndSocketJointComponents.mConeLimitImpulse[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
-        // Compute the impulse P=J^T * lambda for the cone limit constraint of body 1
-        angularImpulseBody1 += coneLimitImpulse;
+            // Compute the impulse P=J^T * lambda for the cone limit constraint of body 1
+            angularImpulseBody1 += coneLimitImpulse;
 
-        // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the body 2
-        Vector3 angularImpulseBody2 = -mBallAndSocketJointComponents.mImpulse[i].cross(r2World);
+            // Compute the impulse P=J^T * lambda for the body 2
+            Vector3 angularImpulseBody2 = -mBallAndSocketJointComponents.mImpulse[i].cross(r2World);
 
-        // Compute the impulse P=J^T * lambda for the cone limit constraint of body 2
-        angularImpulseBody2 += -coneLimitImpulse;
+            // Compute the impulse P=J^T * lambda for the cone limit constraint of body 2
+            angularImpulseBody2 += -coneLimitImpulse;
 
-        // Apply the impulse to the body to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            // Apply the impulse to the body to the body 2
+            v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        }
     }
 }
 
 // Solve the velocity constraint
 void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
 
-    // For each joint component
-    const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
-        const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
+            const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
+            const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
 
-        // --------------- Limits Constraints --------------- //
+            // --------------- Limits Constraints --------------- //
 
-        if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
+            if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
 
-            // If the cone limit is violated
-            if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
+                // If the cone limit is violated
+                if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
 
-                // Compute J*v for the cone limit constraine
-                const decimal JvConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(w1 - w2);
+                    // Compute J*v for the cone limit constraine
+                    const decimal JvConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(w1 - w2);
 
-                // Compute the Lagrange multiplier lambda for the cone limit constraint
-                decimal deltaLambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-JvConeLimit -mBallAndSocketJointComponents.mBConeLimit[i]);
-                decimal lambdaTemp = mBallAndSocketJointComponents.mConeLimitImpulse[i];
-                mBallAndSocketJointComponents.mConeLimitImpulse[i] = std::max(mBallAndSocketJointComponents.mConeLimitImpulse[i] + deltaLambdaConeLimit, decimal(0.0));
-                deltaLambdaConeLimit = mBallAndSocketJointComponents.mConeLimitImpulse[i] - lambdaTemp;
+                    // Compute the Lagrange multiplier lambda for the cone limit constraint
+                    decimal deltaLambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-JvConeLimit -mBallAndSocketJointComponents.mBConeLimit[i]);
+                    decimal lambdaTemp = mBallAndSocketJointComponents.mConeLimitImpulse[i];
+                    mBallAndSocketJointComponents.mConeLimitImpulse[i] = std::max(mBallAndSocketJointComponents.mConeLimitImpulse[i] + deltaLambdaConeLimit, decimal(0.0));
+                    deltaLambdaConeLimit = mBallAndSocketJointComponents.mConeLimitImpulse[i] - lambdaTemp;
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 angularImpulseBody1 = deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+                    const Vector3 angularImpulseBody1 = deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+                    // Apply the impulse to the body 1
+                    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 angularImpulseBody2 = -deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+                    const Vector3 angularImpulseBody2 = -deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+                    // Apply the impulse to the body 2
+                    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 
+                }
             }
-        }
 
-        // --------------- Joint Constraints --------------- //
+            // The equality constraints of an articulated joint are solved by the articulation solver
+            if (mArticulatedJoints != nullptr && mArticulatedJoints[i]) continue;
 
-        // Compute J*v
-        const Vector3 Jv = v2 + w2.cross(mBallAndSocketJointComponents.mR2World[i]) - v1 - w1.cross(mBallAndSocketJointComponents.mR1World[i]);
+            // --------------- Joint Constraints --------------- //
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-Jv - mBallAndSocketJointComponents.mBiasVector[i]);
-        mBallAndSocketJointComponents.mImpulse[i] += deltaLambda;
+            // Compute J*v
+            const Vector3 Jv = v2 + w2.cross(mBallAndSocketJointComponents.mR2World[i]) - v1 - w1.cross(mBallAndSocketJointComponents.mR1World[i]);
 
-        // Compute the impulse P=J^T * lambda for the body 1
-        const Vector3 linearImpulseBody1 = -deltaLambda;
-        const Vector3 angularImpulseBody1 = deltaLambda.cross(mBallAndSocketJointComponents.mR1World[i]);
+            // Compute the Lagrange multiplier lambda
+            const Vector3 deltaLambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-Jv - mBallAndSocketJointComponents.mBiasVector[i]);
+            mBallAndSocketJointComponents.mImpulse[i] += deltaLambda;
 
-        // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Compute the impulse P=J^T * lambda for the body 1
+            const Vector3 linearImpulseBody1 = -deltaLambda;
+            const Vector3 angularImpulseBody1 = deltaLambda.cross(mBallAndSocketJointComponents.mR1World[i]);
 
-        // Compute the impulse P=J^T * lambda for the body 2
-        const Vector3 angularImpulseBody2 = -deltaLambda.cross(mBallAndSocketJointComponents.mR2World[i]);
+            // Apply the impulse to the body 1
+            v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Apply the impulse to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            // Compute the impulse P=J^T * lambda for the body 2
+            const Vector3 angularImpulseBody2 = -deltaLambda.cross(mBallAndSocketJointComponents.mR2World[i]);
+
+            // Apply the impulse to the body 2
+            v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        }
     }
 }
 
 // Solve the position constraint (for position error correction)
 void SolveBallAndSocketJointSystem::solvePositionConstraint() {
 
-    // For each joint component
-    const uint32 nbEnabledJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbEnabledJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do
-        // do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
+            const uint32 i = mColoring.sortedJoints[j];
+            const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            // If the error position correction technique is not the non-linear-gauss-seidel, we do
+            // do not execute this method
+            if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
+            Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+            Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
-                                                    mBallAndSocketJointComponents.mI1[i]);
+            // Recompute the world inverse inertia tensors
+            RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                        mBallAndSocketJointComponents.mI1[i]);
 
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
-                                                    mBallAndSocketJointComponents.mI2[i]);
+            RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                        mBallAndSocketJointComponents.mI2[i]);
 
-        // Compute the vector from body center to the anchor point in world-space
-        mBallAndSocketJointComponents.mR1World[i] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1] *
-                                                    (mBallAndSocketJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mBallAndSocketJointComponents.mR2World[i] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2] *
-                                                    (mBallAndSocketJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+            // Compute the vector from body center to the anchor point in world-space
+            mBallAndSocketJointComponents.mR1World[i] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1] *
+                                                        (mBallAndSocketJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+            mBallAndSocketJointComponents.mR2World[i] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2] *
+                                                        (mBallAndSocketJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
-        const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
+            const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
+            const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
 
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
-        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
+            // Compute the corresponding skew-symmetric matrices
+            Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
+            Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Get the inverse mass and inverse inertia tensors of the bodies
+            const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        // --------------- Limits Constraints --------------- //
+            // --------------- Limits Constraints --------------- //
 
-        if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
+            if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
 
-            // Check if the cone limit constraints is violated or not
-            const Vector3 r1WorldUnit = r1World.getUnit();
-            const Vector3 r2WorldUnit = r2World.getUnit();
-            mBallAndSocketJointComponents.mConeLimitACrossB[i] = r1WorldUnit.cross(-r2WorldUnit);
-            decimal coneAngle = computeCurrentConeHalfAngle(r1WorldUnit, -r2WorldUnit);
-            decimal coneLimitError = mBallAndSocketJointComponents.mConeLimitHalfAngle[i] - coneAngle;
-            mBallAndSocketJointComponents.mIsConeLimitViolated[i] = coneLimitError < 0;
+                // Check if the cone limit constraints is violated or not
+                const Vector3 r1WorldUnit = r1World.getUnit();
+                const Vector3 r2WorldUnit = r2World.getUnit();
+                mBallAndSocketJointComponents.mConeLimitACrossB[i] = r1WorldUnit.cross(-r2WorldUnit);
+                decimal coneAngle = computeCurrentConeHalfAngle(r1WorldUnit, -r2WorldUnit);
+                decimal coneLimitError = mBallAndSocketJointComponents.mConeLimitHalfAngle[i] - coneAngle;
+                mBallAndSocketJointComponents.mIsConeLimitViolated[i] = coneLimitError < 0;
 
-            // If the cone limit is violated
-            if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
+                // If the cone limit is violated
+                if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
 
-                // Compute the inverse of the mass matrix K=JM^-1J^t for the cone limit (1x1 matrix)
-                decimal inverseMassMatrixConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI1[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]) +
-                                                 mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI2[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]);
-                mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] = (inverseMassMatrixConeLimit > decimal(0.0)) ?
-                                                                               decimal(1.0) / inverseMassMatrixConeLimit : decimal(0.0);
+                    // Compute the inverse of the mass matrix K=JM^-1J^t for the cone limit (1x1 matrix)
+                    decimal inverseMassMatrixConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI1[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]) +
+                                                     mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI2[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]);
+                    mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] = (inverseMassMatrixConeLimit > decimal(0.0)) ?
+                                                                                   decimal(1.0) / inverseMassMatrixConeLimit : decimal(0.0);
+
+                    // Compute the Lagrange multiplier lambda for the cone limit constraint
+                    decimal lambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-coneLimitError );
+
+                    // Compute the impulse P=J^T * lambda of body 1
+                    const Vector3 angularImpulseBody1 = lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
-                // Compute the Lagrange multiplier lambda for the cone limit constraint
-                decimal lambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-coneLimitError );
+                    // Compute the pseudo velocity of body 1
+                    const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mBallAndSocketJointComponents.mI1[i] * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda of body 1
-                const Vector3 angularImpulseBody1 = lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+                    // Update the body position/orientation of body 1
+                    q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+                    q1.normalize();
+
+                    // Compute the impulse P=J^T * lambda of body 2
+                    const Vector3 angularImpulseBody2 = -lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+
+                    // Compute the pseudo velocity of body 2
+                    const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mBallAndSocketJointComponents.mI2[i] * angularImpulseBody2);
+
+                    // Update the body position/orientation of body 2
+                    q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+                    q2.normalize();
+                }
+            }
+
+            // --------------- Joint Constraints --------------- //
+
+            // Recompute the inverse mass matrix K=J^TM^-1J of of the 3 translation constraints
+            decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
+            Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                            0, inverseMassBodies, 0,
+                                            0, 0, inverseMassBodies) +
+                                   skewSymmetricMatrixU1 * mBallAndSocketJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
+                                   skewSymmetricMatrixU2 * mBallAndSocketJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
+            mBallAndSocketJointComponents.mInverseMassMatrix[i].setToZero();
+            decimal massMatrixDeterminant = massMatrix.getDeterminant();
+            if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+
+                if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+                    mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+                    mBallAndSocketJointComponents.mInverseMassMatrix[i] = massMatrix.getInverse(massMatrixDeterminant);
+                }
+
+                Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+                Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+
+                // Compute the constraint error (value of the C(x) function)
+                const Vector3 constraintError = (x2 + r2World - x1 - r1World);
+
+                // Compute the Lagrange multiplier lambda
+                // TODO : Do not solve the system by computing the inverse each time and multiplying with the
+                //        right-hand side vector but instead use a method to directly solve the linear system.
+                const Vector3 lambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-constraintError);
+
+                // Compute the impulse of body 1
+                const Vector3 linearImpulseBody1 = -lambda;
+                const Vector3 angularImpulseBody1 = lambda.cross(r1World);
 
                 // Compute the pseudo velocity of body 1
+                const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
                 const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mBallAndSocketJointComponents.mI1[i] * angularImpulseBody1);
 
-                // Update the body position/orientation of body 1
+                // Update the body center of mass and orientation of body 1
+                x1 += v1;
                 q1 += Quaternion(0, w1) * q1 * decimal(0.5);
                 q1.normalize();
 
-                // Compute the impulse P=J^T * lambda of body 2
-                const Vector3 angularImpulseBody2 = -lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+                // Compute the impulse of body 2
+                const Vector3 angularImpulseBody2 = -lambda.cross(r2World);
 
                 // Compute the pseudo velocity of body 2
+                const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambda;
                 const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mBallAndSocketJointComponents.mI2[i] * angularImpulseBody2);
 
                 // Update the body position/orientation of body 2
+                x2 += v2;
                 q2 += Quaternion(0, w2) * q2 * decimal(0.5);
                 q2.normalize();
             }
         }
-
-        // --------------- Joint Constraints --------------- //
-
-        // Recompute the inverse mass matrix K=J^TM^-1J of of the 3 translation constraints
-        decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mBallAndSocketJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mBallAndSocketJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
-        mBallAndSocketJointComponents.mInverseMassMatrix[i].setToZero();
-        decimal massMatrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
-
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mBallAndSocketJointComponents.mInverseMassMatrix[i] = massMatrix.getInverse(massMatrixDeterminant);
-            }
-
-            Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-            Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
-
-            // Compute the constraint error (value of the C(x) function)
-            const Vector3 constraintError = (x2 + r2World - x1 - r1World);
-
-            // Compute the Lagrange multiplier lambda
-            // TODO : Do not solve the system by computing the inverse each time and multiplying with the
-            //        right-hand side vector but instead use a method to directly solve the linear system.
-            const Vector3 lambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-constraintError);
-
-            // Compute the impulse of body 1
-            const Vector3 linearImpulseBody1 = -lambda;
-            const Vector3 angularImpulseBody1 = lambda.cross(r1World);
-
-            // Compute the pseudo velocity of body 1
-            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mBallAndSocketJointComponents.mI1[i] * angularImpulseBody1);
-
-            // Update the body center of mass and orientation of body 1
-            x1 += v1;
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
-
-            // Compute the impulse of body 2
-            const Vector3 angularImpulseBody2 = -lambda.cross(r2World);
-
-            // Compute the pseudo velocity of body 2
-            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambda;
-            const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mBallAndSocketJointComponents.mI2[i] * angularImpulseBody2);
-
-            // Update the body position/orientation of body 2
-            x2 += v2;
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
-        }
     }
 }
@@ -34,11 +34,11 @@ using namespace reactphysics3d;
 const decimal SolveFixedJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveFixedJointSystem::SolveFixedJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveFixedJointSystem::SolveFixedJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
                                              TransformComponents& transformComponents,
                                              JointComponents& jointComponents,
                                              FixedJointComponents& fixedJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mMemoryManager(memoryManager), mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mFixedJointComponents(fixedJointComponents),
                mTimeStep(0), mIsWarmStartingActive(true) {
 
@@ -49,19 +49,21 @@ void SolveFixedJointSystem::initBeforeSolve() {
 
     const decimal biasFactor = BETA / mTimeStep;
 
+    // Compute the colors of the joints and the components indices of their bodies
+    mColoring.compute(mMemoryManager, mFixedJointComponents.mJointEntities, mFixedJointComponents.getNbEnabledComponents(),
+                      mJointComponents, mRigidBodyComponents);
+
     // For each joint
-    const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    for (uint32 i=0; i < mColoring.nbJoints; i++) {
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
         // Get the bodies entities
         const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
         const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+        const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
@@ -145,305 +147,303 @@ void SolveFixedJointSystem::initBeforeSolve() {
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
 void SolveFixedJointSystem::warmstart() {
 
-    // For each joint
-    const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        // Get the inverse mass of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Get the inverse mass of the bodies
+            const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const Vector3& impulseTranslation = mFixedJointComponents.mImpulseTranslation[i];
-        const Vector3& impulseRotation = mFixedJointComponents.mImpulseRotation[i];
+            const Vector3& impulseTranslation = mFixedJointComponents.mImpulseTranslation[i];
+            const Vector3& impulseRotation = mFixedJointComponents.mImpulseRotation[i];
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+            const Vector3& r1World = mFixedJointComponents.mR1World[i];
+            const Vector3& r2World = mFixedJointComponents.mR2World[i];
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 1
-        Vector3 linearImpulseBody1 = -impulseTranslation;
-        Vector3 angularImpulseBody1 = impulseTranslation.cross(r1World);
+            // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 1
+            Vector3 linearImpulseBody1 = -impulseTranslation;
+            Vector3 angularImpulseBody1 = impulseTranslation.cross(r1World);
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
-        angularImpulseBody1 += -impulseRotation;
+            // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
+            angularImpulseBody1 += -impulseRotation;
 
-        const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
+            const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 2
-        Vector3 angularImpulseBody2 = -impulseTranslation.cross(r2World);
+            // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 2
+            Vector3 angularImpulseBody2 = -impulseTranslation.cross(r2World);
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 2
-        angularImpulseBody2 += impulseRotation;
+            // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 2
+            angularImpulseBody2 += impulseRotation;
 
-        const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
+            const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            // Apply the impulse to the body 2
+            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        }
     }
 }
 
 // Solve the velocity constraint
 void SolveFixedJointSystem::solveVelocityConstraint() {
 
-    // For each joint
-    const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        // Get the inverse mass of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Get the inverse mass of the bodies
+            decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+            const Vector3& r1World = mFixedJointComponents.mR1World[i];
+            const Vector3& r2World = mFixedJointComponents.mR2World[i];
 
-        // --------------- Translation Constraints --------------- //
+            // --------------- Translation Constraints --------------- //
 
-        // Compute J*v for the 3 translation constraints
-        const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+            // Compute J*v for the 3 translation constraints
+            const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
 
-        const Matrix3x3& inverseMassMatrixTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i];
+            const Matrix3x3& inverseMassMatrixTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i];
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambda = inverseMassMatrixTranslation * (-JvTranslation - mFixedJointComponents.mBiasTranslation[i]);
-        mFixedJointComponents.mImpulseTranslation[i] += deltaLambda;
+            // Compute the Lagrange multiplier lambda
+            const Vector3 deltaLambda = inverseMassMatrixTranslation * (-JvTranslation - mFixedJointComponents.mBiasTranslation[i]);
+            mFixedJointComponents.mImpulseTranslation[i] += deltaLambda;
 
-        // Compute the impulse P=J^T * lambda for body 1
-        const Vector3 linearImpulseBody1 = -deltaLambda;
-        Vector3 angularImpulseBody1 = deltaLambda.cross(r1World);
+            // Compute the impulse P=J^T * lambda for body 1
+            const Vector3 linearImpulseBody1 = -deltaLambda;
+            Vector3 angularImpulseBody1 = deltaLambda.cross(r1World);
 
-        const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
+            const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda  for body 2
-        const Vector3 angularImpulseBody2 = -deltaLambda.cross(r2World);
+            // Compute the impulse P=J^T * lambda  for body 2
+            const Vector3 angularImpulseBody2 = -deltaLambda.cross(r2World);
 
-        const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
+            const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            // Apply the impulse to the body 2
+            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 
-        // --------------- Rotation Constraints --------------- //
+            // --------------- Rotation Constraints --------------- //
 
-        // Compute J*v for the 3 rotation constraints
-        const Vector3 JvRotation = w2 - w1;
+            // Compute J*v for the 3 rotation constraints
+            const Vector3 JvRotation = w2 - w1;
 
-        const Vector3& biasRotation = mFixedJointComponents.mBiasRotation[i];
-        const Matrix3x3& inverseMassMatrixRotation = mFixedJointComponents.mInverseMassMatrixRotation[i];
+            const Vector3& biasRotation = mFixedJointComponents.mBiasRotation[i];
+            const Matrix3x3& inverseMassMatrixRotation = mFixedJointComponents.mInverseMassMatrixRotation[i];
 
-        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-        Vector3 deltaLambda2 = inverseMassMatrixRotation * (-JvRotation - biasRotation);
-        mFixedJointComponents.mImpulseRotation[i] += deltaLambda2;
+            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+            Vector3 deltaLambda2 = inverseMassMatrixRotation * (-JvRotation - biasRotation);
+            mFixedJointComponents.mImpulseRotation[i] += deltaLambda2;
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
-        angularImpulseBody1 = -deltaLambda2;
+            // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
+            angularImpulseBody1 = -deltaLambda2;
 
-        // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * deltaLambda2);
+            // Apply the impulse to the body 2
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * deltaLambda2);
+        }
     }
 }
 
 // Solve the position constraint (for position error correction)
 void SolveFixedJointSystem::solvePositionConstraint() {
 
-    // For each joint
-    const uint32 nbEnabledJoints = mFixedJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbEnabledJoints; i++) {
-
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do
-        // do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies positions and orientations
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
+            const uint32 i = mColoring.sortedJoints[j];
+            const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.getInertiaTensorLocalInverse(body1Entity),
-                                                    mFixedJointComponents.mI1[i]);
+            // If the error position correction technique is not the non-linear-gauss-seidel, we do
+            // do not execute this method
+            if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
 
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.getInertiaTensorLocalInverse(body2Entity),
-                                                    mFixedJointComponents.mI2[i]);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Compute the vector from body center to the anchor point in world-space
-        mFixedJointComponents.mR1World[i] = q1 * (mFixedJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mFixedJointComponents.mR2World[i] = q2 * (mFixedJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+            // Get the bodies positions and orientations
+            Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+            Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Recompute the world inverse inertia tensors
+            RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                        mFixedJointComponents.mI1[i]);
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+            RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                        mFixedJointComponents.mI2[i]);
 
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
-        Matrix3x3 skewSymmetricMatrixU2= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
+            // Compute the vector from body center to the anchor point in world-space
+            mFixedJointComponents.mR1World[i] = q1 * (mFixedJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+            mFixedJointComponents.mR2World[i] = q2 * (mFixedJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        // --------------- Translation Constraints --------------- //
+            // Get the inverse mass and inverse inertia tensors of the bodies
+            decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
-        decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mFixedJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mFixedJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
-        mFixedJointComponents.mInverseMassMatrixTranslation[i].setToZero();
-        decimal massMatrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+            const Vector3& r1World = mFixedJointComponents.mR1World[i];
+            const Vector3& r2World = mFixedJointComponents.mR2World[i];
 
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mFixedJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(massMatrixDeterminant);
-            }
+            // Compute the corresponding skew-symmetric matrices
+            Matrix3x3 skewSymmetricMatrixU1= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
+            Matrix3x3 skewSymmetricMatrixU2= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
 
-            Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-            Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
-            // Compute position error for the 3 translation constraints
-            const Vector3 errorTranslation = x2 + r2World - x1 - r1World;
+            // --------------- Translation Constraints --------------- //
 
-            // Compute the Lagrange multiplier lambda
-            const Vector3 lambdaTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i] * (-errorTranslation);
+            // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
+            decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
+            Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                            0, inverseMassBodies, 0,
+                                            0, 0, inverseMassBodies) +
+                                   skewSymmetricMatrixU1 * mFixedJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
+                                   skewSymmetricMatrixU2 * mFixedJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
+            mFixedJointComponents.mInverseMassMatrixTranslation[i].setToZero();
+            decimal massMatrixDeterminant = massMatrix.getDeterminant();
+            if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
 
-            // Compute the impulse of body 1
-            Vector3 linearImpulseBody1 = -lambdaTranslation;
-            Vector3 angularImpulseBody1 = lambdaTranslation.cross(r1World);
+                if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+                    mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+                    mFixedJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(massMatrixDeterminant);
+                }
 
-            // Compute the pseudo velocity of body 1
-            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[i] * angularImpulseBody1);
+                Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+                Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+                // Compute position error for the 3 translation constraints
+                const Vector3 errorTranslation = x2 + r2World - x1 - r1World;
 
-            // Update the body position/orientation of body 1
-            x1 += v1;
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
+                // Compute the Lagrange multiplier lambda
+                const Vector3 lambdaTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i] * (-errorTranslation);
 
-            // Compute the impulse of body 2
-            Vector3 angularImpulseBody2 = -lambdaTranslation.cross(r2World);
+                // Compute the impulse of body 1
+                Vector3 linearImpulseBody1 = -lambdaTranslation;
+                Vector3 angularImpulseBody1 = lambdaTranslation.cross(r1World);
 
-            // Compute the pseudo velocity of body 2
-            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[i] * angularImpulseBody2);
+                // Compute the pseudo velocity of body 1
+                const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+                Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[i] * angularImpulseBody1);
 
-            // Update the body position/orientation of body 2
-            x2 += v2;
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
-        }
+                // Update the body position/orientation of body 1
+                x1 += v1;
+                q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+                q1.normalize();
 
-        // --------------- Rotation Constraints --------------- //
+                // Compute the impulse of body 2
+                Vector3 angularImpulseBody2 = -lambdaTranslation.cross(r2World);
 
-        // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
-        // contraints (3x3 matrix)
-        mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mI1[i] + mFixedJointComponents.mI2[i];
-        decimal massMatrixRotationDeterminant = mFixedJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
-        if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+                // Compute the pseudo velocity of body 2
+                const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
+                Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[i] * angularImpulseBody2);
 
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
+                // Update the body position/orientation of body 2
+                x2 += v2;
+                q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+                q2.normalize();
             }
 
-            // Calculate difference in rotation
-            //
-            // The rotation should be:
-            //
-            // q2 = q1 r0
-            //
-            // But because of drift the actual rotation is:
-            //
-            // q2 = qError q1 r0
-            // <=> qError = q2 r0^-1 q1^-1
-            //
-            // Where:
-            // q1 = current rotation of body 1
-            // q2 = current rotation of body 2
-            // qError = error that needs to be reduced to zero
-            Quaternion qError = q2 * mFixedJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
-
-            // A quaternion can be seen as:
-            //
-            // q = [sin(theta / 2) * v, cos(theta/2)]
-            //
-            // Where:
-            // v = rotation vector
-            // theta = rotation angle
-            //
-            // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
-            const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
-
-            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-            Vector3 lambdaRotation = mFixedJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
-
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-            Vector3 angularImpulseBody1 = -lambdaRotation;
-
-            // Compute the pseudo velocity of body 1
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[i] * angularImpulseBody1);
-
-            // Update the body position/orientation of body 1
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
-
-            // Compute the pseudo velocity of body 2
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[i] * lambdaRotation);
-
-            // Update the body position/orientation of body 2
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
+            // --------------- Rotation Constraints --------------- //
+
+            // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
+            // contraints (3x3 matrix)
+            mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mI1[i] + mFixedJointComponents.mI2[i];
+            decimal massMatrixRotationDeterminant = mFixedJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
+            if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+
+                if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+                    mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+                    mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
+                }
+
+                // Calculate difference in rotation
+                //
+                // The rotation should be:
+                //
+                // q2 = q1 r0
+                //
+                // But because of drift the actual rotation is:
+                //
+                // q2 = qError q1 r0
+                // <=> qError = q2 r0^-1 q1^-1
+                //
+                // Where:
+                // q1 = current rotation of body 1
+                // q2 = current rotation of body 2
+                // qError = error that needs to be reduced to zero
+                Quaternion qError = q2 * mFixedJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
+
+                // A quaternion can be seen as:
+                //
+                // q = [sin(theta / 2) * v, cos(theta/2)]
+                //
+                // Where:
+                // v = rotation vector
+                // theta = rotation angle
+                //
+                // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
+                const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
+
+                // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+                Vector3 lambdaRotation = mFixedJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
+
+                // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+                Vector3 angularImpulseBody1 = -lambdaRotation;
+
+                // Compute the pseudo velocity of body 1
+                Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[i] * angularImpulseBody1);
+
+                // Update the body position/orientation of body 1
+                q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+                q1.normalize();
+
+                // Compute the pseudo velocity of body 2
+                Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[i] * lambdaRotation);
+
+                // Update the body position/orientation of body 2
+                q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+                q2.normalize();
+            }
         }
     }
 }
@@ -34,13 +34,13 @@ using namespace reactphysics3d;
 const decimal SolveHingeJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveHingeJointSystem::SolveHingeJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveHingeJointSystem::SolveHingeJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
                                                              TransformComponents& transformComponents,
                                                              JointComponents& jointComponents,
                                                              HingeJointComponents& hingeJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mMemoryManager(memoryManager), mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mHingeJointComponents(hingeJointComponents),
-               mTimeStep(0), mIsWarmStartingActive(true) {
+               mTimeStep(0), mIsWarmStartingActive(true), mArticulatedJoints(nullptr) {
 
 }
 
@@ -49,19 +49,22 @@ void SolveHingeJointSystem::initBeforeSolve() {
 
     const decimal biasFactor = (BETA / mTimeStep);
 
+    // Compute the colors of the joints and the components indices of their bodies
+    mColoring.compute(mMemoryManager, mHingeJointComponents.mJointEntities, mHingeJointComponents.getNbEnabledComponents(),
+                      mJointComponents, mRigidBodyComponents);
+
     // For each joint
-    const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    for (uint32 i=0; i < mColoring.nbJoints; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
         // Get the bodies entities
         const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
         const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+        const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
@@ -216,503 +219,503 @@ void SolveHingeJointSystem::initBeforeSolve() {
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
 void SolveHingeJointSystem::warmstart() {
 
-    // For each joint component
-    const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Get the inverse mass and inverse inertia tensors of the bodies
+            const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const Vector3& impulseTranslation = mHingeJointComponents.mImpulseTranslation[i];
-        const Vector2& impulseRotation = mHingeJointComponents.mImpulseRotation[i];
+            const Vector3& impulseTranslation = mHingeJointComponents.mImpulseTranslation[i];
+            const Vector2& impulseRotation = mHingeJointComponents.mImpulseRotation[i];
 
-        const decimal impulseLowerLimit = mHingeJointComponents.mImpulseLowerLimit[i];
-        const decimal impulseUpperLimit = mHingeJointComponents.mImpulseUpperLimit[i];
+            const decimal impulseLowerLimit = mHingeJointComponents.mImpulseLowerLimit[i];
+            const decimal impulseUpperLimit = mHingeJointComponents.mImpulseUpperLimit[i];
 
-        const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        const Vector3& a1 = mHingeJointComponents.mA1[i];
+            const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+            const Vector3& a1 = mHingeJointComponents.mA1[i];
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints
-        Vector3 rotationImpulse = -b2CrossA1 * impulseRotation.x - mHingeJointComponents.mC2CrossA1[i] * impulseRotation.y;
+            // Compute the impulse P=J^T * lambda for the 2 rotation constraints
+            Vector3 rotationImpulse = -b2CrossA1 * impulseRotation.x - mHingeJointComponents.mC2CrossA1[i] * impulseRotation.y;
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
-        const Vector3 limitsImpulse = (impulseUpperLimit - impulseLowerLimit) * a1;
+            // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
+            const Vector3 limitsImpulse = (impulseUpperLimit - impulseLowerLimit) * a1;
 
-        // Compute the impulse P=J^T * lambda for the motor constraint
-        const Vector3 motorImpulse = -mHingeJointComponents.mImpulseMotor[i] * a1;
+            // Compute the impulse P=J^T * lambda for the motor constraint
+            const Vector3 motorImpulse = -mHingeJointComponents.mImpulseMotor[i] * a1;
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 1
-        Vector3 linearImpulseBody1 = -impulseTranslation;
-        Vector3 angularImpulseBody1 = impulseTranslation.cross(mHingeJointComponents.mR1World[i]);
+            // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 1
+            Vector3 linearImpulseBody1 = -impulseTranslation;
+            Vector3 angularImpulseBody1 = impulseTranslation.cross(mHingeJointComponents.mR1World[i]);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
-        angularImpulseBody1 += rotationImpulse;
+            // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
+            angularImpulseBody1 += rotationImpulse;
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
-        angularImpulseBody1 += limitsImpulse;
+            // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
+            angularImpulseBody1 += limitsImpulse;
 
-        // Compute the impulse P=J^T * lambda for the motor constraint of body 1
-        angularImpulseBody1 += motorImpulse;
+            // Compute the impulse P=J^T * lambda for the motor constraint of body 1
+            angularImpulseBody1 += motorImpulse;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 2
-        Vector3 angularImpulseBody2 = -impulseTranslation.cross(mHingeJointComponents.mR2World[i]);
+            // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 2
+            Vector3 angularImpulseBody2 = -impulseTranslation.cross(mHingeJointComponents.mR2World[i]);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
-        angularImpulseBody2 += -rotationImpulse;
+            // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
+            angularImpulseBody2 += -rotationImpulse;
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 2
-        angularImpulseBody2 += -limitsImpulse;
+            // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 2
+            angularImpulseBody2 += -limitsImpulse;
 
-        // Compute the impulse P=J^T * lambda for the motor constraint of body 2
-        angularImpulseBody2 += -motorImpulse;
+            // Compute the impulse P=J^T * lambda for the motor constraint of body 2
+            angularImpulseBody2 += -motorImpulse;
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+            // Apply the impulse to the body 2
+            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+        }
     }
 }
 
 // Solve the velocity constraint
 void SolveHingeJointSystem::solveVelocityConstraint() {
 
-    // For each joint component
-    const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
+
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
+
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            // Get the inverse mass and inverse inertia tensors of the bodies
+            decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
+            const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            const Vector3& r1World = mHingeJointComponents.mR1World[i];
+            const Vector3& r2World = mHingeJointComponents.mR2World[i];
 
-        const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
-        const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
+            const Vector3& a1 = mHingeJointComponents.mA1[i];
 
-        const Vector3& r1World = mHingeJointComponents.mR1World[i];
-        const Vector3& r2World = mHingeJointComponents.mR2World[i];
+            const decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
 
-        const Vector3& a1 = mHingeJointComponents.mA1[i];
+            // --------------- Limits Constraints --------------- //
 
-        const decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
+            if (mHingeJointComponents.mIsLimitEnabled[i]) {
 
-        // --------------- Limits Constraints --------------- //
+                // If the lower limit is violated
+                if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
 
-        if (mHingeJointComponents.mIsLimitEnabled[i]) {
+                    // Compute J*v for the lower limit constraint
+                    const decimal JvLowerLimit = (w2 - w1).dot(a1);
 
-            // If the lower limit is violated
-            if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
+                    // Compute the Lagrange multiplier lambda for the lower limit constraint
+                    decimal deltaLambdaLower = inverseMassMatrixLimitMotor * (-JvLowerLimit -mHingeJointComponents.mBLowerLimit[i]);
+                    decimal lambdaTemp = mHingeJointComponents.mImpulseLowerLimit[i];
+                    mHingeJointComponents.mImpulseLowerLimit[i] = std::max(mHingeJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
+                    deltaLambdaLower = mHingeJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
 
-                // Compute J*v for the lower limit constraint
-                const decimal JvLowerLimit = (w2 - w1).dot(a1);
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+                    const Vector3 angularImpulseBody1 = -deltaLambdaLower * a1;
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal deltaLambdaLower = inverseMassMatrixLimitMotor * (-JvLowerLimit -mHingeJointComponents.mBLowerLimit[i]);
-                decimal lambdaTemp = mHingeJointComponents.mImpulseLowerLimit[i];
-                mHingeJointComponents.mImpulseLowerLimit[i] = std::max(mHingeJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
-                deltaLambdaLower = mHingeJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
+                    // Apply the impulse to the body 1
+                    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 angularImpulseBody1 = -deltaLambdaLower * a1;
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+                    const Vector3 angularImpulseBody2 = deltaLambdaLower * a1;
 
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+                    // Apply the impulse to the body 2
+                    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+                }
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 angularImpulseBody2 = deltaLambdaLower * a1;
+                // If the upper limit is violated
+                if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+                    // Compute J*v for the upper limit constraint
+                    const decimal JvUpperLimit = -(w2 - w1).dot(a1);
+
+                    // Compute the Lagrange multiplier lambda for the upper limit constraint
+                    decimal deltaLambdaUpper = inverseMassMatrixLimitMotor * (-JvUpperLimit -mHingeJointComponents.mBUpperLimit[i]);
+                    decimal lambdaTemp = mHingeJointComponents.mImpulseUpperLimit[i];
+                    mHingeJointComponents.mImpulseUpperLimit[i] = std::max(mHingeJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
+                    deltaLambdaUpper = mHingeJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
+
+                    // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
+                    const Vector3 angularImpulseBody1 = deltaLambdaUpper * a1;
+
+                    // Apply the impulse to the body 1
+                    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+                    // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
+                    const Vector3 angularImpulseBody2 = -deltaLambdaUpper * a1;
+
+                    // Apply the impulse to the body 2
+                    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+                }
             }
 
-            // If the upper limit is violated
-            if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
+            // --------------- Motor --------------- //
+
+            // If the motor is enabled
+            if (mHingeJointComponents.mIsMotorEnabled[i]) {
 
-                // Compute J*v for the upper limit constraint
-                const decimal JvUpperLimit = -(w2 - w1).dot(a1);
+                // Compute J*v for the motor
+                const decimal JvMotor = a1.dot(w1 - w2);
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal deltaLambdaUpper = inverseMassMatrixLimitMotor * (-JvUpperLimit -mHingeJointComponents.mBUpperLimit[i]);
-                decimal lambdaTemp = mHingeJointComponents.mImpulseUpperLimit[i];
-                mHingeJointComponents.mImpulseUpperLimit[i] = std::max(mHingeJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
-                deltaLambdaUpper = mHingeJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
+                // Compute the Lagrange multiplier lambda for the motor
+                const decimal maxMotorImpulse = mHingeJointComponents.mMaxMotorTorque[i] * mTimeStep;
+                decimal deltaLambdaMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i] * (-JvMotor - mHingeJointComponents.mMotorSpeed[i]);
+                decimal lambdaTemp = mHingeJointComponents.mImpulseMotor[i];
+                mHingeJointComponents.mImpulseMotor[i] = clamp(mHingeJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
+                deltaLambdaMotor = mHingeJointComponents.mImpulseMotor[i] - lambdaTemp;
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
-                const Vector3 angularImpulseBody1 = deltaLambdaUpper * a1;
+                // Compute the impulse P=J^T * lambda for the motor of body 1
+                const Vector3 angularImpulseBody1 = -deltaLambdaMotor * a1;
 
                 // Apply the impulse to the body 1
                 w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
-                const Vector3 angularImpulseBody2 = -deltaLambdaUpper * a1;
+                // Compute the impulse P=J^T * lambda for the motor of body 2
+                const Vector3 angularImpulseBody2 = deltaLambdaMotor * a1;
 
                 // Apply the impulse to the body 2
                 w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
             }
-        }
 
-        // --------------- Motor --------------- //
+            // The equality constraints of an articulated joint are solved by the articulation solver
+            if (mArticulatedJoints != nullptr && mArticulatedJoints[i]) continue;
+
+            // --------------- Joint Rotation Constraints --------------- //
 
-        // If the motor is enabled
-        if (mHingeJointComponents.mIsMotorEnabled[i]) {
+            const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+            const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
 
-            // Compute J*v for the motor
-            const decimal JvMotor = a1.dot(w1 - w2);
+            // Compute J*v for the 2 rotation constraints
+            const Vector2 JvRotation(-b2CrossA1.dot(w1) + b2CrossA1.dot(w2),
+                                     -c2CrossA1.dot(w1) + c2CrossA1.dot(w2));
 
-            // Compute the Lagrange multiplier lambda for the motor
-            const decimal maxMotorImpulse = mHingeJointComponents.mMaxMotorTorque[i] * mTimeStep;
-            decimal deltaLambdaMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i] * (-JvMotor - mHingeJointComponents.mMotorSpeed[i]);
-            decimal lambdaTemp = mHingeJointComponents.mImpulseMotor[i];
-            mHingeJointComponents.mImpulseMotor[i] = clamp(mHingeJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
-            deltaLambdaMotor = mHingeJointComponents.mImpulseMotor[i] - lambdaTemp;
+            // Compute the Lagrange multiplier lambda for the 2 rotation constraints
+            Vector2 deltaLambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] *
+                                          (-JvRotation - mHingeJointComponents.mBiasRotation[i]);
+            mHingeJointComponents.mImpulseRotation[i] += deltaLambdaRotation;
 
-            // Compute the impulse P=J^T * lambda for the motor of body 1
-            const Vector3 angularImpulseBody1 = -deltaLambdaMotor * a1;
+            // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
+            Vector3 angularImpulseBody1 = -b2CrossA1 * deltaLambdaRotation.x - c2CrossA1 * deltaLambdaRotation.y;
 
             // Apply the impulse to the body 1
             w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-            // Compute the impulse P=J^T * lambda for the motor of body 2
-            const Vector3 angularImpulseBody2 = deltaLambdaMotor * a1;
+            // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
+            Vector3 angularImpulseBody2 = b2CrossA1 * deltaLambdaRotation.x + c2CrossA1 * deltaLambdaRotation.y;
 
             // Apply the impulse to the body 2
             w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-        }
 
-        // --------------- Joint Rotation Constraints --------------- //
+            // --------------- Joint Translation Constraints --------------- //
 
-        const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+            // Compute J*v
+            const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
 
-        // Compute J*v for the 2 rotation constraints
-        const Vector2 JvRotation(-b2CrossA1.dot(w1) + b2CrossA1.dot(w2),
-                                 -c2CrossA1.dot(w1) + c2CrossA1.dot(w2));
+            // Compute the Lagrange multiplier lambda
+            const Vector3 deltaLambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] *
+                                                   (-JvTranslation - mHingeJointComponents.mBiasTranslation[i]);
+            mHingeJointComponents.mImpulseTranslation[i] += deltaLambdaTranslation;
 
-        // Compute the Lagrange multiplier lambda for the 2 rotation constraints
-        Vector2 deltaLambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] *
-                                      (-JvRotation - mHingeJointComponents.mBiasRotation[i]);
-        mHingeJointComponents.mImpulseRotation[i] += deltaLambdaRotation;
+            // Compute the impulse P=J^T * lambda of body 1
+            const Vector3 linearImpulseBody1 = -deltaLambdaTranslation;
+            angularImpulseBody1 = deltaLambdaTranslation.cross(r1World);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
-        Vector3 angularImpulseBody1 = -b2CrossA1 * deltaLambdaRotation.x - c2CrossA1 * deltaLambdaRotation.y;
+            // Apply the impulse to the body 1
+            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Compute the impulse P=J^T * lambda of body 2
+            angularImpulseBody2 = -deltaLambdaTranslation.cross(r2World);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
-        Vector3 angularImpulseBody2 = b2CrossA1 * deltaLambdaRotation.x + c2CrossA1 * deltaLambdaRotation.y;
+            // Apply the impulse to the body 2
+            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambdaTranslation;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        }
+    }
+}
 
-        // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+// Solve the position constraint (for position error correction)
+void SolveHingeJointSystem::solvePositionConstraint() {
 
-        // --------------- Joint Translation Constraints --------------- //
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        // Compute J*v
-        const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] *
-                                               (-JvTranslation - mHingeJointComponents.mBiasTranslation[i]);
-        mHingeJointComponents.mImpulseTranslation[i] += deltaLambdaTranslation;
+            const uint32 i = mColoring.sortedJoints[j];
+            const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
+            const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
-        // Compute the impulse P=J^T * lambda of body 1
-        const Vector3 linearImpulseBody1 = -deltaLambdaTranslation;
-        angularImpulseBody1 = deltaLambdaTranslation.cross(r1World);
+            // If the error position correction technique is not the non-linear-gauss-seidel, we do not execute this method
+            if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Compute the impulse P=J^T * lambda of body 2
-        angularImpulseBody2 = -deltaLambdaTranslation.cross(r2World);
+            Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+            Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambdaTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
-}
+            // Recompute the world inverse inertia tensors
+            RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                        mHingeJointComponents.mI1[i]);
 
-// Solve the position constraint (for position error correction)
-void SolveHingeJointSystem::solvePositionConstraint() {
+            RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                        mHingeJointComponents.mI2[i]);
 
-    // For each joint component
-    const uint32 nbEnabledJoints = mHingeJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbEnabledJoints; i++) {
+            // Compute the vector from body center to the anchor point in world-space
+            mHingeJointComponents.mR1World[i] = q1 * (mHingeJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+            mHingeJointComponents.mR2World[i] = q2 * (mHingeJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+            // Compute the corresponding skew-symmetric matrices
+            Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR1World[i]);
+            Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR2World[i]);
 
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
+            Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+            Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
 
-        // Get the bodies entities
-        Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            Vector3& a1 = mHingeJointComponents.mA1[i];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            // Compute vectors needed in the Jacobian
+            a1 = q1 * mHingeJointComponents.mHingeLocalAxisBody1[i];
+            Vector3 a2 = q2 * mHingeJointComponents.mHingeLocalAxisBody2[i];
+            a1.normalize();
+            mHingeJointComponents.mA1[i] = a1;
+            a2.normalize();
+            const Vector3 b2 = a2.getOneUnitOrthogonalVector();
+            const Vector3 c2 = a2.cross(b2);
+            b2CrossA1 = b2.cross(a1);
+            mHingeJointComponents.mB2CrossA1[i] = b2CrossA1;
+            c2CrossA1 = c2.cross(a1);
+            mHingeJointComponents.mC2CrossA1[i] = c2CrossA1;
+
+            // Compute the current angle around the hinge axis
+            const decimal hingeAngle = computeCurrentHingeAngle(jointEntity, q1, q2);
+
+            // Check if the limit constraints are violated or not
+            decimal lowerLimitError = hingeAngle - mHingeJointComponents.mLowerLimit[i];
+            decimal upperLimitError = mHingeJointComponents.mUpperLimit[i] - hingeAngle;
+            mHingeJointComponents.mIsLowerLimitViolated[i] = lowerLimitError <= 0;
+            mHingeJointComponents.mIsUpperLimitViolated[i] = upperLimitError <= 0;
+
+            // --------------- Limits Constraints --------------- //
 
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
+            if (mHingeJointComponents.mIsLimitEnabled[i]) {
 
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
-                                                    mHingeJointComponents.mI1[i]);
+                decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
 
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
-                                                    mHingeJointComponents.mI2[i]);
+                Vector3& a1 = mHingeJointComponents.mA1[i];
 
-        // Compute the vector from body center to the anchor point in world-space
-        mHingeJointComponents.mR1World[i] = q1 * (mHingeJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mHingeJointComponents.mR2World[i] = q2 * (mHingeJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+                if (mHingeJointComponents.mIsLowerLimitViolated[i] || mHingeJointComponents.mIsUpperLimitViolated[i]) {
 
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR1World[i]);
-        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR2World[i]);
+                    // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
+                    mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = a1.dot(mHingeJointComponents.mI1[i] * a1) + a1.dot(mHingeJointComponents.mI2[i] * a1);
+                    mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = (inverseMassMatrixLimitMotor > decimal(0.0)) ?
+                                              decimal(1.0) / mHingeJointComponents.mInverseMassMatrixLimitMotor[i] : decimal(0.0);
+                }
 
+                // If the lower limit is violated
+                if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
 
-        Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+                    // Compute the Lagrange multiplier lambda for the lower limit constraint
+                    decimal lambdaLowerLimit = inverseMassMatrixLimitMotor * (-lowerLimitError );
 
-        Vector3& a1 = mHingeJointComponents.mA1[i];
+                    // Compute the impulse P=J^T * lambda of body 1
+                    const Vector3 angularImpulseBody1 = -lambdaLowerLimit * a1;
 
-        // Compute vectors needed in the Jacobian
-        a1 = q1 * mHingeJointComponents.mHingeLocalAxisBody1[i];
-        Vector3 a2 = q2 * mHingeJointComponents.mHingeLocalAxisBody2[i];
-        a1.normalize();
-        mHingeJointComponents.mA1[i] = a1;
-        a2.normalize();
-        const Vector3 b2 = a2.getOneUnitOrthogonalVector();
-        const Vector3 c2 = a2.cross(b2);
-        b2CrossA1 = b2.cross(a1);
-        mHingeJointComponents.mB2CrossA1[i] = b2CrossA1;
-        c2CrossA1 = c2.cross(a1);
-        mHingeJointComponents.mC2CrossA1[i] = c2CrossA1;
+                    // Compute the pseudo velocity of body 1
+                    const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
 
-        // Compute the current angle around the hinge axis
-        const decimal hingeAngle = computeCurrentHingeAngle(jointEntity, q1, q2);
+                    // Update the body position/orientation of body 1
+                    q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+                    q1.normalize();
 
-        // Check if the limit constraints are violated or not
-        decimal lowerLimitError = hingeAngle - mHingeJointComponents.mLowerLimit[i];
-        decimal upperLimitError = mHingeJointComponents.mUpperLimit[i] - hingeAngle;
-        mHingeJointComponents.mIsLowerLimitViolated[i] = lowerLimitError <= 0;
-        mHingeJointComponents.mIsUpperLimitViolated[i] = upperLimitError <= 0;
+                    // Compute the impulse P=J^T * lambda of body 2
+                    const Vector3 angularImpulseBody2 = lambdaLowerLimit * a1;
 
-        // --------------- Limits Constraints --------------- //
+                    // Compute the pseudo velocity of body 2
+                    const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
 
-        if (mHingeJointComponents.mIsLimitEnabled[i]) {
+                    // Update the body position/orientation of body 2
+                    q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+                    q2.normalize();
+                }
 
-            decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
+                // If the upper limit is violated
+                if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
 
-            Vector3& a1 = mHingeJointComponents.mA1[i];
+                    // Compute the Lagrange multiplier lambda for the upper limit constraint
+                    decimal lambdaUpperLimit = inverseMassMatrixLimitMotor * (-upperLimitError);
 
-            if (mHingeJointComponents.mIsLowerLimitViolated[i] || mHingeJointComponents.mIsUpperLimitViolated[i]) {
+                    // Compute the impulse P=J^T * lambda of body 1
+                    const Vector3 angularImpulseBody1 = lambdaUpperLimit * a1;
 
-                // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
-                mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = a1.dot(mHingeJointComponents.mI1[i] * a1) + a1.dot(mHingeJointComponents.mI2[i] * a1);
-                mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = (inverseMassMatrixLimitMotor > decimal(0.0)) ?
-                                          decimal(1.0) / mHingeJointComponents.mInverseMassMatrixLimitMotor[i] : decimal(0.0);
+                    // Compute the pseudo velocity of body 1
+                    const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+
+                    // Update the body position/orientation of body 1
+                    q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+                    q1.normalize();
+
+                    // Compute the impulse P=J^T * lambda of body 2
+                    const Vector3 angularImpulseBody2 = -lambdaUpperLimit * a1;
+
+                    // Compute the pseudo velocity of body 2
+                    const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+
+                    // Update the body position/orientation of body 2
+                    q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+                    q2.normalize();
+                }
             }
 
-            // If the lower limit is violated
-            if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
+            // --------------- Rotation Constraints --------------- //
+
+            // Compute the inverse mass matrix K=JM^-1J^t for the 2 rotation constraints (2x2 matrix)
+            Vector3 I1B2CrossA1 = mHingeJointComponents.mI1[i] * b2CrossA1;
+            Vector3 I1C2CrossA1 = mHingeJointComponents.mI1[i] * c2CrossA1;
+            Vector3 I2B2CrossA1 = mHingeJointComponents.mI2[i] * b2CrossA1;
+            Vector3 I2C2CrossA1 = mHingeJointComponents.mI2[i] * c2CrossA1;
+            const decimal el11 = b2CrossA1.dot(I1B2CrossA1) +
+                                 b2CrossA1.dot(I2B2CrossA1);
+            const decimal el12 = b2CrossA1.dot(I1C2CrossA1) +
+                                 b2CrossA1.dot(I2C2CrossA1);
+            const decimal el21 = c2CrossA1.dot(I1B2CrossA1) +
+                                 c2CrossA1.dot(I2B2CrossA1);
+            const decimal el22 = c2CrossA1.dot(I1C2CrossA1) +
+                                 c2CrossA1.dot(I2C2CrossA1);
+            const Matrix2x2 matrixKRotation(el11, el12, el21, el22);
+            mHingeJointComponents.mInverseMassMatrixRotation[i].setToZero();
+            decimal matrixDeterminant = matrixKRotation.getDeterminant();
+            if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
+                if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+                    mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+                    mHingeJointComponents.mInverseMassMatrixRotation[i] = matrixKRotation.getInverse(matrixDeterminant);
+                }
+
+                // Compute the position error for the 3 rotation constraints
+                const Vector2 errorRotation = Vector2(a1.dot(b2), a1.dot(c2));
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal lambdaLowerLimit = inverseMassMatrixLimitMotor * (-lowerLimitError );
+                // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+                Vector2 lambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
 
-                // Compute the impulse P=J^T * lambda of body 1
-                const Vector3 angularImpulseBody1 = -lambdaLowerLimit * a1;
+                // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+                Vector3 angularImpulseBody1 = -b2CrossA1 * lambdaRotation.x - c2CrossA1 * lambdaRotation.y;
 
                 // Compute the pseudo velocity of body 1
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+                Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
 
                 // Update the body position/orientation of body 1
                 q1 += Quaternion(0, w1) * q1 * decimal(0.5);
                 q1.normalize();
 
-                // Compute the impulse P=J^T * lambda of body 2
-                const Vector3 angularImpulseBody2 = lambdaLowerLimit * a1;
+                // Compute the impulse of body 2
+                Vector3 angularImpulseBody2 = b2CrossA1 * lambdaRotation.x + c2CrossA1 * lambdaRotation.y;
 
                 // Compute the pseudo velocity of body 2
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+                Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
 
                 // Update the body position/orientation of body 2
                 q2 += Quaternion(0, w2) * q2 * decimal(0.5);
                 q2.normalize();
             }
 
-            // If the upper limit is violated
-            if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
+            // --------------- Translation Constraints --------------- //
+
+            // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
+            const decimal body1InverseMass = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            const decimal body2InverseMass = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            decimal inverseMassBodies = body1InverseMass + body2InverseMass;
+            Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                            0, inverseMassBodies, 0,
+                                            0, 0, inverseMassBodies) +
+                                   skewSymmetricMatrixU1 * mHingeJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
+                                   skewSymmetricMatrixU2 * mHingeJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
+            mHingeJointComponents.mInverseMassMatrixTranslation[i].setToZero();
+            matrixDeterminant = massMatrix.getDeterminant();
+            if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
+
+                if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+                    mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+                    mHingeJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(matrixDeterminant);
+                }
+
+                Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+                Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+
+                // Compute position error for the 3 translation constraints
+                const Vector3 errorTranslation = x2 + mHingeJointComponents.mR2World[i] - x1 - mHingeJointComponents.mR1World[i];
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal lambdaUpperLimit = inverseMassMatrixLimitMotor * (-upperLimitError);
+                // Compute the Lagrange multiplier lambda
+                const Vector3 lambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] * (-errorTranslation);
 
-                // Compute the impulse P=J^T * lambda of body 1
-                const Vector3 angularImpulseBody1 = lambdaUpperLimit * a1;
+                // Compute the impulse of body 1
+                Vector3 linearImpulseBody1 = -lambdaTranslation;
+                Vector3 angularImpulseBody1 = lambdaTranslation.cross(mHingeJointComponents.mR1World[i]);
+
+                // Get the inverse mass and inverse inertia tensors of the bodies
+                decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+                decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
                 // Compute the pseudo velocity of body 1
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+                const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+                Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
 
                 // Update the body position/orientation of body 1
+                x1 += v1;
                 q1 += Quaternion(0, w1) * q1 * decimal(0.5);
                 q1.normalize();
 
-                // Compute the impulse P=J^T * lambda of body 2
-                const Vector3 angularImpulseBody2 = -lambdaUpperLimit * a1;
+                // Compute the impulse of body 2
+                Vector3 angularImpulseBody2 = -lambdaTranslation.cross(mHingeJointComponents.mR2World[i]);
 
                 // Compute the pseudo velocity of body 2
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+                const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
+                Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
 
                 // Update the body position/orientation of body 2
+                x2 += v2;
                 q2 += Quaternion(0, w2) * q2 * decimal(0.5);
                 q2.normalize();
             }
         }
-
-        // --------------- Rotation Constraints --------------- //
-
-        // Compute the inverse mass matrix K=JM^-1J^t for the 2 rotation constraints (2x2 matrix)
-        Vector3 I1B2CrossA1 = mHingeJointComponents.mI1[i] * b2CrossA1;
-        Vector3 I1C2CrossA1 = mHingeJointComponents.mI1[i] * c2CrossA1;
-        Vector3 I2B2CrossA1 = mHingeJointComponents.mI2[i] * b2CrossA1;
-        Vector3 I2C2CrossA1 = mHingeJointComponents.mI2[i] * c2CrossA1;
-        const decimal el11 = b2CrossA1.dot(I1B2CrossA1) +
-                             b2CrossA1.dot(I2B2CrossA1);
-        const decimal el12 = b2CrossA1.dot(I1C2CrossA1) +
-                             b2CrossA1.dot(I2C2CrossA1);
-        const decimal el21 = c2CrossA1.dot(I1B2CrossA1) +
-                             c2CrossA1.dot(I2B2CrossA1);
-        const decimal el22 = c2CrossA1.dot(I1C2CrossA1) +
-                             c2CrossA1.dot(I2C2CrossA1);
-        const Matrix2x2 matrixKRotation(el11, el12, el21, el22);
-        mHingeJointComponents.mInverseMassMatrixRotation[i].setToZero();
-        decimal matrixDeterminant = matrixKRotation.getDeterminant();
-        if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mHingeJointComponents.mInverseMassMatrixRotation[i] = matrixKRotation.getInverse(matrixDeterminant);
-            }
-
-            // Compute the position error for the 3 rotation constraints
-            const Vector2 errorRotation = Vector2(a1.dot(b2), a1.dot(c2));
-
-            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-            Vector2 lambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
-
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-            Vector3 angularImpulseBody1 = -b2CrossA1 * lambdaRotation.x - c2CrossA1 * lambdaRotation.y;
-
-            // Compute the pseudo velocity of body 1
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
-
-            // Update the body position/orientation of body 1
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
-
-            // Compute the impulse of body 2
-            Vector3 angularImpulseBody2 = b2CrossA1 * lambdaRotation.x + c2CrossA1 * lambdaRotation.y;
-
-            // Compute the pseudo velocity of body 2
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
-
-            // Update the body position/orientation of body 2
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
-        }
-
-        // --------------- Translation Constraints --------------- //
-
-        // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
-        const decimal body1InverseMass = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal body2InverseMass = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-        decimal inverseMassBodies = body1InverseMass + body2InverseMass;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mHingeJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mHingeJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
-        mHingeJointComponents.mInverseMassMatrixTranslation[i].setToZero();
-        matrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
-
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mHingeJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(matrixDeterminant);
-            }
-
-
-            Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-            Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
-
-            // Compute position error for the 3 translation constraints
-            const Vector3 errorTranslation = x2 + mHingeJointComponents.mR2World[i] - x1 - mHingeJointComponents.mR1World[i];
-
-            // Compute the Lagrange multiplier lambda
-            const Vector3 lambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] * (-errorTranslation);
-
-            // Compute the impulse of body 1
-            Vector3 linearImpulseBody1 = -lambdaTranslation;
-            Vector3 angularImpulseBody1 = lambdaTranslation.cross(mHingeJointComponents.mR1World[i]);
-
-            // Get the inverse mass and inverse inertia tensors of the bodies
-            decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-            decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-
-            // Compute the pseudo velocity of body 1
-            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
-
-            // Update the body position/orientation of body 1
-            x1 += v1;
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
-
-            // Compute the impulse of body 2
-            Vector3 angularImpulseBody2 = -lambdaTranslation.cross(mHingeJointComponents.mR2World[i]);
-
-            // Compute the pseudo velocity of body 2
-            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
-
-            // Update the body position/orientation of body 2
-            x2 += v2;
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
-        }
     }
 }
 
@@ -34,11 +34,11 @@ using namespace reactphysics3d;
 const decimal SolveSliderJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveSliderJointSystem::SolveSliderJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveSliderJointSystem::SolveSliderJointSystem(MemoryManager& memoryManager, PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
                                                              TransformComponents& transformComponents,
                                                              JointComponents& jointComponents,
                                                              SliderJointComponents& sliderJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mMemoryManager(memoryManager), mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mSliderJointComponents(sliderJointComponents),
                mTimeStep(0), mIsWarmStartingActive(true) {
 
@@ -49,19 +49,21 @@ void SolveSliderJointSystem::initBeforeSolve() {
 
     const decimal biasFactor = (BETA / mTimeStep);
 
+    // Compute the colors of the joints and the components indices of their bodies
+    mColoring.compute(mMemoryManager, mSliderJointComponents.mJointEntities, mSliderJointComponents.getNbEnabledComponents(),
+                      mJointComponents, mRigidBodyComponents);
+
     // For each joint
-    const uint32 nbJoints = mSliderJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    for (uint32 i=0; i < mColoring.nbJoints; i++) {
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
         // Get the bodies entities
         const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
         const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+        const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
@@ -242,451 +244,580 @@ void SolveSliderJointSystem::initBeforeSolve() {
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
 void SolveSliderJointSystem::warmstart() {
 
-    // For each joint component
-    const uint32 nbJoints = mSliderJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Get the inverse mass and inverse inertia tensors of the bodies
+            const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const Vector3& n1 = mSliderJointComponents.mN1[i];
-        const Vector3& n2 = mSliderJointComponents.mN2[i];
+            const Vector3& n1 = mSliderJointComponents.mN1[i];
+            const Vector3& n2 = mSliderJointComponents.mN2[i];
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
-        decimal impulseLimits = mSliderJointComponents.mImpulseUpperLimit[i] - mSliderJointComponents.mImpulseLowerLimit[i];
-        Vector3 linearImpulseLimits = impulseLimits * mSliderJointComponents.mSliderAxisWorld[i];
+            // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
+            decimal impulseLimits = mSliderJointComponents.mImpulseUpperLimit[i] - mSliderJointComponents.mImpulseLowerLimit[i];
+            Vector3 linearImpulseLimits = impulseLimits * mSliderJointComponents.mSliderAxisWorld[i];
 
-        // Compute the impulse P=J^T * lambda for the motor constraint of body 1
-        Vector3 impulseMotor = mSliderJointComponents.mImpulseMotor[i] * mSliderJointComponents.mSliderAxisWorld[i];
+            // Compute the impulse P=J^T * lambda for the motor constraint of body 1
+            Vector3 impulseMotor = mSliderJointComponents.mImpulseMotor[i] * mSliderJointComponents.mSliderAxisWorld[i];
 
-        const Vector2& impulseTranslation = mSliderJointComponents.mImpulseTranslation[i];
-        const Vector3& impulseRotation = mSliderJointComponents.mImpulseRotation[i];
+            const Vector2& impulseTranslation = mSliderJointComponents.mImpulseTranslation[i];
+            const Vector3& impulseRotation = mSliderJointComponents.mImpulseRotation[i];
 
-        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
-        Vector3 linearImpulseBody1 = -n1 * impulseTranslation.x - n2 * impulseTranslation.y;
-        Vector3 angularImpulseBody1 = -mSliderJointComponents.mR1PlusUCrossN1[i] * impulseTranslation.x -
-                mSliderJointComponents.mR1PlusUCrossN2[i] * impulseTranslation.y;
+            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
+            Vector3 linearImpulseBody1 = -n1 * impulseTranslation.x - n2 * impulseTranslation.y;
+            Vector3 angularImpulseBody1 = -mSliderJointComponents.mR1PlusUCrossN1[i] * impulseTranslation.x -
+                    mSliderJointComponents.mR1PlusUCrossN2[i] * impulseTranslation.y;
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-        angularImpulseBody1 += -impulseRotation;
+            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+            angularImpulseBody1 += -impulseRotation;
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
-        linearImpulseBody1 += linearImpulseLimits;
-        angularImpulseBody1 += impulseLimits * mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
+            // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
+            linearImpulseBody1 += linearImpulseLimits;
+            angularImpulseBody1 += impulseLimits * mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
 
-        // Compute the impulse P=J^T * lambda for the motor constraint of body 1
-        linearImpulseBody1 += impulseMotor;
+            // Compute the impulse P=J^T * lambda for the motor constraint of body 1
+            linearImpulseBody1 += impulseMotor;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
-        Vector3 linearImpulseBody2 = n1 * impulseTranslation.x + n2 * impulseTranslation.y;
-        Vector3 angularImpulseBody2 = mSliderJointComponents.mR2CrossN1[i] * impulseTranslation.x +
-                mSliderJointComponents.mR2CrossN2[i] * impulseTranslation.y;
+            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
+            Vector3 linearImpulseBody2 = n1 * impulseTranslation.x + n2 * impulseTranslation.y;
+            Vector3 angularImpulseBody2 = mSliderJointComponents.mR2CrossN1[i] * impulseTranslation.x +
+                    mSliderJointComponents.mR2CrossN2[i] * impulseTranslation.y;
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
-        angularImpulseBody2 += impulseRotation;
+            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
+            angularImpulseBody2 += impulseRotation;
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 2
-        linearImpulseBody2 += -linearImpulseLimits;
-        angularImpulseBody2 += -impulseLimits * mSliderJointComponents.mR2CrossSliderAxis[i];
+            // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 2
+            linearImpulseBody2 += -linearImpulseLimits;
+            angularImpulseBody2 += -impulseLimits * mSliderJointComponents.mR2CrossSliderAxis[i];
 
-        // Compute the impulse P=J^T * lambda for the motor constraint of body 2
-        linearImpulseBody2 += -impulseMotor;
+            // Compute the impulse P=J^T * lambda for the motor constraint of body 2
+            linearImpulseBody2 += -impulseMotor;
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+            // Apply the impulse to the body 2
+            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+        }
     }
 }
 
 // Solve the velocity constraint
 void SolveSliderJointSystem::solveVelocityConstraint() {
 
-    // For each joint component
-    const uint32 nbJoints = mSliderJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbJoints; i++) {
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+            const uint32 i = mColoring.sortedJoints[j];
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            // Get the velocities
+            Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+            Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Matrix3x3& i1 = mSliderJointComponents.mI1[i];
-        const Matrix3x3& i2 = mSliderJointComponents.mI2[i];
+            const Matrix3x3& i1 = mSliderJointComponents.mI1[i];
+            const Matrix3x3& i2 = mSliderJointComponents.mI2[i];
 
-        const Vector3& n1 = mSliderJointComponents.mN1[i];
-        const Vector3& n2 = mSliderJointComponents.mN2[i];
+            const Vector3& n1 = mSliderJointComponents.mN1[i];
+            const Vector3& n2 = mSliderJointComponents.mN2[i];
 
-        const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[i];
-        const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[i];
-        const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[i];
-        const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[i];
+            const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[i];
+            const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[i];
+            const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[i];
+            const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[i];
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Get the inverse mass and inverse inertia tensors of the bodies
+            decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[i];
-        const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
+            const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[i];
+            const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
 
-        const Vector3& sliderAxisWorld = mSliderJointComponents.mSliderAxisWorld[i];
+            const Vector3& sliderAxisWorld = mSliderJointComponents.mSliderAxisWorld[i];
 
-        // --------------- Limits Constraints --------------- //
+            // --------------- Limits Constraints --------------- //
 
-        if (mSliderJointComponents.mIsLimitEnabled[i]) {
+            if (mSliderJointComponents.mIsLimitEnabled[i]) {
 
-            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+                Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+                Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-            const decimal inverseMassMatrixLimit = mSliderJointComponents.mInverseMassMatrixLimit[i];
+                const decimal inverseMassMatrixLimit = mSliderJointComponents.mInverseMassMatrixLimit[i];
 
-            // If the lower limit is violated
-            if (mSliderJointComponents.mIsLowerLimitViolated[i]) {
+                // If the lower limit is violated
+                if (mSliderJointComponents.mIsLowerLimitViolated[i]) {
 
-                // Compute J*v for the lower limit constraint
-                const decimal JvLowerLimit = sliderAxisWorld.dot(v2) + r2CrossSliderAxis.dot(w2) -
-                                             sliderAxisWorld.dot(v1) - r1PlusUCrossSliderAxis.dot(w1);
+                    // Compute J*v for the lower limit constraint
+                    const decimal JvLowerLimit = sliderAxisWorld.dot(v2) + r2CrossSliderAxis.dot(w2) -
+                                                 sliderAxisWorld.dot(v1) - r1PlusUCrossSliderAxis.dot(w1);
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal deltaLambdaLower = inverseMassMatrixLimit * (-JvLowerLimit - mSliderJointComponents.mBLowerLimit[i]);
-                decimal lambdaTemp = mSliderJointComponents.mImpulseLowerLimit[i];
-                mSliderJointComponents.mImpulseLowerLimit[i] = std::max(mSliderJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
-                deltaLambdaLower = mSliderJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
+                    // Compute the Lagrange multiplier lambda for the lower limit constraint
+                    decimal deltaLambdaLower = inverseMassMatrixLimit * (-JvLowerLimit - mSliderJointComponents.mBLowerLimit[i]);
+                    decimal lambdaTemp = mSliderJointComponents.mImpulseLowerLimit[i];
+                    mSliderJointComponents.mImpulseLowerLimit[i] = std::max(mSliderJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
+                    deltaLambdaLower = mSliderJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 linearImpulseBody1 = -deltaLambdaLower * sliderAxisWorld;
-                const Vector3 angularImpulseBody1 = -deltaLambdaLower * r1PlusUCrossSliderAxis;
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+                    const Vector3 linearImpulseBody1 = -deltaLambdaLower * sliderAxisWorld;
+                    const Vector3 angularImpulseBody1 = -deltaLambdaLower * r1PlusUCrossSliderAxis;
 
-                // Apply the impulse to the body 1
-                v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+                    // Apply the impulse to the body 1
+                    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+                    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 linearImpulseBody2 = deltaLambdaLower * sliderAxisWorld;
-                const Vector3 angularImpulseBody2 = deltaLambdaLower * r2CrossSliderAxis;
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+                    const Vector3 linearImpulseBody2 = deltaLambdaLower * sliderAxisWorld;
+                    const Vector3 angularImpulseBody2 = deltaLambdaLower * r2CrossSliderAxis;
 
-                // Apply the impulse to the body 2
-                v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
-            }
+                    // Apply the impulse to the body 2
+                    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+                    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+                }
 
-            // If the upper limit is violated
-            if (mSliderJointComponents.mIsUpperLimitViolated[i]) {
+                // If the upper limit is violated
+                if (mSliderJointComponents.mIsUpperLimitViolated[i]) {
 
-                // Compute J*v for the upper limit constraint
-                const decimal JvUpperLimit = sliderAxisWorld.dot(v1) + r1PlusUCrossSliderAxis.dot(w1)
-                                            - sliderAxisWorld.dot(v2) - r2CrossSliderAxis.dot(w2);
+                    // Compute J*v for the upper limit constraint
+                    const decimal JvUpperLimit = sliderAxisWorld.dot(v1) + r1PlusUCrossSliderAxis.dot(w1)
+                                                - sliderAxisWorld.dot(v2) - r2CrossSliderAxis.dot(w2);
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal deltaLambdaUpper = inverseMassMatrixLimit * (-JvUpperLimit -mSliderJointComponents.mBUpperLimit[i]);
-                decimal lambdaTemp = mSliderJointComponents.mImpulseUpperLimit[i];
-                mSliderJointComponents.mImpulseUpperLimit[i] = std::max(mSliderJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
-                deltaLambdaUpper = mSliderJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
+                    // Compute the Lagrange multiplier lambda for the upper limit constraint
+                    decimal deltaLambdaUpper = inverseMassMatrixLimit * (-JvUpperLimit -mSliderJointComponents.mBUpperLimit[i]);
+                    decimal lambdaTemp = mSliderJointComponents.mImpulseUpperLimit[i];
+                    mSliderJointComponents.mImpulseUpperLimit[i] = std::max(mSliderJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
+                    deltaLambdaUpper = mSliderJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
-                const Vector3 linearImpulseBody1 = deltaLambdaUpper * sliderAxisWorld;
-                const Vector3 angularImpulseBody1 = deltaLambdaUpper * r1PlusUCrossSliderAxis;
+                    // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
+                    const Vector3 linearImpulseBody1 = deltaLambdaUpper * sliderAxisWorld;
+                    const Vector3 angularImpulseBody1 = deltaLambdaUpper * r1PlusUCrossSliderAxis;
 
-                // Apply the impulse to the body 1
-                v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+                    // Apply the impulse to the body 1
+                    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+                    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
-                const Vector3 linearImpulseBody2 = -deltaLambdaUpper * sliderAxisWorld;
-                const Vector3 angularImpulseBody2 = -deltaLambdaUpper * r2CrossSliderAxis;
+                    // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
+                    const Vector3 linearImpulseBody2 = -deltaLambdaUpper * sliderAxisWorld;
+                    const Vector3 angularImpulseBody2 = -deltaLambdaUpper * r2CrossSliderAxis;
 
-                // Apply the impulse to the body 2
-                v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+                    // Apply the impulse to the body 2
+                    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+                    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+                }
             }
-        }
 
-        // --------------- Motor --------------- //
+            // --------------- Motor --------------- //
 
-        if (mSliderJointComponents.mIsMotorEnabled[i]) {
+            if (mSliderJointComponents.mIsMotorEnabled[i]) {
 
-            // Compute J*v for the motor
-            const decimal JvMotor = sliderAxisWorld.dot(v1) - sliderAxisWorld.dot(v2);
+                // Compute J*v for the motor
+                const decimal JvMotor = sliderAxisWorld.dot(v1) - sliderAxisWorld.dot(v2);
 
-            // Compute the Lagrange multiplier lambda for the motor
-            const decimal maxMotorImpulse = mSliderJointComponents.mMaxMotorForce[i] * mTimeStep;
-            decimal deltaLambdaMotor = mSliderJointComponents.mInverseMassMatrixMotor[i] * (-JvMotor - mSliderJointComponents.mMotorSpeed[i]);
-            decimal lambdaTemp = mSliderJointComponents.mImpulseMotor[i];
-            mSliderJointComponents.mImpulseMotor[i] = clamp(mSliderJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
-            deltaLambdaMotor = mSliderJointComponents.mImpulseMotor[i] - lambdaTemp;
+                // Compute the Lagrange multiplier lambda for the motor
+                const decimal maxMotorImpulse = mSliderJointComponents.mMaxMotorForce[i] * mTimeStep;
+                decimal deltaLambdaMotor = mSliderJointComponents.mInverseMassMatrixMotor[i] * (-JvMotor - mSliderJointComponents.mMotorSpeed[i]);
+                decimal lambdaTemp = mSliderJointComponents.mImpulseMotor[i];
+                mSliderJointComponents.mImpulseMotor[i] = clamp(mSliderJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
+                deltaLambdaMotor = mSliderJointComponents.mImpulseMotor[i] - lambdaTemp;
 
-            // Compute the impulse P=J^T * lambda for the motor of body 1
-            const Vector3 linearImpulseBody1 = deltaLambdaMotor * sliderAxisWorld;
+                // Compute the impulse P=J^T * lambda for the motor of body 1
+                const Vector3 linearImpulseBody1 = deltaLambdaMotor * sliderAxisWorld;
 
-            // Apply the impulse to the body 1
-            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+                // Apply the impulse to the body 1
+                v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
 
-            // Compute the impulse P=J^T * lambda for the motor of body 2
-            const Vector3 linearImpulseBody2 = -deltaLambdaMotor * sliderAxisWorld;
+                // Compute the impulse P=J^T * lambda for the motor of body 2
+                const Vector3 linearImpulseBody2 = -deltaLambdaMotor * sliderAxisWorld;
 
-            // Apply the impulse to the body 2
-            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-        }
+                // Apply the impulse to the body 2
+                v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+            }
 
-        // --------------- Rotation Constraints --------------- //
+            // --------------- Rotation Constraints --------------- //
 
-        // Compute J*v for the 3 rotation constraints
-        const Vector3 JvRotation = w2 - w1;
+            // Compute J*v for the 3 rotation constraints
+            const Vector3 JvRotation = w2 - w1;
 
-        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-        Vector3 deltaLambda2 = mSliderJointComponents.mInverseMassMatrixRotation[i] *
-                               (-JvRotation - mSliderJointComponents.getBiasRotation(jointEntity));
-        mSliderJointComponents.mImpulseRotation[i] += deltaLambda2;
+            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+            Vector3 deltaLambda2 = mSliderJointComponents.mInverseMassMatrixRotation[i] *
+                                   (-JvRotation - mSliderJointComponents.mBiasRotation[i]);
+            mSliderJointComponents.mImpulseRotation[i] += deltaLambda2;
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-        Vector3 angularImpulseBody1 = -deltaLambda2;
+            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+            Vector3 angularImpulseBody1 = -deltaLambda2;
 
-        // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
-        Vector3 angularImpulseBody2 = deltaLambda2;
+            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
+            Vector3 angularImpulseBody2 = deltaLambda2;
 
-        // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+            // Apply the impulse to the body 2
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
 
-        // --------------- Translation Constraints --------------- //
+            // --------------- Translation Constraints --------------- //
 
-        // Compute J*v for the 2 translation constraints
-        const decimal el1 = -n1.dot(v1) - w1.dot(r1PlusUCrossN1) +
-                             n1.dot(v2) + w2.dot(r2CrossN1);
-        const decimal el2 = -n2.dot(v1) - w1.dot(r1PlusUCrossN2) +
-                             n2.dot(v2) + w2.dot(r2CrossN2);
-        const Vector2 JvTranslation(el1, el2);
+            // Compute J*v for the 2 translation constraints
+            const decimal el1 = -n1.dot(v1) - w1.dot(r1PlusUCrossN1) +
+                                 n1.dot(v2) + w2.dot(r2CrossN1);
+            const decimal el2 = -n2.dot(v1) - w1.dot(r1PlusUCrossN2) +
+                                 n2.dot(v2) + w2.dot(r2CrossN2);
+            const Vector2 JvTranslation(el1, el2);
 
-        // Compute the Lagrange multiplier lambda for the 2 translation constraints
-        const Vector2 deltaLambda = mSliderJointComponents.mInverseMassMatrixTranslation[i] * (-JvTranslation - mSliderJointComponents.mBiasTranslation[i]);
-        mSliderJointComponents.mImpulseTranslation[i] += deltaLambda;
+            // Compute the Lagrange multiplier lambda for the 2 translation constraints
+            const Vector2 deltaLambda = mSliderJointComponents.mInverseMassMatrixTranslation[i] * (-JvTranslation - mSliderJointComponents.mBiasTranslation[i]);
+            mSliderJointComponents.mImpulseTranslation[i] += deltaLambda;
 
-        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
-        const Vector3 linearImpulseBody1 = -n1 * deltaLambda.x - n2 * deltaLambda.y;
-        angularImpulseBody1 = -r1PlusUCrossN1 * deltaLambda.x -
-                r1PlusUCrossN2 * deltaLambda.y;
+            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
+            const Vector3 linearImpulseBody1 = -n1 * deltaLambda.x - n2 * deltaLambda.y;
+            angularImpulseBody1 = -r1PlusUCrossN1 * deltaLambda.x -
+                    r1PlusUCrossN2 * deltaLambda.y;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
-        const Vector3 linearImpulseBody2 = -linearImpulseBody1;
-        angularImpulseBody2 = r2CrossN1 * deltaLambda.x + r2CrossN2 * deltaLambda.y;
+            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
+            const Vector3 linearImpulseBody2 = -linearImpulseBody1;
+            angularImpulseBody2 = r2CrossN1 * deltaLambda.x + r2CrossN2 * deltaLambda.y;
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            // Apply the impulse to the body 2
+            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        }
     }
 }
 
 // Solve the position constraint (for position error correction)
 void SolveSliderJointSystem::solvePositionConstraint() {
 
-    // For each joint component
-    const uint32 nbEnabledJoints = mSliderJointComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbEnabledJoints; i++) {
-
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+    // Solve the joints color by color (the joints of a color do not share any body and can be solved in any order)
+    for (uint32 color=0; color < mColoring.nbColors; color++) {
 
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do
-        // do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) return;
+        // For each joint of the color
+        const uint32 endIndex = mColoring.getColorEndIndex(color);
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
-
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
-
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
-                                                    mSliderJointComponents.mI1[i]);
-
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
-                                                    mSliderJointComponents.mI2[i]);
-
-        // Vector from body center to the anchor point
-        mSliderJointComponents.mR1[i] = q1 * (mSliderJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mSliderJointComponents.mR2[i] = q2 * (mSliderJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
-
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-
-        const Vector3& r1 = mSliderJointComponents.mR1[i];
-        const Vector3& r2 = mSliderJointComponents.mR2[i];
+            const uint32 i = mColoring.sortedJoints[j];
+            const uint32 jointIndex = mColoring.jointComponentIndices[i];
 
-        const Vector3& n1 = mSliderJointComponents.mN1[i];
-        const Vector3& n2 = mSliderJointComponents.mN2[i];
+            // If the error position correction technique is not the non-linear-gauss-seidel, we do
+            // do not execute this method
+            if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) return;
 
-        Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-        Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+            const uint32 componentIndexBody1 = mColoring.rigidBodyComponentIndicesBody1[i];
+            const uint32 componentIndexBody2 = mColoring.rigidBodyComponentIndicesBody2[i];
 
-        // Compute the vector u (difference between anchor points)
-        const Vector3 u = x2 + r2 - x1 - r1;
+            Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+            Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-        // Compute the two orthogonal vectors to the slider axis in world-space
-        mSliderJointComponents.mSliderAxisWorld[i] = q1 * mSliderJointComponents.mSliderAxisBody1[i];
-        mSliderJointComponents.mSliderAxisWorld[i].normalize();
-        mSliderJointComponents.mN1[i] = mSliderJointComponents.mSliderAxisWorld[i].getOneUnitOrthogonalVector();
-        mSliderJointComponents.mN2[i] = mSliderJointComponents.mSliderAxisWorld[i].cross(n1);
+            // Recompute the world inverse inertia tensors
+            RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                        mSliderJointComponents.mI1[i]);
 
-        // Check if the limit constraints are violated or not
-        decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
-        decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.getLowerLimit(jointEntity);
-        decimal upperLimitError = mSliderJointComponents.getUpperLimit(jointEntity) - uDotSliderAxis;
-        mSliderJointComponents.mIsLowerLimitViolated[i] = lowerLimitError <= 0;
-        mSliderJointComponents.mIsUpperLimitViolated[i] = upperLimitError <= 0;
+            RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                        mSliderJointComponents.mI2[i]);
 
-        // Compute the cross products used in the Jacobians
-        mSliderJointComponents.mR2CrossN1[i] = r2.cross(n1);
-        mSliderJointComponents.mR2CrossN2[i] = r2.cross(n2);
-        mSliderJointComponents.mR2CrossSliderAxis[i] = r2.cross(mSliderJointComponents.mSliderAxisWorld[i]);
-        const Vector3 r1PlusU = r1 + u;
-        mSliderJointComponents.mR1PlusUCrossN1[i] = r1PlusU.cross(n1);
-        mSliderJointComponents.mR1PlusUCrossN2[i] = r1PlusU.cross(n2);
-        mSliderJointComponents.mR1PlusUCrossSliderAxis[i] = r1PlusU.cross(mSliderJointComponents.mSliderAxisWorld[i]);
+            // Vector from body center to the anchor point
+            mSliderJointComponents.mR1[i] = q1 * (mSliderJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+            mSliderJointComponents.mR2[i] = q2 * (mSliderJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[i];
-        const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[i];
-        const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[i];
-        const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[i];
+            // Get the inverse mass and inverse inertia tensors of the bodies
+            const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        // --------------- Limits Constraints --------------- //
+            const Vector3& r1 = mSliderJointComponents.mR1[i];
+            const Vector3& r2 = mSliderJointComponents.mR2[i];
 
-        if (mSliderJointComponents.mIsLimitEnabled[i]) {
+            const Vector3& n1 = mSliderJointComponents.mN1[i];
+            const Vector3& n2 = mSliderJointComponents.mN2[i];
 
             Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
             Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
 
-            const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[i];
-            const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
-
-            if (mSliderJointComponents.mIsLowerLimitViolated[i] || mSliderJointComponents.mIsUpperLimitViolated[i]) {
-
-                // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
-                const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-                const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-                mSliderJointComponents.mInverseMassMatrixLimit[i] = body1MassInverse + body2MassInverse +
-                                        r1PlusUCrossSliderAxis.dot(mSliderJointComponents.mI1[i] * r1PlusUCrossSliderAxis) +
-                                        r2CrossSliderAxis.dot(mSliderJointComponents.mI2[i] * r2CrossSliderAxis);
-                mSliderJointComponents.mInverseMassMatrixLimit[i] = (mSliderJointComponents.mInverseMassMatrixLimit[i] > decimal(0.0)) ?
-                                          decimal(1.0) / mSliderJointComponents.mInverseMassMatrixLimit[i] : decimal(0.0);
+            // Compute the vector u (difference between anchor points)
+            const Vector3 u = x2 + r2 - x1 - r1;
+
+            // Compute the two orthogonal vectors to the slider axis in world-space
+            mSliderJointComponents.mSliderAxisWorld[i] = q1 * mSliderJointComponents.mSliderAxisBody1[i];
+            mSliderJointComponents.mSliderAxisWorld[i].normalize();
+            mSliderJointComponents.mN1[i] = mSliderJointComponents.mSliderAxisWorld[i].getOneUnitOrthogonalVector();
+            mSliderJointComponents.mN2[i] = mSliderJointComponents.mSliderAxisWorld[i].cross(n1);
+
+            // Check if the limit constraints are violated or not
+            decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
+            decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.mLowerLimit[i];
+            decimal upperLimitError = mSliderJointComponents.mUpperLimit[i] - uDotSliderAxis;
+            mSliderJointComponents.mIsLowerLimitViolated[i] = lowerLimitError <= 0;
+            mSliderJointComponents.mIsUpperLimitViolated[i] = upperLimitError <= 0;
+
+            // Compute the cross products used in the Jacobians
+            mSliderJointComponents.mR2CrossN1[i] = r2.cross(n1);
+            mSliderJointComponents.mR2CrossN2[i] = r2.cross(n2);
+            mSliderJointComponents.mR2CrossSliderAxis[i] = r2.cross(mSliderJointComponents.mSliderAxisWorld[i]);
+            const Vector3 r1PlusU = r1 + u;
+            mSliderJointComponents.mR1PlusUCrossN1[i] = r1PlusU.cross(n1);
+            mSliderJointComponents.mR1PlusUCrossN2[i] = r1PlusU.cross(n2);
+            mSliderJointComponents.mR1PlusUCrossSliderAxis[i] = r1PlusU.cross(mSliderJointComponents.mSliderAxisWorld[i]);
+
+            const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[i];
+            const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[i];
+            const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[i];
+            const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[i];
+
+            // --------------- Limits Constraints --------------- //
+
+            if (mSliderJointComponents.mIsLimitEnabled[i]) {
+
+                Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+                Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+
+                const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[i];
+                const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
+
+                if (mSliderJointComponents.mIsLowerLimitViolated[i] || mSliderJointComponents.mIsUpperLimitViolated[i]) {
+
+                    // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
+                    const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+                    const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+                    mSliderJointComponents.mInverseMassMatrixLimit[i] = body1MassInverse + body2MassInverse +
+                                            r1PlusUCrossSliderAxis.dot(mSliderJointComponents.mI1[i] * r1PlusUCrossSliderAxis) +
+                                            r2CrossSliderAxis.dot(mSliderJointComponents.mI2[i] * r2CrossSliderAxis);
+                    mSliderJointComponents.mInverseMassMatrixLimit[i] = (mSliderJointComponents.mInverseMassMatrixLimit[i] > decimal(0.0)) ?
+                                              decimal(1.0) / mSliderJointComponents.mInverseMassMatrixLimit[i] : decimal(0.0);
+                }
+
+                const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+                const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+
+                // If the lower limit is violated
+                if (mSliderJointComponents.mIsLowerLimitViolated[i]) {
+
+                    const Vector3& r1 = mSliderJointComponents.mR1[i];
+                    const Vector3& r2 = mSliderJointComponents.mR2[i];
+                    const Vector3 u = x2 + r2 - x1 - r1;
+                    decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
+                    decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.mLowerLimit[i];
+
+                    // Compute the Lagrange multiplier lambda for the lower limit constraint
+                    decimal lambdaLowerLimit = mSliderJointComponents.mInverseMassMatrixLimit[i] * (-lowerLimitError);
+
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+                    const Vector3 linearImpulseBody1 = -lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[i];
+                    const Vector3 angularImpulseBody1 = -lambdaLowerLimit * r1PlusUCrossSliderAxis;
+
+                    // Apply the impulse to the body 1
+                    const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+                    const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+
+                    // Update the body position/orientation of body 1
+                    x1 += v1;
+                    q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+                    q1.normalize();
+
+                    // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+                    const Vector3 linearImpulseBody2 = lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[i];
+                    const Vector3 angularImpulseBody2 = lambdaLowerLimit * r2CrossSliderAxis;
+
+                    // Apply the impulse to the body 2
+                    const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+                    const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+
+                    // Update the body position/orientation of body 2
+                    x2 += v2;
+                    q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+                    q2.normalize();
+                }
+
+                // If the upper limit is violated
+                if (mSliderJointComponents.mIsUpperLimitViolated[i]) {
+
+                    const Vector3& r1 = mSliderJointComponents.mR1[i];
+                    const Vector3& r2 = mSliderJointComponents.mR2[i];
+                    const Vector3 u = x2 + r2 - x1 - r1;
+                    decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
+                    decimal upperLimitError = mSliderJointComponents.mUpperLimit[i] - uDotSliderAxis;
+
+                    // Compute the Lagrange multiplier lambda for the upper limit constraint
+                    decimal lambdaUpperLimit = mSliderJointComponents.mInverseMassMatrixLimit[i] * (-upperLimitError);
+
+                    // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
+                    const Vector3 linearImpulseBody1 = lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[i];
+                    const Vector3 angularImpulseBody1 = lambdaUpperLimit * r1PlusUCrossSliderAxis;
+
+                    // Apply the impulse to the body 1
+                    const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+                    const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+
+                    // Update the body position/orientation of body 1
+                    x1 += v1;
+                    q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+                    q1.normalize();
+
+                    // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
+                    const Vector3 linearImpulseBody2 = -lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[i];
+                    const Vector3 angularImpulseBody2 = -lambdaUpperLimit * r2CrossSliderAxis;
+
+                    // Apply the impulse to the body 2
+                    const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+                    const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+
+                    // Update the body position/orientation of body 2
+                    x2 += v2;
+                    q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+                    q2.normalize();
+                }
             }
 
-            const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-            const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-
-            // If the lower limit is violated
-            if (mSliderJointComponents.mIsLowerLimitViolated[i]) {
-
-                const Vector3& r1 = mSliderJointComponents.mR1[i];
-                const Vector3& r2 = mSliderJointComponents.mR2[i];
-                const Vector3 u = x2 + r2 - x1 - r1;
-                decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
-                decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.mLowerLimit[i];
-
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal lambdaLowerLimit = mSliderJointComponents.mInverseMassMatrixLimit[i] * (-lowerLimitError);
-
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 linearImpulseBody1 = -lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody1 = -lambdaLowerLimit * r1PlusUCrossSliderAxis;
+            // --------------- Rotation Constraints --------------- //
+
+            // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
+            // contraints (3x3 matrix)
+            mSliderJointComponents.mInverseMassMatrixRotation[i] = mSliderJointComponents.mI1[i] + mSliderJointComponents.mI2[i];
+            decimal massMatrixRotationDeterminant = mSliderJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
+            if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+
+                if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+
+                    mSliderJointComponents.mInverseMassMatrixRotation[i] = mSliderJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
+                }
+
+                // Calculate difference in rotation
+                //
+                // The rotation should be:
+                //
+                // q2 = q1 r0
+                //
+                // But because of drift the actual rotation is:
+                //
+                // q2 = qError q1 r0
+                // <=> qError = q2 r0^-1 q1^-1
+                //
+                // Where:
+                // q1 = current rotation of body 1
+                // q2 = current rotation of body 2
+                // qError = error that needs to be reduced to zero
+                Quaternion qError = q2 * mSliderJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
+
+                // A quaternion can be seen as:
+                //
+                // q = [sin(theta / 2) * v, cos(theta/2)]
+                //
+                // Where:
+                // v = rotation vector
+                // theta = rotation angle
+                //
+                // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
+                const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
+
+                // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+                Vector3 lambdaRotation = mSliderJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
+
+                // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+                Vector3 angularImpulseBody1 = -lambdaRotation;
 
                 // Apply the impulse to the body 1
-                const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+                Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
                 // Update the body position/orientation of body 1
-                x1 += v1;
                 q1 += Quaternion(0, w1) * q1 * decimal(0.5);
                 q1.normalize();
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 linearImpulseBody2 = lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody2 = lambdaLowerLimit * r2CrossSliderAxis;
+                // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
+                Vector3 angularImpulseBody2 = lambdaRotation;
 
                 // Apply the impulse to the body 2
-                const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+                Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
 
                 // Update the body position/orientation of body 2
-                x2 += v2;
                 q2 += Quaternion(0, w2) * q2 * decimal(0.5);
                 q2.normalize();
             }
 
-            // If the upper limit is violated
-            if (mSliderJointComponents.mIsUpperLimitViolated[i]) {
-
-                const Vector3& r1 = mSliderJointComponents.mR1[i];
-                const Vector3& r2 = mSliderJointComponents.mR2[i];
-                const Vector3 u = x2 + r2 - x1 - r1;
-                decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
-                decimal upperLimitError = mSliderJointComponents.mUpperLimit[i] - uDotSliderAxis;
+            // --------------- Translation Constraints --------------- //
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal lambdaUpperLimit = mSliderJointComponents.mInverseMassMatrixLimit[i] * (-upperLimitError);
+            const Matrix3x3& i1 = mSliderJointComponents.mI1[i];
+            const Matrix3x3& i2 = mSliderJointComponents.mI2[i];
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
-                const Vector3 linearImpulseBody1 = lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody1 = lambdaUpperLimit * r1PlusUCrossSliderAxis;
+            // Recompute the inverse of the mass matrix K=JM^-1J^t for the 2 translation
+            // constraints (2x2 matrix)
+            const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+            const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            decimal sumInverseMass = body1MassInverse + body2MassInverse;
+            Vector3 I1R1PlusUCrossN1 = i1 * r1PlusUCrossN1;
+            Vector3 I1R1PlusUCrossN2 = i1 * r1PlusUCrossN2;
+            Vector3 I2R2CrossN1 = i2 * r2CrossN1;
+            Vector3 I2R2CrossN2 = i2 * r2CrossN2;
+            const decimal el11 = sumInverseMass + r1PlusUCrossN1.dot(I1R1PlusUCrossN1) +
+                                 r2CrossN1.dot(I2R2CrossN1);
+            const decimal el12 = r1PlusUCrossN1.dot(I1R1PlusUCrossN2) +
+                                 r2CrossN1.dot(I2R2CrossN2);
+            const decimal el21 = r1PlusUCrossN2.dot(I1R1PlusUCrossN1) +
+                                 r2CrossN2.dot(I2R2CrossN1);
+            const decimal el22 = sumInverseMass + r1PlusUCrossN2.dot(I1R1PlusUCrossN2) +
+                                 r2CrossN2.dot(I2R2CrossN2);
+            Matrix2x2 matrixKTranslation(el11, el12, el21, el22);
+            mSliderJointComponents.mInverseMassMatrixTranslation[i].setToZero();
+            decimal matrixKTranslationDeterminant = matrixKTranslation.getDeterminant();
+            if (std::abs(matrixKTranslationDeterminant) > MACHINE_EPSILON) {
+
+                if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+
+                    mSliderJointComponents.mInverseMassMatrixTranslation[i] = matrixKTranslation.getInverse(matrixKTranslationDeterminant);
+                }
+
+                // Compute the position error for the 2 translation constraints
+                const Vector2 translationError(u.dot(n1), u.dot(n2));
+
+                // Compute the Lagrange multiplier lambda for the 2 translation constraints
+                Vector2 lambdaTranslation = mSliderJointComponents.mInverseMassMatrixTranslation[i] * (-translationError);
+
+                // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
+                const Vector3 linearImpulseBody1 = -n1 * lambdaTranslation.x - n2 * lambdaTranslation.y;
+                Vector3 angularImpulseBody1 = -r1PlusUCrossN1 * lambdaTranslation.x -
+                                                    r1PlusUCrossN2 * lambdaTranslation.y;
 
                 // Apply the impulse to the body 1
                 const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+                Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
                 // Update the body position/orientation of body 1
                 x1 += v1;
                 q1 += Quaternion(0, w1) * q1 * decimal(0.5);
                 q1.normalize();
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
-                const Vector3 linearImpulseBody2 = -lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody2 = -lambdaUpperLimit * r2CrossSliderAxis;
+                // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
+                const Vector3 linearImpulseBody2 = n1 * lambdaTranslation.x + n2 * lambdaTranslation.y;
+                Vector3 angularImpulseBody2 = r2CrossN1 * lambdaTranslation.x + r2CrossN2 * lambdaTranslation.y;
 
                 // Apply the impulse to the body 2
                 const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+                Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 
                 // Update the body position/orientation of body 2
                 x2 += v2;
@@ -694,136 +825,5 @@ void SolveSliderJointSystem::solvePositionConstraint() {
                 q2.normalize();
             }
         }
-
-        // --------------- Rotation Constraints --------------- //
-
-        // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
-        // contraints (3x3 matrix)
-        mSliderJointComponents.mInverseMassMatrixRotation[i] = mSliderJointComponents.mI1[i] + mSliderJointComponents.mI2[i];
-        decimal massMatrixRotationDeterminant = mSliderJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
-        if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
-
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-
-                mSliderJointComponents.mInverseMassMatrixRotation[i] = mSliderJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
-            }
-
-            // Calculate difference in rotation
-            //
-            // The rotation should be:
-            //
-            // q2 = q1 r0
-            //
-            // But because of drift the actual rotation is:
-            //
-            // q2 = qError q1 r0
-            // <=> qError = q2 r0^-1 q1^-1
-            //
-            // Where:
-            // q1 = current rotation of body 1
-            // q2 = current rotation of body 2
-            // qError = error that needs to be reduced to zero
-            Quaternion qError = q2 * mSliderJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
-
-            // A quaternion can be seen as:
-            //
-            // q = [sin(theta / 2) * v, cos(theta/2)]
-            //
-            // Where:
-            // v = rotation vector
-            // theta = rotation angle
-            //
-            // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
-            const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
-
-            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-            Vector3 lambdaRotation = mSliderJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
-
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-            Vector3 angularImpulseBody1 = -lambdaRotation;
-
-            // Apply the impulse to the body 1
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
-
-            // Update the body position/orientation of body 1
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
-
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
-            Vector3 angularImpulseBody2 = lambdaRotation;
-
-            // Apply the impulse to the body 2
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
-
-            // Update the body position/orientation of body 2
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
-        }
-
-        // --------------- Translation Constraints --------------- //
-
-        const Matrix3x3& i1 = mSliderJointComponents.getI1(jointEntity);
-        const Matrix3x3& i2 = mSliderJointComponents.getI2(jointEntity);
-
-        // Recompute the inverse of the mass matrix K=JM^-1J^t for the 2 translation
-        // constraints (2x2 matrix)
-        const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-        decimal sumInverseMass = body1MassInverse + body2MassInverse;
-        Vector3 I1R1PlusUCrossN1 = i1 * r1PlusUCrossN1;
-        Vector3 I1R1PlusUCrossN2 = i1 * r1PlusUCrossN2;
-        Vector3 I2R2CrossN1 = i2 * r2CrossN1;
-        Vector3 I2R2CrossN2 = i2 * r2CrossN2;
-        const decimal el11 = sumInverseMass + r1PlusUCrossN1.dot(I1R1PlusUCrossN1) +
-                             r2CrossN1.dot(I2R2CrossN1);
-        const decimal el12 = r1PlusUCrossN1.dot(I1R1PlusUCrossN2) +
-                             r2CrossN1.dot(I2R2CrossN2);
-        const decimal el21 = r1PlusUCrossN2.dot(I1R1PlusUCrossN1) +
-                             r2CrossN2.dot(I2R2CrossN1);
-        const decimal el22 = sumInverseMass + r1PlusUCrossN2.dot(I1R1PlusUCrossN2) +
-                             r2CrossN2.dot(I2R2CrossN2);
-        Matrix2x2 matrixKTranslation(el11, el12, el21, el22);
-        mSliderJointComponents.mInverseMassMatrixTranslation[i].setToZero();
-        decimal matrixKTranslationDeterminant = matrixKTranslation.getDeterminant();
-        if (std::abs(matrixKTranslationDeterminant) > MACHINE_EPSILON) {
-
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-
-                mSliderJointComponents.mInverseMassMatrixTranslation[i] = matrixKTranslation.getInverse(matrixKTranslationDeterminant);
-            }
-
-            // Compute the position error for the 2 translation constraints
-            const Vector2 translationError(u.dot(n1), u.dot(n2));
-
-            // Compute the Lagrange multiplier lambda for the 2 translation constraints
-            Vector2 lambdaTranslation = mSliderJointComponents.mInverseMassMatrixTranslation[i] * (-translationError);
-
-            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
-            const Vector3 linearImpulseBody1 = -n1 * lambdaTranslation.x - n2 * lambdaTranslation.y;
-            Vector3 angularImpulseBody1 = -r1PlusUCrossN1 * lambdaTranslation.x -
-                                                r1PlusUCrossN2 * lambdaTranslation.y;
-
-            // Apply the impulse to the body 1
-            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
-
-            // Update the body position/orientation of body 1
-            x1 += v1;
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
-
-            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
-            const Vector3 linearImpulseBody2 = n1 * lambdaTranslation.x + n2 * lambdaTranslation.y;
-            Vector3 angularImpulseBody2 = r2CrossN1 * lambdaTranslation.x + r2CrossN2 * lambdaTranslation.y;
-
-            // Apply the impulse to the body 2
-            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-
-            // Update the body position/orientation of body 2
-            x2 += v2;
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
-        }
     }
 }
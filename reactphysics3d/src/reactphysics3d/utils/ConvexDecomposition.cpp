@@ -0,0 +1,471 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/utils/ConvexDecomposition.h>
+#include <reactphysics3d/utils/QuickHull.h>
+
+using namespace reactphysics3d;
+
+namespace {
+
+/// Voxel that is outside of the mesh
+const int32 VOXEL_OUTSIDE = -2;
+
+/// Voxel that is not classified yet
+const int32 VOXEL_UNKNOWN = -1;
+
+/// Maximum number of cutting planes tested along each axis
+const int32 NB_CUTTING_PLANES_PER_AXIS = 8;
+
+/// Part of the voxelized mesh
+struct VoxelPart {
+
+    /// Bounds of the part in voxel coordinates (inclusive)
+    int32 min[3];
+    int32 max[3];
+
+    /// Number of voxels of the part
+    uint32 nbVoxels;
+
+    /// Volume of the convex hull of the part that is not filled by voxels
+    decimal concavity;
+
+    /// True if the part cannot be cut anymore
+    bool isFinal;
+};
+
+/// Voxel grid of a mesh where each voxel stores the part that contains it
+class VoxelGrid {
+
+    public:
+
+        MemoryAllocator& mAllocator;
+        Vector3 mOrigin;
+        decimal mVoxelSize;
+        int32 mSize[3];
+        Array<int32> mVoxels;
+
+        VoxelGrid(MemoryAllocator& allocator) : mAllocator(allocator), mVoxelSize(0), mVoxels(allocator) {
+            mSize[0] = mSize[1] = mSize[2] = 0;
+        }
+
+        int32 getIndex(int32 x, int32 y, int32 z) const {
+            return x + mSize[0] * (y + mSize[1] * z);
+        }
+
+        int32 getIndex(const int32* coordinates) const {
+            return getIndex(coordinates[0], coordinates[1], coordinates[2]);
+        }
+
+        // Return the position of a voxel corner (offset 0) or center (offset 0.5)
+        Vector3 getPoint(decimal x, decimal y, decimal z) const {
+            return mOrigin + Vector3(x, y, z) * mVoxelSize;
+        }
+
+        // Return the coordinate of the voxel that contains a position along an axis
+        int32 getCoordinate(const Vector3& position, int axis) const {
+            const int32 coordinate = static_cast<int32>(std::floor((position[axis] - mOrigin[axis]) / mVoxelSize));
+            return std::min(std::max(coordinate, int32(1)), mSize[axis] - 2);
+        }
+
+        // Return the voxel that contains a position
+        int32 getVoxelIndex(const Vector3& position) const {
+            return getIndex(getCoordinate(position, 0), getCoordinate(position, 1), getCoordinate(position, 2));
+        }
+
+        // Voxelize the surface and the interior of a triangle mesh. All the voxels of the mesh belong to part 0
+        bool voxelize(const Vector3* vertices, const uint32* triangleIndices, uint32 nbTriangles, uint32 resolution) {
+
+            Vector3 minBounds = vertices[triangleIndices[0]];
+            Vector3 maxBounds = minBounds;
+            for (uint32 i=0; i < nbTriangles * 3; i++) {
+                minBounds = Vector3::min(minBounds, vertices[triangleIndices[i]]);
+                maxBounds = Vector3::max(maxBounds, vertices[triangleIndices[i]]);
+            }
+            const Vector3 extent = maxBounds - minBounds;
+            const decimal maxExtent = std::max(extent.x, std::max(extent.y, extent.z));
+            if (maxExtent <= MACHINE_EPSILON) return false;
+
+            // Keep one empty voxel of padding around the mesh
+            mVoxelSize = maxExtent / decimal(resolution);
+            mOrigin = minBounds - Vector3(mVoxelSize, mVoxelSize, mVoxelSize);
+            for (int axis=0; axis < 3; axis++) {
+                mSize[axis] = static_cast<int32>(std::ceil(extent[axis] / mVoxelSize)) + 2;
+                mSize[axis] = std::max(mSize[axis], int32(3));
+            }
+            const int32 nbVoxels = mSize[0] * mSize[1] * mSize[2];
+            mVoxels.reserve(nbVoxels);
+            for (int32 i=0; i < nbVoxels; i++) mVoxels.add(VOXEL_UNKNOWN);
+
+            // Mark the surface voxels by sampling the triangles
+            const decimal samplingStep = mVoxelSize * decimal(0.5);
+            for (uint32 t=0; t < nbTriangles; t++) {
+
+                const Vector3& a = vertices[triangleIndices[t * 3]];
+                const Vector3& b = vertices[triangleIndices[t * 3 + 1]];
+                const Vector3& c = vertices[triangleIndices[t * 3 + 2]];
+                const decimal maxEdgeLength = std::max((b - a).length(), std::max((c - b).length(), (a - c).length()));
+                const int32 nbSteps = static_cast<int32>(std::ceil(maxEdgeLength / samplingStep)) + 1;
+                for (int32 i=0; i <= nbSteps; i++) {
+                    for (int32 j=0; i + j <= nbSteps; j++) {
+                        const Vector3 point = a + (b - a) * (decimal(i) / nbSteps) + (c - a) * (decimal(j) / nbSteps);
+                        mVoxels[getVoxelIndex(point)] = 0;
+                    }
+                }
+            }
+
+            // Flood fill the outside from the padding, the remaining unknown voxels are inside the mesh
+            Array<int32> stack(mAllocator);
+            mVoxels[0] = VOXEL_OUTSIDE;
+            stack.add(0);
+            while (stack.size() > 0) {
+
+                const int32 index = stack[stack.size() - 1];
+                stack.removeAt(stack.size() - 1);
+                const int32 x = index % mSize[0];
+                const int32 y = (index / mSize[0]) % mSize[1];
+                const int32 z = index / (mSize[0] * mSize[1]);
+                const int32 neighbors[6][3] = {{x - 1, y, z}, {x + 1, y, z}, {x, y - 1, z},
+                                               {x, y + 1, z}, {x, y, z - 1}, {x, y, z + 1}};
+                for (int n=0; n < 6; n++) {
+                    const int32* neighbor = neighbors[n];
+                    if (neighbor[0] < 0 || neighbor[1] < 0 || neighbor[2] < 0 ||
+                        neighbor[0] >= mSize[0] || neighbor[1] >= mSize[1] || neighbor[2] >= mSize[2]) continue;
+                    const int32 neighborIndex = getIndex(neighbor);
+                    if (mVoxels[neighborIndex] == VOXEL_UNKNOWN) {
+                        mVoxels[neighborIndex] = VOXEL_OUTSIDE;
+                        stack.add(neighborIndex);
+                    }
+                }
+            }
+            for (int32 i=0; i < nbVoxels; i++) {
+                if (mVoxels[i] == VOXEL_UNKNOWN) mVoxels[i] = 0;
+            }
+
+            return true;
+        }
+
+        // Compute the tight bounds and the number of voxels of a part inside a region
+        void computePartBounds(int32 partId, const int32* regionMin, const int32* regionMax, VoxelPart& part) const {
+
+            part.nbVoxels = 0;
+            for (int axis=0; axis < 3; axis++) {
+                part.min[axis] = regionMax[axis];
+                part.max[axis] = regionMin[axis];
+            }
+            for (int32 z=regionMin[2]; z <= regionMax[2]; z++) {
+                for (int32 y=regionMin[1]; y <= regionMax[1]; y++) {
+                    for (int32 x=regionMin[0]; x <= regionMax[0]; x++) {
+                        if (mVoxels[getIndex(x, y, z)] != partId) continue;
+                        part.nbVoxels++;
+                        const int32 coordinates[3] = {x, y, z};
+                        for (int axis=0; axis < 3; axis++) {
+                            part.min[axis] = std::min(part.min[axis], coordinates[axis]);
+                            part.max[axis] = std::max(part.max[axis], coordinates[axis]);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Add the points whose convex hull is the convex hull of the voxels of a part inside a region.
+        // Only the first and last voxels of each line of voxels along the line axis are needed.
+        void addHullPoints(int32 partId, const int32* regionMin, const int32* regionMax, int lineAxis,
+                           bool useCorners, Array<Vector3>& points) const {
+
+            const int axisU = (lineAxis + 1) % 3;
+            const int axisV = (lineAxis + 2) % 3;
+            int32 coordinates[3];
+            for (int32 u=regionMin[axisU]; u <= regionMax[axisU]; u++) {
+                for (int32 v=regionMin[axisV]; v <= regionMax[axisV]; v++) {
+
+                    coordinates[axisU] = u;
+                    coordinates[axisV] = v;
+
+                    int32 first = -1;
+                    int32 last = -1;
+                    for (int32 w=regionMin[lineAxis]; w <= regionMax[lineAxis]; w++) {
+                        coordinates[lineAxis] = w;
+                        if (mVoxels[getIndex(coordinates)] == partId) {
+                            if (first == -1) first = w;
+                            last = w;
+                        }
+                    }
+                    if (first == -1) continue;
+
+                    decimal point[3];
+                    if (useCorners) {
+                        for (int corner=0; corner < 8; corner++) {
+                            point[lineAxis] = decimal((corner & 1) ? last + 1 : first);
+                            point[axisU] = decimal(u + ((corner >> 1) & 1));
+                            point[axisV] = decimal(v + ((corner >> 2) & 1));
+                            points.add(getPoint(point[0], point[1], point[2]));
+                        }
+                    }
+                    else {
+                        point[axisU] = decimal(u) + decimal(0.5);
+                        point[axisV] = decimal(v) + decimal(0.5);
+                        point[lineAxis] = decimal(first) + decimal(0.5);
+                        points.add(getPoint(point[0], point[1], point[2]));
+                        if (last != first) {
+                            point[lineAxis] = decimal(last) + decimal(0.5);
+                            points.add(getPoint(point[0], point[1], point[2]));
+                        }
+                    }
+                }
+            }
+        }
+};
+
+// Compute the volume of a convex hull
+decimal computeHullVolume(const Array<Vector3>& vertices, const Array<uint32>& indices,
+                          const Array<PolygonVertexArray::PolygonFace>& faces) {
+
+    decimal volume = 0;
+    for (uint32 f=0; f < faces.size(); f++) {
+        const Vector3& a = vertices[indices[faces[f].indexBase]];
+        for (uint32 i=1; i + 1 < faces[f].nbVertices; i++) {
+            const Vector3& b = vertices[indices[faces[f].indexBase + i]];
+            const Vector3& c = vertices[indices[faces[f].indexBase + i + 1]];
+            volume += a.dot(b.cross(c));
+        }
+    }
+
+    return volume / decimal(6.0);
+}
+
+// Compute the concavity of the voxels of a part inside a region
+decimal computeConcavity(const VoxelGrid& grid, int32 partId, const int32* regionMin, const int32* regionMax,
+                         uint32 nbVoxels, MemoryAllocator& allocator, decimal* outHullVolume = nullptr) {
+
+    Array<Vector3> points(allocator);
+    grid.addHullPoints(partId, regionMin, regionMax, 0, true, points);
+
+    Array<Vector3> hullVertices(allocator);
+    Array<uint32> hullIndices(allocator);
+    Array<PolygonVertexArray::PolygonFace> hullFaces(allocator);
+    decimal hullVolume = 0;
+    if (QuickHull::computeConvexHull(&points[0], static_cast<uint32>(points.size()), allocator,
+                                     hullVertices, hullIndices, hullFaces)) {
+        hullVolume = computeHullVolume(hullVertices, hullIndices, hullFaces);
+    }
+    if (outHullVolume != nullptr) *outHullVolume = hullVolume;
+
+    const decimal voxelVolume = grid.mVoxelSize * grid.mVoxelSize * grid.mVoxelSize;
+    return std::max(hullVolume - decimal(nbVoxels) * voxelVolume, decimal(0.0));
+}
+
+// Cut a part by the best axis-aligned plane. Return false if the part cannot be cut
+bool cutPart(VoxelGrid& grid, Array<VoxelPart>& parts, uint32 partIndex, MemoryAllocator& allocator) {
+
+    const int32 partId = static_cast<int32>(partIndex);
+    const VoxelPart part = parts[partIndex];
+
+    int bestAxis = -1;
+    int32 bestPlane = 0;
+    decimal bestCost = DECIMAL_LARGEST;
+    Array<uint32> slabNbVoxels(allocator);
+    for (int axis=0; axis < 3; axis++) {
+
+        const int32 extent = part.max[axis] - part.min[axis] + 1;
+        if (extent < 2) continue;
+
+        // Count the voxels of each slab of the part orthogonal to the axis
+        slabNbVoxels.clear();
+        for (int32 i=0; i < extent; i++) slabNbVoxels.add(0);
+        int32 coordinates[3];
+        for (coordinates[2]=part.min[2]; coordinates[2] <= part.max[2]; coordinates[2]++) {
+            for (coordinates[1]=part.min[1]; coordinates[1] <= part.max[1]; coordinates[1]++) {
+                for (coordinates[0]=part.min[0]; coordinates[0] <= part.max[0]; coordinates[0]++) {
+                    if (grid.mVoxels[grid.getIndex(coordinates)] == partId) {
+                        slabNbVoxels[coordinates[axis] - part.min[axis]]++;
+                    }
+                }
+            }
+        }
+
+        // Test evenly spaced cutting planes (a plane is the first slab of the second part)
+        const int32 nbPlanes = std::min(extent - 1, NB_CUTTING_PLANES_PER_AXIS);
+        for (int32 p=1; p <= nbPlanes; p++) {
+
+            const int32 plane = part.min[axis] + (p * extent) / (nbPlanes + 1);
+            if (plane <= part.min[axis] || plane > part.max[axis]) continue;
+
+            uint32 nbVoxelsBefore = 0;
+            for (int32 i=0; i < plane - part.min[axis]; i++) nbVoxelsBefore += slabNbVoxels[i];
+            if (nbVoxelsBefore == 0 || nbVoxelsBefore == part.nbVoxels) continue;
+
+            int32 maxBefore[3] = {part.max[0], part.max[1], part.max[2]};
+            int32 minAfter[3] = {part.min[0], part.min[1], part.min[2]};
+            maxBefore[axis] = plane - 1;
+            minAfter[axis] = plane;
+            const decimal cost = computeConcavity(grid, partId, part.min, maxBefore, nbVoxelsBefore, allocator) +
+                                 computeConcavity(grid, partId, minAfter, part.max, part.nbVoxels - nbVoxelsBefore, allocator);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestPlane = plane;
+            }
+        }
+    }
+
+    if (bestAxis == -1) return false;
+
+    // Move the voxels after the plane into a new part
+    const int32 newPartId = static_cast<int32>(parts.size());
+    int32 minAfter[3] = {part.min[0], part.min[1], part.min[2]};
+    minAfter[bestAxis] = bestPlane;
+    int32 coordinates[3];
+    for (coordinates[2]=minAfter[2]; coordinates[2] <= part.max[2]; coordinates[2]++) {
+        for (coordinates[1]=minAfter[1]; coordinates[1] <= part.max[1]; coordinates[1]++) {
+            for (coordinates[0]=minAfter[0]; coordinates[0] <= part.max[0]; coordinates[0]++) {
+                const int32 index = grid.getIndex(coordinates);
+                if (grid.mVoxels[index] == partId) grid.mVoxels[index] = newPartId;
+            }
+        }
+    }
+
+    int32 maxBefore[3] = {part.max[0], part.max[1], part.max[2]};
+    maxBefore[bestAxis] = bestPlane - 1;
+
+    VoxelPart newPart;
+    grid.computePartBounds(newPartId, minAfter, part.max, newPart);
+    newPart.concavity = computeConcavity(grid, newPartId, newPart.min, newPart.max, newPart.nbVoxels, allocator);
+    newPart.isFinal = false;
+
+    VoxelPart& firstPart = parts[partIndex];
+    grid.computePartBounds(partId, part.min, maxBefore, firstPart);
+    firstPart.concavity = computeConcavity(grid, partId, firstPart.min, firstPart.max, firstPart.nbVoxels, allocator);
+
+    parts.add(newPart);
+
+    return true;
+}
+
+}
+
+// Compute the approximate convex decomposition of a triangle mesh
+/**
+ * @param vertices Array of vertices of the mesh
+ * @param triangleIndices Three vertex indices per triangle
+ * @param nbTriangles Number of triangles of the mesh
+ * @param allocator Memory allocator used for the temporary data
+ * @param settings Budget and precision of the decomposition
+ * @param[out] outVertices Vertices of all the hulls
+ * @param[out] outIndices Vertex indices of the faces (relative to the first vertex of their hull)
+ * @param[out] outFaces Polygon faces (index base relative to the first index of their hull)
+ * @param[out] outHulls Ranges of each hull inside the output arrays
+ * @return False if the mesh is empty or flat
+ */
+bool ConvexDecomposition::computeDecomposition(const Vector3* vertices, const uint32* triangleIndices, uint32 nbTriangles,
+                                               MemoryAllocator& allocator, const Settings& settings,
+                                               Array<Vector3>& outVertices, Array<uint32>& outIndices,
+                                               Array<PolygonVertexArray::PolygonFace>& outFaces, Array<Hull>& outHulls) {
+
+    outVertices.clear();
+    outIndices.clear();
+    outFaces.clear();
+    outHulls.clear();
+
+    if (nbTriangles == 0) return false;
+
+    VoxelGrid grid(allocator);
+    if (!grid.voxelize(vertices, triangleIndices, nbTriangles, std::max(settings.resolution, uint32(2)))) return false;
+
+    // The whole mesh is the first part
+    Array<VoxelPart> parts(allocator);
+    const int32 gridMin[3] = {0, 0, 0};
+    const int32 gridMax[3] = {grid.mSize[0] - 1, grid.mSize[1] - 1, grid.mSize[2] - 1};
+    VoxelPart wholePart;
+    grid.computePartBounds(0, gridMin, gridMax, wholePart);
+    decimal wholeHullVolume = 0;
+    wholePart.concavity = computeConcavity(grid, 0, wholePart.min, wholePart.max, wholePart.nbVoxels, allocator,
+                                           &wholeHullVolume);
+    wholePart.isFinal = false;
+    parts.add(wholePart);
+    if (wholeHullVolume <= 0) return false;
+
+    // Cut the most concave part until the budget is reached or all the parts are convex enough
+    const decimal concavityThreshold = settings.concavity * wholeHullVolume;
+    const uint32 maxNbHulls = std::max(settings.maxNbHulls, uint32(1));
+    while (parts.size() < maxNbHulls) {
+
+        int32 mostConcavePart = -1;
+        for (uint32 p=0; p < parts.size(); p++) {
+            if (!parts[p].isFinal && parts[p].concavity > concavityThreshold &&
+                (mostConcavePart == -1 || parts[p].concavity > parts[mostConcavePart].concavity)) {
+                mostConcavePart = static_cast<int32>(p);
+            }
+        }
+        if (mostConcavePart == -1) break;
+
+        if (!cutPart(grid, parts, static_cast<uint32>(mostConcavePart), allocator)) {
+            parts[mostConcavePart].isFinal = true;
+        }
+    }
+
+    // Compute the convex hull of each part from the voxel centers and the mesh vertices inside the part
+    Array<Vector3> points(allocator);
+    Array<Vector3> hullVertices(allocator);
+    Array<uint32> hullIndices(allocator);
+    Array<PolygonVertexArray::PolygonFace> hullFaces(allocator);
+    for (uint32 p=0; p < parts.size(); p++) {
+
+        const int32 partId = static_cast<int32>(p);
+        points.clear();
+        grid.addHullPoints(partId, parts[p].min, parts[p].max, 0, false, points);
+        for (uint32 i=0; i < nbTriangles * 3; i++) {
+            const Vector3& vertex = vertices[triangleIndices[i]];
+            if (grid.mVoxels[grid.getVoxelIndex(vertex)] == partId) points.add(vertex);
+        }
+
+        bool isHullValid = QuickHull::computeConvexHull(&points[0], static_cast<uint32>(points.size()), allocator,
+                                                        hullVertices, hullIndices, hullFaces, settings.maxNbVerticesPerHull);
+        if (!isHullValid) {
+
+            // The part is too thin, use the corners of its voxels
+            points.clear();
+            grid.addHullPoints(partId, parts[p].min, parts[p].max, 0, true, points);
+            isHullValid = QuickHull::computeConvexHull(&points[0], static_cast<uint32>(points.size()), allocator,
+                                                       hullVertices, hullIndices, hullFaces, settings.maxNbVerticesPerHull);
+        }
+        if (!isHullValid) continue;
+
+        Hull hull;
+        hull.verticesStart = static_cast<uint32>(outVertices.size());
+        hull.nbVertices = static_cast<uint32>(hullVertices.size());
+        hull.facesStart = static_cast<uint32>(outFaces.size());
+        hull.nbFaces = static_cast<uint32>(hullFaces.size());
+        hull.indicesStart = static_cast<uint32>(outIndices.size());
+        hull.nbIndices = static_cast<uint32>(hullIndices.size());
+        outVertices.addRange(hullVertices);
+        outIndices.addRange(hullIndices);
+        outFaces.addRange(hullFaces);
+        outHulls.add(hull);
+    }
+
+    return outHulls.size() > 0;
+}
@@ -42,7 +42,9 @@ using namespace reactphysics3d;
 // Constructor
 DebugRenderer::DebugRenderer(MemoryAllocator& allocator)
               :mAllocator(allocator), mLines(allocator), mTriangles(allocator), mDisplayedDebugItems(0), mMapDebugItemWithColor(allocator),
-               mContactPointSphereRadius(DEFAULT_CONTACT_POINT_SPHERE_RADIUS), mContactNormalLength(DEFAULT_CONTACT_NORMAL_LENGTH) {
+               mContactPointSphereRadius(DEFAULT_CONTACT_POINT_SPHERE_RADIUS), mContactNormalLength(DEFAULT_CONTACT_NORMAL_LENGTH),
+               mHasViewAABB(false), mHasViewFrustum(false), mMaxNbPrimitives(0), mIsStaticCacheEnabled(true),
+               mStaticCacheEntries(allocator), mStaticCacheFrame(0) {
 
     mMapDebugItemWithColor.add(Pair<DebugItem, uint32>(DebugItem::COLLIDER_AABB, static_cast<uint32>(DebugColor::MAGENTA)));
     mMapDebugItemWithColor.add(Pair<DebugItem, uint32>(DebugItem::COLLIDER_BROADPHASE_AABB, static_cast<uint32>(DebugColor::YELLOW)));
@@ -54,6 +56,7 @@ DebugRenderer::DebugRenderer(MemoryAllocator& allocator)
 // Destructor
 DebugRenderer::~DebugRenderer() {
 
+    clearStaticCache();
 }
 
 // Clear all the debugging primitives (points, lines, triangles, ...)
@@ -394,6 +397,180 @@ void DebugRenderer::drawCollisionShapeOfCollider(const Collider* collider, uint3
     }
 }
 
+// Draw the collision shape of a collider of a static body using the cache
+/// The cached entries are mapped with the collider entities. If the entry of the collider does not match
+/// (transform, shape, shape size or color), only the primitives of this collider are generated again.
+void DebugRenderer::drawCachedCollisionShapeOfCollider(const Collider* collider, bool isDisplayed, uint32 color) {
+
+    const CollisionShape* shape = collider->getCollisionShape();
+    const Transform transform = collider->getLocalToWorldTransform();
+
+    StaticCacheEntry* entry;
+    auto it = mStaticCacheEntries.find(collider->getEntity());
+    if (it != mStaticCacheEntries.end()) {
+
+        entry = it->second;
+        entry->frame = mStaticCacheFrame;
+        if (entry->shape == shape && entry->shapeVersion == shape->getVersion() &&
+            entry->transform == transform && entry->color == color) {
+
+            if (isDisplayed) {
+                for (uint32 i = 0; i < entry->lines.size(); i++) {
+                    mLines.add(entry->lines[i]);
+                }
+                for (uint32 i = 0; i < entry->triangles.size(); i++) {
+                    mTriangles.add(entry->triangles[i]);
+                }
+            }
+            return;
+        }
+
+        entry->lines.clear();
+        entry->triangles.clear();
+    }
+    else {
+
+        entry = new (mAllocator.allocate(sizeof(StaticCacheEntry))) StaticCacheEntry(mAllocator);
+        entry->frame = mStaticCacheFrame;
+        mStaticCacheEntries.add(Pair<Entity, StaticCacheEntry*>(collider->getEntity(), entry));
+    }
+
+    const uint32 nbLinesBefore = static_cast<uint32>(mLines.size());
+    const uint32 nbTrianglesBefore = static_cast<uint32>(mTriangles.size());
+
+    drawCollisionShapeOfCollider(collider, color);
+
+    entry->shape = shape;
+    entry->shapeVersion = shape->getVersion();
+    entry->transform = transform;
+    entry->color = color;
+
+    for (uint32 i = nbLinesBefore; i < mLines.size(); i++) {
+        entry->lines.add(mLines[i]);
+    }
+    for (uint32 i = nbTrianglesBefore; i < mTriangles.size(); i++) {
+        entry->triangles.add(mTriangles[i]);
+    }
+
+    // The primitives were only generated for the cache
+    if (!isDisplayed) {
+        while (mLines.size() > nbLinesBefore) mLines.removeAt(mLines.size() - 1);
+        while (mTriangles.size() > nbTrianglesBefore) mTriangles.removeAt(mTriangles.size() - 1);
+    }
+}
+
+// Remove the cached entries of the colliders that were not drawn in the current frame
+/// Those colliders were destroyed, disabled or their body is not static anymore
+void DebugRenderer::removeUnusedStaticCacheEntries() {
+
+    for (auto it = mStaticCacheEntries.begin(); it != mStaticCacheEntries.end(); ) {
+
+        if (it->second->frame != mStaticCacheFrame) {
+
+            it->second->~StaticCacheEntry();
+            mAllocator.release(it->second, sizeof(StaticCacheEntry));
+            it = mStaticCacheEntries.remove(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+// Remove all the cached entries
+void DebugRenderer::clearStaticCache() {
+
+    for (auto it = mStaticCacheEntries.begin(); it != mStaticCacheEntries.end(); ++it) {
+
+        it->second->~StaticCacheEntry();
+        mAllocator.release(it->second, sizeof(StaticCacheEntry));
+    }
+    mStaticCacheEntries.clear(true);
+}
+
+// Remove the last primitives that are over the maximum number of primitives
+void DebugRenderer::applyPrimitivesBudget() {
+
+    if (mMaxNbPrimitives == 0) return;
+
+    while (mTriangles.size() > 0 && mLines.size() + mTriangles.size() > mMaxNbPrimitives) {
+        mTriangles.removeAt(mTriangles.size() - 1);
+    }
+    while (mLines.size() > mMaxNbPrimitives) {
+        mLines.removeAt(mLines.size() - 1);
+    }
+}
+
+// Return true if a world-space AABB is inside the view region
+bool DebugRenderer::isInViewRegion(const AABB& aabb) const {
+
+    if (mHasViewAABB && !mViewAABB.testCollision(aabb)) return false;
+
+    if (mHasViewFrustum) {
+
+        const Vector3& min = aabb.getMin();
+        const Vector3& max = aabb.getMax();
+
+        for (int i = 0; i < 6; i++) {
+
+            // Corner of the AABB that is the farthest along the plane normal
+            const Vector3& n = mViewFrustumNormals[i];
+            const Vector3 corner(n.x >= decimal(0.0) ? max.x : min.x,
+                                 n.y >= decimal(0.0) ? max.y : min.y,
+                                 n.z >= decimal(0.0) ? max.z : min.z);
+
+            if (n.dot(corner) + mViewFrustumDistances[i] < decimal(0.0)) return false;
+        }
+    }
+
+    return true;
+}
+
+// Display only the colliders that overlap a world-space AABB
+/**
+ * @param aabb The AABB of the region to display (in world-space)
+ */
+void DebugRenderer::setViewAABB(const AABB& aabb) {
+    mViewAABB = aabb;
+    mHasViewAABB = true;
+}
+
+// Remove the view AABB
+void DebugRenderer::removeViewAABB() {
+    mHasViewAABB = false;
+}
+
+// Display only the colliders inside a frustum given by six planes
+/// A point p is inside a plane if dot(normal, p) + distance >= 0.
+/**
+ * @param planeNormals Array with the normals of the six planes (pointing inside the frustum)
+ * @param planeDistances Array with the distances of the six planes
+ */
+void DebugRenderer::setViewFrustum(const Vector3* planeNormals, const decimal* planeDistances) {
+    for (int i = 0; i < 6; i++) {
+        mViewFrustumNormals[i] = planeNormals[i];
+        mViewFrustumDistances[i] = planeDistances[i];
+    }
+    mHasViewFrustum = true;
+}
+
+// Remove the view frustum
+void DebugRenderer::removeViewFrustum() {
+    mHasViewFrustum = false;
+}
+
+// Set whether the shape primitives of static bodies are cached
+/// The cached primitives are only generated again when the transform or the shape of a collider changes.
+/**
+ * @param isEnabled True if the primitives of static bodies are cached
+ */
+void DebugRenderer::setIsStaticCacheEnabled(bool isEnabled) {
+    mIsStaticCacheEnabled = isEnabled;
+    if (!isEnabled) {
+        clearStaticCache();
+    }
+}
+
 // Generate the rendering primitives (triangles, lines, ...) of a physics world
 void DebugRenderer::computeDebugRenderingPrimitives(const PhysicsWorld& world) {
 
@@ -404,6 +581,8 @@ void DebugRenderer::computeDebugRenderingPrimitives(const PhysicsWorld& world) {
     const uint32 nbCollisionBodies = world.getNbCollisionBodies();
     const uint32 nbRigidBodies = world.getNbRigidBodies();
 
+    mStaticCacheFrame++;
+
     // For each body of the world
     for (uint32 b = 0; b < nbCollisionBodies + nbRigidBodies; b++) {
 
@@ -412,20 +591,29 @@ void DebugRenderer::computeDebugRenderingPrimitives(const PhysicsWorld& world) {
 
         if (body->isActive()) {
 
+            // Collision bodies and static rigid bodies only move when the user moves them
+            const bool useStaticCache = mIsStaticCacheEnabled && drawCollisionShape &&
+                    (b < nbCollisionBodies || static_cast<const RigidBody*>(body)->getType() == BodyType::STATIC);
+
             // For each collider of the body
             for (uint32 c = 0; c < body->getNbColliders(); c++) {
 
                 // Get a collider
                 const Collider* collider = body->getCollider(c);
 
+                const bool isDisplayed = isInViewRegion(collider->getWorldAABB()) && hasPrimitivesBudget();
+
+                // The cache must contain the static colliders that are not displayed too
+                if (!isDisplayed && !useStaticCache) continue;
+
                 // If we need to draw the collider AABB
-                if (drawColliderAABB) {
+                if (drawColliderAABB && isDisplayed) {
 
                     drawAABB(collider->getWorldAABB(), mMapDebugItemWithColor[DebugItem::COLLIDER_AABB]);
                 }
 
                 // If we need to draw the collider broad-phase AABB
-                if (drawColliderBroadphaseAABB) {
+                if (drawColliderBroadphaseAABB && isDisplayed) {
 
                     if (collider->getBroadPhaseId() != -1) {
                         drawAABB(world.mCollisionDetection.mBroadPhaseSystem.getFatAABB(collider->getBroadPhaseId()), mMapDebugItemWithColor[DebugItem::COLLIDER_BROADPHASE_AABB]);
@@ -433,13 +621,26 @@ void DebugRenderer::computeDebugRenderingPrimitives(const PhysicsWorld& world) {
                 }
 
                 // If we need to draw the collision shape
-                if (drawCollisionShape) {
+                if (useStaticCache) {
+
+                    drawCachedCollisionShapeOfCollider(collider, isDisplayed, mMapDebugItemWithColor[DebugItem::COLLISION_SHAPE]);
+                }
+                else if (drawCollisionShape) {
 
                     drawCollisionShapeOfCollider(collider, mMapDebugItemWithColor[DebugItem::COLLISION_SHAPE]);
                 }
+
+                if (isDisplayed) {
+                    applyPrimitivesBudget();
+                }
             }
         }
     }
+
+    // Remove the entries of the static colliders that do not exist anymore
+    if (mIsStaticCacheEnabled && drawCollisionShape) {
+        removeUnusedStaticCacheEntries();
+    }
 }
 
 // Called when some contacts occur
@@ -0,0 +1,526 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/utils/QuickHull.h>
+#include <reactphysics3d/containers/Map.h>
+#include <limits>
+
+using namespace reactphysics3d;
+
+namespace {
+
+/// Triangle face of the hull during the construction
+struct HullFace {
+
+    /// Indices of the three vertices (counter-clockwise seen from outside)
+    uint32 v[3];
+
+    /// Outward unit normal of the face
+    Vector3 normal;
+
+    /// Signed distance of the face plane to the origin
+    decimal offset;
+
+    /// First point of the outside set of the face (-1 if empty)
+    int32 outsideHead;
+
+    /// Point of the outside set that is the farthest from the face
+    int32 farthestPoint;
+
+    /// Distance of the farthest point of the outside set
+    decimal farthestDistance;
+
+    /// Stamp of the last iteration that has visited this face
+    uint32 visitStamp;
+
+    /// True if the face is visible from the eye point of the current iteration
+    bool isVisible;
+
+    /// False if the face has been removed from the hull
+    bool isValid;
+};
+
+// Return the key of a directed edge in the edge map
+inline uint64 edgeKey(uint32 a, uint32 b) {
+    return (uint64(a) << 32) | uint64(b);
+}
+
+// Return the signed distance of a point to the plane of a face
+inline decimal distanceToFace(const HullFace& face, const Vector3& point) {
+    return face.normal.dot(point) - face.offset;
+}
+
+/// Internal state of a convex hull computation
+class HullBuilder {
+
+    public:
+
+        const Vector3* mPoints;
+        uint32 mNbPoints;
+        decimal mEpsilon;
+
+        Array<HullFace> mFaces;
+        Map<uint64, uint32> mEdgeToFace;
+
+        /// Next point in the outside set linked list of a face
+        Array<int32> mNextOutside;
+
+        /// Number of valid faces that use each point as a vertex
+        Array<uint32> mVertexUseCount;
+
+        /// Number of points that are currently vertices of the hull
+        uint32 mNbHullVertices;
+
+        HullBuilder(const Vector3* points, uint32 nbPoints, MemoryAllocator& allocator)
+            : mPoints(points), mNbPoints(nbPoints), mEpsilon(0), mFaces(allocator), mEdgeToFace(allocator),
+              mNextOutside(allocator, nbPoints), mVertexUseCount(allocator, nbPoints), mNbHullVertices(0) {
+
+            for (uint32 i=0; i < nbPoints; i++) {
+                mNextOutside.add(-1);
+                mVertexUseCount.add(0);
+            }
+        }
+
+        // Add a new face to the hull and return its index
+        uint32 addFace(uint32 a, uint32 b, uint32 c, const Vector3& fallbackNormal) {
+
+            HullFace face;
+            face.v[0] = a;
+            face.v[1] = b;
+            face.v[2] = c;
+            Vector3 normal = (mPoints[b] - mPoints[a]).cross(mPoints[c] - mPoints[a]);
+            const decimal length = normal.length();
+            face.normal = length > MACHINE_EPSILON ? normal / length : fallbackNormal;
+            face.offset = face.normal.dot(mPoints[a]);
+            face.outsideHead = -1;
+            face.farthestPoint = -1;
+            face.farthestDistance = 0;
+            face.visitStamp = 0;
+            face.isVisible = false;
+            face.isValid = true;
+
+            const uint32 faceIndex = static_cast<uint32>(mFaces.size());
+            mFaces.add(face);
+
+            for (uint32 i=0; i < 3; i++) {
+                mEdgeToFace.add(Pair<uint64, uint32>(edgeKey(face.v[i], face.v[(i + 1) % 3]), faceIndex), true);
+                if (mVertexUseCount[face.v[i]]++ == 0) mNbHullVertices++;
+            }
+
+            return faceIndex;
+        }
+
+        // Remove a face from the hull
+        void removeFace(uint32 faceIndex) {
+
+            HullFace& face = mFaces[faceIndex];
+            face.isValid = false;
+            for (uint32 i=0; i < 3; i++) {
+                mEdgeToFace.remove(edgeKey(face.v[i], face.v[(i + 1) % 3]));
+                if (--mVertexUseCount[face.v[i]] == 0) mNbHullVertices--;
+            }
+        }
+
+        // Return the face on the other side of the edge (a, b) of a face
+        uint32 getNeighborFace(uint32 a, uint32 b) const {
+            auto it = mEdgeToFace.find(edgeKey(b, a));
+            assert(it != mEdgeToFace.end());
+            return it->second;
+        }
+
+        // Add a point to the outside set of the first face that can see it
+        void assignPoint(uint32 pointIndex, const Array<uint32>& faces) {
+
+            for (uint32 i=0; i < faces.size(); i++) {
+
+                HullFace& face = mFaces[faces[i]];
+                const decimal distance = distanceToFace(face, mPoints[pointIndex]);
+                if (distance > mEpsilon) {
+
+                    mNextOutside[pointIndex] = face.outsideHead;
+                    face.outsideHead = static_cast<int32>(pointIndex);
+                    if (face.farthestPoint == -1 || distance > face.farthestDistance) {
+                        face.farthestPoint = static_cast<int32>(pointIndex);
+                        face.farthestDistance = distance;
+                    }
+                    return;
+                }
+            }
+
+            // The point is inside the hull and can be discarded
+        }
+
+        // Build the initial tetrahedron of the hull
+        bool buildInitialSimplex(MemoryAllocator& allocator) {
+
+            // Compute the extreme points along each axis
+            uint32 minIndices[3] = {0, 0, 0};
+            uint32 maxIndices[3] = {0, 0, 0};
+            decimal maxAbsCoordinates[3] = {0, 0, 0};
+            for (uint32 i=0; i < mNbPoints; i++) {
+                for (int axis=0; axis < 3; axis++) {
+                    if (mPoints[i][axis] < mPoints[minIndices[axis]][axis]) minIndices[axis] = i;
+                    if (mPoints[i][axis] > mPoints[maxIndices[axis]][axis]) maxIndices[axis] = i;
+                    maxAbsCoordinates[axis] = std::max(maxAbsCoordinates[axis], std::abs(mPoints[i][axis]));
+                }
+            }
+
+            // Tolerance used to classify the points against the faces (relative to the size of the cloud)
+            mEpsilon = decimal(3.0) * std::numeric_limits<decimal>::epsilon() *
+                       (maxAbsCoordinates[0] + maxAbsCoordinates[1] + maxAbsCoordinates[2]);
+
+            // The two first points are the extreme points along the axis with the largest extent
+            int bestAxis = 0;
+            decimal bestExtent = -1;
+            for (int axis=0; axis < 3; axis++) {
+                const decimal extent = mPoints[maxIndices[axis]][axis] - mPoints[minIndices[axis]][axis];
+                if (extent > bestExtent) {
+                    bestExtent = extent;
+                    bestAxis = axis;
+                }
+            }
+            if (bestExtent <= mEpsilon) return false;
+            const uint32 i0 = minIndices[bestAxis];
+            const uint32 i1 = maxIndices[bestAxis];
+
+            // The third point is the farthest point from the line (i0, i1)
+            const Vector3 lineDirection = (mPoints[i1] - mPoints[i0]).getUnit();
+            uint32 i2 = i0;
+            decimal maxDistance = 0;
+            for (uint32 i=0; i < mNbPoints; i++) {
+                const decimal distance = (mPoints[i] - mPoints[i0]).cross(lineDirection).length();
+                if (distance > maxDistance) {
+                    maxDistance = distance;
+                    i2 = i;
+                }
+            }
+            if (maxDistance <= mEpsilon) return false;
+
+            // The fourth point is the farthest point from the plane (i0, i1, i2)
+            const Vector3 planeNormal = (mPoints[i1] - mPoints[i0]).cross(mPoints[i2] - mPoints[i0]).getUnit();
+            uint32 i3 = i0;
+            decimal maxSignedDistance = 0;
+            maxDistance = 0;
+            for (uint32 i=0; i < mNbPoints; i++) {
+                const decimal signedDistance = planeNormal.dot(mPoints[i] - mPoints[i0]);
+                if (std::abs(signedDistance) > maxDistance) {
+                    maxDistance = std::abs(signedDistance);
+                    maxSignedDistance = signedDistance;
+                    i3 = i;
+                }
+            }
+            if (maxDistance <= mEpsilon) return false;
+
+            // Create the base triangle such that the fourth point is behind it
+            uint32 a = i0, b = i1, c = i2;
+            Vector3 baseNormal = planeNormal;
+            if (maxSignedDistance > 0) {
+                std::swap(b, c);
+                baseNormal = -planeNormal;
+            }
+            Array<uint32> faces(allocator, 4);
+            faces.add(addFace(a, b, c, baseNormal));
+            faces.add(addFace(b, a, i3, baseNormal));
+            faces.add(addFace(c, b, i3, baseNormal));
+            faces.add(addFace(a, c, i3, baseNormal));
+
+            // Assign the remaining points to the faces
+            for (uint32 i=0; i < mNbPoints; i++) {
+                if (i == i0 || i == i1 || i == i2 || i == i3) continue;
+                assignPoint(i, faces);
+            }
+
+            return true;
+        }
+
+        // Return the index of the face with the farthest outside point (-1 if there is none)
+        int32 findEyeFace() const {
+
+            int32 bestFace = -1;
+            decimal bestDistance = 0;
+            for (uint32 f=0; f < mFaces.size(); f++) {
+                const HullFace& face = mFaces[f];
+                if (face.isValid && face.farthestPoint != -1 && face.farthestDistance > bestDistance) {
+                    bestDistance = face.farthestDistance;
+                    bestFace = static_cast<int32>(f);
+                }
+            }
+
+            return bestFace;
+        }
+
+        // Add the farthest point of a face to the hull
+        void addEyePoint(uint32 eyeFace, uint32 stamp, MemoryAllocator& allocator) {
+
+            const uint32 eyePoint = static_cast<uint32>(mFaces[eyeFace].farthestPoint);
+            const Vector3& eye = mPoints[eyePoint];
+
+            Array<uint32> visibleFaces(allocator);
+            Array<uint32> horizonEdges(allocator);
+            Array<uint32> horizonVisibleFaces(allocator);
+            Array<uint32> stack(allocator);
+
+            // Find the faces visible from the eye point and the horizon edges
+            mFaces[eyeFace].visitStamp = stamp;
+            mFaces[eyeFace].isVisible = true;
+            stack.add(eyeFace);
+            while (stack.size() > 0) {
+
+                const uint32 faceIndex = stack[stack.size() - 1];
+                stack.removeAt(stack.size() - 1);
+                visibleFaces.add(faceIndex);
+
+                for (uint32 i=0; i < 3; i++) {
+
+                    const uint32 a = mFaces[faceIndex].v[i];
+                    const uint32 b = mFaces[faceIndex].v[(i + 1) % 3];
+                    const uint32 neighbor = getNeighborFace(a, b);
+                    HullFace& neighborFace = mFaces[neighbor];
+
+                    if (neighborFace.visitStamp != stamp) {
+                        neighborFace.visitStamp = stamp;
+                        neighborFace.isVisible = distanceToFace(neighborFace, eye) > mEpsilon;
+                        if (neighborFace.isVisible) {
+                            stack.add(neighbor);
+                            continue;
+                        }
+                    }
+
+                    if (!neighborFace.isVisible) {
+                        horizonEdges.add(a);
+                        horizonEdges.add(b);
+                        horizonVisibleFaces.add(faceIndex);
+                    }
+                }
+            }
+
+            // Gather the outside points of the visible faces and remove those faces
+            Array<uint32> orphanPoints(allocator);
+            for (uint32 i=0; i < visibleFaces.size(); i++) {
+
+                int32 point = mFaces[visibleFaces[i]].outsideHead;
+                while (point != -1) {
+                    if (static_cast<uint32>(point) != eyePoint) orphanPoints.add(static_cast<uint32>(point));
+                    point = mNextOutside[point];
+                }
+                removeFace(visibleFaces[i]);
+            }
+
+            // Connect the horizon to the eye point
+            Array<uint32> newFaces(allocator, horizonVisibleFaces.size());
+            for (uint32 i=0; i < horizonVisibleFaces.size(); i++) {
+                newFaces.add(addFace(horizonEdges[i * 2], horizonEdges[i * 2 + 1], eyePoint,
+                                     mFaces[horizonVisibleFaces[i]].normal));
+            }
+
+            // Assign the orphan points to the new faces
+            for (uint32 i=0; i < orphanPoints.size(); i++) {
+                assignPoint(orphanPoints[i], newFaces);
+            }
+        }
+};
+
+}
+
+// Compute the convex hull of a cloud of points
+/**
+ * @param points Array of points of the cloud
+ * @param nbPoints Number of points in the cloud
+ * @param allocator Memory allocator used for the temporary data
+ * @param[out] outVertices Vertices of the hull
+ * @param[out] outIndices Vertex indices of the faces of the hull (counter-clockwise seen from outside)
+ * @param[out] outFaces Polygon faces of the hull (ranges inside the array of indices)
+ * @param maxNbVertices Maximum number of vertices of the hull (0 for no limit)
+ * @param coplanarAngleTolerance Maximum angle (in radians) between the normals of adjacent triangles
+ *                               that are merged into the same polygon face
+ * @return False if the points do not define a volume (less than four points or all points coplanar)
+ */
+bool QuickHull::computeConvexHull(const Vector3* points, uint32 nbPoints, MemoryAllocator& allocator,
+                                  Array<Vector3>& outVertices, Array<uint32>& outIndices,
+                                  Array<PolygonVertexArray::PolygonFace>& outFaces,
+                                  uint32 maxNbVertices, decimal coplanarAngleTolerance) {
+
+    outVertices.clear();
+    outIndices.clear();
+    outFaces.clear();
+
+    if (nbPoints < 4) return false;
+    if (maxNbVertices != 0 && maxNbVertices < 4) maxNbVertices = 4;
+
+    HullBuilder builder(points, nbPoints, allocator);
+    if (!builder.buildInitialSimplex(allocator)) return false;
+
+    // Grow the hull with the farthest point until all the points are inside or the budget is reached
+    uint32 stamp = 1;
+    while (maxNbVertices == 0 || builder.mNbHullVertices < maxNbVertices) {
+
+        const int32 eyeFace = builder.findEyeFace();
+        if (eyeFace == -1) break;
+
+        builder.addEyePoint(static_cast<uint32>(eyeFace), stamp++, allocator);
+    }
+
+    // Group the adjacent coplanar triangles
+    const decimal cosTolerance = std::cos(coplanarAngleTolerance);
+    const uint32 nbTriangles = static_cast<uint32>(builder.mFaces.size());
+    Array<int32> triangleGroups(allocator, nbTriangles);
+    for (uint32 f=0; f < nbTriangles; f++) triangleGroups.add(-1);
+
+    Array<uint32> loopIndices(allocator);
+    Array<PolygonVertexArray::PolygonFace> loops(allocator);
+    Array<uint32> groupTriangles(allocator);
+    Array<uint32> stack(allocator);
+    int32 nbGroups = 0;
+    for (uint32 f=0; f < nbTriangles; f++) {
+
+        if (!builder.mFaces[f].isValid || triangleGroups[f] != -1) continue;
+
+        const Vector3 groupNormal = builder.mFaces[f].normal;
+        const int32 group = nbGroups++;
+        groupTriangles.clear();
+        stack.clear();
+        triangleGroups[f] = group;
+        stack.add(f);
+        while (stack.size() > 0) {
+
+            const uint32 triangle = stack[stack.size() - 1];
+            stack.removeAt(stack.size() - 1);
+            groupTriangles.add(triangle);
+
+            for (uint32 i=0; i < 3; i++) {
+                const HullFace& face = builder.mFaces[triangle];
+                const uint32 neighbor = builder.getNeighborFace(face.v[i], face.v[(i + 1) % 3]);
+                if (triangleGroups[neighbor] == -1 && builder.mFaces[neighbor].normal.dot(groupNormal) >= cosTolerance) {
+                    triangleGroups[neighbor] = group;
+                    stack.add(neighbor);
+                }
+            }
+        }
+
+        // Chain the boundary edges of the group into a single polygon
+        Map<uint32, uint32> nextVertex(allocator);
+        bool isSimplePolygon = true;
+        uint32 nbBoundaryEdges = 0;
+        uint32 firstVertex = 0;
+        for (uint32 t=0; t < groupTriangles.size() && isSimplePolygon; t++) {
+            const HullFace& face = builder.mFaces[groupTriangles[t]];
+            for (uint32 i=0; i < 3; i++) {
+                const uint32 a = face.v[i];
+                const uint32 b = face.v[(i + 1) % 3];
+                if (triangleGroups[builder.getNeighborFace(a, b)] != group) {
+                    if (nextVertex.containsKey(a)) {
+                        isSimplePolygon = false;
+                        break;
+                    }
+                    nextVertex.add(Pair<uint32, uint32>(a, b));
+                    firstVertex = a;
+                    nbBoundaryEdges++;
+                }
+            }
+        }
+
+        const uint32 loopStart = static_cast<uint32>(loopIndices.size());
+        if (isSimplePolygon) {
+            uint32 vertex = firstVertex;
+            do {
+                loopIndices.add(vertex);
+                auto it = nextVertex.find(vertex);
+                if (it == nextVertex.end()) break;
+                vertex = it->second;
+            } while (vertex != firstVertex && loopIndices.size() - loopStart <= nbBoundaryEdges);
+
+            isSimplePolygon = vertex == firstVertex && loopIndices.size() - loopStart == nbBoundaryEdges;
+        }
+
+        if (isSimplePolygon) {
+            loops.add({nbBoundaryEdges, loopStart});
+        }
+        else {
+
+            // The group is not a disk, keep its triangles as separate faces
+            while (loopIndices.size() > loopStart) loopIndices.removeAt(loopIndices.size() - 1);
+            for (uint32 t=0; t < groupTriangles.size(); t++) {
+                const HullFace& face = builder.mFaces[groupTriangles[t]];
+                loops.add({3, static_cast<uint32>(loopIndices.size())});
+                for (uint32 i=0; i < 3; i++) loopIndices.add(face.v[i]);
+            }
+        }
+    }
+
+    // Remove the vertices that are shared by only two faces (they lie on an edge after the merge)
+    Array<uint32> vertexNbFaces(allocator, nbPoints);
+    Array<int32> vertexNewIndex(allocator, nbPoints);
+    for (uint32 i=0; i < nbPoints; i++) {
+        vertexNbFaces.add(0);
+        vertexNewIndex.add(-1);
+    }
+    for (uint32 i=0; i < loopIndices.size(); i++) vertexNbFaces[loopIndices[i]]++;
+
+    Array<uint32> loopSizes(allocator, loops.size());
+    for (uint32 l=0; l < loops.size(); l++) loopSizes.add(loops[l].nbVertices);
+    Array<bool> isVertexRemoved(allocator, nbPoints);
+    for (uint32 i=0; i < nbPoints; i++) isVertexRemoved.add(false);
+    for (uint32 v=0; v < nbPoints; v++) {
+
+        if (vertexNbFaces[v] != 2) continue;
+
+        uint32 vertexLoops[2];
+        uint32 nbVertexLoops = 0;
+        for (uint32 l=0; l < loops.size() && nbVertexLoops < 2; l++) {
+            for (uint32 i=0; i < loops[l].nbVertices; i++) {
+                if (loopIndices[loops[l].indexBase + i] == v) {
+                    vertexLoops[nbVertexLoops++] = l;
+                    break;
+                }
+            }
+        }
+        if (nbVertexLoops == 2 && loopSizes[vertexLoops[0]] > 3 && loopSizes[vertexLoops[1]] > 3) {
+            isVertexRemoved[v] = true;
+            loopSizes[vertexLoops[0]]--;
+            loopSizes[vertexLoops[1]]--;
+        }
+    }
+
+    // Output the faces with a compact array of vertices
+    for (uint32 l=0; l < loops.size(); l++) {
+
+        const uint32 indexBase = static_cast<uint32>(outIndices.size());
+        for (uint32 i=0; i < loops[l].nbVertices; i++) {
+
+            const uint32 v = loopIndices[loops[l].indexBase + i];
+            if (isVertexRemoved[v]) continue;
+
+            if (vertexNewIndex[v] == -1) {
+                vertexNewIndex[v] = static_cast<int32>(outVertices.size());
+                outVertices.add(points[v]);
+            }
+            outIndices.add(static_cast<uint32>(vertexNewIndex[v]));
+        }
+        outFaces.add({static_cast<uint32>(outIndices.size()) - indexBase, indexBase});
+    }
+
+    return true;
+}
@@ -81,6 +81,20 @@ namespace rp3dDefold {
             lua_setfield(L, -2, "collider");
     }
 
+    void pushRp3dShapeCastInfo(lua_State *L, const reactphysics3d::ShapeCastInfo &info){
+        lua_newtable(L);
+            pushRp3dVector3(L,info.worldPoint);
+            lua_setfield(L, -2, "worldPoint");
+            pushRp3dVector3(L,info.worldNormal);
+            lua_setfield(L, -2, "worldNormal");
+            lua_pushnumber(L,info.hitFraction);
+            lua_setfield(L, -2, "hitFraction");
+            CollisionBodyPush(L,info.body);
+            lua_setfield(L, -2, "body");
+            ColliderPush(L,info.collider);
+            lua_setfield(L, -2, "collider");
+    }
+
     void pushRp3dMaterial(lua_State *L, reactphysics3d::Material &material){
         lua_newtable(L);
             lua_pushnumber(L,material.getBounciness());
@@ -18,6 +18,10 @@ local WorldSettings = {
 	isSleepingEnabled = true;
 	--Number of iterations when solving the velocity constraints of the Sequential Impulse technique
 	defaultVelocitySolverNbIterations = 6,
+	--Number of substeps of each world update. The contacts are computed once per update and reused by the substeps
+	defaultNbSubsteps = 1,
+	--True if the ball-and-socket and hinge joints connected in a tree (chains, ropes, ragdolls) are solved exactly by the articulation solver
+	isArticulationSolverEnabled = false,
 	--Number of iterations when solving the position constraints of the Sequential Impulse technique
 	defaultPositionSolverNbIterations = 3,
 	--Time (in seconds) that a body must stay still to be considered sleeping
@@ -32,6 +36,74 @@ local WorldSettings = {
 	cosAngleSimilarContactManifold = 0.95,
 }
 
+---@class Rp3dCharacterControllerSettings
+local CharacterControllerSettings = {
+	--Up direction of the character
+	up = vmath.vector3(0, 1, 0),
+	--Max angle of a walkable surface (in radians)
+	maxSlopeAngle = math.pi / 4,
+	--Max height of a step that the character can climb
+	stepHeight = 0.3,
+	--Max distance to the ground for ground snapping. 0 to disable
+	snapDistance = 0.2,
+	--Distance kept between the shape and colliders. Should be > 0
+	skinWidth = 0.01,
+	--Force applied to dynamic bodies hit by the character
+	pushForce = 0,
+	--Bits mask of the collider categories that block the character
+	collideWithMaskBits = 0xFFFF,
+}
+
+---@class Rp3dRaycastVehicleSettings
+local RaycastVehicleSettings = {
+	--Forward direction of the vehicle (local space of the chassis)
+	forward = vmath.vector3(0, 0, -1),
+	--Up direction of the vehicle (local space of the chassis)
+	up = vmath.vector3(0, 1, 0),
+	--Bits mask of the collider categories that the wheels can touch
+	collideWithMaskBits = 0xFFFF,
+}
+
+---@class Rp3dForceFieldSettings
+local ForceFieldSettings = {
+	--rp3d.ForceFieldType
+	type = "WIND",
+	--Direction of the wind (world-space)
+	direction = vmath.vector3(1, 0, 0),
+	--Force of the wind or acceleration of the attractor
+	strength = 10,
+	--Center of the attractor (world-space)
+	center = vmath.vector3(0, 0, 0),
+	--Distance where the acceleration of the attractor becomes zero. 0 for a constant acceleration
+	radius = 0,
+	fluidDensity = 1000,
+	linearDrag = 1,
+	angularDrag = 1,
+	--Bits mask of the collider categories that are affected by the field
+	collideWithMaskBits = 0xFFFF,
+}
+
+---@class Rp3dWheelSettings
+local WheelSettings = {
+	--Top point of the suspension (local space of the chassis)
+	connectionPoint = vmath.vector3(0, 0, 0),
+	radius = 0.5,
+	suspensionRestLength = 0.6,
+	--Max compression of the suspension from its rest length
+	maxSuspensionTravel = 0.5,
+	--Stiffness of the suspension (per unit of chassis mass)
+	suspensionStiffness = 20,
+	--Damping of the suspension when compressed (per unit of chassis mass)
+	dampingCompression = 2.3,
+	--Damping of the suspension when extended (per unit of chassis mass)
+	dampingRelaxation = 4.4,
+	maxSuspensionForce = 6000,
+	--Friction coefficient of the tire
+	frictionSlip = 1.5,
+	--0 to apply the tire forces at the height of the center of mass
+	rollInfluence = 0.1,
+}
+
 --Represent a polygon face of the polyhedron.
 ---@class Rp3dPolygonFace
 local Rp3dPolygonFace = {
@@ -61,6 +133,17 @@ local Rp3dEventListener = {
 	---@param triggers Rp3dOverlapPair[]
 	onTrigger = function(triggers)
 
+	end,
+	--Called at the end of the step with all the joints broken during the step
+	---@param joints Rp3dJoint[]
+	onJointBreak = function(joints)
+
+	end,
+	--Called at the end of the step with the bodies whose sleeping state has changed since the previous step
+	---@param sleepingBodies Rp3dRigidBody[] bodies that have fallen asleep
+	---@param awakeBodies Rp3dRigidBody[] bodies that have been woken up
+	onSleepChange = function(sleepingBodies, awakeBodies)
+
 	end
 }
 
@@ -80,6 +163,14 @@ end
 ---@field collider Rp3dCollider
 local Rp3dRaycastInfo = {}
 
+---@class Rp3dShapeCastInfo
+---@field worldPoint vector3 Contact point on the surface of the hit collider in world-space coordinates.
+---@field worldNormal vector3 Surface normal of the hit collider at the contact point in world-space coordinates.
+---@field hitFraction number Fraction of the cast at the time of impact. The shape position is from + hitFraction * (to - from)
+---@field body Rp3dCollisionBody
+---@field collider Rp3dCollider
+local Rp3dShapeCastInfo = {}
+
 ---@class Rp3dOverlapPair
 ---@field collider1 Rp3dCollider
 ---@field collider2 Rp3dCollider
@@ -140,6 +231,8 @@ local Rp3dMaterial = {
 ---@field type string rp3d.JointInfoType
 ---@field positionCorrectionTechnique string rp3d.JointsPositionCorrectionTechnique
 ---@field isCollisionEnabled bool True if the two bodies of the joint are allowed to collide with each other.
+---@field breakForce number Force (in Newtons) above which the joint breaks. By default, the joint never breaks.
+---@field breakTorque number Torque (in Newtons * meters) above which the joint breaks. By default, the joint never breaks.
 local Rp3dJointInfo = {}
 
 ---@class Rp3dBallAndSocketJointInfo:Rp3dJointInfo
@@ -213,6 +306,26 @@ function Rp3dJoint:getReactionTorque(timeStep) end
 ---@return bool
 function Rp3dJoint:isCollisionEnabled() end
 
+--Return the force (in Newtons) above which the joint breaks.
+---@return number
+function Rp3dJoint:getBreakForce() end
+
+--Set the force (in Newtons) above which the joint breaks.
+---@param breakForce number
+function Rp3dJoint:setBreakForce(breakForce) end
+
+--Return the torque (in Newtons * meters) above which the joint breaks.
+---@return number
+function Rp3dJoint:getBreakTorque() end
+
+--Set the torque (in Newtons * meters) above which the joint breaks.
+---@param breakTorque number
+function Rp3dJoint:setBreakTorque(breakTorque) end
+
+--Return true if the force or the torque of the joint has exceeded its break threshold.
+---@return bool
+function Rp3dJoint:isBroken() end
+
 --Return the entity id of the joint.
 ---@return number
 function Rp3dJoint:getEntityId() end
@@ -444,6 +557,16 @@ function Collider:getIsTrigger() end
 ---@param isTrigger boolean
 function Collider:setIsTrigger(isTrigger) end
 
+--Return the number of colliders inside the trigger in the last update.
+---@return number
+function Collider:getNbTriggerOccupants() end
+
+--Find the colliders inside the trigger in the last update.
+--Write collider entity ids in the uint32 stream "collider" and body entity ids in the optional uint32 stream "body".
+---@param buffer buffer|nil
+---@return number number of colliders inside the trigger
+function Collider:getTriggerOccupants(buffer) end
+
 --	Return material properties of the collider.
 ---@return Rp3dMaterial
 function Collider:getMaterial() end
@@ -524,6 +647,12 @@ function CollisionBody:setTransformQuat(quat) end
 ---@return Rp3dCollider
 function CollisionBody:addCollider(collisionShape, transform) end
 
+--Create a collider for each collision shape with the same transform and add them to the body.
+---@param collisionShapes Rp3dCollisionShape[]
+---@param transform Rp3dTransform
+---@return Rp3dCollider[]
+function CollisionBody:addColliders(collisionShapes, transform) end
+
 ---@return Rp3dCollider
 ---@param index number [0,size)
 function CollisionBody:getCollider(index) end
@@ -584,6 +713,22 @@ function CollisionBody:setIsActive(isActive) end
 ---@return boolean
 function CollisionBody:isActive() end
 
+--Return true if the convex colliders of the body are grouped in a local tree
+--and share a single broad-phase proxy.
+---@return boolean
+function CollisionBody:isCompound() end
+
+--Group the convex colliders of the body in a local tree behind a single broad-phase proxy.
+--Use it for bodies with many colliders. Trigger and concave colliders keep their own proxy.
+---@param isCompound boolean
+function CollisionBody:setIsCompound(isCompound) end
+
+--Create a copy of the body (colliders, mass properties and settings) in the same world.
+--Velocities, forces, joints and user data are not copied.
+---@param transform Rp3dTransform
+---@return Rp3dCollisionBody|Rp3dRigidBody
+function CollisionBody:clone(transform) end
+
 ---@class Rp3dRigidBody:Rp3dCollisionBody
 local RigidBody = {}
 
@@ -778,9 +923,40 @@ function DebugRenderer:getContactNormalLength() end
 ---@param length number
 function DebugRenderer:setContactNormalLength(length) end
 
+--Display only the colliders whose AABB overlaps the given world-space AABB. Pass nil to display all colliders.
+---@param aabb Rp3dAABB|nil
+function DebugRenderer:setViewAABB(aabb) end
+
+--Display only the colliders inside the camera frustum (planes from projection * view). Pass nil to display all colliders.
+---@param viewProjection matrix4|nil
+function DebugRenderer:setViewFrustum(viewProjection) end
+
+--Return the maximum number of lines and triangles. 0 if there is no limit.
+---@return number
+function DebugRenderer:getMaxNbPrimitives() end
+
+--Set the maximum number of lines and triangles. 0 if there is no limit.
+---@param maxNbPrimitives number
+function DebugRenderer:setMaxNbPrimitives(maxNbPrimitives) end
+
+--Return true if the shape primitives of static bodies are cached.
+---@return boolean
+function DebugRenderer:getIsStaticCacheEnabled() end
+
+--Set whether the shape primitives of collision bodies and static rigid bodies are cached.
+---@param isEnabled boolean
+function DebugRenderer:setIsStaticCacheEnabled(isEnabled) end
+
 ---post draw_line messages to render
 function DebugRenderer:draw() end
 
+--Write debug lines and triangles into buffers with position(float32 x3) and optional color(float32 x3|x4) streams.
+--Return number of vertices needed for lines and triangles.
+---@param linesBuffer buffer|nil
+---@param trianglesBuffer buffer|nil
+---@return number, number
+function DebugRenderer:fillBuffer(linesBuffer, trianglesBuffer) end
+
 function DebugRenderer:reset() end
 
 ---@class Rp3dPhysicsWorld
@@ -837,6 +1013,22 @@ function PhysicsWorld:setSleepAngularVelocity(sleepAngularVelocity) end
 ---@param timeStep number
 function PhysicsWorld:update(timeStep) end
 
+--Get the number of substeps of each world update.
+---@return number
+function PhysicsWorld:getNbSubsteps() end
+
+--Set the number of substeps of each world update. The contacts are computed once per update and reused by the substeps.
+---@param nbSubsteps number
+function PhysicsWorld:setNbSubsteps(nbSubsteps) end
+
+--Return true if the joints connected in a tree are solved by the articulation solver.
+---@return bool
+function PhysicsWorld:isArticulationSolverEnabled() end
+
+--Enable/Disable the articulation solver. The ball-and-socket and hinge joints connected in a tree (chains, ropes, ragdolls) are solved exactly instead of iteratively.
+---@param isEnabled bool
+function PhysicsWorld:setIsArticulationSolverEnabled(isEnabled) end
+
 --Set the number of iterations for the velocity constraint solver.
 ---@param nbIterations number
 function PhysicsWorld:setNbIterationsVelocitySolver(nbIterations) end
@@ -850,7 +1042,7 @@ function PhysicsWorld:setNbIterationsPositionSolver(nbIterations) end
 function PhysicsWorld:setContactsPositionCorrectionTechnique(technique) end
 
 
---Disable the joints for pair of sleeping bodies.
+--Recompute the enabled/disabled state of all the joints (they are already updated when their bodies sleep, wake up or change active state).
 function PhysicsWorld:enableDisableJoints() end
 
 --Set the gravity vector of the world.
@@ -899,6 +1091,54 @@ function PhysicsWorld:createRigidBody(transform) end
 ---@param body Rp3dRigidBody
 function PhysicsWorld:destroyRigidBody(body) end
 
+--Create a pool with size disabled copies of templateBody.
+---@param templateBody Rp3dCollisionBody|Rp3dRigidBody
+---@param size number
+---@return Rp3dBodyPool
+function PhysicsWorld:createBodyPool(templateBody, size) end
+
+--Destroy the pool and all its bodies (free and acquired).
+---@param bodyPool Rp3dBodyPool
+function PhysicsWorld:destroyBodyPool(bodyPool) end
+
+--Create a kinematic character controller with a kinematic body and one collider of the shape.
+---@param shape Rp3dCollisionShape convex shape
+---@param transform Rp3dTransform
+---@param settings Rp3dCharacterControllerSettings|nil
+---@return Rp3dCharacterController
+function PhysicsWorld:createCharacterController(shape, transform, settings) end
+
+--Destroy the controller and its body.
+---@param controller Rp3dCharacterController
+function PhysicsWorld:destroyCharacterController(controller) end
+
+--Move each controller with the "displacement" stream of the buffer.
+--New positions are written in the "position" stream if it exists.
+---@param controllers Rp3dCharacterController[]
+---@param buffer buffer
+---@return number number of moved controllers
+function PhysicsWorld:moveCharacterControllers(controllers, buffer) end
+
+--Create a raycast vehicle with the body as chassis. The vehicle is destroyed with the body.
+---@param body Rp3dRigidBody
+---@param settings Rp3dRaycastVehicleSettings|nil
+---@return Rp3dRaycastVehicle
+function PhysicsWorld:createRaycastVehicle(body, settings) end
+
+--Destroy the vehicle. The chassis body is not destroyed.
+---@param vehicle Rp3dRaycastVehicle
+function PhysicsWorld:destroyRaycastVehicle(vehicle) end
+
+--Create a force field applied in update to the dynamic bodies inside the volume.
+---@param volume Rp3dCollider|Rp3dAABB collider of the volume (usually a trigger) or world-space AABB
+---@param settings Rp3dForceFieldSettings|nil
+---@return Rp3dForceField
+function PhysicsWorld:createForceField(volume, settings) end
+
+--Destroy the force field. The collider of the volume is not destroyed.
+---@param field Rp3dForceField
+function PhysicsWorld:destroyForceField(field) end
+
 ---@return Rp3dDebugRenderer
 function PhysicsWorld:getDebugRenderer() end
 
@@ -922,6 +1162,69 @@ function PhysicsWorld:testOverlapBodyList(body) end
 ---@return Rp3dOverlapPair[]
 function PhysicsWorld:testOverlapList() end
 
+---Return all the colliders that overlap a convex shape at a transform. No body is created.
+---Triggers are ignored. Shapes that only touch do not overlap.
+---@param shape Rp3dCollisionShape convex shape
+---@param transform Rp3dTransform
+---@param collideWithMaskBits number|nil
+---@param result Rp3dCollider[]|nil table to fill and return instead of a new table
+---@return Rp3dCollider[]
+function PhysicsWorld:testOverlapShape(shape, transform, collideWithMaskBits, result) end
+
+---Same as testOverlapShape but write collider entity ids in the uint32 stream "collider" and body entity ids
+---in the optional uint32 stream "body".
+---@param shape Rp3dCollisionShape convex shape
+---@param transform Rp3dTransform
+---@param buffer buffer|nil
+---@param collideWithMaskBits number|nil
+---@return number number of colliders found
+function PhysicsWorld:testOverlapShapeBuffer(shape, transform, buffer, collideWithMaskBits) end
+
+---Find the colliders whose AABB overlaps with an AABB. Coarse broad-phase query. Triggers are reported.
+---Write collider entity ids in the uint32 stream "collider" and body entity ids in the optional uint32 stream "body".
+---@param aabb Rp3dAABB
+---@param buffer buffer|nil
+---@param collideWithMaskBits number|nil
+---@return number number of colliders found
+function PhysicsWorld:queryAABB(aabb, buffer, collideWithMaskBits) end
+
+---Find the colliders whose AABB overlaps with a sphere. Coarse broad-phase query. Triggers are reported.
+---Write collider entity ids in the uint32 stream "collider" and body entity ids in the optional uint32 stream "body".
+---@param center vector3
+---@param radius number
+---@param buffer buffer|nil
+---@param collideWithMaskBits number|nil
+---@return number number of colliders found
+function PhysicsWorld:querySphere(center, radius, buffer, collideWithMaskBits) end
+
+--Apply an impulse away from the center to the dynamic bodies in the radius (explosion).
+--The velocities are changed directly and sleeping bodies are woken up.
+---@param center vector3
+---@param radius number
+---@param impulse number impulse applied to a body at the center
+---@param falloff string|nil rp3d.RadialImpulseFalloff. Default LINEAR
+---@param collideWithMaskBits number|nil
+---@param occlusion boolean|nil if true, bodies behind other bodies are not affected
+---@return number number of affected bodies
+function PhysicsWorld:applyRadialImpulse(center, radius, impulse, falloff, collideWithMaskBits, occlusion) end
+
+---Compute the distance and the closest points between two colliders with convex shapes. No contact is created.
+---If the colliders overlap, the distance is 0 and the points and the normal are nil.
+---@param collider1 Rp3dCollider
+---@param collider2 Rp3dCollider
+---@return number distance
+---@return vector3|nil point1 closest point on collider1
+---@return vector3|nil point2 closest point on collider2
+---@return vector3|nil normal from collider1 to collider2
+function PhysicsWorld:computeDistance(collider1, collider2) end
+
+---Compute the distance between pairs of colliders with convex shapes.
+---Write the distance in float32 stream "distance"(1) and the optional "point1"(3), "point2"(3) and "normal"(3) streams.
+---@param colliders Rp3dCollider[] {pair1_collider1, pair1_collider2, pair2_collider1, ...}
+---@param buffer buffer
+---@return number number of computed pairs
+function PhysicsWorld:computeDistanceBuffer(colliders, buffer) end
+
 
 --Use this method if you only want to get all the contacts between two bodies.
 --If you are not interested in the contacts but you only want to know if the bodies collide,
@@ -961,6 +1264,26 @@ function PhysicsWorld:getRigidBody(index) end
 ---@param categoryMaskBits number|nil
 function PhysicsWorld:raycast(ray, cb, categoryMaskBits) end
 
+---Sweep a convex shape from the transform position to the "to" position and return the first collider hit.
+---The shape keeps the orientation of the transform. Triggers are ignored.
+---@param shape Rp3dCollisionShape convex shape
+---@param transform Rp3dTransform
+---@param to vector3
+---@param collideWithMaskBits number|nil
+---@return Rp3dShapeCastInfo|nil nil if nothing is hit
+function PhysicsWorld:shapeCast(shape, transform, to, collideWithMaskBits) end
+
+---Make a shape cast for each element of the buffer.
+---Read float32 streams "from"(3) and "to"(3). Write the hit fraction(or -1) in "fraction"(1)
+---and the contact point and normal in the optional "point"(3) and "normal"(3) streams.
+---@param shape Rp3dCollisionShape convex shape
+---@param orientation quaternion
+---@param buffer buffer
+---@param colliders table|nil filled with the hit Rp3dCollider or false for each element
+---@param collideWithMaskBits number|nil
+---@return number number of hits
+function PhysicsWorld:shapeCastBuffer(shape, orientation, buffer, colliders, collideWithMaskBits) end
+
 ---@param eventListener Rp3dEventListener|nil
 function PhysicsWorld:setEventListener(eventListener) end
 
@@ -972,6 +1295,28 @@ function PhysicsWorld:getWorldAABB(collider) end
 ---@return Rp3dJoint
 function PhysicsWorld:createJoint(jointInfo) end
 
+--Create a chain of joints. Each body is connected to the next one with a copy of the joint info.
+---@param bodies Rp3dRigidBody[]
+---@param jointInfo Rp3dJointInfo settings of all the joints. Its bodies are replaced.
+---@param anchor number|nil position of the anchor point between the body1 (0) and the body2 (1). Default 0.5
+---@param pushIds bool|nil return the entity ids of the joints (see Joint:getEntityId()) instead of the joints. Default false
+---@return Rp3dJoint[]|number[]
+function PhysicsWorld:createJointChain(bodies, jointInfo, anchor, pushIds) end
+
+--Create a grid of joints. The bodies are stored row by row and each body is connected to the previous body of its row and of its column.
+---@param bodies Rp3dRigidBody[]
+---@param nbColumns number
+---@param jointInfo Rp3dJointInfo settings of all the joints. Its bodies are replaced.
+---@param anchor number|nil position of the anchor point between the body1 (0) and the body2 (1). Default 0.5
+---@param pushIds bool|nil return the entity ids of the joints (see Joint:getEntityId()) instead of the joints. Default false
+---@return Rp3dJoint[]|number[]
+function PhysicsWorld:createJointGrid(bodies, nbColumns, jointInfo, anchor, pushIds) end
+
+--Return the joint with an entity id (see Joint:getEntityId()) or nil if the world has no joint with this id.
+---@param id number
+---@return Rp3dJoint|nil
+function PhysicsWorld:getJoint(id) end
+
 --Destroy a joint.
 ---@param joint Rp3dJoint
 function PhysicsWorld:destroyJoint(joint) end
@@ -1016,6 +1361,10 @@ function CollisionShape:getVolume() end
 ---@return Rp3dAABB
 function CollisionShape:computeAABB(transform) end
 
+--Return true if the shape was created by rp3d.getShared...Shape(). Shared shapes can't be changed.
+---@return boolean
+function CollisionShape:isShared() end
+
 ---@class Rp3dConvexShape:Rp3dCollisionShape
 local ConvexShape = {}
 
@@ -1277,6 +1626,264 @@ function Rp3dAABB:raycast(ray) end
 ---@param scale vector3
 function Rp3dAABB:applyScale(scale) end
 
+---@class Rp3dBodyPool
+local Rp3dBodyPool = {}
+
+--Take a free body from the pool, move it to transform and enable it.
+--Return nil if there are no free bodies.
+---@param transform Rp3dTransform
+---@return Rp3dCollisionBody|Rp3dRigidBody|nil
+function Rp3dBodyPool:acquire(transform) end
+
+--Disable the body and return it to the pool.
+---@param body Rp3dCollisionBody|Rp3dRigidBody
+function Rp3dBodyPool:release(body) end
+
+--Return the number of bodies in the pool (free and acquired).
+---@return number
+function Rp3dBodyPool:getNbBodies() end
+
+--Return the number of free bodies in the pool.
+---@return number
+function Rp3dBodyPool:getNbFreeBodies() end
+
+---@class Rp3dCharacterController
+local Rp3dCharacterController = {}
+
+--Move the character. Slide along walls, climb steps and snap to the ground.
+---@param displacement vector3
+function Rp3dCharacterController:move(displacement) end
+
+---@return vector3
+function Rp3dCharacterController:getPosition() end
+
+--Teleport the character. The ground state is reset.
+---@param position vector3
+function Rp3dCharacterController:setPosition(position) end
+
+---@return Rp3dRigidBody
+function Rp3dCharacterController:getBody() end
+
+---@return Rp3dCollider
+function Rp3dCharacterController:getCollider() end
+
+--Return true if the character stands on a walkable surface after the last move.
+---@return boolean
+function Rp3dCharacterController:isOnGround() end
+
+--Return the normal of the ground or the up direction if not on the ground.
+---@return vector3
+function Rp3dCharacterController:getGroundNormal() end
+
+---@return Rp3dCollider|nil
+function Rp3dCharacterController:getGroundCollider() end
+
+--Return the real displacement of the character in the last move.
+---@return vector3
+function Rp3dCharacterController:getDisplacement() end
+
+---@return vector3
+function Rp3dCharacterController:getUp() end
+
+---@param up vector3
+function Rp3dCharacterController:setUp(up) end
+
+---@return number
+function Rp3dCharacterController:getMaxSlopeAngle() end
+
+---@param angle number in radians
+function Rp3dCharacterController:setMaxSlopeAngle(angle) end
+
+---@return number
+function Rp3dCharacterController:getStepHeight() end
+
+---@param height number
+function Rp3dCharacterController:setStepHeight(height) end
+
+---@return number
+function Rp3dCharacterController:getSnapDistance() end
+
+---@param distance number
+function Rp3dCharacterController:setSnapDistance(distance) end
+
+---@return number
+function Rp3dCharacterController:getSkinWidth() end
+
+---@param width number
+function Rp3dCharacterController:setSkinWidth(width) end
+
+---@return number
+function Rp3dCharacterController:getPushForce() end
+
+---@param force number
+function Rp3dCharacterController:setPushForce(force) end
+
+---@return number
+function Rp3dCharacterController:getCollideWithMaskBits() end
+
+---@param mask number
+function Rp3dCharacterController:setCollideWithMaskBits(mask) end
+
+---@class Rp3dRaycastVehicle
+local Rp3dRaycastVehicle = {}
+
+--Add a wheel and return its index. Indices start from 0.
+---@param settings Rp3dWheelSettings|nil
+---@return number
+function Rp3dRaycastVehicle:addWheel(settings) end
+
+---@return number
+function Rp3dRaycastVehicle:getNbWheels() end
+
+---@return Rp3dRigidBody
+function Rp3dRaycastVehicle:getBody() end
+
+---@param wheelIndex number
+---@return number
+function Rp3dRaycastVehicle:getSteering(wheelIndex) end
+
+---@param wheelIndex number
+---@param angle number in radians
+function Rp3dRaycastVehicle:setSteering(wheelIndex, angle) end
+
+---@param wheelIndex number
+---@return number
+function Rp3dRaycastVehicle:getEngineForce(wheelIndex) end
+
+--A negative force moves the vehicle backward.
+---@param wheelIndex number
+---@param force number
+function Rp3dRaycastVehicle:setEngineForce(wheelIndex, force) end
+
+---@param wheelIndex number
+---@return number
+function Rp3dRaycastVehicle:getBrake(wheelIndex) end
+
+---@param wheelIndex number
+---@param force number max brake force
+function Rp3dRaycastVehicle:setBrake(wheelIndex, force) end
+
+--Return the rotation angle of the wheel around its axle (in radians).
+---@param wheelIndex number
+---@return number
+function Rp3dRaycastVehicle:getWheelRotation(wheelIndex) end
+
+--Return the world transform of the wheel center with steering and rotation.
+---@param wheelIndex number
+---@return Rp3dTransform
+function Rp3dRaycastVehicle:getWheelTransform(wheelIndex) end
+
+---@param wheelIndex number
+---@return boolean
+function Rp3dRaycastVehicle:isWheelInContact(wheelIndex) end
+
+---@param wheelIndex number
+---@return vector3
+function Rp3dRaycastVehicle:getWheelContactPoint(wheelIndex) end
+
+---@param wheelIndex number
+---@return vector3
+function Rp3dRaycastVehicle:getWheelContactNormal(wheelIndex) end
+
+---@param wheelIndex number
+---@return Rp3dCollider|nil
+function Rp3dRaycastVehicle:getWheelGroundCollider(wheelIndex) end
+
+---@param wheelIndex number
+---@return number
+function Rp3dRaycastVehicle:getSuspensionLength(wheelIndex) end
+
+---@param wheelIndex number
+---@return number
+function Rp3dRaycastVehicle:getSuspensionForce(wheelIndex) end
+
+--Return the ratio between the applied and the requested tire force. 1 if the tire does not skid.
+---@param wheelIndex number
+---@return number
+function Rp3dRaycastVehicle:getSkidInfo(wheelIndex) end
+
+--Return the speed of the chassis along the forward direction.
+---@return number
+function Rp3dRaycastVehicle:getCurrentSpeed() end
+
+---@return number
+function Rp3dRaycastVehicle:getCollideWithMaskBits() end
+
+---@param mask number
+function Rp3dRaycastVehicle:setCollideWithMaskBits(mask) end
+
+---@class Rp3dForceField
+local Rp3dForceField = {}
+
+---@return string rp3d.ForceFieldType
+function Rp3dForceField:getType() end
+
+---@return boolean
+function Rp3dForceField:isEnabled() end
+
+---@param isEnabled boolean
+function Rp3dForceField:setIsEnabled(isEnabled) end
+
+--Return the collider of the volume. nil if the volume is an AABB or if the collider was destroyed.
+---@return Rp3dCollider|nil
+function Rp3dForceField:getCollider() end
+
+--Return the world-space AABB of the volume.
+---@return Rp3dAABB
+function Rp3dForceField:getAABB() end
+
+--Use a world-space AABB as the volume of the field.
+---@param aabb Rp3dAABB
+function Rp3dForceField:setAABB(aabb) end
+
+---@return vector3
+function Rp3dForceField:getDirection() end
+
+---@param direction vector3
+function Rp3dForceField:setDirection(direction) end
+
+---@return number
+function Rp3dForceField:getStrength() end
+
+---@param strength number force of the wind or acceleration of the attractor
+function Rp3dForceField:setStrength(strength) end
+
+---@return vector3
+function Rp3dForceField:getCenter() end
+
+---@param center vector3
+function Rp3dForceField:setCenter(center) end
+
+---@return number
+function Rp3dForceField:getRadius() end
+
+---@param radius number distance where the acceleration of the attractor becomes zero
+function Rp3dForceField:setRadius(radius) end
+
+---@return number
+function Rp3dForceField:getFluidDensity() end
+
+---@param density number
+function Rp3dForceField:setFluidDensity(density) end
+
+---@return number
+function Rp3dForceField:getLinearDrag() end
+
+---@param drag number
+function Rp3dForceField:setLinearDrag(drag) end
+
+---@return number
+function Rp3dForceField:getAngularDrag() end
+
+---@param drag number
+function Rp3dForceField:setAngularDrag(drag) end
+
+---@return number
+function Rp3dForceField:getCollideWithMaskBits() end
+
+---@param mask number
+function Rp3dForceField:setCollideWithMaskBits(mask) end
+
 ---@class Rp3dTriangleMesh
 local Rp3dTriangleMesh = {}
 
@@ -1351,6 +1958,12 @@ function rp3d.createBoxShape(halfExtents) end
 ---@param boxShape Rp3dBoxShape
 function rp3d.destroyBoxShape(boxShape) end
 
+--Return a box collision shape shared with all other calls with same halfExtents.
+--Call rp3d.destroyBoxShape once for every call.
+---@param halfExtents vector3
+---@return Rp3dBoxShape
+function rp3d.getSharedBoxShape(halfExtents) end
+
 --Create and return a sphere collision shape.
 ---@param radius number
 ---@return Rp3dSphereShape
@@ -1360,6 +1973,12 @@ function rp3d.createSphereShape(radius) end
 ---@param sphereShape Rp3dSphereShape
 function rp3d.destroySphereShape(sphereShape) end
 
+--Return a sphere collision shape shared with all other calls with same radius.
+--Call rp3d.destroySphereShape once for every call.
+---@param radius number
+---@return Rp3dSphereShape
+function rp3d.getSharedSphereShape(radius) end
+
 --Create and return a capsule collision shape.
 ---@param radius number
 ---@param height number
@@ -1370,6 +1989,13 @@ function rp3d.createCapsuleShape(radius, height) end
 ---@param capsuleShape Rp3dCapsuleShape
 function rp3d.destroyCapsuleShape(capsuleShape) end
 
+--Return a capsule collision shape shared with all other calls with same radius and height.
+--Call rp3d.destroyCapsuleShape once for every call.
+---@param radius number
+---@param height number
+---@return Rp3dCapsuleShape
+function rp3d.getSharedCapsuleShape(radius, height) end
+
 --Create a polyhedron mesh.
 ---@param vertices number[]
 ---@param indices number[]
@@ -1382,6 +2008,33 @@ function rp3d.createPolyhedronMesh(vertices, indices, polygonFaces) end
 ---@return Rp3dPolyhedronMesh
 function rp3d.createPolyhedronMeshFromMeshVerticesCopy(buffer) end
 
+--Create a polyhedron mesh from the convex hull of a cloud of points.
+--If maxVertices is set, the hull is simplified to keep at most maxVertices vertices.
+---@param vertices number[] x, y, z coordinates of the points. Start from 0.
+---@param maxVertices number|nil
+---@return Rp3dPolyhedronMesh
+function rp3d.createConvexHullPolyhedronMesh(vertices, maxVertices) end
+
+--Create a polyhedron mesh from the convex hull of mesh vertices.
+--If maxVertices is set, the hull is simplified to keep at most maxVertices vertices.
+---@param buffer buffer
+---@param maxVertices number|nil
+---@return Rp3dPolyhedronMesh
+function rp3d.createConvexHullPolyhedronMeshFromMeshVerticesCopy(buffer, maxVertices) end
+
+---@class Rp3dConvexDecompositionSettings
+---@field maxHulls number|nil
+---@field maxVerticesPerHull number|nil
+---@field resolution number|nil
+---@field concavity number|nil
+
+--Compute an approximate convex decomposition of a concave mesh.
+--Use it to make dynamic bodies from concave meshes.
+---@param buffer buffer
+---@param settings Rp3dConvexDecompositionSettings|nil
+---@return Rp3dPolyhedronMesh[]
+function rp3d.createConvexDecompositionFromMeshVerticesCopy(buffer, settings) end
+
 --Destroy a polyhedron mesh.
 ---@param polyhedronMesh Rp3dPolyhedronMesh
 function rp3d.destroyPolyhedronMesh(polyhedronMesh) end
@@ -1396,6 +2049,13 @@ function rp3d.createConvexMeshShape(mesh) end
 ---@param convexMeshShape Rp3dConvexMeshShape
 function rp3d.destroyConvexMeshShape(convexMeshShape) end
 
+--Return a convex mesh collision shape shared with all other calls with same mesh and scaling.
+--Call rp3d.destroyConvexMeshShape once for every call.
+---@param mesh Rp3dPolyhedronMesh
+---@param scaling vector3|nil
+---@return Rp3dConvexMeshShape
+function rp3d.getSharedConvexMeshShape(mesh, scaling) end
+
 ---@param triangleMesh Rp3dTriangleMesh
 ---@param scaling vector3|nil
 ---@return Rp3dConvexMeshShape
@@ -1587,5 +2247,17 @@ rp3d.JointsPositionCorrectionTechnique = {
 	NON_LINEAR_GAUSS_SEIDEL = "NON_LINEAR_GAUSS_SEIDEL",
 }
 
+rp3d.ForceFieldType = {
+	WIND = "WIND",
+	ATTRACTOR = "ATTRACTOR",
+	BUOYANCY = "BUOYANCY"
+}
+
+rp3d.RadialImpulseFalloff = {
+	CONSTANT = "CONSTANT",
+	LINEAR = "LINEAR",
+	QUADRATIC = "QUADRATIC"
+}
+
 
 
@@ -16,6 +16,15 @@ function M.test_joint(joint, data)
 	else
 		assert_true(joint:isCollisionEnabled())
 	end
+	assert_false(joint:isBroken())
+	local breakForce, breakTorque = joint:getBreakForce(), joint:getBreakTorque()
+	UTILS.test_method_get_set(joint, "BreakForce", { values = { 0, 10, 1000 } })
+	UTILS.test_method_get_set(joint, "BreakTorque", { values = { 0, 10, 1000 } })
+	local status, error = pcall(joint.setBreakForce, joint, -1)
+	assert_false(status)
+	UTILS.test_error(error, "breakForce must be >=0")
+	joint:setBreakForce(breakForce)
+	joint:setBreakTorque(breakTorque)
 end
 
 function M.set_env(env)
@@ -13,6 +13,8 @@ function M.test_joint_info(jointInfo, data)
 	else
 		assert_true(jointInfo.isCollisionEnabled)
 	end
+	assert_type(jointInfo.breakForce, "number")
+	assert_type(jointInfo.breakTorque, "number")
 
 end
 
@@ -184,6 +184,60 @@ return function()
 			})
 		end)
 
+		test("getTriggerOccupants()", function()
+			local zone = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local body_1 = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local body_2 = w:createRigidBody({ position = vmath.vector3(10, 0, 0), quat = vmath.quat() })
+			zone:setType(rp3d.BodyType.STATIC)
+			body_1:setType(rp3d.BodyType.KINEMATIC)
+			body_2:setType(rp3d.BodyType.KINEMATIC)
+			local trigger = zone:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c1 = body_1:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c2 = body_2:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			trigger:setIsTrigger(true)
+
+			local buf = buffer.create(2, {
+				{ name = hash("collider"), type = buffer.VALUE_TYPE_UINT32, count = 1 },
+				{ name = hash("body"), type = buffer.VALUE_TYPE_UINT32, count = 1 },
+			})
+			local colliders = buffer.get_stream(buf, hash("collider"))
+			local bodies = buffer.get_stream(buf, hash("body"))
+
+			assert_equal(trigger:getNbTriggerOccupants(), 0)
+			w:update(1 / 60)
+			assert_equal(trigger:getNbTriggerOccupants(), 1)
+			assert_equal(trigger:getTriggerOccupants(buf), 1)
+			assert_equal(colliders[1], c1:getEntityId())
+			assert_equal(bodies[1], body_1:getEntityId())
+			assert_equal(c1:getNbTriggerOccupants(), 0)
+
+			body_2:setTransform({ position = vmath.vector3(1, 0, 0), quat = vmath.quat() })
+			w:update(1 / 60)
+			assert_equal(trigger:getTriggerOccupants(nil), 2)
+
+			body_1:setTransform({ position = vmath.vector3(-10, 0, 0), quat = vmath.quat() })
+			w:update(1 / 60)
+			assert_equal(trigger:getTriggerOccupants(buf), 1)
+			assert_equal(colliders[1], c2:getEntityId())
+
+			--pairs removed without OverlapExit event
+			body_2:setIsSleeping(true)
+			w:update(1 / 60)
+			assert_equal(trigger:getNbTriggerOccupants(), 0)
+			body_2:setIsSleeping(false)
+			w:update(1 / 60)
+			assert_equal(trigger:getNbTriggerOccupants(), 1)
+			body_2:removeCollider(c2)
+			assert_equal(trigger:getNbTriggerOccupants(), 0)
+
+			trigger:setIsTrigger(false)
+			assert_equal(trigger:getNbTriggerOccupants(), 0)
+
+			w:destroyRigidBody(zone)
+			w:destroyRigidBody(body_1)
+			w:destroyRigidBody(body_2)
+		end)
+
 		test("set/get Material()", function()
 			local m = collider:getMaterial()
 			assert_equal(m.bounciness, 0.5)
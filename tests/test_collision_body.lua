@@ -55,6 +55,117 @@ return function()
 						})
 			end
 		end)
+		test("is/set Compound()", function()
+			for _, body in ipairs(bodies) do
+				assert_false(body:isCompound())
+				UTILS.test_method_get_set(body, "Compound",
+						{
+							getter_full = "isCompound",
+							setter_full = "setIsCompound",
+							values = { true, false, true, false }
+						})
+			end
+		end)
+
+		test("compound events, queries and AABB", function()
+			local world = rp3d.createPhysicsWorld()
+			local small = rp3d.createBoxShape(vmath.vector3(0.5))
+			local long = rp3d.createBoxShape(vmath.vector3(2, 0.5, 0.5))
+			local sphere = rp3d.createSphereShape(0.3)
+
+			local compound = world:createRigidBody({ position = vmath.vector3(), quat = vmath.quat() })
+			compound:setType(rp3d.BodyType.STATIC)
+			compound:setIsCompound(true)
+			local c0 = compound:addCollider(small, { position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local c1 = compound:addCollider(small, { position = vmath.vector3(3, 0, 0), quat = vmath.quat() })
+
+			local probe = world:createRigidBody({ position = vmath.vector3(0, 0.9, 0), quat = vmath.quat() })
+			probe:setType(rp3d.BodyType.KINEMATIC)
+			local p = probe:addCollider(long, { position = vmath.vector3(), quat = vmath.quat() })
+
+			local events = {}
+			local function add_events(pairs)
+				for _, pair in ipairs(pairs) do
+					local child = pair.collider1 == p and pair.collider2 or pair.collider1
+					events[child == c0 and "c0" or child == c1 and "c1" or "?"] = pair.eventType
+				end
+			end
+			world:setEventListener({ onContact = add_events, onTrigger = add_events })
+
+			local function move(x)
+				events = {}
+				probe:setTransform({ position = vmath.vector3(x, 0.9, 0), quat = vmath.quat() })
+				world:update(1 / 60)
+				return events
+			end
+
+			for _, trigger in ipairs({ false, true }) do
+				p:setIsTrigger(trigger)
+				local prefix = trigger and "Overlap" or "Contact"
+				assert_equal(move(0).c0, prefix .. "Start")
+				--second child starts touching while the first one stays in contact
+				local e = move(1)
+				assert_equal(e.c0, prefix .. "Stay")
+				assert_equal(e.c1, prefix .. "Start")
+				--first child stops touching while the second one stays in contact
+				e = move(3)
+				assert_equal(e.c0, prefix .. "Exit")
+				assert_equal(e.c1, prefix .. "Stay")
+				e = move(30)
+				assert_nil(e.c0)
+				assert_equal(e.c1, prefix .. "Exit")
+				assert_nil(next(move(30)))
+			end
+
+			local aabb = world:getWorldAABB(c1)
+			assert_equal_v3(aabb:getMin(), vmath.vector3(2.5, -0.5, -0.5))
+			assert_equal_v3(aabb:getMax(), vmath.vector3(3.5, 0.5, 0.5))
+			assert_equal_v3(c1:getWorldAABB():getMin(), vmath.vector3(2.5, -0.5, -0.5))
+
+			local hits = {}
+			world:raycast({ point1 = vmath.vector3(3, 5, 0), point2 = vmath.vector3(3, -5, 0), maxFraction = 1 }, function(info)
+				table.insert(hits, info)
+				return info.hitFraction
+			end)
+			assert_equal(hits[#hits].collider, c1)
+			assert_equal(hits[#hits].body, compound)
+
+			local result = world:testOverlapShape(sphere, { position = vmath.vector3(3, 0.6, 0), quat = vmath.quat() })
+			assert_equal(#result, 1)
+			assert_equal(result[1], c1)
+
+			rp3d.destroyPhysicsWorld(world)
+			rp3d.destroyBoxShape(small)
+			rp3d.destroyBoxShape(long)
+			rp3d.destroySphereShape(sphere)
+		end)
+
+		test("clone()", function()
+			local shape = rp3d.createBoxShape(vmath.vector3(1))
+			for _, body in ipairs(bodies) do
+				local collider = body:addCollider(shape, { position = vmath.vector3(0, 1, 0), quat = vmath.quat() })
+				collider:setCollisionCategoryBits(4)
+				collider:setIsTrigger(true)
+				local clone = body:clone({ position = vmath.vector3(5, 0, 0), quat = vmath.quat() })
+				assert_not_equal(body, clone)
+				assert_equal(body:isRigidBody(), clone:isRigidBody())
+				assert_equal_v3(clone:getTransformPosition(), vmath.vector3(5, 0, 0))
+				assert_equal(clone:getNbColliders(), 1)
+				local cloneCollider = clone:getCollider(0)
+				assert_equal(cloneCollider:getCollisionShape(), shape)
+				assert_equal(cloneCollider:getCollisionCategoryBits(), 4)
+				assert_true(cloneCollider:getIsTrigger())
+				assert_equal_v3(cloneCollider:getLocalToBodyTransform().position, vmath.vector3(0, 1, 0))
+				if (body:isRigidBody()) then
+					assert_equal(clone:getMass(), body:getMass())
+					w:destroyRigidBody(clone)
+				else
+					w:destroyCollisionBody(clone)
+				end
+				body:removeCollider(collider)
+			end
+			rp3d.destroyBoxShape(shape)
+		end)
 
 		test("get/set UserData()", function()
 			for _, body in ipairs(bodies) do
@@ -134,6 +245,21 @@ return function()
 				assert_not_nil(collider)
 			end
 		end)
+		test("addColliders()", function()
+			local shape = rp3d.createBoxShape(vmath.vector3(2))
+			local shape2 = rp3d.createSphereShape(1)
+			for _, b in ipairs(bodies) do
+				local colliders = b:addColliders({ shape, shape2 }, { position = vmath.vector3(), quat = vmath.quat() })
+				assert_equal(#colliders, 2)
+				assert_equal(b:getNbColliders(), 2)
+				assert_equal(colliders[1], b:getCollider(0))
+				assert_equal(colliders[2], b:getCollider(1))
+
+				local status, error = pcall(b.addColliders, b, { shape, {} }, { position = vmath.vector3(), quat = vmath.quat() })
+				assert_false(status)
+				assert_equal(b:getNbColliders(), 2)
+			end
+		end)
 		test("getNbColliders()", function()
 			local shape = rp3d.createBoxShape(vmath.vector3(2))
 			for _, b in ipairs(bodies) do
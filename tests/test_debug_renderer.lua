@@ -71,6 +71,134 @@ return function()
 			renderer:draw()
 		end)
 
+		test("fillBuffer()", function()
+			local renderer = w:getDebugRenderer()
+			w:setIsDebugRenderingEnabled(true)
+			renderer:setIsDebugItemDisplayed(rp3d.DebugRenderer.DebugItem.COLLIDER_AABB, true)
+			renderer:setIsDebugItemDisplayed(rp3d.DebugRenderer.DebugItem.COLLISION_SHAPE, true)
+			local shape = rp3d.createBoxShape(vmath.vector3(1))
+			local body = w:createCollisionBody({ position = vmath.vector3(), quat = vmath.quat() })
+			body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			w:update(1 / 60)
+
+			local streams = {
+				{ name = hash("position"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 },
+				{ name = hash("color"), type = buffer.VALUE_TYPE_FLOAT32, count = 4 }
+			}
+			local linesBuffer = buffer.create(100, streams)
+			local trianglesBuffer = buffer.create(12, streams)
+			local nbLineVertices, nbTriangleVertices = renderer:fillBuffer(linesBuffer, trianglesBuffer)
+			assert_equal(nbLineVertices, 24)
+			assert_equal(nbTriangleVertices, 36)
+
+			local positions = buffer.get_stream(linesBuffer, hash("position"))
+			assert_equal(math.abs(positions[1]), 1)
+			assert_equal(positions[24 * 3 + 1], 0)
+			local colors = buffer.get_stream(linesBuffer, hash("color"))
+			assert_equal(colors[4], 1)
+
+			--only 4 triangles fit
+			positions = buffer.get_stream(trianglesBuffer, hash("position"))
+			assert_equal(math.abs(positions[12 * 3]), 1)
+
+			nbLineVertices, nbTriangleVertices = renderer:fillBuffer(nil, nil)
+			assert_equal(nbLineVertices, 24)
+			assert_equal(nbTriangleVertices, 36)
+
+			local status, error = pcall(renderer.fillBuffer, renderer, buffer.create(2, { { name = hash("normal"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 } }), nil)
+			assert_false(status)
+			UTILS.test_error(error, "buffer can't get position")
+
+			w:destroyCollisionBody(body)
+			rp3d.destroyBoxShape(shape)
+			renderer:reset()
+		end)
+
+		test("set/get MaxNbPrimitives()", function()
+			assert_equal(w:getDebugRenderer():getMaxNbPrimitives(), 0)
+			UTILS.test_method_get_set(w:getDebugRenderer(), "MaxNbPrimitives", {
+				values = { 1, 100, 0 }
+			})
+		end)
+
+		test("set/get IsStaticCacheEnabled()", function()
+			assert_true(w:getDebugRenderer():getIsStaticCacheEnabled())
+			UTILS.test_method_get_set(w:getDebugRenderer(), "IsStaticCacheEnabled", {
+				values = { false, true }
+			})
+		end)
+
+		test("view region and budget", function()
+			local renderer = w:getDebugRenderer()
+			w:setIsDebugRenderingEnabled(true)
+			renderer:setIsDebugItemDisplayed(rp3d.DebugRenderer.DebugItem.COLLISION_SHAPE, true)
+			local nbTriangles = function()
+				local _, nbVertices = renderer:fillBuffer(nil, nil)
+				return nbVertices / 3
+			end
+			local shape = rp3d.createBoxShape(vmath.vector3(1))
+			local body = w:createRigidBody({ position = vmath.vector3(), quat = vmath.quat() })
+			body:setType(rp3d.BodyType.STATIC)
+			body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local body2 = w:createCollisionBody({ position = vmath.vector3(10, 0, 0), quat = vmath.quat() })
+			body2:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 24)
+
+			renderer:setViewAABB(rp3d.createAABB(vmath.vector3(-2), vmath.vector3(2)))
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 12)
+			renderer:setViewAABB(nil)
+
+			--camera at (10,0,5) look at -z
+			local view = vmath.matrix4_look_at(vmath.vector3(10, 0, 5), vmath.vector3(10, 0, 0), vmath.vector3(0, 1, 0))
+			local projection = vmath.matrix4_perspective(math.rad(45), 1, 0.1, 100)
+			renderer:setViewFrustum(projection * view)
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 12)
+			renderer:setViewFrustum(nil)
+
+			renderer:setMaxNbPrimitives(5)
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 5)
+			renderer:setMaxNbPrimitives(0)
+
+			--cached shape updated when body moved
+			body2:setTransformPosition(vmath.vector3(100, 0, 0))
+			renderer:setViewAABB(rp3d.createAABB(vmath.vector3(90, -2, -2), vmath.vector3(110, 2, 2)))
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 12)
+			local trianglesBuffer = buffer.create(12 * 3, {
+				{ name = hash("position"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 }
+			})
+			renderer:fillBuffer(nil, trianglesBuffer)
+			local positions = buffer.get_stream(trianglesBuffer, hash("position"))
+			for i = 1, 12 * 3 do
+				local x = positions[(i - 1) * 3 + 1]
+				assert_true(x >= 99 and x <= 101)
+			end
+			renderer:setViewAABB(nil)
+
+			--destroyed collider removed from cache. Other cached colliders are still drawn
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 24)
+			w:destroyRigidBody(body)
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 12)
+			body = w:createRigidBody({ position = vmath.vector3(50, 0, 0), quat = vmath.quat() })
+			body:setType(rp3d.BodyType.STATIC)
+			body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			w:update(1 / 60)
+			assert_equal(nbTriangles(), 24)
+
+			w:destroyRigidBody(body)
+			w:destroyCollisionBody(body2)
+			rp3d.destroyBoxShape(shape)
+			w:setIsDebugRenderingEnabled(false)
+			renderer:reset()
+		end)
+
 		test("toString()", function()
 			local renderer = w:getDebugRenderer();
 			assert_equal(tostring(renderer):sub(1,19), "rp3d::DebugRenderer")
@@ -97,6 +97,75 @@ return function()
 			rp3d.destroyPolyhedronMesh(mesh_b)
 		end)
 
+		test("create convex hull", function()
+			--box corners plus points inside and on the faces
+			local vertices = {}
+			local idx = 0
+			for x = -3, 3, 1.5 do
+				for y = -3, 3, 1.5 do
+					for z = -3, 3, 1.5 do
+						vertices[idx], vertices[idx + 1], vertices[idx + 2] = x, y, z
+						idx = idx + 3
+					end
+				end
+			end
+			local hull = rp3d.createConvexHullPolyhedronMesh(vertices)
+			assert_equal(hull:getNbVertices(), 8)
+			assert_equal(hull:getNbFaces(), 6)
+			assert_equal_float(hull:getVolume(), 216)
+			rp3d.destroyPolyhedronMesh(hull)
+
+			hull = rp3d.createConvexHullPolyhedronMesh(vertices, 4)
+			assert_equal(hull:getNbVertices(), 4)
+			assert_equal(hull:getNbFaces(), 4)
+			rp3d.destroyPolyhedronMesh(hull)
+
+			local status, error = pcall(rp3d.createConvexHullPolyhedronMesh, vertices, 3)
+			assert_false(status)
+			UTILS.test_error(error, "maxVertices should be >= 4")
+
+			status, error = pcall(rp3d.createConvexHullPolyhedronMesh, vertices, 4.5)
+			assert_false(status)
+			UTILS.test_error(error, "maxVertices should be integer")
+
+			status, error = pcall(rp3d.createConvexHullPolyhedronMesh, { [0] = 0, 0, 0, 1, 0, 0, 0, 1, 0 })
+			assert_false(status)
+			UTILS.test_error(error, "can't build convex hull. Need at least 4 not coplanar points")
+		end)
+
+		test("create convex hull from buffer", function()
+			local res = go.get("/meshes#box", "vertices")
+			local buf = resource.get_buffer(res)
+			local hull = rp3d.createConvexHullPolyhedronMeshFromMeshVerticesCopy(buf)
+			assert_equal(hull:getNbVertices(), 8)
+			assert_equal(hull:getNbFaces(), 6)
+			rp3d.destroyPolyhedronMesh(hull)
+		end)
+
+		test("create convex decomposition", function()
+			local res = go.get("/meshes#castle", "vertices")
+			local buf = resource.get_buffer(res)
+			local hulls = rp3d.createConvexDecompositionFromMeshVerticesCopy(buf, { maxHulls = 4, maxVerticesPerHull = 16, resolution = 16 })
+			assert_true(#hulls >= 1 and #hulls <= 4)
+			for _, hull in ipairs(hulls) do
+				assert_true(hull:getNbVertices() <= 16)
+				rp3d.destroyPolyhedronMesh(hull)
+			end
+
+			local status, error = pcall(rp3d.createConvexDecompositionFromMeshVerticesCopy, buf, { maxHull = 4 })
+			assert_false(status)
+			UTILS.test_error(error, "unknown key:maxHull")
+			status, error = pcall(rp3d.createConvexDecompositionFromMeshVerticesCopy, buf, { maxHulls = -1 })
+			assert_false(status)
+			UTILS.test_error(error, "maxHulls should be >= 1")
+			status, error = pcall(rp3d.createConvexDecompositionFromMeshVerticesCopy, buf, { maxVerticesPerHull = -4 })
+			assert_false(status)
+			UTILS.test_error(error, "maxVerticesPerHull should be >= 4")
+			status, error = pcall(rp3d.createConvexDecompositionFromMeshVerticesCopy, buf, { resolution = -16 })
+			assert_false(status)
+			UTILS.test_error(error, "resolution should be in [2,128]")
+		end)
+
 		test("tostring()", function()
 			assert_equal(tostring(mesh):sub(1, 20), "rp3d::PolyhedronMesh")
 		end)
@@ -65,6 +65,91 @@ return function()
 			})
 		end)
 
+		test("shared shapes", function()
+			local box = rp3d.getSharedBoxShape(vmath.vector3(1, 2, 3))
+			local box2 = rp3d.getSharedBoxShape(vmath.vector3(1, 2, 3))
+			local box3 = rp3d.getSharedBoxShape(vmath.vector3(3, 2, 1))
+			assert_equal(box, box2)
+			assert_not_equal(box, box3)
+			assert_true(box:isShared())
+			local not_shared = rp3d.createBoxShape(vmath.vector3(1, 2, 3))
+			assert_false(not_shared:isShared())
+			rp3d.destroyBoxShape(not_shared)
+			rp3d.destroyBoxShape(box3)
+
+			local status, error = pcall(box.setHalfExtents, box, vmath.vector3(2))
+			assert_false(status)
+			UTILS.test_error(error, "shared shape can't be changed")
+
+			local sphere = rp3d.getSharedSphereShape(2)
+			local sphere2 = rp3d.getSharedSphereShape(2)
+			assert_equal(sphere, sphere2)
+			local capsule = rp3d.getSharedCapsuleShape(1, 2)
+			local capsule2 = rp3d.getSharedCapsuleShape(1, 2)
+			local capsule3 = rp3d.getSharedCapsuleShape(2, 1)
+			assert_equal(capsule, capsule2)
+			assert_not_equal(capsule, capsule3)
+			rp3d.destroySphereShape(sphere)
+			rp3d.destroySphereShape(sphere2)
+			rp3d.destroyCapsuleShape(capsule)
+			rp3d.destroyCapsuleShape(capsule2)
+			rp3d.destroyCapsuleShape(capsule3)
+
+			--shape is alive while it have references or colliders
+			local w = rp3d.createPhysicsWorld()
+			local body = w:createRigidBody({ position = vmath.vector3(), quat = vmath.quat() })
+			body:addCollider(box, { position = vmath.vector3(), quat = vmath.quat() })
+			rp3d.destroyBoxShape(box)
+			rp3d.destroyBoxShape(box2)
+			assert_equal(body:getCollider(0):getCollisionShape(), box)
+			assert_equal(rp3d.getSharedBoxShape(vmath.vector3(1, 2, 3)), box)
+			rp3d.destroyBoxShape(box)
+			w:destroyRigidBody(body)
+			status, error = pcall(box.isShared, box)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::CollisionShape was destroyed")
+			rp3d.destroyPhysicsWorld(w)
+		end)
+
+		test("shared convex mesh shapes", function()
+			local vertices = { [0] = -1, -1, -1, 1, -1, -1, 1, 1, -1, -1, 1, -1, -1, -1, 1, 1, -1, 1, 1, 1, 1, -1, 1, 1 }
+			local mesh = rp3d.createConvexHullPolyhedronMesh(vertices)
+			local shape = rp3d.getSharedConvexMeshShape(mesh)
+			local shape2 = rp3d.getSharedConvexMeshShape(mesh, vmath.vector3(1))
+			local scaled = rp3d.getSharedConvexMeshShape(mesh, vmath.vector3(2))
+			assert_equal(shape, shape2)
+			assert_not_equal(shape, scaled)
+			assert_true(shape:isShared())
+			rp3d.destroyConvexMeshShape(shape2)
+			rp3d.destroyConvexMeshShape(scaled)
+
+			--destroyed mesh is removed from cache. New mesh can have same address
+			rp3d.destroyPolyhedronMesh(mesh)
+			local mesh2 = rp3d.createConvexHullPolyhedronMesh(vertices)
+			local shape3 = rp3d.getSharedConvexMeshShape(mesh2)
+			assert_not_equal(shape, shape3)
+			assert_true(shape:isShared())
+			rp3d.destroyConvexMeshShape(shape)
+			rp3d.destroyConvexMeshShape(shape3)
+			rp3d.destroyPolyhedronMesh(mesh2)
+		end)
+
+		test("destroy shape before collider", function()
+			local w = rp3d.createPhysicsWorld()
+			local shape = rp3d.createBoxShape(vmath.vector3(2))
+			local body = w:createCollisionBody({ position = vmath.vector3(), quat = vmath.quat() })
+			local collider = body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			rp3d.destroyBoxShape(shape)
+			local status, error = pcall(rp3d.destroyBoxShape, shape)
+			assert_false(status)
+			UTILS.test_error(error, "shape was already destroyed")
+			body:removeCollider(collider)
+			status, error = pcall(shape.getVolume, shape)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::CollisionShape was destroyed")
+			rp3d.destroyPhysicsWorld(w)
+		end)
+
 		--crash if have some memory corrupted issues
 		test("test memory errors", function()
 			for i = 1, 1000 do
@@ -63,6 +63,141 @@ return function()
 			rp3d.destroyPhysicsWorld(w)
 		end)
 
+		test("Set/Get NbSubsteps()", function()
+			local w = rp3d.createPhysicsWorld()
+			assert_equal(1, w:getNbSubsteps())
+			UTILS.test_method_get_set(w, "NbSubsteps", {
+				values = { 1, 2, 4 }
+			})
+			local status, error = pcall(w.setNbSubsteps, w, 0)
+			assert_false(status)
+			UTILS.test_error(error, "nbSubsteps should be > 0")
+			rp3d.destroyPhysicsWorld(w)
+		end)
+
+		test("NbSubsteps stack", function()
+			local w = rp3d.createPhysicsWorld()
+			w:setGravity(vmath.vector3(0, -9.81, 0))
+			w:setNbSubsteps(4)
+			local groundShape = rp3d.createBoxShape(vmath.vector3(10, 0.5, 10))
+			local shape = rp3d.createBoxShape(vmath.vector3(0.5))
+			local ground = w:createRigidBody({ position = vmath.vector3(0, -0.5, 0), quat = vmath.quat() })
+			ground:setType(rp3d.BodyType.STATIC)
+			ground:addCollider(groundShape, { position = vmath.vector3(), quat = vmath.quat() })
+			local boxes = {}
+			for i = 1, 4 do
+				local body = w:createRigidBody({ position = vmath.vector3(0, i - 0.5, 0), quat = vmath.quat() })
+				body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+				boxes[i] = body
+			end
+			for _ = 1, 120 do w:update(1 / 60) end
+
+			local top = boxes[4]:getTransformPosition()
+			assert_true(math.abs(top.y - 3.5) < 0.05)
+			assert_true(math.abs(top.x) < 0.01)
+			assert_true(math.abs(top.z) < 0.01)
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(groundShape)
+			rp3d.destroyBoxShape(shape)
+		end)
+
+		test("Is/SetIs ArticulationSolverEnabled()", function()
+			local w = rp3d.createPhysicsWorld()
+			assert_false(w:isArticulationSolverEnabled())
+			UTILS.test_method_get_set(w, "ArticulationSolverEnabled",
+					{
+						getter_full = "isArticulationSolverEnabled",
+						setter_full = "setIsArticulationSolverEnabled",
+						values = { true, false, false, true }
+					})
+			rp3d.destroyPhysicsWorld(w)
+		end)
+
+		test("ArticulationSolver hinge chain stretch", function()
+			local shape = rp3d.createBoxShape(vmath.vector3(0.4, 0.1, 0.1))
+			local nbLinks = 20
+			local chainStretch = function(isArticulationSolverEnabled)
+				local w = rp3d.createPhysicsWorld()
+				w:setGravity(vmath.vector3(0, -9.81, 0))
+				w:setIsArticulationSolverEnabled(isArticulationSolverEnabled)
+				local ground = w:createRigidBody({ position = vmath.vector3(), quat = vmath.quat() })
+				ground:setType(rp3d.BodyType.STATIC)
+				local links = {}
+				local prev = ground
+				for i = 1, nbLinks do
+					local body = w:createRigidBody({ position = vmath.vector3(i, 0, 0), quat = vmath.quat() })
+					local collider = body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+					--heavy end mass
+					collider:setMaterialMassDensity(i == nbLinks and 50 or 1)
+					body:updateMassPropertiesFromColliders()
+					w:createJoint(rp3d.createHingeJointInfoWorldSpace(prev, body, vmath.vector3(i - 0.5, 0, 0), vmath.vector3(0, 0, 1)))
+					links[i] = body
+					prev = body
+				end
+				local maxStretch = 0
+				for _ = 1, 120 do
+					w:update(1 / 60)
+					local length = 0
+					local prevPosition = vmath.vector3()
+					for i = 1, nbLinks do
+						local position = links[i]:getTransformPosition()
+						length = length + vmath.length(position - prevPosition)
+						prevPosition = position
+					end
+					maxStretch = math.max(maxStretch, length - nbLinks)
+				end
+				rp3d.destroyPhysicsWorld(w)
+				return maxStretch
+			end
+
+			local iterativeStretch = chainStretch(false)
+			local articulationStretch = chainStretch(true)
+			assert_true(articulationStretch < iterativeStretch * 0.5)
+			rp3d.destroyBoxShape(shape)
+		end)
+
+		test("hinge chain with very large forces", function()
+			--used to fail the length() > MACHINE_EPSILON assertion of the hinge joint solver
+			local w = rp3d.createPhysicsWorld()
+			w:setGravity(vmath.vector3(0, -9.81, 0))
+			local shape = rp3d.createBoxShape(vmath.vector3(1, 0.5, 0.5))
+			local links = {}
+			for i = 1, 20 do
+				local body = w:createRigidBody({ position = vmath.vector3((i - 1) * 2.3, 20, 0), quat = vmath.quat() })
+				body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+				if i == 1 then body:setType(rp3d.BodyType.STATIC) end
+				links[i] = body
+			end
+			for i = 1, 19 do
+				local info = rp3d.createHingeJointInfoWorldSpace(links[i], links[i + 1],
+						links[i]:getTransformPosition() + vmath.vector3(1, 0, 0), vmath.vector3(0, 0, 1))
+				info.isCollisionEnabled = false
+				w:createJoint(info)
+			end
+			--deterministic Park-Miller random
+			local seed = 9
+			local random = function()
+				seed = (seed * 16807) % 2147483647
+				return seed % 200 - 100
+			end
+			local kick = 1000
+			for frame = 0, 599 do
+				if frame % 20 == 0 then
+					local body = links[2 + (random() + 100) % 19]
+					body:applyWorldForceAtCenterOfMass(vmath.vector3(random(), random(), random()) * kick)
+					body:applyLocalTorque(vmath.vector3(random(), random(), random()) * kick)
+				end
+				w:update(1 / 60)
+			end
+			for i = 1, 20 do
+				local position = links[i]:getTransformPosition()
+				assert_true(position.x == position.x and position.y == position.y and position.z == position.z)
+			end
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(shape)
+		end)
+
 		test("Set/Get Gravity()", function()
 			local w = rp3d.createPhysicsWorld()
 			UTILS.test_method_get_set(w, "Gravity",
@@ -214,6 +349,402 @@ return function()
 			rp3d.destroyPhysicsWorld(w)
 		end)
 
+		test("createBodyPool()", function()
+			local w = rp3d.createPhysicsWorld()
+			local shape = rp3d.createSphereShape(0.5)
+			local template = w:createRigidBody({ position = vmath.vector3(), quat = vmath.quat() })
+			template:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			template:setMass(2)
+			local pool = w:createBodyPool(template, 2)
+			assert_equal(pool:getNbBodies(), 2)
+			assert_equal(pool:getNbFreeBodies(), 2)
+			assert_equal(w:getNbRigidBodies(), 3)
+
+			local body = pool:acquire({ position = vmath.vector3(0, 10, 0), quat = vmath.quat() })
+			local body2 = pool:acquire({ position = vmath.vector3(0, 20, 0), quat = vmath.quat() })
+			assert_nil(pool:acquire({ position = vmath.vector3(), quat = vmath.quat() }))
+			assert_equal(pool:getNbFreeBodies(), 0)
+			assert_true(body:isActive())
+			assert_equal(body:getMass(), 2)
+			assert_equal(body:getNbColliders(), 1)
+			assert_equal_v3(body:getTransformPosition(), vmath.vector3(0, 10, 0))
+			w:update(1 / 60)
+			assert_true(body:getTransformPosition().y < 10)
+
+			local status, error = pcall(w.destroyRigidBody, w, body)
+			assert_false(status)
+			UTILS.test_error(error, "can't destroy body from BodyPool")
+
+			pool:release(body)
+			assert_false(body:isActive())
+			assert_equal(pool:getNbFreeBodies(), 1)
+			status, error = pcall(pool.release, pool, body)
+			assert_false(status)
+			UTILS.test_error(error, "body already released")
+			status, error = pcall(pool.release, pool, template)
+			assert_false(status)
+			UTILS.test_error(error, "body not from this pool")
+
+			--same body and lua table reused
+			assert_equal(pool:acquire({ position = vmath.vector3(0, 5, 0), quat = vmath.quat() }), body)
+			assert_equal_v3(body:getLinearVelocity(), vmath.vector3(0))
+
+			w:destroyBodyPool(pool)
+			assert_equal(w:getNbRigidBodies(), 1)
+			status, error = pcall(body2.isActive, body2)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::CollisionBody was destroyed")
+			status, error = pcall(pool.getNbBodies, pool)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::BodyPool was destroyed")
+
+			--pool destroyed with world
+			pool = w:createBodyPool(template, 1)
+			rp3d.destroyPhysicsWorld(w)
+			status, error = pcall(pool.getNbBodies, pool)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::BodyPool was destroyed")
+			rp3d.destroySphereShape(shape)
+		end)
+
+		test("createCharacterController()", function()
+			local w = rp3d.createPhysicsWorld()
+			local capsule = rp3d.createCapsuleShape(0.4, 1)
+			local box = rp3d.createBoxShape(vmath.vector3(10, 0.5, 10))
+			local ground = w:createRigidBody({ position = vmath.vector3(), quat = vmath.quat() })
+			ground:setType(rp3d.BodyType.STATIC)
+			local groundCollider = ground:addCollider(box, { position = vmath.vector3(), quat = vmath.quat() })
+
+			local controller = w:createCharacterController(capsule, { position = vmath.vector3(0, 3, 0), quat = vmath.quat() },
+					{ stepHeight = 0.25, skinWidth = 0.02 })
+			assert_equal(w:getNbRigidBodies(), 2)
+			assert_equal(controller:getBody():getType(), rp3d.BodyType.KINEMATIC)
+			assert_equal(controller:getStepHeight(), 0.25)
+			assert_true(math.abs(controller:getSkinWidth() - 0.02) < 0.0001)
+			assert_false(controller:isOnGround())
+			assert_nil(controller:getGroundCollider())
+
+			for _ = 1, 10 do controller:move(vmath.vector3(0, -0.5, 0)) end
+			assert_true(controller:isOnGround())
+			assert_equal(controller:getGroundCollider(), groundCollider)
+			assert_true(math.abs(controller:getPosition().y - 1.42) < 0.02)
+			assert_true(vmath.length(controller:getGroundNormal() - vmath.vector3(0, 1, 0)) < 0.001)
+			assert_true(math.abs(controller:getDisplacement().y) < 0.001)
+
+			controller:move(vmath.vector3(1, 0, 0))
+			assert_true(controller:isOnGround())
+			assert_true(math.abs(controller:getPosition().x - 1) < 0.001)
+
+			local buf = buffer.create(1, {
+				{ name = hash("displacement"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 },
+				{ name = hash("position"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 },
+			})
+			local displacement = buffer.get_stream(buf, hash("displacement"))
+			displacement[1] = 1
+			assert_equal(w:moveCharacterControllers({ controller }, buf), 1)
+			assert_true(math.abs(buffer.get_stream(buf, hash("position"))[1] - 2) < 0.001)
+			local status, error = pcall(w.moveCharacterControllers, w, { controller, controller }, buf)
+			assert_false(status)
+			UTILS.test_error(error, "buffer count:1 less than controllers:2")
+
+			status, error = pcall(w.createCharacterController, w, capsule, { position = vmath.vector3(), quat = vmath.quat() }, { skinWidth = 0 })
+			assert_false(status)
+			UTILS.test_error(error, "skinWidth should be > 0")
+			status, error = pcall(w.createCharacterController, w, capsule, { position = vmath.vector3(), quat = vmath.quat() }, { bad = 0 })
+			assert_false(status)
+			UTILS.test_error(error, "unknown key:bad")
+			status, error = pcall(controller.setMaxSlopeAngle, controller, -1)
+			assert_false(status)
+			UTILS.test_error(error, "maxSlopeAngle should be in [0, pi]")
+
+			local body = controller:getBody()
+			status, error = pcall(w.destroyRigidBody, w, body)
+			assert_false(status)
+			UTILS.test_error(error, "can't destroy body of CharacterController")
+
+			--ground destroyed under the character
+			assert_equal(controller:getGroundCollider(), groundCollider)
+			w:destroyRigidBody(ground)
+			assert_false(controller:isOnGround())
+			assert_nil(controller:getGroundCollider())
+			controller:move(vmath.vector3(0, -0.5, 0))
+			assert_false(controller:isOnGround())
+
+			w:destroyCharacterController(controller)
+			assert_equal(w:getNbRigidBodies(), 0)
+			status, error = pcall(body.getType, body)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::CollisionBody was destroyed")
+			status, error = pcall(controller.move, controller, vmath.vector3())
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::CharacterController was destroyed")
+
+			--controller destroyed with world
+			controller = w:createCharacterController(capsule, { position = vmath.vector3(0, 3, 0), quat = vmath.quat() })
+			rp3d.destroyPhysicsWorld(w)
+			status, error = pcall(controller.move, controller, vmath.vector3())
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::CharacterController was destroyed")
+			rp3d.destroyCapsuleShape(capsule)
+			rp3d.destroyBoxShape(box)
+		end)
+
+		test("CharacterController move()", function()
+			local w = rp3d.createPhysicsWorld()
+			local capsule = rp3d.createCapsuleShape(0.4, 1)
+			local groundShape = rp3d.createBoxShape(vmath.vector3(20, 0.5, 20))
+			local stepShape = rp3d.createBoxShape(vmath.vector3(1, 0.1, 1))
+			local slopeShape = rp3d.createBoxShape(vmath.vector3(3, 0.1, 1))
+			local sillShape = rp3d.createBoxShape(vmath.vector3(1, 0.125, 0.5))
+			local boxShape = rp3d.createBoxShape(vmath.vector3(0.5))
+			local addBody = function(shape, position, quat, type)
+				local body = w:createRigidBody({ position = position, quat = quat or vmath.quat() })
+				body:setType(type or rp3d.BodyType.STATIC)
+				body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+				return body
+			end
+			addBody(groundShape, vmath.vector3(0, -0.5, 0))
+			addBody(stepShape, vmath.vector3(3, 0.1, 0))
+			addBody(slopeShape, vmath.vector3(-5, 0, 0), vmath.quat_rotation_z(-math.pi / 3))
+			local box = addBody(boxShape, vmath.vector3(0, 0.5, 3), nil, rp3d.BodyType.DYNAMIC)
+			--sill that is too high to step on with a dynamic box on it behind the front face of the sill
+			addBody(sillShape, vmath.vector3(0, 0.125, -3.5))
+			local sillBox = addBody(boxShape, vmath.vector3(0, 0.75, -3.6), nil, rp3d.BodyType.DYNAMIC)
+
+			local controller = w:createCharacterController(capsule, { position = vmath.vector3(0, 0.92, 0), quat = vmath.quat() },
+					{ stepHeight = 0.3, pushForce = 100 })
+			local reset = function()
+				controller:setPosition(vmath.vector3(0, 0.92, 0))
+				controller:move(vmath.vector3(0, -0.1, 0))
+				assert_true(controller:isOnGround())
+				assert_true(math.abs(controller:getPosition().y - 0.91) < 0.001)
+			end
+
+			--step up
+			reset()
+			for _ = 1, 30 do controller:move(vmath.vector3(0.1, -0.01, 0)) end
+			assert_true(controller:isOnGround())
+			assert_true(controller:getPosition().x > 2.8)
+			assert_true(math.abs(controller:getPosition().y - 1.11) < 0.001)
+
+			--slope limit
+			reset()
+			for _ = 1, 40 do controller:move(vmath.vector3(-0.1, -0.01, 0)) end
+			assert_true(controller:isOnGround())
+			assert_true(math.abs(controller:getPosition().x + 4) < 0.01)
+			assert_true(math.abs(controller:getPosition().y - 0.91) < 0.001)
+			controller:setMaxSlopeAngle(math.pi * 0.4)
+			for _ = 1, 20 do controller:move(vmath.vector3(-0.1, -0.01, 0)) end
+			assert_true(controller:isOnGround())
+			assert_true(controller:getPosition().y > 1.4)
+			controller:setMaxSlopeAngle(math.pi / 4)
+
+			--the box behind the sill is hit only by the rejected step up and is not pushed
+			reset()
+			for _ = 1, 30 do controller:move(vmath.vector3(0, -0.01, -0.1)) end
+			w:update(1 / 60)
+			assert_true(math.abs(controller:getPosition().z + 2.62) < 0.01)
+			assert_true(math.abs(sillBox:getLinearVelocity().z) < 0.001)
+
+			--push dynamic body
+			controller:setPosition(vmath.vector3(0, 0.92, 1.5))
+			controller:move(vmath.vector3(0, -0.01, 1))
+			assert_true(math.abs(controller:getPosition().z - 2.09) < 0.001)
+			w:update(1 / 60)
+			assert_true(box:getLinearVelocity().z > 1)
+
+			--depenetration
+			controller:setPosition(vmath.vector3(0, 0.5, 0))
+			controller:move(vmath.vector3(0, 0, 0))
+			assert_true(controller:isOnGround())
+			assert_true(math.abs(controller:getPosition().y - 0.91) < 0.001)
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyCapsuleShape(capsule)
+			rp3d.destroyBoxShape(groundShape)
+			rp3d.destroyBoxShape(stepShape)
+			rp3d.destroyBoxShape(slopeShape)
+			rp3d.destroyBoxShape(sillShape)
+			rp3d.destroyBoxShape(boxShape)
+		end)
+
+		test("createRaycastVehicle()", function()
+			local w = rp3d.createPhysicsWorld()
+			local groundShape = rp3d.createBoxShape(vmath.vector3(500, 1, 500))
+			local chassisShape = rp3d.createBoxShape(vmath.vector3(1, 0.25, 2))
+			local ground = w:createRigidBody({ position = vmath.vector3(0, -1, 0), quat = vmath.quat() })
+			ground:setType(rp3d.BodyType.STATIC)
+			local groundCollider = ground:addCollider(groundShape, { position = vmath.vector3(), quat = vmath.quat() })
+			local chassis = w:createRigidBody({ position = vmath.vector3(0, 1.5, 0), quat = vmath.quat() })
+			local chassisCollider = chassis:addCollider(chassisShape, { position = vmath.vector3(), quat = vmath.quat() })
+			chassisCollider:setMaterialMassDensity(125)
+			chassis:updateMassPropertiesFromColliders()
+
+			local vehicle = w:createRaycastVehicle(chassis)
+			assert_equal(vehicle:getBody(), chassis)
+			for i = 0, 3 do
+				local idx = vehicle:addWheel({
+					connectionPoint = vmath.vector3(i % 2 == 1 and 0.9 or -0.9, -0.2, i < 2 and -1.4 or 1.4),
+					radius = 0.4, suspensionRestLength = 0.4, maxSuspensionTravel = 0.3, maxSuspensionForce = 20000
+				})
+				assert_equal(idx, i)
+			end
+			assert_equal(vehicle:getNbWheels(), 4)
+			assert_false(vehicle:isWheelInContact(0))
+			assert_nil(vehicle:getWheelGroundCollider(0))
+
+			for _ = 1, 180 do w:update(1 / 60) end
+			assert_true(vehicle:isWheelInContact(0))
+			assert_equal(vehicle:getWheelGroundCollider(3), groundCollider)
+			assert_true(vehicle:getSuspensionForce(0) > 0)
+			assert_true(vehicle:getSuspensionLength(0) < 0.4)
+			assert_true(math.abs(vehicle:getWheelTransform(0).position.y - 0.4) < 0.02)
+			assert_true(math.abs(chassis:getTransformPosition().z) < 0.01)
+
+			for i = 0, 3 do vehicle:setEngineForce(i, 1000) end
+			assert_equal(vehicle:getEngineForce(2), 1000)
+			for _ = 1, 120 do w:update(1 / 60) end
+			assert_true(chassis:getTransformPosition().z < -5)
+			assert_true(vehicle:getCurrentSpeed() > 5)
+			assert_true(vehicle:getWheelRotation(0) > 1)
+
+			for i = 0, 3 do
+				vehicle:setEngineForce(i, 0)
+				vehicle:setBrake(i, 3000)
+			end
+			for _ = 1, 240 do w:update(1 / 60) end
+			assert_true(vmath.length(chassis:getLinearVelocity()) < 0.05)
+
+			--ground destroyed under the resting vehicle
+			for _ = 1, 240 do w:update(1 / 60) end
+			assert_true(chassis:isSleeping())
+			w:destroyRigidBody(ground)
+			for i = 0, 3 do
+				assert_false(vehicle:isWheelInContact(i))
+				assert_nil(vehicle:getWheelGroundCollider(i))
+			end
+			assert_false(chassis:isSleeping())
+			local y = chassis:getTransformPosition().y
+			for _ = 1, 30 do w:update(1 / 60) end
+			assert_true(chassis:getTransformPosition().y < y - 0.5)
+
+			local status, error = pcall(vehicle.setSteering, vehicle, 4, 0.3)
+			assert_false(status)
+			UTILS.test_error(error, "bad idx:4. Size:4")
+			status, error = pcall(vehicle.setBrake, vehicle, 0, -1)
+			assert_false(status)
+			UTILS.test_error(error, "brake should be >= 0")
+			status, error = pcall(vehicle.addWheel, vehicle, { radius = 0 })
+			assert_false(status)
+			UTILS.test_error(error, "radius should be > 0")
+			status, error = pcall(w.createRaycastVehicle, w, chassis, { forward = vmath.vector3(0, 1, 0) })
+			assert_false(status)
+			UTILS.test_error(error, "forward and up should not be parallel")
+
+			w:destroyRaycastVehicle(vehicle)
+			status, error = pcall(vehicle.getNbWheels, vehicle)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::RaycastVehicle was destroyed")
+
+			--vehicle destroyed with body
+			vehicle = w:createRaycastVehicle(chassis)
+			w:destroyRigidBody(chassis)
+			status, error = pcall(vehicle.getNbWheels, vehicle)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::RaycastVehicle was destroyed")
+
+			--vehicle destroyed with world
+			chassis = w:createRigidBody({ position = vmath.vector3(0, 1.5, 0), quat = vmath.quat() })
+			vehicle = w:createRaycastVehicle(chassis)
+			rp3d.destroyPhysicsWorld(w)
+			status, error = pcall(vehicle.getNbWheels, vehicle)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::RaycastVehicle was destroyed")
+			rp3d.destroyBoxShape(groundShape)
+			rp3d.destroyBoxShape(chassisShape)
+		end)
+
+		test("createForceField()", function()
+			local w = rp3d.createPhysicsWorld()
+			local sphere = rp3d.createSphereShape(1)
+			local zoneShape = rp3d.createBoxShape(vmath.vector3(10, 5, 10))
+
+			--wind in aabb
+			local wind = w:createForceField(rp3d.createAABB(vmath.vector3(-5, -5, -5), vmath.vector3(5, 5, 5)),
+				{ type = rp3d.ForceFieldType.WIND, direction = vmath.vector3(2, 0, 0), strength = 10 })
+			assert_equal(wind:getType(), rp3d.ForceFieldType.WIND)
+			assert_true(wind:isEnabled())
+			assert_nil(wind:getCollider())
+			assert_equal(wind:getAABB():getMax(), vmath.vector3(5, 5, 5))
+			assert_equal(wind:getDirection(), vmath.vector3(1, 0, 0))
+			assert_equal(wind:getStrength(), 10)
+			local body = w:createRigidBody({ position = vmath.vector3(), quat = vmath.quat() })
+			body:addCollider(sphere, { position = vmath.vector3(), quat = vmath.quat() })
+			body:setMass(2)
+			body:enableGravity(false)
+			for _ = 1, 60 do w:update(1 / 60) end
+			assert_true(math.abs(body:getLinearVelocity().x - 5) < 0.01)
+			wind:setIsEnabled(false)
+			assert_false(wind:isEnabled())
+			w:update(1 / 60)
+			assert_true(math.abs(body:getLinearVelocity().x - 5) < 0.01)
+			w:destroyForceField(wind)
+			local status, error = pcall(wind.getType, wind)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::ForceField was destroyed")
+
+			--buoyancy in trigger collider
+			local water = w:createRigidBody({ position = vmath.vector3(100, -5, 0), quat = vmath.quat() })
+			water:setType(rp3d.BodyType.STATIC)
+			local waterCollider = water:addCollider(zoneShape, { position = vmath.vector3(), quat = vmath.quat() })
+			waterCollider:setIsTrigger(true)
+			local buoyancy = w:createForceField(waterCollider, { type = rp3d.ForceFieldType.BUOYANCY, linearDrag = 3 })
+			assert_equal(buoyancy:getType(), rp3d.ForceFieldType.BUOYANCY)
+			assert_equal(buoyancy:getCollider(), waterCollider)
+			assert_equal(buoyancy:getFluidDensity(), 1000)
+			assert_equal(buoyancy:getLinearDrag(), 3)
+			local float = w:createRigidBody({ position = vmath.vector3(100, 2, 0), quat = vmath.quat() })
+			local floatCollider = float:addCollider(sphere, { position = vmath.vector3(), quat = vmath.quat() })
+			floatCollider:setMaterialMassDensity(500)
+			float:updateMassPropertiesFromColliders()
+			for _ = 1, 900 do w:update(1 / 60) end
+			assert_true(math.abs(float:getTransformPosition().y) < 0.05)
+
+			--large drag stops the body and never reverses its velocity
+			buoyancy:setLinearDrag(1000)
+			buoyancy:setAngularDrag(1000)
+			local dragged = w:createRigidBody({ position = vmath.vector3(100, -5, 0), quat = vmath.quat() })
+			dragged:addCollider(sphere, { position = vmath.vector3(), quat = vmath.quat() })
+			dragged:enableGravity(false)
+			dragged:setLinearVelocity(vmath.vector3(5, 0, 0))
+			dragged:setAngularVelocity(vmath.vector3(0, 0, 5))
+			w:update(1 / 60)
+			assert_true(math.abs(dragged:getLinearVelocity().x) < 0.01)
+			assert_true(math.abs(dragged:getAngularVelocity().z) < 0.01)
+
+			status, error = pcall(w.createForceField, w, waterCollider, { type = "WATER" })
+			assert_false(status)
+			UTILS.test_error(error, "unknown ForceFieldType:WATER")
+			status, error = pcall(w.createForceField, w, waterCollider, { direction = vmath.vector3() })
+			assert_false(status)
+			UTILS.test_error(error, "direction should not be zero")
+			status, error = pcall(buoyancy.setFluidDensity, buoyancy, -1)
+			assert_false(status)
+			UTILS.test_error(error, "fluidDensity should be >= 0")
+
+			--volume collider destroyed with body
+			w:destroyRigidBody(water)
+			assert_nil(buoyancy:getCollider())
+
+			--field destroyed with world
+			rp3d.destroyPhysicsWorld(w)
+			status, error = pcall(buoyancy.getType, buoyancy)
+			assert_false(status)
+			UTILS.test_error(error, "rp3d::ForceField was destroyed")
+			rp3d.destroySphereShape(sphere)
+			rp3d.destroyBoxShape(zoneShape)
+		end)
+
 		test("getDebugRenderer()", function()
 			local w = rp3d.createPhysicsWorld()
 			assert_not_nil(w:getDebugRenderer())
@@ -350,6 +881,86 @@ return function()
 			rp3d.destroyBoxShape(shape)
 		end)
 
+		test("shapeCast()", function()
+			local w = rp3d.createPhysicsWorld()
+			local box = rp3d.createBoxShape(vmath.vector3(10, 1, 10))
+			local sphere = rp3d.createSphereShape(0.5)
+			local body = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			body:setType(rp3d.BodyType.STATIC)
+			local collider = body:addCollider(box, { position = vmath.vector3(), quat = vmath.quat() })
+			local from = { position = vmath.vector3(0, 5, 0), quat = vmath.quat() }
+
+			local info = w:shapeCast(sphere, from, vmath.vector3(0, -5, 0))
+			assert_not_nil(info)
+			assert_equal(info.body, body)
+			assert_equal(info.collider, collider)
+			assert_true(math.abs(info.hitFraction - 0.35) < 0.001)
+			assert_true(math.abs(info.worldPoint.y - 1) < 0.001)
+			assert_true(math.abs(info.worldNormal.y - 1) < 0.001)
+
+			assert_nil(w:shapeCast(sphere, from, vmath.vector3(0, 10, 0)))
+			assert_nil(w:shapeCast(sphere, from, vmath.vector3(0, 2, 0)))
+			assert_nil(w:shapeCast(sphere, from, vmath.vector3(0, -5, 0), 2))
+			assert_not_nil(w:shapeCast(sphere, from, vmath.vector3(0, -5, 0), 1))
+
+			--start inside collider
+			info = w:shapeCast(sphere, { position = vmath.vector3(0, 1.2, 0), quat = vmath.quat() }, vmath.vector3(5, 1.2, 0))
+			assert_equal(info.hitFraction, 0)
+
+			--large shapes passing close to the collider
+			local bigSphere = rp3d.createSphereShape(8)
+			local bigBox = rp3d.createBoxShape(vmath.vector3(6))
+			assert_nil(w:shapeCast(bigSphere, { position = vmath.vector3(-30, 0, 18.1), quat = vmath.quat() }, vmath.vector3(30, 0, 18.1)))
+			assert_nil(w:shapeCast(bigBox, { position = vmath.vector3(-30, 0, 16.1), quat = vmath.quat() }, vmath.vector3(30, 0, 16.1)))
+			assert_nil(w:shapeCast(bigBox, { position = vmath.vector3(-30, 7.1, 0), quat = vmath.quat() }, vmath.vector3(30, 7.1, 0)))
+
+			--large shapes touching the collider and moving apart or along its surface
+			for _, shape in ipairs({ bigSphere, bigBox }) do
+				local start = vmath.vector3(0.3, 20, 0.2)
+				info = w:shapeCast(shape, { position = start, quat = vmath.quat() }, vmath.vector3(0.3, 0, 0.2))
+				local rest = { position = vmath.lerp(info.hitFraction, start, vmath.vector3(0.3, 0, 0.2)), quat = vmath.quat() }
+				assert_nil(w:shapeCast(shape, rest, rest.position + vmath.vector3(0, 5, 0)))
+				assert_nil(w:shapeCast(shape, rest, rest.position + vmath.vector3(-7, 0, 3)))
+				assert_nil(w:shapeCast(shape, rest, rest.position + vmath.vector3(5, 0, -5)))
+				assert_equal(w:shapeCast(shape, rest, rest.position + vmath.vector3(0, -1, 0)).hitFraction, 0)
+			end
+			rp3d.destroySphereShape(bigSphere)
+			rp3d.destroyBoxShape(bigBox)
+
+			collider:setIsTrigger(true)
+			assert_nil(w:shapeCast(sphere, from, vmath.vector3(0, -5, 0)))
+			collider:setIsTrigger(false)
+
+			local buf = buffer.create(2, {
+				{ name = hash("from"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 },
+				{ name = hash("to"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 },
+				{ name = hash("fraction"), type = buffer.VALUE_TYPE_FLOAT32, count = 1 },
+				{ name = hash("normal"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 },
+			})
+			local from_stream = buffer.get_stream(buf, hash("from"))
+			local to_stream = buffer.get_stream(buf, hash("to"))
+			from_stream[2], to_stream[2] = 5, -5
+			from_stream[5], to_stream[5] = 5, 10
+			local colliders = {}
+			assert_equal(w:shapeCastBuffer(sphere, vmath.quat(), buf, colliders), 1)
+			local fraction_stream = buffer.get_stream(buf, hash("fraction"))
+			assert_true(math.abs(fraction_stream[1] - 0.35) < 0.001)
+			assert_equal(fraction_stream[2], -1)
+			assert_true(math.abs(buffer.get_stream(buf, hash("normal"))[2] - 1) < 0.001)
+			assert_equal(colliders[1], collider)
+			assert_equal(colliders[2], false)
+			assert_equal(w:shapeCastBuffer(sphere, vmath.quat(), buf, nil, 2), 0)
+
+			local status, error = pcall(w.shapeCastBuffer, w, sphere, vmath.quat(), buffer.create(2, { { name = hash("from"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 } }))
+			assert_false(status)
+			UTILS.test_error(error, "buffer can't get to")
+
+			w:destroyRigidBody(body)
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(box)
+			rp3d.destroySphereShape(sphere)
+		end)
+
 		test("testOverlap2Bodies()", function()
 			local w = rp3d.createPhysicsWorld()
 			local shape = rp3d.createBoxShape(vmath.vector3(2.5))
@@ -439,6 +1050,257 @@ return function()
 			rp3d.destroyBoxShape(shape_big)
 		end)
 
+		test("testOverlapShape()", function()
+			local w = rp3d.createPhysicsWorld()
+			local shape = rp3d.createBoxShape(vmath.vector3(0.5))
+			local sphere = rp3d.createSphereShape(1)
+
+			local body_1 = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local body_2 = w:createRigidBody({ position = vmath.vector3(2, 0, 0), quat = vmath.quat() })
+			local body_3 = w:createRigidBody({ position = vmath.vector3(4, 0, 0), quat = vmath.quat() })
+			local c1 = body_1:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c2 = body_2:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c3 = body_3:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			c3:setCollisionCategoryBits(2)
+
+			local result = w:testOverlapShape(sphere, { position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			assert_equal(#result, 1)
+			assert_equal(result[1], c1)
+
+			result = w:testOverlapShape(sphere, { position = vmath.vector3(3, 0, 0), quat = vmath.quat() })
+			assert_equal(#result, 2)
+			result = w:testOverlapShape(sphere, { position = vmath.vector3(3, 0, 0), quat = vmath.quat() }, 1)
+			assert_equal(#result, 1)
+			assert_equal(result[1], c2)
+			assert_equal(#w:testOverlapShape(sphere, { position = vmath.vector3(0, 5, 0), quat = vmath.quat() }), 0)
+
+			--reuse table
+			local reused = { c1, c2, c3 }
+			result = w:testOverlapShape(sphere, { position = vmath.vector3(4, 0, 0), quat = vmath.quat() }, nil, reused)
+			assert_equal(result, reused)
+			assert_equal(#reused, 1)
+			assert_equal(reused[1], c3)
+			assert_nil(reused[2])
+			assert_nil(reused[3])
+
+			--large shapes near the colliders but separated from them
+			local bigSphere = rp3d.createSphereShape(8)
+			local bigBox = rp3d.createBoxShape(vmath.vector3(6))
+			assert_equal(#w:testOverlapShape(bigSphere, { position = vmath.vector3(2, 8.55, 0), quat = vmath.quat() }), 0)
+			assert_equal(#w:testOverlapShape(bigSphere, { position = vmath.vector3(2, 8.52, 0), quat = vmath.quat() }), 0)
+			assert_equal(#w:testOverlapShape(bigBox, { position = vmath.vector3(2, 6.55, 0), quat = vmath.quat() }), 0)
+			assert_equal(#w:testOverlapShape(bigBox, { position = vmath.vector3(-6.55, 0, 0), quat = vmath.quat() }), 0)
+			result = w:testOverlapShape(bigSphere, { position = vmath.vector3(2, 8.45, 0), quat = vmath.quat() })
+			assert_equal(#result, 1)
+			assert_equal(result[1], c2)
+			result = w:testOverlapShape(bigBox, { position = vmath.vector3(-6.45, 0, 0), quat = vmath.quat() })
+			assert_equal(#result, 1)
+			assert_equal(result[1], c1)
+			--no skin distance, a tiny gap is not an overlap
+			assert_equal(#w:testOverlapShape(bigSphere, { position = vmath.vector3(2, 8.502, 0), quat = vmath.quat() }), 0)
+			assert_equal(#w:testOverlapShape(bigSphere, { position = vmath.vector3(2, 8.498, 0), quat = vmath.quat() }), 1)
+			assert_equal(#w:testOverlapShape(bigBox, { position = vmath.vector3(2, 6.502, 0), quat = vmath.quat() }), 0)
+			assert_equal(#w:testOverlapShape(bigBox, { position = vmath.vector3(2, 6.498, 0), quat = vmath.quat() }), 1)
+			assert_equal(#w:testOverlapShape(shape, { position = vmath.vector3(1.002, 0, 0), quat = vmath.quat() }), 0)
+			rp3d.destroySphereShape(bigSphere)
+			rp3d.destroyBoxShape(bigBox)
+
+			c2:setIsTrigger(true)
+			assert_equal(#w:testOverlapShape(sphere, { position = vmath.vector3(2, 0, 0), quat = vmath.quat() }), 0)
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(shape)
+			rp3d.destroySphereShape(sphere)
+		end)
+
+		test("testOverlapShapeBuffer()", function()
+			local w = rp3d.createPhysicsWorld()
+			local shape = rp3d.createBoxShape(vmath.vector3(0.5))
+			local sphere = rp3d.createSphereShape(1)
+
+			local body_1 = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local body_2 = w:createRigidBody({ position = vmath.vector3(2, 0, 0), quat = vmath.quat() })
+			local body_3 = w:createRigidBody({ position = vmath.vector3(4, 0, 0), quat = vmath.quat() })
+			local c1 = body_1:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c2 = body_2:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c3 = body_3:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			c3:setCollisionCategoryBits(2)
+
+			local buf = buffer.create(2, {
+				{ name = hash("collider"), type = buffer.VALUE_TYPE_UINT32, count = 1 },
+				{ name = hash("body"), type = buffer.VALUE_TYPE_UINT32, count = 1 },
+			})
+			local colliders = buffer.get_stream(buf, hash("collider"))
+			local bodies = buffer.get_stream(buf, hash("body"))
+
+			assert_equal(w:testOverlapShapeBuffer(sphere, { position = vmath.vector3(0, 0, 0), quat = vmath.quat() }, buf), 1)
+			assert_equal(colliders[1], c1:getEntityId())
+			assert_equal(bodies[1], body_1:getEntityId())
+			assert_equal(w:testOverlapShapeBuffer(sphere, { position = vmath.vector3(3, 0, 0), quat = vmath.quat() }, buf), 2)
+			assert_equal(w:testOverlapShapeBuffer(sphere, { position = vmath.vector3(3, 0, 0), quat = vmath.quat() }, buf, 1), 1)
+			assert_equal(colliders[1], c2:getEntityId())
+			assert_equal(bodies[1], body_2:getEntityId())
+			--the count is returned even if the buffer is too small or nil
+			local bigSphere = rp3d.createSphereShape(10)
+			assert_equal(w:testOverlapShapeBuffer(bigSphere, { position = vmath.vector3(2, 0, 0), quat = vmath.quat() }, buf), 3)
+			rp3d.destroySphereShape(bigSphere)
+			assert_equal(w:testOverlapShapeBuffer(sphere, { position = vmath.vector3(4, 0, 0), quat = vmath.quat() }, nil), 1)
+			assert_equal(w:testOverlapShapeBuffer(sphere, { position = vmath.vector3(0, 5, 0), quat = vmath.quat() }, buf), 0)
+
+			local status, error = pcall(w.testOverlapShapeBuffer, w, sphere, { position = vmath.vector3(), quat = vmath.quat() },
+					buffer.create(2, { { name = hash("collider"), type = buffer.VALUE_TYPE_FLOAT32, count = 1 } }))
+			assert_false(status)
+			UTILS.test_error(error, "collider should be uint32")
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(shape)
+			rp3d.destroySphereShape(sphere)
+		end)
+
+		test("queryAABB() querySphere()", function()
+			local w = rp3d.createPhysicsWorld()
+			local shape = rp3d.createBoxShape(vmath.vector3(0.5))
+
+			local body_1 = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local body_2 = w:createRigidBody({ position = vmath.vector3(2, 0, 0), quat = vmath.quat() })
+			local body_3 = w:createRigidBody({ position = vmath.vector3(4, 0, 0), quat = vmath.quat() })
+			local c1 = body_1:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c2 = body_2:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			local c3 = body_3:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			c3:setCollisionCategoryBits(2)
+			c3:setIsTrigger(true)
+
+			local buf = buffer.create(2, {
+				{ name = hash("collider"), type = buffer.VALUE_TYPE_UINT32, count = 1 },
+				{ name = hash("body"), type = buffer.VALUE_TYPE_UINT32, count = 1 },
+			})
+			local colliders = buffer.get_stream(buf, hash("collider"))
+			local bodies = buffer.get_stream(buf, hash("body"))
+
+			assert_equal(w:queryAABB(rp3d.createAABB(vmath.vector3(-1), vmath.vector3(0.1)), buf), 1)
+			assert_equal(colliders[1], c1:getEntityId())
+			assert_equal(bodies[1], body_1:getEntityId())
+
+			assert_equal(w:queryAABB(rp3d.createAABB(vmath.vector3(1.6, -1, -1), vmath.vector3(3.6, 1, 1)), buf), 2)
+			assert_equal(w:queryAABB(rp3d.createAABB(vmath.vector3(1.6, -1, -1), vmath.vector3(3.6, 1, 1)), buf, 1), 1)
+			assert_equal(colliders[1], c2:getEntityId())
+			assert_equal(w:queryAABB(rp3d.createAABB(vmath.vector3(-10), vmath.vector3(10)), nil), 3)
+			assert_equal(w:queryAABB(rp3d.createAABB(vmath.vector3(0, 5, 0), vmath.vector3(1, 6, 1)), buf), 0)
+
+			assert_equal(w:querySphere(vmath.vector3(1, 0, 0), 0.6, buf), 2)
+			assert_equal(w:querySphere(vmath.vector3(1, 0, 0), 0.4, buf), 0)
+			--sphere is near the corner of the aabb but not inside
+			assert_equal(w:querySphere(vmath.vector3(1.2, 1.2, 0), 0.5, buf), 0)
+			assert_equal(w:querySphere(vmath.vector3(1.2, 1.2, 0), 1, buf), 2)
+
+			local status, error = pcall(w.querySphere, w, vmath.vector3(), -1, buf)
+			assert_false(status)
+			UTILS.test_error(error, "radius must be >=0")
+			status, error = pcall(w.queryAABB, w, rp3d.createAABB(vmath.vector3(-1), vmath.vector3(1)),
+					buffer.create(2, { { name = hash("collider"), type = buffer.VALUE_TYPE_FLOAT32, count = 1 } }))
+			assert_false(status)
+			UTILS.test_error(error, "collider should be uint32")
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(shape)
+		end)
+
+		test("applyRadialImpulse()", function()
+			local w = rp3d.createPhysicsWorld()
+			w:setIsGravityEnabled(false)
+			local shape = rp3d.createBoxShape(vmath.vector3(0.5))
+
+			local body_1 = w:createRigidBody({ position = vmath.vector3(3, 0, 0), quat = vmath.quat() })
+			local body_2 = w:createRigidBody({ position = vmath.vector3(0, 0, 8), quat = vmath.quat() })
+			local body_far = w:createRigidBody({ position = vmath.vector3(20, 0, 0), quat = vmath.quat() })
+			local wall = w:createRigidBody({ position = vmath.vector3(-2, 0, 0), quat = vmath.quat() })
+			local body_hidden = w:createRigidBody({ position = vmath.vector3(-4, 0, 0), quat = vmath.quat() })
+			body_1:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			body_2:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			body_far:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			wall:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			body_hidden:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+			wall:setType(rp3d.BodyType.STATIC)
+			body_1:setMass(2)
+			body_1:setIsSleeping(true)
+
+			assert_equal(w:applyRadialImpulse(vmath.vector3(), 10, 10, rp3d.RadialImpulseFalloff.CONSTANT), 3)
+			assert_false(body_1:isSleeping())
+			assert_true(vmath.length(body_1:getLinearVelocity() - vmath.vector3(5, 0, 0)) < 0.001)
+			assert_true(vmath.length(body_2:getLinearVelocity() - vmath.vector3(0, 0, 10)) < 0.001)
+			assert_true(vmath.length(body_hidden:getLinearVelocity() - vmath.vector3(-10, 0, 0)) < 0.001)
+			assert_equal(body_far:getLinearVelocity(), vmath.vector3(0, 0, 0))
+
+			body_1:setLinearVelocity(vmath.vector3())
+			body_2:setLinearVelocity(vmath.vector3())
+			body_hidden:setLinearVelocity(vmath.vector3())
+			--linear falloff from the closest point of the body. Hidden body is behind the wall
+			assert_equal(w:applyRadialImpulse(vmath.vector3(), 10, 10, nil, nil, true), 2)
+			assert_true(vmath.length(body_1:getLinearVelocity() - vmath.vector3(3.75, 0, 0)) < 0.001)
+			assert_true(vmath.length(body_2:getLinearVelocity() - vmath.vector3(0, 0, 2.5)) < 0.001)
+			assert_equal(body_hidden:getLinearVelocity(), vmath.vector3(0, 0, 0))
+			assert_equal(w:applyRadialImpulse(vmath.vector3(), 10, 10, rp3d.RadialImpulseFalloff.QUADRATIC, 2), 0)
+
+			local status, error = pcall(w.applyRadialImpulse, w, vmath.vector3(), 0, 10)
+			assert_false(status)
+			UTILS.test_error(error, "radius must be >0")
+			status, error = pcall(w.applyRadialImpulse, w, vmath.vector3(), 1, 10, "CUBIC")
+			assert_false(status)
+			UTILS.test_error(error, "unknown RadialImpulseFalloff:CUBIC")
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(shape)
+		end)
+
+		test("computeDistance()", function()
+			local w = rp3d.createPhysicsWorld()
+			local box = rp3d.createBoxShape(vmath.vector3(0.5))
+			local sphere = rp3d.createSphereShape(1)
+
+			local body_1 = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local body_2 = w:createRigidBody({ position = vmath.vector3(5, 0, 0), quat = vmath.quat() })
+			local c1 = body_1:addCollider(box, { position = vmath.vector3(), quat = vmath.quat() })
+			local c2 = body_2:addCollider(sphere, { position = vmath.vector3(), quat = vmath.quat() })
+
+			local distance, point1, point2, normal = w:computeDistance(c1, c2)
+			assert_true(math.abs(distance - 3.5) < 0.001)
+			assert_true(vmath.length(point1 - vmath.vector3(0.5, 0, 0)) < 0.001)
+			assert_true(vmath.length(point2 - vmath.vector3(4, 0, 0)) < 0.001)
+			assert_true(vmath.length(normal - vmath.vector3(1, 0, 0)) < 0.001)
+
+			local buf = buffer.create(2, {
+				{ name = hash("distance"), type = buffer.VALUE_TYPE_FLOAT32, count = 1 },
+				{ name = hash("point1"), type = buffer.VALUE_TYPE_FLOAT32, count = 3 },
+			})
+			assert_equal(w:computeDistanceBuffer({ c1, c2, c2, c1 }, buf), 2)
+			local distances = buffer.get_stream(buf, hash("distance"))
+			assert_true(math.abs(distances[1] - 3.5) < 0.001)
+			assert_true(math.abs(distances[2] - 3.5) < 0.001)
+			assert_true(math.abs(buffer.get_stream(buf, hash("point1"))[4] - 4) < 0.001)
+
+			body_2:setTransform({ position = vmath.vector3(1, 0, 0), quat = vmath.quat() })
+			distance, point1, point2, normal = w:computeDistance(c1, c2)
+			assert_equal(distance, 0)
+			assert_nil(point1)
+			assert_nil(point2)
+			assert_nil(normal)
+
+			local w2 = rp3d.createPhysicsWorld()
+			local body_3 = w2:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local c3 = body_3:addCollider(box, { position = vmath.vector3(), quat = vmath.quat() })
+			local status, error = pcall(w.computeDistance, w, c1, c3)
+			assert_false(status)
+			UTILS.test_error(error, "collider from another world")
+			status, error = pcall(w.computeDistanceBuffer, w, { c3, c1 }, buf)
+			assert_false(status)
+			UTILS.test_error(error, "collider from another world")
+			rp3d.destroyPhysicsWorld(w2)
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(box)
+			rp3d.destroySphereShape(sphere)
+		end)
+
 		test("testCollision2Bodies()", function()
 			local w = rp3d.createPhysicsWorld()
 			local shape = rp3d.createBoxShape(vmath.vector3(2.5))
@@ -683,6 +1545,65 @@ return function()
 			rp3d.destroyPhysicsWorld(w)
 		end)
 
+		test("setEventListener() onSleepChange", function()
+			local w = rp3d.createPhysicsWorld()
+			w:setGravity(vmath.vector3(0, -9.81, 0))
+
+			local body_1 = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			local body_2 = w:createRigidBody({ position = vmath.vector3(0, 1.5, 0), quat = vmath.quat() })
+			body_1:setType(rp3d.BodyType.STATIC)
+			local shape_1 = rp3d.createBoxShape(vmath.vector3(10, 1, 10))
+			local shape_2 = rp3d.createBoxShape(vmath.vector3(0.5))
+			body_1:addCollider(shape_1, { position = vmath.vector3(), quat = vmath.quat() })
+			body_2:addCollider(shape_2, { position = vmath.vector3(), quat = vmath.quat() })
+
+			local sleeping_t, awake_t
+			w:setEventListener({
+				onSleepChange = function(sleeping, awake)
+					sleeping_t = sleeping
+					awake_t = awake
+				end
+			})
+			for _ = 1, 600 do
+				w:update(1 / 60)
+				if sleeping_t then break end
+			end
+			assert_true(body_2:isSleeping())
+			assert_not_nil(sleeping_t)
+			assert_equal(#awake_t, 0)
+			local found = false
+			for _, body in ipairs(sleeping_t) do
+				assert_true(body:isSleeping())
+				if body == body_2 then found = true end
+			end
+			assert_true(found)
+
+			sleeping_t, awake_t = nil, nil
+			w:update(1 / 60)
+			assert_nil(sleeping_t)
+
+			body_2:setIsSleeping(false)
+			w:update(1 / 60)
+			assert_not_nil(awake_t)
+			assert_equal(#sleeping_t, 0)
+			assert_equal(awake_t[1], body_2)
+
+			--fall asleep and woken up again before the step
+			sleeping_t, awake_t = nil, nil
+			body_2:setIsSleeping(true)
+			body_2:setIsSleeping(false)
+			w:update(1 / 60)
+			assert_nil(sleeping_t)
+
+			local status, error = pcall(w.setEventListener, w, { onSleepChange = 1 })
+			assert_false(status)
+			UTILS.test_error(error, "onSleepChange must be function")
+
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(shape_1)
+			rp3d.destroyBoxShape(shape_2)
+		end)
+
 		test("setEventListener() Bad Script Instance", function()
 			local w = rp3d.createPhysicsWorld()
 			local go_url = factory.create("/tests#test_go_instance")
@@ -727,6 +1648,52 @@ return function()
 			rp3d.destroyPhysicsWorld(w)
 		end)
 
+		test("setEventListener() onJointBreak", function()
+			local w = rp3d.createPhysicsWorld()
+			w:setGravity(vmath.vector3(0, -9.81, 0))
+			local shape = rp3d.createBoxShape(vmath.vector3(0.4))
+
+			local ground = w:createRigidBody({ position = vmath.vector3(0, 0, 0), quat = vmath.quat() })
+			ground:setType(rp3d.BodyType.STATIC)
+			local body = w:createRigidBody({ position = vmath.vector3(0, -1, 0), quat = vmath.quat() })
+			body:addCollider(shape, { position = vmath.vector3(), quat = vmath.quat() })
+
+			local info = rp3d.createBallAndSocketJointInfoWorldSpace(ground, body, vmath.vector3(0, -0.5, 0))
+			info.breakForce = 1000
+			local joint = w:createJoint(info)
+			assert_equal(joint:getBreakForce(), 1000)
+
+			local broken_t
+			w:setEventListener({
+				onJointBreak = function(joints)
+					broken_t = joints
+				end
+			})
+			for _ = 1, 10 do w:update(1 / 60) end
+			assert_nil(broken_t)
+			assert_false(joint:isBroken())
+
+			joint:setBreakForce(1)
+			w:update(1 / 60)
+			assert_not_nil(broken_t)
+			assert_equal(#broken_t, 1)
+			assert_equal(broken_t[1], joint)
+			assert_true(joint:isBroken())
+
+			--broken joint is disabled and not reported again
+			broken_t = nil
+			for _ = 1, 10 do w:update(1 / 60) end
+			assert_nil(broken_t)
+			assert_true(body:getLinearVelocity().y < -1)
+
+			local status, error = pcall(w.setEventListener, w, { onJointBreak = 1 })
+			assert_false(status)
+			UTILS.test_error(error, "onJointBreak must be function")
+			w:destroyJoint(joint)
+			rp3d.destroyPhysicsWorld(w)
+			rp3d.destroyBoxShape(shape)
+		end)
+
 		test("getWorldAAB()", function()
 			local shape = rp3d.createBoxShape(vmath.vector3(1))
 			local w = rp3d.createPhysicsWorld()
@@ -742,5 +1709,78 @@ return function()
 			rp3d.destroyBoxShape(shape)
 
 		end)
+
+		test("createJointChain()", function()
+			local w = rp3d.createPhysicsWorld()
+			local bodies = {}
+			for i = 1, 5 do
+				bodies[i] = w:createRigidBody({ position = vmath.vector3(i * 2, 0, 0), quat = vmath.quat() })
+			end
+			local info = rp3d.createBallAndSocketJointInfoWorldSpace(bodies[1], bodies[2], vmath.vector3())
+
+			local joints = w:createJointChain(bodies, info)
+			assert_equal(4, #joints)
+			for i = 1, #joints do
+				assert_equal(rp3d.JointType.BALLSOCKETJOINT, joints[i]:getType())
+				assert_equal(bodies[i], joints[i]:getBody1())
+				assert_equal(bodies[i + 1], joints[i]:getBody2())
+			end
+
+			local ids = w:createJointChain(bodies, info, 1, true)
+			assert_equal(4, #ids)
+			for i = 1, #ids do assert_type(ids[i], "number") end
+			assert_not_equal(joints[1]:getEntityId(), ids[1])
+			for i = 1, #ids do
+				local joint = w:getJoint(ids[i])
+				assert_equal(ids[i], joint:getEntityId())
+				assert_equal(bodies[i], joint:getBody1())
+				w:destroyJoint(joint)
+				assert_nil(w:getJoint(ids[i]))
+			end
+			assert_equal(joints[1], w:getJoint(joints[1]:getEntityId()))
+			assert_nil(w:getJoint(-1))
+			assert_nil(w:getJoint(0.5))
+
+			for i = 1, #joints do w:destroyJoint(joints[i]) end
+
+			local status, error = pcall(w.createJointChain, w, { bodies[1] }, info)
+			assert_false(status)
+			UTILS.test_error(error, "bodies should contain at least 2 bodies")
+			local collisionBody = w:createCollisionBody({ position = vmath.vector3(), quat = vmath.quat() })
+			status, error = pcall(w.createJointChain, w, { bodies[1], collisionBody }, info)
+			assert_false(status)
+			UTILS.test_error(error, "need RigidBody.Get CollisionBody.")
+			status, error = pcall(w.createJointChain, w, { bodies[1], bodies[2], bodies[1] }, info)
+			assert_false(status)
+			UTILS.test_error(error, "bodies should not contain the same body twice")
+
+			rp3d.destroyPhysicsWorld(w)
+		end)
+
+		test("createJointGrid()", function()
+			local w = rp3d.createPhysicsWorld()
+			local bodies = {}
+			for row = 0, 2 do
+				for column = 0, 3 do
+					table.insert(bodies, w:createRigidBody({ position = vmath.vector3(column, 0, row), quat = vmath.quat() }))
+				end
+			end
+			local info = rp3d.createHingeJointInfoWorldSpace(bodies[1], bodies[2], vmath.vector3(), vmath.vector3(0, 1, 0))
+
+			local joints = w:createJointGrid(bodies, 4, info, 0.5)
+			assert_equal(2 * 4 + 3 * 3, #joints)
+			assert_equal(bodies[1], joints[1]:getBody1())
+			assert_equal(bodies[2], joints[1]:getBody2())
+			assert_equal(rp3d.JointType.HINGEJOINT, joints[1]:getType())
+
+			local status, error = pcall(w.createJointGrid, w, bodies, 5, info)
+			assert_false(status)
+			UTILS.test_error(error, "number of bodies should be a multiple of nbColumns")
+			status, error = pcall(w.createJointGrid, w, bodies, 0, info)
+			assert_false(status)
+			UTILS.test_error(error, "nbColumns should be > 0")
+
+			rp3d.destroyPhysicsWorld(w)
+		end)
 	end)
 end
@@ -34,6 +34,10 @@ return function()
                 defaultVelocitySolverNbIterations = 5,
                 --Number of iterations when solving the position constraints of the Sequential Impulse technique
                 defaultPositionSolverNbIterations = 4,
+                --Number of substeps of each world update
+                defaultNbSubsteps = 3,
+                --True if the joints connected in a tree are solved by the articulation solver
+                isArticulationSolverEnabled = true,
                 --Time (in seconds) that a body must stay still to be considered sleeping
                 defaultTimeBeforeSleep = 1.5,
                 --A body with a linear velocity smaller than the sleep linear velocity (in m/s) might enter sleeping mode.
@@ -50,6 +54,8 @@ return function()
             assert_equal_v3(vmath.vector3(1, 2, 3),w:getGravity())
             assert_equal(5,w:getNbIterationsVelocitySolver())
             assert_equal(4,w:getNbIterationsPositionSolver())
+            assert_equal(3,w:getNbSubsteps())
+            assert_equal(true,w:isArticulationSolverEnabled())
             assert_equal(false,w:isSleepingEnabled())
             assert_equal(1.5,w:getTimeBeforeSleep())
             assert_equal_float(0.05,w:getSleepLinearVelocity())